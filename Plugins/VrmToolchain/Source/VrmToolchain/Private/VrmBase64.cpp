@@ -0,0 +1,235 @@
+#include "VrmToolchain/VrmBase64.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#endif
+
+namespace VrmBase64
+{
+	static constexpr uint8 InvalidSextet = 0xFF;
+
+	/** Sextet value of every character; InvalidSextet outside the alphabet */
+	struct FDecodeTable
+	{
+		uint8 Values[256];
+
+		FDecodeTable()
+		{
+			FMemory::Memset(Values, InvalidSextet, sizeof(Values));
+			for (int32 i = 0; i < 26; ++i)
+			{
+				Values['A' + i] = static_cast<uint8>(i);
+				Values['a' + i] = static_cast<uint8>(26 + i);
+			}
+			for (int32 i = 0; i < 10; ++i)
+			{
+				Values['0' + i] = static_cast<uint8>(52 + i);
+			}
+			Values['+'] = 62;
+			Values['/'] = 63;
+		}
+	};
+
+	static const FDecodeTable& GetDecodeTable()
+	{
+		static const FDecodeTable Table;
+		return Table;
+	}
+
+	/** Characters that carry data, i.e. without the trailing '=' padding */
+	static int64 GetDataLength(FAnsiStringView Encoded)
+	{
+		int64 Length = Encoded.Len();
+		if (Length % 4 == 0)
+		{
+			for (int32 Pad = 0; Pad < 2 && Length > 0 && Encoded[Length - 1] == '='; ++Pad)
+			{
+				--Length;
+			}
+		}
+		return Length;
+	}
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	/** Maps 16 characters to sextets; false if any is outside the alphabet */
+	static bool ClassifyNeon(uint8x16_t Chars, uint8x16_t& OutSextets)
+	{
+		const uint8x16_t Upper = vandq_u8(vcgeq_u8(Chars, vdupq_n_u8('A')), vcleq_u8(Chars, vdupq_n_u8('Z')));
+		const uint8x16_t Lower = vandq_u8(vcgeq_u8(Chars, vdupq_n_u8('a')), vcleq_u8(Chars, vdupq_n_u8('z')));
+		const uint8x16_t Digit = vandq_u8(vcgeq_u8(Chars, vdupq_n_u8('0')), vcleq_u8(Chars, vdupq_n_u8('9')));
+		const uint8x16_t Plus = vceqq_u8(Chars, vdupq_n_u8('+'));
+		const uint8x16_t Slash = vceqq_u8(Chars, vdupq_n_u8('/'));
+
+		const uint8x16_t Valid = vorrq_u8(vorrq_u8(Upper, Lower), vorrq_u8(vorrq_u8(Digit, Plus), Slash));
+		if (vminvq_u8(Valid) == 0)
+		{
+			return false;
+		}
+
+		// Offsets wrap modulo 256: 'A' - 65, 'a' - 71, '0' + 4, '+' + 19, '/' + 16
+		uint8x16_t Offset = vandq_u8(Upper, vdupq_n_u8(static_cast<uint8>(-65)));
+		Offset = vorrq_u8(Offset, vandq_u8(Lower, vdupq_n_u8(static_cast<uint8>(-71))));
+		Offset = vorrq_u8(Offset, vandq_u8(Digit, vdupq_n_u8(4)));
+		Offset = vorrq_u8(Offset, vandq_u8(Plus, vdupq_n_u8(19)));
+		Offset = vorrq_u8(Offset, vandq_u8(Slash, vdupq_n_u8(16)));
+		OutSextets = vaddq_u8(Chars, Offset);
+		return true;
+	}
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+	/** Maps 16 characters to sextets; false if any is outside the alphabet (bytes >= 0x80 compare negative and fail every range) */
+	static bool ClassifySse(__m128i Chars, __m128i& OutSextets)
+	{
+		auto InRange = [Chars](char Lo, char Hi)
+		{
+			return _mm_and_si128(_mm_cmpgt_epi8(Chars, _mm_set1_epi8(Lo - 1)), _mm_cmplt_epi8(Chars, _mm_set1_epi8(Hi + 1)));
+		};
+
+		const __m128i Upper = InRange('A', 'Z');
+		const __m128i Lower = InRange('a', 'z');
+		const __m128i Digit = InRange('0', '9');
+		const __m128i Plus = _mm_cmpeq_epi8(Chars, _mm_set1_epi8('+'));
+		const __m128i Slash = _mm_cmpeq_epi8(Chars, _mm_set1_epi8('/'));
+
+		const __m128i Valid = _mm_or_si128(_mm_or_si128(Upper, Lower), _mm_or_si128(_mm_or_si128(Digit, Plus), Slash));
+		if (_mm_movemask_epi8(Valid) != 0xFFFF)
+		{
+			return false;
+		}
+
+		// Offsets wrap modulo 256: 'A' - 65, 'a' - 71, '0' + 4, '+' + 19, '/' + 16
+		__m128i Offset = _mm_and_si128(Upper, _mm_set1_epi8(-65));
+		Offset = _mm_or_si128(Offset, _mm_and_si128(Lower, _mm_set1_epi8(-71)));
+		Offset = _mm_or_si128(Offset, _mm_and_si128(Digit, _mm_set1_epi8(4)));
+		Offset = _mm_or_si128(Offset, _mm_and_si128(Plus, _mm_set1_epi8(19)));
+		Offset = _mm_or_si128(Offset, _mm_and_si128(Slash, _mm_set1_epi8(16)));
+		OutSextets = _mm_add_epi8(Chars, Offset);
+		return true;
+	}
+#endif
+
+	int64 GetDecodedSize(FAnsiStringView Encoded)
+	{
+		const int64 DataLength = GetDataLength(Encoded);
+		if (DataLength % 4 == 1)
+		{
+			return INDEX_NONE;
+		}
+		return DataLength / 4 * 3 + FMath::Max<int64>(DataLength % 4 - 1, 0);
+	}
+
+	bool Decode(FAnsiStringView Encoded, TArray<uint8>& OutBytes)
+	{
+		OutBytes.Reset();
+
+		const int64 DecodedSize = GetDecodedSize(Encoded);
+		if (DecodedSize < 0 || DecodedSize > MAX_int32)
+		{
+			return false;
+		}
+
+		OutBytes.SetNumUninitialized(static_cast<int32>(DecodedSize));
+		const uint8* Src = reinterpret_cast<const uint8*>(Encoded.GetData());
+		uint8* Dst = OutBytes.GetData();
+		const int64 DataLength = GetDataLength(Encoded);
+		int64 Pos = 0;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+		// 64 characters at a time: the structured load splits them into the 1st..4th character of each quad
+		for (; Pos + 64 <= DataLength; Pos += 64)
+		{
+			const uint8x16x4_t Chars = vld4q_u8(Src + Pos);
+			uint8x16_t A;
+			uint8x16_t B;
+			uint8x16_t C;
+			uint8x16_t D;
+			if (!ClassifyNeon(Chars.val[0], A) || !ClassifyNeon(Chars.val[1], B) || !ClassifyNeon(Chars.val[2], C) || !ClassifyNeon(Chars.val[3], D))
+			{
+				break;
+			}
+
+			uint8x16x3_t Bytes;
+			Bytes.val[0] = vorrq_u8(vshlq_n_u8(A, 2), vshrq_n_u8(B, 4));
+			Bytes.val[1] = vorrq_u8(vshlq_n_u8(B, 4), vshrq_n_u8(C, 2));
+			Bytes.val[2] = vorrq_u8(vshlq_n_u8(C, 6), D);
+			vst3q_u8(Dst + Pos / 4 * 3, Bytes);
+		}
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+		// 16 characters at a time: each 32-bit lane holds one quad, packed into 24 bits
+		const __m128i ByteMask = _mm_set1_epi32(0xFF);
+		for (; Pos + 16 <= DataLength; Pos += 16)
+		{
+			__m128i Sextets;
+			if (!ClassifySse(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + Pos)), Sextets))
+			{
+				break;
+			}
+
+			const __m128i A = _mm_and_si128(Sextets, ByteMask);
+			const __m128i B = _mm_and_si128(_mm_srli_epi32(Sextets, 8), ByteMask);
+			const __m128i C = _mm_and_si128(_mm_srli_epi32(Sextets, 16), ByteMask);
+			const __m128i D = _mm_srli_epi32(Sextets, 24);
+			const __m128i Packed = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 18), _mm_slli_epi32(B, 12)), _mm_or_si128(_mm_slli_epi32(C, 6), D));
+
+			alignas(16) uint32 Lanes[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(Lanes), Packed);
+
+			uint8* Out = Dst + Pos / 4 * 3;
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				Out[Lane * 3 + 0] = static_cast<uint8>(Lanes[Lane] >> 16);
+				Out[Lane * 3 + 1] = static_cast<uint8>(Lanes[Lane] >> 8);
+				Out[Lane * 3 + 2] = static_cast<uint8>(Lanes[Lane]);
+			}
+		}
+#endif
+
+		// Remaining quads (and any run the vector loop stopped on, which then fails here)
+		const uint8* Table = GetDecodeTable().Values;
+		for (; Pos + 4 <= DataLength; Pos += 4)
+		{
+			const uint32 A = Table[Src[Pos]];
+			const uint32 B = Table[Src[Pos + 1]];
+			const uint32 C = Table[Src[Pos + 2]];
+			const uint32 D = Table[Src[Pos + 3]];
+			if ((A | B | C | D) > 63)
+			{
+				OutBytes.Reset();
+				return false;
+			}
+
+			const uint32 Packed = (A << 18) | (B << 12) | (C << 6) | D;
+			uint8* Out = Dst + Pos / 4 * 3;
+			Out[0] = static_cast<uint8>(Packed >> 16);
+			Out[1] = static_cast<uint8>(Packed >> 8);
+			Out[2] = static_cast<uint8>(Packed);
+		}
+
+		// Final 2 or 3 characters carry 1 or 2 bytes
+		const int64 Remaining = DataLength - Pos;
+		if (Remaining > 0)
+		{
+			uint32 Packed = 0;
+			for (int64 i = 0; i < Remaining; ++i)
+			{
+				const uint32 Sextet = Table[Src[Pos + i]];
+				if (Sextet == InvalidSextet)
+				{
+					OutBytes.Reset();
+					return false;
+				}
+				Packed |= Sextet << (18 - 6 * i);
+			}
+
+			uint8* Out = Dst + Pos / 4 * 3;
+			Out[0] = static_cast<uint8>(Packed >> 16);
+			if (Remaining == 3)
+			{
+				Out[1] = static_cast<uint8>(Packed >> 8);
+			}
+		}
+
+		return true;
+	}
+}
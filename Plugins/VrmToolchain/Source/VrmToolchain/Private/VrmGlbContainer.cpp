@@ -0,0 +1,131 @@
+#include "VrmToolchain/VrmGlbContainer.h"
+
+bool FVrmGlbContainer::ValidateHeader(const uint8* HeaderBytes, int64 DataSize, uint32& OutLength, FString& OutError)
+{
+	if (!HeaderBytes || DataSize < HeaderSize)
+	{
+		OutError = TEXT("Invalid GLB data: insufficient size for header");
+		return false;
+	}
+
+	uint32 Header[3];
+	FMemory::Memcpy(Header, HeaderBytes, sizeof(Header));
+
+	if (Header[0] != Magic)
+	{
+		OutError = TEXT("Invalid GLB file: incorrect magic number");
+		return false;
+	}
+
+	if (Header[1] != Version)
+	{
+		OutError = FString::Printf(TEXT("Unsupported GLB version: %u (expected 2)"), Header[1]);
+		return false;
+	}
+
+	if (Header[2] > DataSize)
+	{
+		OutError = FString::Printf(TEXT("Invalid GLB file: header length (%u) exceeds data size (%lld)"), Header[2], DataSize);
+		return false;
+	}
+
+	OutLength = Header[2];
+	return true;
+}
+
+void FVrmGlbContainer::Reset()
+{
+	Bytes = TArrayView<const uint8>();
+	Chunks.Reset();
+	Length = 0;
+	JsonChunkIndex = INDEX_NONE;
+	BinChunkIndex = INDEX_NONE;
+}
+
+bool FVrmGlbContainer::Parse(TArrayView<const uint8> InBytes, FString& OutError)
+{
+	Reset();
+
+	const uint8* Data = InBytes.GetData();
+	uint32 DeclaredLength = 0;
+	if (!ValidateHeader(Data, InBytes.Num(), DeclaredLength, OutError))
+	{
+		return false;
+	}
+
+	// Walk the chunk table once, recording every chunk (including unknown types)
+	int64 Offset = HeaderSize;
+	while (Offset + ChunkHeaderSize <= DeclaredLength)
+	{
+		if (Offset % 4 != 0)
+		{
+			OutError = FString::Printf(TEXT("Invalid GLB chunk alignment at offset %lld"), Offset);
+			Reset();
+			return false;
+		}
+
+		uint32 ChunkHeader[2];
+		FMemory::Memcpy(ChunkHeader, Data + Offset, sizeof(ChunkHeader));
+		Offset += ChunkHeaderSize;
+
+		const uint32 ChunkLength = ChunkHeader[0];
+		if (ChunkLength > DeclaredLength - Offset)
+		{
+			OutError = FString::Printf(TEXT("Invalid GLB chunk: length (%u) exceeds remaining file size"), ChunkLength);
+			Reset();
+			return false;
+		}
+
+		FVrmGlbChunk& Chunk = Chunks.AddDefaulted_GetRef();
+		Chunk.Type = ChunkHeader[1];
+		Chunk.Offset = Offset;
+		Chunk.Length = ChunkLength;
+
+		if (Chunk.Type == EVrmGlbChunkType::Json && JsonChunkIndex == INDEX_NONE)
+		{
+			JsonChunkIndex = Chunks.Num() - 1;
+		}
+		else if (Chunk.Type == EVrmGlbChunkType::Bin && BinChunkIndex == INDEX_NONE)
+		{
+			BinChunkIndex = Chunks.Num() - 1;
+		}
+
+		Offset += ChunkLength;
+	}
+
+	if (JsonChunkIndex == INDEX_NONE)
+	{
+		OutError = TEXT("GLB file does not contain a JSON chunk");
+		Reset();
+		return false;
+	}
+
+	Bytes = InBytes;
+	Length = DeclaredLength;
+	return true;
+}
+
+int32 FVrmGlbContainer::FindChunk(uint32 Type) const
+{
+	if (Type == EVrmGlbChunkType::Json)
+	{
+		return JsonChunkIndex;
+	}
+	if (Type == EVrmGlbChunkType::Bin)
+	{
+		return BinChunkIndex;
+	}
+	return Chunks.IndexOfByPredicate([Type](const FVrmGlbChunk& Chunk) { return Chunk.Type == Type; });
+}
+
+TArrayView<const uint8> FVrmGlbContainer::GetChunkData(int32 ChunkIndex) const
+{
+	if (!Chunks.IsValidIndex(ChunkIndex))
+	{
+		return TArrayView<const uint8>();
+	}
+
+	// Offsets and lengths were bounds-checked against the bytes in Parse
+	const FVrmGlbChunk& Chunk = Chunks[ChunkIndex];
+	return TArrayView<const uint8>(Bytes.GetData() + Chunk.Offset, static_cast<int32>(Chunk.Length));
+}
@@ -0,0 +1,391 @@
+#include "VrmToolchain/VrmGlbDocument.h"
+#include "VrmToolchain/VrmBase64.h"
+#include "VrmToolchain/VrmJsonReader.h"
+#include "VrmToolchain.h"
+#include "Misc/Base64.h"
+#include "Misc/Paths.h"
+#include "Hash/Blake3.h"
+
+namespace
+{
+	/** A .gltf file is JSON text: first non-whitespace byte (after an optional UTF-8 BOM) is '{' */
+	bool IsGltfJson(TArrayView<const uint8> Bytes)
+	{
+		int32 Pos = (Bytes.Num() >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF) ? 3 : 0;
+		while (Pos < Bytes.Num() && (Bytes[Pos] == ' ' || Bytes[Pos] == '\t' || Bytes[Pos] == '\r' || Bytes[Pos] == '\n'))
+		{
+			++Pos;
+		}
+		return Pos < Bytes.Num() && Bytes[Pos] == '{';
+	}
+
+	/** Decodes "data:[<mediatype>];base64,<payload>" */
+	bool DecodeDataUri(FAnsiStringView Uri, TArray<uint8>& OutBytes, FString& OutError)
+	{
+		int32 Comma = INDEX_NONE;
+		if (!Uri.FindChar(',', Comma) || !Uri.Left(Comma).EndsWith(";base64"))
+		{
+			OutError = TEXT("only base64 data: URIs are supported");
+			return false;
+		}
+
+		if (!VrmBase64::Decode(Uri.RightChop(Comma + 1), OutBytes))
+		{
+			OutError = TEXT("invalid base64 payload");
+			return false;
+		}
+		return true;
+	}
+
+	/** Decodes %XX escapes of a relative URI reference into a file path */
+	FString DecodeUriPath(FAnsiStringView Uri)
+	{
+		auto HexValue = [](ANSICHAR C) -> int32
+		{
+			return (C >= '0' && C <= '9') ? C - '0' : (C >= 'a' && C <= 'f') ? C - 'a' + 10 : (C >= 'A' && C <= 'F') ? C - 'A' + 10 : INDEX_NONE;
+		};
+
+		TArray<ANSICHAR> Utf8;
+		Utf8.Reserve(Uri.Len() + 1);
+		for (int32 i = 0; i < Uri.Len(); ++i)
+		{
+			if (Uri[i] == '%' && i + 2 < Uri.Len() && HexValue(Uri[i + 1]) != INDEX_NONE && HexValue(Uri[i + 2]) != INDEX_NONE)
+			{
+				Utf8.Add(static_cast<ANSICHAR>(HexValue(Uri[i + 1]) * 16 + HexValue(Uri[i + 2])));
+				i += 2;
+			}
+			else
+			{
+				Utf8.Add(Uri[i]);
+			}
+		}
+		Utf8.Add('\0');
+		return FString(UTF8_TO_TCHAR(Utf8.GetData()));
+	}
+}
+
+TSharedPtr<FVrmGlbDocument> FVrmGlbDocument::LoadFromFile(const FString& FilePath, FString& OutError, EVrmGlbReadMode ReadMode)
+{
+	OutError.Reset();
+
+	TUniquePtr<FVrmMappedFile> File = FVrmMappedFile::Open(FilePath, OutError, ReadMode == EVrmGlbReadMode::MemoryMapped);
+	if (!File.IsValid())
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FVrmGlbDocument> Document = MakeShareable(new FVrmGlbDocument());
+	Document->SourcePath = FilePath;
+	Document->bMapExternalBuffers = ReadMode == EVrmGlbReadMode::MemoryMapped;
+	Document->Bytes = File->GetView();
+	Document->MappedFile = MoveTemp(File);
+
+	if (!Document->Parse(OutError))
+	{
+		return nullptr;
+	}
+	return Document;
+}
+
+TSharedPtr<FVrmGlbDocument> FVrmGlbDocument::LoadFromBytes(TArray<uint8>&& InBytes, FString& OutError, const FString& InSourcePath)
+{
+	OutError.Reset();
+
+	TSharedPtr<FVrmGlbDocument> Document = MakeShareable(new FVrmGlbDocument());
+	Document->SourcePath = InSourcePath;
+	Document->OwnedBytes = MoveTemp(InBytes);
+	Document->Bytes = Document->OwnedBytes;
+
+	if (!Document->Parse(OutError))
+	{
+		return nullptr;
+	}
+	return Document;
+}
+
+TSharedPtr<FVrmGlbDocument> FVrmGlbDocument::LoadFromView(TArrayView<const uint8> InBytes, FString& OutError, const FString& InSourcePath)
+{
+	OutError.Reset();
+
+	TSharedPtr<FVrmGlbDocument> Document = MakeShareable(new FVrmGlbDocument());
+	Document->SourcePath = InSourcePath;
+	Document->Bytes = InBytes;
+	Document->bBorrowedBytes = true;
+
+	if (!Document->Parse(OutError))
+	{
+		return nullptr;
+	}
+	return Document;
+}
+
+bool FVrmGlbDocument::EmbedExternalBuffers(TArray<uint8>& InOutBytes, const FString& InSourcePath, FString& OutError)
+{
+	OutError.Reset();
+
+	// Unparsable bytes are reported by the importer's own parse of them
+	FString ParseError;
+	const TSharedPtr<FVrmGlbDocument> Document = LoadFromView(InOutBytes, ParseError, InSourcePath);
+	if (!Document.IsValid())
+	{
+		return true;
+	}
+
+	const TArray<FVrmGltfBuffer>& Buffers = Document->GetModel().Buffers;
+	TBitArray<> External(false, Buffers.Num());
+	for (int32 BufferIndex = 0; BufferIndex < Buffers.Num(); ++BufferIndex)
+	{
+		const FVrmGltfBuffer& Buffer = Buffers[BufferIndex];
+		if (Buffer.Uri.IsEmpty() || Buffer.bDataUri)
+		{
+			continue;
+		}
+		if (Document->GetBufferData(BufferIndex).Num() < Buffer.ByteLength)
+		{
+			OutError = FString::Printf(TEXT("glTF buffer %d ('%s') could not be read next to %s"), BufferIndex, *Buffer.Uri, *InSourcePath);
+			return false;
+		}
+		External[BufferIndex] = true;
+	}
+	if (External.Find(true) == INDEX_NONE)
+	{
+		return true;
+	}
+
+	// Each buffer's uri string token, by buffer index
+	const TArrayView<const uint8> Json = Document->GetJsonChunk();
+	TArray<TPair<int64, int64>> UriTokens;
+	FVrmJsonReader Reader(Json);
+	Reader.Next();
+	Reader.ForEachMember([&Reader, &UriTokens]()
+	{
+		if (!Reader.KeyEquals("buffers") || Reader.Next() != EVrmJsonToken::BeginArray)
+		{
+			return false;
+		}
+		for (EVrmJsonToken Token = Reader.Next(); Token != EVrmJsonToken::EndArray && Token != EVrmJsonToken::Error; Token = Reader.Next())
+		{
+			TPair<int64, int64>& UriToken = UriTokens.Emplace_GetRef(INDEX_NONE, INDEX_NONE);
+			Reader.ForEachMember([&Reader, &UriToken]()
+			{
+				if (!Reader.KeyEquals("uri"))
+				{
+					return false;
+				}
+				if (Reader.Next() == EVrmJsonToken::String)
+				{
+					UriToken = { Reader.GetTokenOffset(), Reader.GetTokenEndOffset() };
+				}
+				else
+				{
+					Reader.SkipValue();
+				}
+				return true;
+			});
+		}
+		return true;
+	});
+
+	// Splice the data: URIs over the file references; buffers appear in offset order
+	const FAnsiStringView DataUriPrefix = "\"data:application/octet-stream;base64,";
+	TArray<uint8> NewJson;
+	int64 Copied = 0;
+	for (int32 BufferIndex = 0; BufferIndex < Buffers.Num(); ++BufferIndex)
+	{
+		if (!External[BufferIndex] || !UriTokens.IsValidIndex(BufferIndex) || UriTokens[BufferIndex].Key == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const TArrayView<const uint8> Data = Document->GetBufferData(BufferIndex);
+		NewJson.Append(Json.GetData() + Copied, UriTokens[BufferIndex].Key - Copied);
+		NewJson.Append(reinterpret_cast<const uint8*>(DataUriPrefix.GetData()), DataUriPrefix.Len());
+		const int32 EncodedStart = NewJson.Num();
+		NewJson.AddUninitialized(FBase64::GetEncodedDataSize(Data.Num()) + 1);
+		const uint32 EncodedLength = FBase64::Encode(Data.GetData(), Data.Num(), reinterpret_cast<ANSICHAR*>(NewJson.GetData() + EncodedStart));
+		NewJson.SetNum(EncodedStart + EncodedLength, EAllowShrinking::No);
+		NewJson.Add('"');
+		Copied = UriTokens[BufferIndex].Value;
+	}
+	NewJson.Append(Json.GetData() + Copied, Json.Num() - Copied);
+
+	if (!Document->IsGlb())
+	{
+		InOutBytes = MoveTemp(NewJson);
+		return true;
+	}
+
+	// GLB: the new JSON chunk (space padded), then every other chunk as it was
+	while (NewJson.Num() % 4 != 0)
+	{
+		NewJson.Add(' ');
+	}
+
+	const TArray<FChunk>& Chunks = Document->GetChunks();
+	const int32 JsonChunk = Chunks.IndexOfByPredicate([](const FChunk& Chunk) { return Chunk.Type == EVrmGlbChunkType::Json; });
+	int64 TotalSize = FVrmGlbContainer::HeaderSize;
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+	{
+		TotalSize += FVrmGlbContainer::ChunkHeaderSize + (ChunkIndex == JsonChunk ? NewJson.Num() : Align(Chunks[ChunkIndex].Length, 4));
+	}
+	if (TotalSize > MAX_int32)
+	{
+		OutError = FString::Printf(TEXT("GLB with embedded buffers would be %lld bytes, too large to store"), TotalSize);
+		return false;
+	}
+
+	TArray<uint8> Glb;
+	Glb.Reserve(TotalSize);
+	auto AppendUint32 = [&Glb](uint32 Value) { Glb.Append(reinterpret_cast<const uint8*>(&Value), sizeof(Value)); };
+	AppendUint32(FVrmGlbContainer::Magic);
+	AppendUint32(FVrmGlbContainer::Version);
+	AppendUint32(static_cast<uint32>(TotalSize));
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+	{
+		const FChunk& Chunk = Chunks[ChunkIndex];
+		if (ChunkIndex == JsonChunk)
+		{
+			AppendUint32(NewJson.Num());
+			AppendUint32(Chunk.Type);
+			Glb.Append(NewJson);
+			continue;
+		}
+
+		AppendUint32(Align(Chunk.Length, 4));
+		AppendUint32(Chunk.Type);
+		Glb.Append(InOutBytes.GetData() + Chunk.Offset, Chunk.Length);
+		Glb.AddZeroed(Align(Chunk.Length, 4) - Chunk.Length);
+	}
+
+	InOutBytes = MoveTemp(Glb);
+	return true;
+}
+
+bool FVrmGlbDocument::Parse(FString& OutError)
+{
+	// A plain .gltf is all JSON; its buffers live in URIs rather than a BIN chunk
+	if (IsGltfJson(Bytes))
+	{
+		Container.Reset();
+		JsonBytes = Bytes;
+	}
+	else
+	{
+		if (!Container.Parse(Bytes, OutError))
+		{
+			return false;
+		}
+		JsonBytes = Container.GetJsonChunk();
+	}
+
+	// Parse the JSON DOM once. A JSON chunk that fails to parse is not fatal for the container:
+	// consumers treat an invalid root the same way they treat unparsable JSON.
+	// The DOM is built straight from the UTF-8 chunk bytes into a single arena.
+	FString JsonError;
+	if (!Json.Parse(GetJsonChunk(), JsonError))
+	{
+		UE_LOG(LogVrmToolchain, Warning, TEXT("Failed to parse JSON from GLB file: %s"), *JsonError);
+	}
+	else if (Json.GetRoot().IsObject())
+	{
+		// Resolve the glTF schema once so downstream stages index typed arrays instead of walking JSON.
+		// Sizes and offsets the buffers are read with must be exact, so a malformed one fails the document
+		if (!Model.Build(Json.GetRoot(), JsonError))
+		{
+			OutError = FString::Printf(TEXT("Invalid glTF: %s"), *JsonError);
+			return false;
+		}
+		ResolveBuffers();
+	}
+
+	return true;
+}
+
+FIoHash FVrmGlbDocument::ComputeContentHash() const
+{
+	FBlake3 Hasher;
+	Hasher.Update(Bytes.GetData(), Bytes.Num());
+
+	// The BIN chunk is already covered by the file bytes; sizes keep adjacent buffers from running together
+	const uint8* BytesEnd = Bytes.GetData() + Bytes.Num();
+	for (const TArrayView<const uint8>& Buffer : BufferData)
+	{
+		if (Buffer.Num() > 0 && Buffer.GetData() >= Bytes.GetData() && Buffer.GetData() + Buffer.Num() <= BytesEnd)
+		{
+			continue;
+		}
+
+		const uint64 Size = Buffer.Num();
+		Hasher.Update(&Size, sizeof(Size));
+		Hasher.Update(Buffer.GetData(), Size);
+	}
+
+	return FIoHash(Hasher.Finalize());
+}
+
+void FVrmGlbDocument::ResolveBuffers()
+{
+	BufferData.SetNum(Model.Buffers.Num());
+	const TConstArrayView<FVrmJsonValue> BuffersJson = GetJsonRoot().FindArray("buffers");
+
+	for (int32 BufferIndex = 0; BufferIndex < Model.Buffers.Num(); ++BufferIndex)
+	{
+		const FVrmGltfBuffer& Buffer = Model.Buffers[BufferIndex];
+		const FVrmJsonValue* UriJson = BuffersJson.IsValidIndex(BufferIndex) ? BuffersJson[BufferIndex].Find("uri") : nullptr;
+		const FAnsiStringView Uri = UriJson ? UriJson->AsUtf8() : FAnsiStringView();
+
+		// The GLB-stored buffer is buffers[0] without a uri; other uri-less buffers (e.g. meshopt fallbacks) carry no data
+		if (Uri.IsEmpty())
+		{
+			if (BufferIndex == 0)
+			{
+				BufferData[BufferIndex] = GetBinChunk();
+			}
+			continue;
+		}
+
+		FString Error;
+		if (Buffer.bDataUri)
+		{
+			// Decoded straight from the DOM's UTF-8 text; the inner array keeps its heap block when DecodedBuffers grows
+			TArray<uint8>& Decoded = DecodedBuffers.AddDefaulted_GetRef();
+			if (DecodeDataUri(Uri, Decoded, Error))
+			{
+				BufferData[BufferIndex] = Decoded;
+			}
+		}
+		else if (SourcePath.IsEmpty())
+		{
+			Error = TEXT("no source path to resolve the relative URI against");
+		}
+		else
+		{
+			const FString RelativePath = DecodeUriPath(Uri);
+			if (RelativePath.Contains(TEXT("://")) || !FPaths::IsRelative(RelativePath))
+			{
+				Error = FString::Printf(TEXT("only relative file URIs are supported (%s)"), *RelativePath);
+			}
+			else
+			{
+				FString FilePath = FPaths::Combine(FPaths::GetPath(SourcePath), RelativePath);
+				FPaths::CollapseRelativeDirectories(FilePath);
+
+				TUniquePtr<FVrmMappedFile> File = FVrmMappedFile::Open(FilePath, Error, bMapExternalBuffers);
+				if (File.IsValid())
+				{
+					BufferData[BufferIndex] = File->GetView();
+					ExternalBuffers.Add(MoveTemp(File));
+				}
+			}
+		}
+
+		if (!Error.IsEmpty())
+		{
+			UE_LOG(LogVrmToolchain, Warning, TEXT("glTF buffer %d is unavailable: %s"), BufferIndex, *Error);
+		}
+		else if (BufferData[BufferIndex].Num() < Buffer.ByteLength)
+		{
+			UE_LOG(LogVrmToolchain, Warning, TEXT("glTF buffer %d holds %d bytes, less than its byteLength %lld"), BufferIndex, BufferData[BufferIndex].Num(), Buffer.ByteLength);
+		}
+	}
+}
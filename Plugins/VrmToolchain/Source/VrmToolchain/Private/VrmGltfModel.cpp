@@ -0,0 +1,592 @@
+#include "VrmToolchain/VrmGltfModel.h"
+#include "VrmToolchain/VrmJsonDom.h"
+
+namespace
+{
+	int32 GetIndex(const FVrmJsonValue& Object, FAnsiStringView Key)
+	{
+		const FVrmJsonValue* Value = Object.Find(Key);
+		return Value ? Value->AsInt(INDEX_NONE) : INDEX_NONE;
+	}
+
+	/**
+	 * Non-negative integer member (sizes, offsets, counts), 0 when absent. A number that is not finite, has a
+	 * fraction or exceeds Max is a parse error instead of a truncated value; the first error is kept.
+	 */
+	int64 GetUnsigned(const FVrmJsonValue& Object, FAnsiStringView Key, int64 Max, FString& InOutError)
+	{
+		const FVrmJsonValue* Value = Object.Find(Key);
+		if (!Value || !Value->IsNumber())
+		{
+			return 0;
+		}
+
+		// Max + 1 is a power of two for both limits, so the comparison is exact in double
+		const double Number = Value->Number;
+		if (FMath::IsFinite(Number) && Number >= 0.0 && Number == FMath::FloorToDouble(Number) && Number < static_cast<double>(Max) + 1.0)
+		{
+			return static_cast<int64>(Number);
+		}
+
+		if (InOutError.IsEmpty())
+		{
+			InOutError = FString::Printf(TEXT("'%s' is not an integer in [0, %lld]: %g"), *FString(Key), Max, Number);
+		}
+		return 0;
+	}
+
+	int64 GetInt64(const FVrmJsonValue& Object, FAnsiStringView Key, FString& InOutError)
+	{
+		return GetUnsigned(Object, Key, MAX_int64, InOutError);
+	}
+
+	int32 GetInt32(const FVrmJsonValue& Object, FAnsiStringView Key, FString& InOutError)
+	{
+		return static_cast<int32>(GetUnsigned(Object, Key, MAX_int32, InOutError));
+	}
+
+	float GetFloat(const FVrmJsonValue& Object, FAnsiStringView Key, float Default)
+	{
+		const FVrmJsonValue* Value = Object.Find(Key);
+		return Value ? static_cast<float>(Value->AsNumber(Default)) : Default;
+	}
+
+	FString GetString(const FVrmJsonValue& Object, FAnsiStringView Key)
+	{
+		const FVrmJsonValue* Value = Object.Find(Key);
+		return Value ? Value->AsString() : FString();
+	}
+
+	/** "index" of a textureInfo object (e.g. pbrMetallicRoughness.baseColorTexture) */
+	int32 GetTextureIndex(const FVrmJsonValue* Parent, FAnsiStringView Key)
+	{
+		const FVrmJsonValue* TextureInfo = Parent ? Parent->FindObject(Key) : nullptr;
+		return TextureInfo ? GetIndex(*TextureInfo, "index") : INDEX_NONE;
+	}
+
+	FLinearColor GetColor(const FVrmJsonValue* Parent, FAnsiStringView Key, const FLinearColor& Default)
+	{
+		const TConstArrayView<FVrmJsonValue> Values = Parent ? Parent->FindArray(Key) : TConstArrayView<FVrmJsonValue>();
+		if (Values.Num() < 3)
+		{
+			return Default;
+		}
+
+		return FLinearColor(
+			static_cast<float>(Values[0].AsNumber()),
+			static_cast<float>(Values[1].AsNumber()),
+			static_cast<float>(Values[2].AsNumber()),
+			Values.Num() >= 4 ? static_cast<float>(Values[3].AsNumber()) : Default.A);
+	}
+
+	EVrmGltfAccessorType ParseAccessorType(FAnsiStringView Type)
+	{
+		if (Type.Equals("SCALAR")) return EVrmGltfAccessorType::Scalar;
+		if (Type.Equals("VEC2")) return EVrmGltfAccessorType::Vec2;
+		if (Type.Equals("VEC3")) return EVrmGltfAccessorType::Vec3;
+		if (Type.Equals("VEC4")) return EVrmGltfAccessorType::Vec4;
+		if (Type.Equals("MAT2")) return EVrmGltfAccessorType::Mat2;
+		if (Type.Equals("MAT3")) return EVrmGltfAccessorType::Mat3;
+		if (Type.Equals("MAT4")) return EVrmGltfAccessorType::Mat4;
+		return EVrmGltfAccessorType::Unknown;
+	}
+
+	EVrmGltfMeshoptMode ParseMeshoptMode(FAnsiStringView Mode)
+	{
+		if (Mode.Equals("ATTRIBUTES")) return EVrmGltfMeshoptMode::Attributes;
+		if (Mode.Equals("TRIANGLES")) return EVrmGltfMeshoptMode::Triangles;
+		if (Mode.Equals("INDICES")) return EVrmGltfMeshoptMode::Indices;
+		return EVrmGltfMeshoptMode::Unknown;
+	}
+
+	EVrmGltfMeshoptFilter ParseMeshoptFilter(FAnsiStringView Filter)
+	{
+		if (Filter.Equals("NONE")) return EVrmGltfMeshoptFilter::None;
+		if (Filter.Equals("OCTAHEDRAL")) return EVrmGltfMeshoptFilter::Octahedral;
+		if (Filter.Equals("QUATERNION")) return EVrmGltfMeshoptFilter::Quaternion;
+		if (Filter.Equals("EXPONENTIAL")) return EVrmGltfMeshoptFilter::Exponential;
+		return EVrmGltfMeshoptFilter::Unknown;
+	}
+
+	/** Parses an indexed attribute semantic such as "TEXCOORD_1"; returns INDEX_NONE if Name does not match Prefix */
+	int32 ParseSemanticSet(FAnsiStringView Name, FAnsiStringView Prefix)
+	{
+		if (!Name.StartsWith(Prefix, ESearchCase::CaseSensitive) || Name.Len() == Prefix.Len())
+		{
+			return INDEX_NONE;
+		}
+
+		int32 Set = 0;
+		for (const ANSICHAR C : Name.RightChop(Prefix.Len()))
+		{
+			if (C < '0' || C > '9')
+			{
+				return INDEX_NONE;
+			}
+			Set = Set * 10 + (C - '0');
+			if (Set > MAX_uint8)
+			{
+				return INDEX_NONE;
+			}
+		}
+		return Set;
+	}
+
+	FVrmGltfRange AppendIndices(TArray<int32>& Pool, TConstArrayView<FVrmJsonValue> Values)
+	{
+		FVrmGltfRange Range;
+		Range.First = Pool.Num();
+		Range.Num = Values.Num();
+		for (const FVrmJsonValue& Value : Values)
+		{
+			Pool.Add(Value.AsInt(INDEX_NONE));
+		}
+		return Range;
+	}
+}
+
+int32 EVrmGltfComponentType::GetSize(int32 ComponentType)
+{
+	switch (ComponentType)
+	{
+	case Byte:
+	case UnsignedByte:
+		return 1;
+	case Short:
+	case UnsignedShort:
+		return 2;
+	case UnsignedInt:
+	case Float:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+int32 FVrmGltfAccessor::GetComponentCount() const
+{
+	switch (Type)
+	{
+	case EVrmGltfAccessorType::Scalar: return 1;
+	case EVrmGltfAccessorType::Vec2: return 2;
+	case EVrmGltfAccessorType::Vec3: return 3;
+	case EVrmGltfAccessorType::Vec4: return 4;
+	case EVrmGltfAccessorType::Mat2: return 4;
+	case EVrmGltfAccessorType::Mat3: return 9;
+	case EVrmGltfAccessorType::Mat4: return 16;
+	default: return 0;
+	}
+}
+
+int32 FVrmGltfVrmExtension::FindHumanBoneNode(FName Bone) const
+{
+	for (const FVrmGltfHumanBone& HumanBone : HumanBones)
+	{
+		if (HumanBone.Bone == Bone)
+		{
+			return HumanBone.Node;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FVrmGltfModel::Reset()
+{
+	*this = FVrmGltfModel();
+}
+
+FMatrix FVrmGltfModel::GetLocalMatrix(const FVrmGltfNode& Node)
+{
+	return Node.bHasMatrix ? Node.Matrix : FTransform(Node.Rotation, Node.Translation, Node.Scale).ToMatrixWithScale();
+}
+
+FMatrix FVrmGltfModel::GetWorldMatrix(int32 NodeIndex) const
+{
+	// Parents come from authored children lists: a cycle stops after visiting every node once
+	FMatrix World = FMatrix::Identity;
+	for (int32 Depth = 0; Nodes.IsValidIndex(NodeIndex) && Depth < Nodes.Num(); ++Depth)
+	{
+		World = World * GetLocalMatrix(Nodes[NodeIndex]);
+		NodeIndex = Nodes[NodeIndex].Parent;
+	}
+	return World;
+}
+
+bool FVrmGltfModel::Build(const FVrmJsonValue& Root, FString& OutError)
+{
+	Reset();
+	OutError.Reset();
+
+	if (!Root.IsObject())
+	{
+		OutError = TEXT("glTF JSON root is not an object");
+		return false;
+	}
+
+	// Buffers and views
+	for (const FVrmJsonValue& Json : Root.FindArray("buffers"))
+	{
+		FVrmGltfBuffer& Buffer = Buffers.AddDefaulted_GetRef();
+		Buffer.ByteLength = GetInt64(Json, "byteLength", OutError);
+
+		// Embedded buffers can be megabytes of base64: keep the payload in the DOM, where it is decoded from UTF-8 directly
+		if (const FVrmJsonValue* Uri = Json.Find("uri"))
+		{
+			const FAnsiStringView UriText = Uri->AsUtf8();
+			Buffer.bDataUri = UriText.StartsWith("data:");
+			if (Buffer.bDataUri)
+			{
+				int32 Comma = INDEX_NONE;
+				UriText.FindChar(',', Comma);
+				Buffer.Uri = FString(Comma == INDEX_NONE ? UriText : UriText.Left(Comma));
+			}
+			else
+			{
+				Buffer.Uri = Uri->AsString();
+			}
+		}
+	}
+
+	for (const FVrmJsonValue& Json : Root.FindArray("bufferViews"))
+	{
+		FVrmGltfBufferView& View = BufferViews.AddDefaulted_GetRef();
+		View.Buffer = GetIndex(Json, "buffer");
+		View.ByteOffset = GetInt64(Json, "byteOffset", OutError);
+		View.ByteLength = GetInt64(Json, "byteLength", OutError);
+		View.ByteStride = GetInt32(Json, "byteStride", OutError);
+
+		const FVrmJsonValue* ViewExtensions = Json.FindObject("extensions");
+		if (const FVrmJsonValue* Meshopt = ViewExtensions ? ViewExtensions->FindObject("EXT_meshopt_compression") : nullptr)
+		{
+			View.Meshopt.Buffer = GetIndex(*Meshopt, "buffer");
+			View.Meshopt.ByteOffset = GetInt64(*Meshopt, "byteOffset", OutError);
+			View.Meshopt.ByteLength = GetInt64(*Meshopt, "byteLength", OutError);
+			View.Meshopt.ByteStride = GetInt32(*Meshopt, "byteStride", OutError);
+			View.Meshopt.Count = GetInt32(*Meshopt, "count", OutError);
+			if (const FVrmJsonValue* Mode = Meshopt->Find("mode"))
+			{
+				View.Meshopt.Mode = ParseMeshoptMode(Mode->AsUtf8());
+			}
+			if (const FVrmJsonValue* Filter = Meshopt->Find("filter"))
+			{
+				View.Meshopt.Filter = ParseMeshoptFilter(Filter->AsUtf8());
+			}
+		}
+	}
+
+	for (const FVrmJsonValue& Json : Root.FindArray("accessors"))
+	{
+		FVrmGltfAccessor& Accessor = Accessors.AddDefaulted_GetRef();
+		Accessor.BufferView = GetIndex(Json, "bufferView");
+		Accessor.ByteOffset = GetInt64(Json, "byteOffset", OutError);
+		Accessor.ComponentType = GetInt32(Json, "componentType", OutError);
+		Accessor.Count = GetInt32(Json, "count", OutError);
+		Accessor.bNormalized = Json.Find("normalized") && Json.Find("normalized")->AsBool();
+		if (const FVrmJsonValue* Type = Json.Find("type"))
+		{
+			Accessor.Type = ParseAccessorType(Type->AsUtf8());
+		}
+		if (const FVrmJsonValue* Sparse = Json.FindObject("sparse"))
+		{
+			Accessor.Sparse.Count = GetInt32(*Sparse, "count", OutError);
+			if (const FVrmJsonValue* Indices = Sparse->FindObject("indices"))
+			{
+				Accessor.Sparse.IndicesBufferView = GetIndex(*Indices, "bufferView");
+				Accessor.Sparse.IndicesByteOffset = GetInt64(*Indices, "byteOffset", OutError);
+				Accessor.Sparse.IndicesComponentType = GetInt32(*Indices, "componentType", OutError);
+			}
+			if (const FVrmJsonValue* Values = Sparse->FindObject("values"))
+			{
+				Accessor.Sparse.ValuesBufferView = GetIndex(*Values, "bufferView");
+				Accessor.Sparse.ValuesByteOffset = GetInt64(*Values, "byteOffset", OutError);
+			}
+		}
+	}
+
+	// Meshes; primitives are stored flat, in mesh order
+	const TConstArrayView<FVrmJsonValue> MeshesJson = Root.FindArray("meshes");
+	Meshes.Reserve(MeshesJson.Num());
+	for (int32 MeshIndex = 0; MeshIndex < MeshesJson.Num(); ++MeshIndex)
+	{
+		const FVrmJsonValue& Json = MeshesJson[MeshIndex];
+		FVrmGltfMesh& Mesh = Meshes.AddDefaulted_GetRef();
+		Mesh.Name = GetString(Json, "name");
+		Mesh.Primitives.First = Primitives.Num();
+
+		const TConstArrayView<FVrmJsonValue> PrimitivesJson = Json.FindArray("primitives");
+
+		// Exporters put target names on the mesh; some only on the primitives
+		const FVrmJsonValue* Extras = Json.FindObject("extras");
+		if ((!Extras || !Extras->HasField("targetNames")) && PrimitivesJson.Num() > 0)
+		{
+			Extras = PrimitivesJson[0].FindObject("extras");
+		}
+		if (Extras)
+		{
+			for (const FVrmJsonValue& TargetName : Extras->FindArray("targetNames"))
+			{
+				Mesh.TargetNames.Add(TargetName.AsString());
+			}
+		}
+
+		for (const FVrmJsonValue& PrimitiveJson : PrimitivesJson)
+		{
+			FVrmGltfPrimitive& Primitive = Primitives.AddDefaulted_GetRef();
+			Primitive.Mesh = MeshIndex;
+			Primitive.Indices = GetIndex(PrimitiveJson, "indices");
+			Primitive.Material = GetIndex(PrimitiveJson, "material");
+			if (const FVrmJsonValue* Mode = PrimitiveJson.Find("mode"))
+			{
+				Primitive.Mode = Mode->AsInt(4);
+			}
+
+			const TConstArrayView<FVrmJsonValue> TargetsJson = PrimitiveJson.FindArray("targets");
+			Primitive.Targets.First = MorphTargets.Num();
+			Primitive.Targets.Num = TargetsJson.Num();
+			for (const FVrmJsonValue& TargetJson : TargetsJson)
+			{
+				FVrmGltfMorphTarget& Target = MorphTargets.AddDefaulted_GetRef();
+				Target.Position = GetIndex(TargetJson, "POSITION");
+				Target.Normal = GetIndex(TargetJson, "NORMAL");
+				Target.Tangent = GetIndex(TargetJson, "TANGENT");
+			}
+
+			const FVrmJsonValue* Attributes = PrimitiveJson.FindObject("attributes");
+			if (!Attributes)
+			{
+				continue;
+			}
+
+			for (const FVrmJsonMember& Attribute : Attributes->GetMembers())
+			{
+				const FAnsiStringView Name = Attribute.Key->View();
+				const int32 AccessorIndex = Attribute.Value.AsInt(INDEX_NONE);
+				int32 Set = INDEX_NONE;
+
+				if (Name.Equals("POSITION"))
+				{
+					Primitive.Position = AccessorIndex;
+				}
+				else if (Name.Equals("NORMAL"))
+				{
+					Primitive.Normal = AccessorIndex;
+				}
+				else if (Name.Equals("TANGENT"))
+				{
+					Primitive.Tangent = AccessorIndex;
+				}
+				else if (Name.Equals("COLOR_0"))
+				{
+					Primitive.Color0 = AccessorIndex;
+				}
+				else if ((Set = ParseSemanticSet(Name, "TEXCOORD_")) != INDEX_NONE)
+				{
+					if (Set < FVrmGltfPrimitive::MaxTexCoordSets)
+					{
+						Primitive.TexCoords[Set] = AccessorIndex;
+					}
+				}
+				else if ((Set = ParseSemanticSet(Name, "JOINTS_")) != INDEX_NONE)
+				{
+					if (Set < FVrmGltfPrimitive::MaxInfluenceSets)
+					{
+						Primitive.Joints[Set] = AccessorIndex;
+					}
+				}
+				else if ((Set = ParseSemanticSet(Name, "WEIGHTS_")) != INDEX_NONE)
+				{
+					if (Set < FVrmGltfPrimitive::MaxInfluenceSets)
+					{
+						Primitive.Weights[Set] = AccessorIndex;
+					}
+				}
+			}
+		}
+
+		Mesh.Primitives.Num = Primitives.Num() - Mesh.Primitives.First;
+	}
+
+	// Nodes; parents are derived from the children lists
+	const TConstArrayView<FVrmJsonValue> NodesJson = Root.FindArray("nodes");
+	Nodes.Reserve(NodesJson.Num());
+	for (const FVrmJsonValue& Json : NodesJson)
+	{
+		FVrmGltfNode& Node = Nodes.AddDefaulted_GetRef();
+		Node.Name = GetString(Json, "name");
+		Node.Mesh = GetIndex(Json, "mesh");
+		Node.Skin = GetIndex(Json, "skin");
+		Node.Children = AppendIndices(NodeChildren, Json.FindArray("children"));
+
+		const TConstArrayView<FVrmJsonValue> Matrix = Json.FindArray("matrix");
+		if (Matrix.Num() == 16)
+		{
+			Node.bHasMatrix = true;
+			for (int32 Element = 0; Element < 16; ++Element)
+			{
+				Node.Matrix.M[Element / 4][Element % 4] = Matrix[Element].AsNumber();
+			}
+			continue;
+		}
+
+		const TConstArrayView<FVrmJsonValue> Translation = Json.FindArray("translation");
+		if (Translation.Num() == 3)
+		{
+			Node.Translation = FVector(Translation[0].AsNumber(), Translation[1].AsNumber(), Translation[2].AsNumber());
+		}
+		const TConstArrayView<FVrmJsonValue> Rotation = Json.FindArray("rotation");
+		if (Rotation.Num() == 4)
+		{
+			Node.Rotation = FQuat(Rotation[0].AsNumber(), Rotation[1].AsNumber(), Rotation[2].AsNumber(), Rotation[3].AsNumber());
+		}
+		const TConstArrayView<FVrmJsonValue> Scale = Json.FindArray("scale");
+		if (Scale.Num() == 3)
+		{
+			Node.Scale = FVector(Scale[0].AsNumber(), Scale[1].AsNumber(), Scale[2].AsNumber());
+		}
+	}
+
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		for (const int32 Child : GetChildren(Nodes[NodeIndex]))
+		{
+			if (Nodes.IsValidIndex(Child))
+			{
+				Nodes[Child].Parent = NodeIndex;
+			}
+		}
+	}
+
+	for (const FVrmJsonValue& Json : Root.FindArray("skins"))
+	{
+		FVrmGltfSkin& Skin = Skins.AddDefaulted_GetRef();
+		Skin.Name = GetString(Json, "name");
+		Skin.InverseBindMatrices = GetIndex(Json, "inverseBindMatrices");
+		Skin.Skeleton = GetIndex(Json, "skeleton");
+		Skin.Joints = AppendIndices(SkinJoints, Json.FindArray("joints"));
+	}
+
+	// Images, textures, materials
+	for (const FVrmJsonValue& Json : Root.FindArray("images"))
+	{
+		FVrmGltfImage& Image = Images.AddDefaulted_GetRef();
+		Image.Name = GetString(Json, "name");
+		Image.MimeType = GetString(Json, "mimeType");
+		Image.Uri = GetString(Json, "uri");
+		Image.BufferView = GetIndex(Json, "bufferView");
+	}
+
+	for (const FVrmJsonValue& Json : Root.FindArray("textures"))
+	{
+		FVrmGltfTexture& Texture = Textures.AddDefaulted_GetRef();
+		Texture.Source = GetIndex(Json, "source");
+		Texture.Sampler = GetIndex(Json, "sampler");
+	}
+
+	for (const FVrmJsonValue& Json : Root.FindArray("materials"))
+	{
+		FVrmGltfMaterial& Material = Materials.AddDefaulted_GetRef();
+		Material.Name = GetString(Json, "name");
+
+		const FVrmJsonValue* Pbr = Json.FindObject("pbrMetallicRoughness");
+		Material.BaseColorFactor = GetColor(Pbr, "baseColorFactor", FLinearColor::White);
+		Material.BaseColorTexture = GetTextureIndex(Pbr, "baseColorTexture");
+		Material.MetallicRoughnessTexture = GetTextureIndex(Pbr, "metallicRoughnessTexture");
+		if (Pbr)
+		{
+			Material.MetallicFactor = GetFloat(*Pbr, "metallicFactor", 1.0f);
+			Material.RoughnessFactor = GetFloat(*Pbr, "roughnessFactor", 1.0f);
+		}
+
+		Material.NormalTexture = GetTextureIndex(&Json, "normalTexture");
+		Material.EmissiveTexture = GetTextureIndex(&Json, "emissiveTexture");
+		Material.EmissiveFactor = GetColor(&Json, "emissiveFactor", FLinearColor::Black);
+		Material.AlphaCutoff = GetFloat(Json, "alphaCutoff", 0.5f);
+		Material.bDoubleSided = Json.Find("doubleSided") && Json.Find("doubleSided")->AsBool();
+
+		if (const FVrmJsonValue* AlphaMode = Json.Find("alphaMode"))
+		{
+			Material.AlphaMode = AlphaMode->StringEquals("MASK") ? EVrmGltfAlphaMode::Mask
+				: AlphaMode->StringEquals("BLEND") ? EVrmGltfAlphaMode::Blend
+				: EVrmGltfAlphaMode::Opaque;
+		}
+
+		if (const FVrmJsonValue* Extensions = Json.FindObject("extensions"))
+		{
+			Material.bUnlit = Extensions->HasField("KHR_materials_unlit");
+			Material.bMToon = Extensions->HasField("VRMC_materials_mtoon");
+		}
+	}
+
+	// VRM extensions, detected with the rules of FVrmParser::ScanVrmFeatures so the document and the file probe agree:
+	// VRMC_vrm takes precedence, either key marks the version whatever its value, and VRM0 spring bones may sit at the root.
+	// Only object values are read further.
+	const FVrmJsonValue* Extensions = Root.FindObject("extensions");
+	if (const FVrmJsonValue* Vrm1 = Extensions ? Extensions->Find("VRMC_vrm") : nullptr)
+	{
+		Vrm.Version = EVrmVersion::VRM1;
+		Vrm.bHasSpringBones = Extensions->HasField("VRMC_springBone") || Vrm1->HasField("springBone");
+
+		const FVrmJsonValue* Humanoid = Vrm1->FindObject("humanoid");
+		const FVrmJsonValue* HumanBones = Humanoid ? Humanoid->FindObject("humanBones") : nullptr;
+		if (HumanBones)
+		{
+			for (const FVrmJsonMember& Member : HumanBones->GetMembers())
+			{
+				FVrmGltfHumanBone& HumanBone = Vrm.HumanBones.AddDefaulted_GetRef();
+				HumanBone.Bone = FName(Member.Key->View());
+				HumanBone.Node = GetIndex(Member.Value, "node");
+			}
+		}
+
+		if (const FVrmJsonValue* Meta = Vrm1->FindObject("meta"))
+		{
+			Vrm.ThumbnailImage = GetIndex(*Meta, "thumbnailImage");
+		}
+
+		if (const FVrmJsonValue* Expressions = Vrm1->FindObject("expressions"))
+		{
+			const FVrmJsonValue* Preset = Expressions->FindObject("preset");
+			const FVrmJsonValue* Custom = Expressions->FindObject("custom");
+			Vrm.NumExpressions = (Preset ? Preset->GetMembers().Num() : 0) + (Custom ? Custom->GetMembers().Num() : 0);
+		}
+	}
+	else if (const FVrmJsonValue* Vrm0 = Extensions ? Extensions->Find("VRM") : nullptr)
+	{
+		Vrm.Version = EVrmVersion::VRM0;
+		Vrm.bHasSpringBones = Vrm0->HasField("secondaryAnimation") || Root.HasField("secondaryAnimation");
+
+		if (const FVrmJsonValue* Humanoid = Vrm0->FindObject("humanoid"))
+		{
+			for (const FVrmJsonValue& Json : Humanoid->FindArray("humanBones"))
+			{
+				const FVrmJsonValue* BoneName = Json.Find("bone");
+				if (BoneName && BoneName->IsString())
+				{
+					FVrmGltfHumanBone& HumanBone = Vrm.HumanBones.AddDefaulted_GetRef();
+					HumanBone.Bone = FName(BoneName->AsUtf8());
+					HumanBone.Node = GetIndex(Json, "node");
+				}
+			}
+		}
+
+		if (const FVrmJsonValue* Meta = Vrm0->FindObject("meta"))
+		{
+			Vrm.ThumbnailTexture = GetIndex(*Meta, "texture");
+		}
+
+		if (const FVrmJsonValue* BlendShapeMaster = Vrm0->FindObject("blendShapeMaster"))
+		{
+			Vrm.NumExpressions = BlendShapeMaster->FindArray("blendShapeGroups").Num();
+		}
+
+		// VRM0 keeps shader selection per material index in materialProperties
+		const TConstArrayView<FVrmJsonValue> MaterialProperties = Vrm0->FindArray("materialProperties");
+		for (int32 MaterialIndex = 0; MaterialIndex < MaterialProperties.Num() && MaterialIndex < Materials.Num(); ++MaterialIndex)
+		{
+			const FVrmJsonValue* Shader = MaterialProperties[MaterialIndex].Find("shader");
+			Materials[MaterialIndex].bMToon = Shader && Shader->StringEquals("VRM/MToon");
+		}
+	}
+
+	return OutError.IsEmpty();
+}
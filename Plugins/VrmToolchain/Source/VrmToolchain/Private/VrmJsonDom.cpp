@@ -0,0 +1,423 @@
+#include "VrmToolchain/VrmJsonDom.h"
+#include "VrmToolchain/VrmJsonReader.h"
+
+namespace
+{
+	/** Deepest nesting accepted before the input is rejected (guards the recursive parser's stack) */
+	constexpr int32 VrmJsonDom_MaxDepth = 512;
+
+	constexpr int64 VrmJsonDom_MinBlockSize = 64 * 1024;
+	constexpr int64 VrmJsonDom_MaxBlockSize = 4 * 1024 * 1024;
+
+	uint32 HashKey(FAnsiStringView Key)
+	{
+		// FNV-1a over the key bytes
+		uint32 Hash = 2166136261u;
+		for (const ANSICHAR C : Key)
+		{
+			Hash = (Hash ^ static_cast<uint8>(C)) * 16777619u;
+		}
+		return Hash;
+	}
+
+	bool KeyMatches(const FVrmJsonKey* Key, FAnsiStringView Text)
+	{
+		return Key->Len == Text.Len() && FMemory::Memcmp(Key->Chars, Text.GetData(), Text.Len()) == 0;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// FVrmJsonValue
+
+FString FVrmJsonValue::AsString() const
+{
+	if (!IsString())
+	{
+		return FString();
+	}
+
+	FUTF8ToTCHAR Converter(Chars, Count);
+	return FString(Converter.Length(), Converter.Get());
+}
+
+bool FVrmJsonValue::StringEquals(FAnsiStringView Ascii) const
+{
+	return IsString() && Count == Ascii.Len() && FMemory::Memcmp(Chars, Ascii.GetData(), Count) == 0;
+}
+
+TConstArrayView<FVrmJsonMember> FVrmJsonValue::GetMembers() const
+{
+	return IsObject() ? TConstArrayView<FVrmJsonMember>(Members, Count) : TConstArrayView<FVrmJsonMember>();
+}
+
+const FVrmJsonValue* FVrmJsonValue::Find(FAnsiStringView Key) const
+{
+	for (const FVrmJsonMember& Member : GetMembers())
+	{
+		if (KeyMatches(Member.Key, Key))
+		{
+			return &Member.Value;
+		}
+	}
+	return nullptr;
+}
+
+const FVrmJsonValue* FVrmJsonValue::Find(const FVrmJsonKey* Key) const
+{
+	if (!Key)
+	{
+		return nullptr;
+	}
+
+	for (const FVrmJsonMember& Member : GetMembers())
+	{
+		if (Member.Key == Key)
+		{
+			return &Member.Value;
+		}
+	}
+	return nullptr;
+}
+
+const FVrmJsonValue* FVrmJsonValue::FindObject(FAnsiStringView Key) const
+{
+	const FVrmJsonValue* Value = Find(Key);
+	return (Value && Value->IsObject()) ? Value : nullptr;
+}
+
+TConstArrayView<FVrmJsonValue> FVrmJsonValue::FindArray(FAnsiStringView Key) const
+{
+	const FVrmJsonValue* Value = Find(Key);
+	return Value ? Value->AsArray() : TConstArrayView<FVrmJsonValue>();
+}
+
+bool FVrmJsonValue::TryGetNumber(FAnsiStringView Key, double& OutValue) const
+{
+	const FVrmJsonValue* Value = Find(Key);
+	if (!Value || !Value->IsNumber())
+	{
+		return false;
+	}
+	OutValue = Value->Number;
+	return true;
+}
+
+int32 FVrmJsonValue::AsInt(int32 Default) const
+{
+	int32 Value = Default;
+	return IsNumber() && VrmJson::TryConvertToInt32(Number, Value) ? Value : Default;
+}
+
+bool FVrmJsonValue::TryGetInt(FAnsiStringView Key, int32& OutValue) const
+{
+	double Value = 0.0;
+	return TryGetNumber(Key, Value) && VrmJson::TryConvertToInt32(Value, OutValue);
+}
+
+bool FVrmJsonValue::TryGetString(FAnsiStringView Key, FString& OutValue) const
+{
+	const FVrmJsonValue* Value = Find(Key);
+	if (!Value || !Value->IsString())
+	{
+		return false;
+	}
+	OutValue = Value->AsString();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// FVrmJsonDom
+
+struct FVrmJsonDom::FParseContext
+{
+	explicit FParseContext(TArrayView<const uint8> Utf8)
+		: Reader(Utf8)
+	{
+	}
+
+	/** Text of the current key/string token, unescaped if needed (valid until the next call) */
+	FAnsiStringView ResolveString()
+	{
+		const FUtf8StringView Raw = Reader.GetRawString();
+		if (!Reader.HasEscapes())
+		{
+			return FAnsiStringView(reinterpret_cast<const ANSICHAR*>(Raw.GetData()), Raw.Len());
+		}
+
+		FVrmJsonReader::UnescapeString(Raw, StringScratch);
+		return FAnsiStringView(StringScratch.GetData(), StringScratch.Num());
+	}
+
+	FVrmJsonReader Reader;
+
+	/** Shared stacks for containers being built; each level uses the tail and truncates it when done */
+	TArray<FVrmJsonValue> ValueScratch;
+	TArray<FVrmJsonMember> MemberScratch;
+	TArray<ANSICHAR> StringScratch;
+
+	FString Error;
+};
+
+FVrmJsonDom::FVrmJsonDom() = default;
+
+FVrmJsonDom::~FVrmJsonDom() = default;
+
+FVrmJsonDom::FVrmJsonDom(FVrmJsonDom&& Other)
+{
+	*this = MoveTemp(Other);
+}
+
+FVrmJsonDom& FVrmJsonDom::operator=(FVrmJsonDom&& Other)
+{
+	if (this != &Other)
+	{
+		Blocks = MoveTemp(Other.Blocks);
+		BlockCursor = Other.BlockCursor;
+		BlockRemaining = Other.BlockRemaining;
+		AllocatedSize = Other.AllocatedSize;
+		KeyTable = MoveTemp(Other.KeyTable);
+		NumKeys = Other.NumKeys;
+		Root = Other.Root;
+
+		// The moved-from DOM must not keep allocating into blocks it no longer owns
+		Other.Reset();
+	}
+	return *this;
+}
+
+void FVrmJsonDom::Reset()
+{
+	Blocks.Reset();
+	BlockCursor = nullptr;
+	BlockRemaining = 0;
+	AllocatedSize = 0;
+	KeyTable.Reset();
+	NumKeys = 0;
+	Root = FVrmJsonValue();
+}
+
+void* FVrmJsonDom::Allocate(int64 Size, int64 Alignment)
+{
+	const int64 Padding = (Alignment - (reinterpret_cast<UPTRINT>(BlockCursor) & (Alignment - 1))) & (Alignment - 1);
+	if (!BlockCursor || Padding + Size > BlockRemaining)
+	{
+		// Grow block size with the document so large JSON chunks need few blocks
+		const int64 PreferredSize = FMath::Clamp<int64>(AllocatedSize, VrmJsonDom_MinBlockSize, VrmJsonDom_MaxBlockSize);
+		const int64 BlockSize = FMath::Max<int64>(PreferredSize, Size + Alignment);
+
+		Blocks.Emplace(new uint8[BlockSize]);
+		BlockCursor = Blocks.Last().Get();
+		BlockRemaining = BlockSize;
+		AllocatedSize += BlockSize;
+		return Allocate(Size, Alignment);
+	}
+
+	uint8* Result = BlockCursor + Padding;
+	BlockCursor += Padding + Size;
+	BlockRemaining -= Padding + Size;
+	return Result;
+}
+
+const ANSICHAR* FVrmJsonDom::CopyString(FAnsiStringView Text)
+{
+	ANSICHAR* Chars = static_cast<ANSICHAR*>(Allocate(Text.Len() + 1, 1));
+	FMemory::Memcpy(Chars, Text.GetData(), Text.Len());
+	Chars[Text.Len()] = '\0';
+	return Chars;
+}
+
+const FVrmJsonKey* FVrmJsonDom::FindKey(FAnsiStringView Key) const
+{
+	if (KeyTable.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	const uint32 Mask = KeyTable.Num() - 1;
+	for (uint32 Slot = HashKey(Key) & Mask; KeyTable[Slot]; Slot = (Slot + 1) & Mask)
+	{
+		if (KeyMatches(KeyTable[Slot], Key))
+		{
+			return KeyTable[Slot];
+		}
+	}
+	return nullptr;
+}
+
+const FVrmJsonKey* FVrmJsonDom::InternKey(FAnsiStringView Key)
+{
+	// Keep the table at most half full
+	if ((NumKeys + 1) * 2 > KeyTable.Num())
+	{
+		TArray<const FVrmJsonKey*> OldTable = MoveTemp(KeyTable);
+		KeyTable.SetNumZeroed(FMath::Max(64, OldTable.Num() * 2));
+
+		const uint32 Mask = KeyTable.Num() - 1;
+		for (const FVrmJsonKey* Existing : OldTable)
+		{
+			if (Existing)
+			{
+				uint32 Slot = Existing->Hash & Mask;
+				while (KeyTable[Slot])
+				{
+					Slot = (Slot + 1) & Mask;
+				}
+				KeyTable[Slot] = Existing;
+			}
+		}
+	}
+
+	const uint32 Hash = HashKey(Key);
+	const uint32 Mask = KeyTable.Num() - 1;
+	uint32 Slot = Hash & Mask;
+	for (; KeyTable[Slot]; Slot = (Slot + 1) & Mask)
+	{
+		if (KeyTable[Slot]->Hash == Hash && KeyMatches(KeyTable[Slot], Key))
+		{
+			return KeyTable[Slot];
+		}
+	}
+
+	FVrmJsonKey* NewKey = static_cast<FVrmJsonKey*>(Allocate(sizeof(FVrmJsonKey), alignof(FVrmJsonKey)));
+	NewKey->Chars = CopyString(Key);
+	NewKey->Len = Key.Len();
+	NewKey->Hash = Hash;
+
+	KeyTable[Slot] = NewKey;
+	++NumKeys;
+	return NewKey;
+}
+
+bool FVrmJsonDom::Parse(TArrayView<const uint8> Utf8, FString& OutError)
+{
+	Reset();
+	OutError.Reset();
+
+	FParseContext Context(Utf8);
+	Context.Reader.Next();
+
+	FVrmJsonValue ParsedRoot;
+	if (!ParseValue(Context, ParsedRoot, 0) || Context.Reader.Next() != EVrmJsonToken::EndOfInput)
+	{
+		OutError = !Context.Error.IsEmpty() ? Context.Error
+			: !Context.Reader.GetError().IsEmpty() ? Context.Reader.GetError()
+			: FString(TEXT("Invalid JSON"));
+		Reset();
+		return false;
+	}
+
+	Root = ParsedRoot;
+	return true;
+}
+
+bool FVrmJsonDom::ParseValue(FParseContext& Context, FVrmJsonValue& OutValue, int32 Depth)
+{
+	FVrmJsonReader& Reader = Context.Reader;
+
+	switch (Reader.GetToken())
+	{
+	case EVrmJsonToken::Null:
+		OutValue.Type = EVrmJsonType::Null;
+		return true;
+
+	case EVrmJsonToken::True:
+	case EVrmJsonToken::False:
+		OutValue.Type = EVrmJsonType::Boolean;
+		OutValue.bBoolean = Reader.GetToken() == EVrmJsonToken::True;
+		return true;
+
+	case EVrmJsonToken::Number:
+		OutValue.Type = EVrmJsonType::Number;
+		OutValue.Number = Reader.GetNumber();
+		return true;
+
+	case EVrmJsonToken::String:
+	{
+		const FAnsiStringView Text = Context.ResolveString();
+		OutValue.Type = EVrmJsonType::String;
+		OutValue.Count = Text.Len();
+		OutValue.Chars = CopyString(Text);
+		return true;
+	}
+
+	case EVrmJsonToken::BeginArray:
+	{
+		if (Depth >= VrmJsonDom_MaxDepth)
+		{
+			Context.Error = TEXT("JSON nesting too deep");
+			return false;
+		}
+
+		const int32 Base = Context.ValueScratch.Num();
+		while (Reader.Next() != EVrmJsonToken::EndArray)
+		{
+			FVrmJsonValue Element;
+			if (!ParseValue(Context, Element, Depth + 1))
+			{
+				return false;
+			}
+			Context.ValueScratch.Add(Element);
+		}
+
+		const int32 Count = Context.ValueScratch.Num() - Base;
+		FVrmJsonValue* Elements = nullptr;
+		if (Count > 0)
+		{
+			Elements = static_cast<FVrmJsonValue*>(Allocate(sizeof(FVrmJsonValue) * Count, alignof(FVrmJsonValue)));
+			FMemory::Memcpy(Elements, Context.ValueScratch.GetData() + Base, sizeof(FVrmJsonValue) * Count);
+		}
+		Context.ValueScratch.SetNum(Base, EAllowShrinking::No);
+
+		OutValue.Type = EVrmJsonType::Array;
+		OutValue.Count = Count;
+		OutValue.Elements = Elements;
+		return true;
+	}
+
+	case EVrmJsonToken::BeginObject:
+	{
+		if (Depth >= VrmJsonDom_MaxDepth)
+		{
+			Context.Error = TEXT("JSON nesting too deep");
+			return false;
+		}
+
+		const int32 Base = Context.MemberScratch.Num();
+		while (Reader.Next() == EVrmJsonToken::Key)
+		{
+			FVrmJsonMember Member;
+			Member.Key = InternKey(Context.ResolveString());
+
+			Reader.Next();
+			if (!ParseValue(Context, Member.Value, Depth + 1))
+			{
+				return false;
+			}
+			Context.MemberScratch.Add(Member);
+		}
+
+		if (Reader.GetToken() != EVrmJsonToken::EndObject)
+		{
+			return false;
+		}
+
+		const int32 Count = Context.MemberScratch.Num() - Base;
+		FVrmJsonMember* Members = nullptr;
+		if (Count > 0)
+		{
+			Members = static_cast<FVrmJsonMember*>(Allocate(sizeof(FVrmJsonMember) * Count, alignof(FVrmJsonMember)));
+			FMemory::Memcpy(Members, Context.MemberScratch.GetData() + Base, sizeof(FVrmJsonMember) * Count);
+		}
+		Context.MemberScratch.SetNum(Base, EAllowShrinking::No);
+
+		OutValue.Type = EVrmJsonType::Object;
+		OutValue.Count = Count;
+		OutValue.Members = Members;
+		return true;
+	}
+
+	default:
+		// EndOfInput / Error / stray container end
+		return false;
+	}
+}
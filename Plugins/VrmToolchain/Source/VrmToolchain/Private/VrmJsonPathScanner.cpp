@@ -0,0 +1,142 @@
+#include "VrmToolchain/VrmJsonPathScanner.h"
+#include "VrmToolchain/VrmJsonReader.h"
+
+int32 FVrmJsonPathScanner::AddPath(FAnsiStringView DottedPath)
+{
+	FPath& Path = Paths.AddDefaulted_GetRef();
+	Path.Text.Append(DottedPath.GetData(), DottedPath.Len());
+
+	int32 SegmentStart = 0;
+	for (int32 Index = 0; Index <= Path.Text.Num(); ++Index)
+	{
+		if (Index == Path.Text.Num() || Path.Text[Index] == '.')
+		{
+			Path.Segments.Emplace(SegmentStart, Index - SegmentStart);
+			SegmentStart = Index + 1;
+		}
+	}
+
+	return Paths.Num() - 1;
+}
+
+bool FVrmJsonPathScanner::ShouldStop() const
+{
+	return StopCondition ? StopCondition(*this) : NumFound == Paths.Num();
+}
+
+bool FVrmJsonPathScanner::Scan(TArrayView<const uint8> Utf8)
+{
+	Found.Init(false, Paths.Num());
+	Completed.Init(false, Paths.Num());
+	NumFound = 0;
+	bStoppedEarly = false;
+
+	FVrmJsonReader Reader(Utf8);
+	if (Reader.Next() != EVrmJsonToken::BeginObject)
+	{
+		return false;
+	}
+
+	TArray<int32, TInlineAllocator<16>> AllPaths;
+	for (int32 PathIndex = 0; PathIndex < Paths.Num(); ++PathIndex)
+	{
+		AllPaths.Add(PathIndex);
+	}
+
+	switch (ScanObject(Reader, 0, AllPaths))
+	{
+	case EScanResult::Stop:
+		return true;
+	case EScanResult::Error:
+		return false;
+	default:
+		return Reader.Next() == EVrmJsonToken::EndOfInput;
+	}
+}
+
+FVrmJsonPathScanner::EScanResult FVrmJsonPathScanner::ScanObject(FVrmJsonReader& Reader, int32 Depth, TConstArrayView<int32> Candidates)
+{
+	while (Reader.Next() == EVrmJsonToken::Key)
+	{
+		// Split the candidates on this key: paths ending here, and paths that continue below it
+		TArray<int32, TInlineAllocator<16>> EndingHere;
+		TArray<int32, TInlineAllocator<16>> Deeper;
+		for (const int32 PathIndex : Candidates)
+		{
+			const FPath& Path = Paths[PathIndex];
+			const TPair<int32, int32>& Segment = Path.Segments[Depth];
+			if (!Reader.KeyEquals(FAnsiStringView(Path.Text.GetData() + Segment.Key, Segment.Value)))
+			{
+				continue;
+			}
+
+			if (Path.Segments.Num() == Depth + 1)
+			{
+				if (!Found[PathIndex])
+				{
+					Found[PathIndex] = true;
+					++NumFound;
+				}
+				EndingHere.Add(PathIndex);
+			}
+			else
+			{
+				Deeper.Add(PathIndex);
+			}
+		}
+
+		if (EndingHere.Num() > 0 && ShouldStop())
+		{
+			bStoppedEarly = true;
+			return EScanResult::Stop;
+		}
+
+		if (EndingHere.Num() == 0 && Deeper.Num() == 0)
+		{
+			if (!Reader.SkipValue())
+			{
+				return EScanResult::Error;
+			}
+			continue;
+		}
+
+		const EVrmJsonToken ValueToken = Reader.Next();
+		if (ValueToken != EVrmJsonToken::BeginObject)
+		{
+			if (ValueToken == EVrmJsonToken::Error || !Reader.SkipValue())
+			{
+				return EScanResult::Error;
+			}
+			continue;
+		}
+
+		if (Deeper.Num() > 0)
+		{
+			const EScanResult Result = ScanObject(Reader, Depth + 1, Deeper);
+			if (Result != EScanResult::Continue)
+			{
+				return Result;
+			}
+		}
+		else if (!Reader.SkipValue())
+		{
+			return EScanResult::Error;
+		}
+
+		if (EndingHere.Num() > 0)
+		{
+			for (const int32 PathIndex : EndingHere)
+			{
+				Completed[PathIndex] = true;
+			}
+
+			if (ShouldStop())
+			{
+				bStoppedEarly = true;
+				return EScanResult::Stop;
+			}
+		}
+	}
+
+	return Reader.GetToken() == EVrmJsonToken::EndObject ? EScanResult::Continue : EScanResult::Error;
+}
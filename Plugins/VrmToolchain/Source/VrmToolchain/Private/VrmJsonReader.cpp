@@ -0,0 +1,515 @@
+#include "VrmToolchain/VrmJsonReader.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	FORCEINLINE bool IsJsonWhitespace(uint8 C)
+	{
+		return C == ' ' || C == '\t' || C == '\n' || C == '\r';
+	}
+
+	FORCEINLINE bool IsDigit(uint8 C)
+	{
+		return C >= '0' && C <= '9';
+	}
+
+	int32 ParseHex4(const UTF8CHAR* Chars)
+	{
+		int32 Value = 0;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			const uint8 C = static_cast<uint8>(Chars[Index]);
+			Value <<= 4;
+			if (C >= '0' && C <= '9') { Value |= C - '0'; }
+			else if (C >= 'a' && C <= 'f') { Value |= C - 'a' + 10; }
+			else if (C >= 'A' && C <= 'F') { Value |= C - 'A' + 10; }
+			else { return -1; }
+		}
+		return Value;
+	}
+
+	void AppendUtf8CodePoint(TArray<ANSICHAR>& Out, uint32 CodePoint)
+	{
+		if (CodePoint < 0x80)
+		{
+			Out.Add(static_cast<ANSICHAR>(CodePoint));
+		}
+		else if (CodePoint < 0x800)
+		{
+			Out.Add(static_cast<ANSICHAR>(0xC0 | (CodePoint >> 6)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			Out.Add(static_cast<ANSICHAR>(0xE0 | (CodePoint >> 12)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+		else
+		{
+			Out.Add(static_cast<ANSICHAR>(0xF0 | (CodePoint >> 18)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+}
+
+FVrmJsonReader::FVrmJsonReader(TArrayView<const uint8> InJson)
+	: Data(InJson.GetData())
+	, Size(InJson.Num())
+{
+	// Tolerate a UTF-8 byte order mark
+	if (Size >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+	{
+		Pos = 3;
+	}
+}
+
+EVrmJsonToken FVrmJsonReader::Fail(const TCHAR* Message)
+{
+	Error = FString::Printf(TEXT("%s at offset %lld"), Message, Pos);
+	Token = EVrmJsonToken::Error;
+	return Token;
+}
+
+void FVrmJsonReader::SkipWhitespace()
+{
+	while (Pos < Size && IsJsonWhitespace(Data[Pos]))
+	{
+		++Pos;
+	}
+}
+
+void FVrmJsonReader::CompleteValue()
+{
+	bNeedsSeparator = true;
+	if (ContainerStack.Num() == 0)
+	{
+		bRootDone = true;
+	}
+}
+
+EVrmJsonToken FVrmJsonReader::Next()
+{
+	if (Token == EVrmJsonToken::Error || Token == EVrmJsonToken::EndOfInput)
+	{
+		return Token;
+	}
+
+	SkipWhitespace();
+
+	if (bRootDone)
+	{
+		if (Pos < Size)
+		{
+			return Fail(TEXT("Unexpected data after root value"));
+		}
+		Token = EVrmJsonToken::EndOfInput;
+		return Token;
+	}
+
+	if (Pos >= Size)
+	{
+		return Fail(TEXT("Unexpected end of JSON"));
+	}
+
+	bool bAfterComma = false;
+	if (bNeedsSeparator && Data[Pos] == ',')
+	{
+		++Pos;
+		SkipWhitespace();
+		bNeedsSeparator = false;
+		bAfterComma = true;
+		if (Pos >= Size)
+		{
+			return Fail(TEXT("Unexpected end of JSON"));
+		}
+	}
+
+	uint8 C = Data[Pos];
+	TokenOffset = Pos;
+
+	// Container end
+	if (C == '}' || C == ']')
+	{
+		const uint8 Expected = (C == '}') ? '{' : '[';
+		if (ContainerStack.Num() == 0 || ContainerStack.Last() != Expected || bAfterComma || bAfterKey)
+		{
+			return Fail(TEXT("Unexpected container end"));
+		}
+		ContainerStack.Pop(EAllowShrinking::No);
+		++Pos;
+		TokenEndOffset = Pos;
+		Token = (C == '}') ? EVrmJsonToken::EndObject : EVrmJsonToken::EndArray;
+		CompleteValue();
+		return Token;
+	}
+
+	if (bNeedsSeparator)
+	{
+		return Fail(TEXT("Expected ',' or container end"));
+	}
+
+	// Object member key
+	if (ContainerStack.Num() > 0 && ContainerStack.Last() == '{' && !bAfterKey)
+	{
+		if (C != '"' || !ScanString())
+		{
+			return Token == EVrmJsonToken::Error ? Token : Fail(TEXT("Expected object key"));
+		}
+
+		TokenEndOffset = Pos;
+		SkipWhitespace();
+		if (Pos >= Size || Data[Pos] != ':')
+		{
+			return Fail(TEXT("Expected ':' after object key"));
+		}
+		++Pos;
+		bAfterKey = true;
+		Token = EVrmJsonToken::Key;
+		return Token;
+	}
+
+	// Value
+	bAfterKey = false;
+	switch (C)
+	{
+	case '{':
+	case '[':
+		ContainerStack.Add(C);
+		++Pos;
+		TokenEndOffset = Pos;
+		Token = (C == '{') ? EVrmJsonToken::BeginObject : EVrmJsonToken::BeginArray;
+		return Token;
+
+	case '"':
+		if (!ScanString())
+		{
+			return Token;
+		}
+		TokenEndOffset = Pos;
+		Token = EVrmJsonToken::String;
+		CompleteValue();
+		return Token;
+
+	case 't':
+		return ScanLiteral("true", EVrmJsonToken::True) ? Token : EVrmJsonToken::Error;
+
+	case 'f':
+		return ScanLiteral("false", EVrmJsonToken::False) ? Token : EVrmJsonToken::Error;
+
+	case 'n':
+		return ScanLiteral("null", EVrmJsonToken::Null) ? Token : EVrmJsonToken::Error;
+
+	default:
+		if (C == '-' || IsDigit(C))
+		{
+			if (!ScanNumber())
+			{
+				return Token;
+			}
+			TokenEndOffset = Pos;
+			Token = EVrmJsonToken::Number;
+			CompleteValue();
+			return Token;
+		}
+		return Fail(TEXT("Unexpected character"));
+	}
+}
+
+bool FVrmJsonReader::ScanString()
+{
+	// Data[Pos] is the opening quote
+	++Pos;
+	StringBegin = Pos;
+	bStringHasEscapes = false;
+
+	while (Pos < Size)
+	{
+		const uint8 C = Data[Pos];
+		if (C == '"')
+		{
+			StringEnd = Pos;
+			++Pos;
+			return true;
+		}
+		if (C == '\\')
+		{
+			bStringHasEscapes = true;
+			Pos += 2;
+			continue;
+		}
+		if (C < 0x20)
+		{
+			Fail(TEXT("Control character in string"));
+			return false;
+		}
+		++Pos;
+	}
+
+	Fail(TEXT("Unterminated string"));
+	return false;
+}
+
+bool FVrmJsonReader::ScanNumber()
+{
+	if (Data[Pos] == '-')
+	{
+		++Pos;
+	}
+
+	if (Pos >= Size || !IsDigit(Data[Pos]))
+	{
+		Fail(TEXT("Invalid number"));
+		return false;
+	}
+
+	if (Data[Pos] == '0')
+	{
+		++Pos;
+	}
+	else
+	{
+		while (Pos < Size && IsDigit(Data[Pos]))
+		{
+			++Pos;
+		}
+	}
+
+	if (Pos < Size && Data[Pos] == '.')
+	{
+		++Pos;
+		if (Pos >= Size || !IsDigit(Data[Pos]))
+		{
+			Fail(TEXT("Invalid number fraction"));
+			return false;
+		}
+		while (Pos < Size && IsDigit(Data[Pos]))
+		{
+			++Pos;
+		}
+	}
+
+	if (Pos < Size && (Data[Pos] == 'e' || Data[Pos] == 'E'))
+	{
+		++Pos;
+		if (Pos < Size && (Data[Pos] == '+' || Data[Pos] == '-'))
+		{
+			++Pos;
+		}
+		if (Pos >= Size || !IsDigit(Data[Pos]))
+		{
+			Fail(TEXT("Invalid number exponent"));
+			return false;
+		}
+		while (Pos < Size && IsDigit(Data[Pos]))
+		{
+			++Pos;
+		}
+	}
+
+	return true;
+}
+
+bool FVrmJsonReader::ScanLiteral(FAnsiStringView Literal, EVrmJsonToken LiteralToken)
+{
+	if (Size - Pos < Literal.Len() || FMemory::Memcmp(Data + Pos, Literal.GetData(), Literal.Len()) != 0)
+	{
+		Fail(TEXT("Invalid literal"));
+		return false;
+	}
+
+	Pos += Literal.Len();
+	TokenEndOffset = Pos;
+	Token = LiteralToken;
+	CompleteValue();
+	return true;
+}
+
+bool FVrmJsonReader::SkipValue()
+{
+	if (Token == EVrmJsonToken::Key)
+	{
+		Next();
+	}
+
+	if (Token != EVrmJsonToken::BeginObject && Token != EVrmJsonToken::BeginArray)
+	{
+		return Token != EVrmJsonToken::Error && Token != EVrmJsonToken::EndOfInput;
+	}
+
+	// Bracket counting over raw bytes; strings are stepped over so brackets inside them are ignored
+	int32 Depth = 1;
+	while (Pos < Size)
+	{
+		const uint8 C = Data[Pos++];
+		if (C == '"')
+		{
+			while (Pos < Size && Data[Pos] != '"')
+			{
+				Pos += (Data[Pos] == '\\') ? 2 : 1;
+			}
+			++Pos;
+		}
+		else if (C == '{' || C == '[')
+		{
+			++Depth;
+		}
+		else if (C == '}' || C == ']')
+		{
+			if (--Depth == 0)
+			{
+				ContainerStack.Pop(EAllowShrinking::No);
+				TokenOffset = Pos - 1;
+				TokenEndOffset = Pos;
+				Token = (C == '}') ? EVrmJsonToken::EndObject : EVrmJsonToken::EndArray;
+				CompleteValue();
+				return true;
+			}
+		}
+	}
+
+	Fail(TEXT("Unexpected end of JSON while skipping value"));
+	return false;
+}
+
+bool FVrmJsonReader::KeyEquals(FAnsiStringView AsciiKey) const
+{
+	return Token == EVrmJsonToken::Key && RawEquals(AsciiKey);
+}
+
+bool FVrmJsonReader::RawEquals(FAnsiStringView Ascii) const
+{
+	if (Token != EVrmJsonToken::Key && Token != EVrmJsonToken::String)
+	{
+		return false;
+	}
+
+	const int64 Length = StringEnd - StringBegin;
+	return !bStringHasEscapes
+		&& Length == Ascii.Len()
+		&& FMemory::Memcmp(Data + StringBegin, Ascii.GetData(), Length) == 0;
+}
+
+FUtf8StringView FVrmJsonReader::GetRawString() const
+{
+	if (Token != EVrmJsonToken::Key && Token != EVrmJsonToken::String)
+	{
+		return FUtf8StringView();
+	}
+	return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Data + StringBegin), static_cast<int32>(StringEnd - StringBegin));
+}
+
+FString FVrmJsonReader::GetString() const
+{
+	return DecodeString(GetRawString());
+}
+
+double FVrmJsonReader::GetNumber() const
+{
+	if (Token != EVrmJsonToken::Number)
+	{
+		return 0.0;
+	}
+
+	return ParseNumber(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Data + TokenOffset), static_cast<int32>(TokenEndOffset - TokenOffset)));
+}
+
+double FVrmJsonReader::ParseNumber(FUtf8StringView Raw)
+{
+	// Copy into a terminated buffer for the C runtime parser; numbers are short, but long ones must not be cut
+	TArray<ANSICHAR, TInlineAllocator<64>> Buffer;
+	Buffer.SetNumUninitialized(Raw.Len() + 1);
+	FMemory::Memcpy(Buffer.GetData(), Raw.GetData(), Raw.Len());
+	Buffer[Raw.Len()] = '\0';
+	return FCStringAnsi::Atod(Buffer.GetData());
+}
+
+void FVrmJsonReader::UnescapeString(FUtf8StringView Raw, TArray<ANSICHAR>& Utf8)
+{
+	const UTF8CHAR* Chars = Raw.GetData();
+	const int32 Length = Raw.Len();
+
+	Utf8.Reset(Length);
+
+	for (int32 Index = 0; Index < Length; ++Index)
+	{
+		const ANSICHAR C = static_cast<ANSICHAR>(Chars[Index]);
+		if (C != '\\' || Index + 1 >= Length)
+		{
+			Utf8.Add(C);
+			continue;
+		}
+
+		const ANSICHAR Escape = static_cast<ANSICHAR>(Chars[++Index]);
+		switch (Escape)
+		{
+		case '"': Utf8.Add('"'); break;
+		case '\\': Utf8.Add('\\'); break;
+		case '/': Utf8.Add('/'); break;
+		case 'b': Utf8.Add('\b'); break;
+		case 'f': Utf8.Add('\f'); break;
+		case 'n': Utf8.Add('\n'); break;
+		case 'r': Utf8.Add('\r'); break;
+		case 't': Utf8.Add('\t'); break;
+		case 'u':
+		{
+			if (Index + 4 >= Length)
+			{
+				break;
+			}
+			int32 CodePoint = ParseHex4(Chars + Index + 1);
+			Index += 4;
+			if (CodePoint < 0)
+			{
+				break;
+			}
+
+			// Combine UTF-16 surrogate pairs
+			if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Index + 6 < Length && Chars[Index + 1] == '\\' && Chars[Index + 2] == 'u')
+			{
+				const int32 Low = ParseHex4(Chars + Index + 3);
+				if (Low >= 0xDC00 && Low <= 0xDFFF)
+				{
+					CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+					Index += 6;
+				}
+			}
+			AppendUtf8CodePoint(Utf8, static_cast<uint32>(CodePoint));
+			break;
+		}
+		default:
+			Utf8.Add(Escape);
+			break;
+		}
+	}
+}
+
+FString FVrmJsonReader::DecodeString(FUtf8StringView Raw)
+{
+	TArray<ANSICHAR> Utf8;
+	UnescapeString(Raw, Utf8);
+
+	FUTF8ToTCHAR Converter(Utf8.GetData(), Utf8.Num());
+	return FString(Converter.Length(), Converter.Get());
+}
+
+namespace VrmJson
+{
+	bool DeserializeUtf8(TArrayView<const uint8> Utf8, TSharedPtr<FJsonObject>& OutRoot)
+	{
+		OutRoot.Reset();
+
+		const FUtf8StringView JsonView(reinterpret_cast<const UTF8CHAR*>(Utf8.GetData()), Utf8.Num());
+		TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(JsonView);
+		if (!FJsonSerializer::Deserialize(Reader, OutRoot) || !OutRoot.IsValid())
+		{
+			OutRoot.Reset();
+			return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,416 @@
+#include "VrmToolchain/VrmJsonReader.h"
+#include "VrmToolchain/VrmJsonPathScanner.h"
+#include "VrmToolchain/VrmJsonDom.h"
+#include "VrmToolchain/VrmJsonTape.h"
+#include "Misc/AutomationTest.h"
+#include "Dom/JsonObject.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Helper to view an ASCII/UTF-8 literal as JSON chunk bytes
+static TArrayView<const uint8> AsJsonBytes(const ANSICHAR* Utf8)
+{
+	return TArrayView<const uint8>(reinterpret_cast<const uint8*>(Utf8), FCStringAnsi::Strlen(Utf8));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonReaderTokensTest, "VrmToolchain.Json.Reader.Tokens", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonReaderTokensTest::RunTest(const FString& Parameters)
+{
+	FVrmJsonReader Reader(AsJsonBytes(R"({"a":[1,-2.5e1,true,false,null],"b":"x"})"));
+
+	const EVrmJsonToken Expected[] =
+	{
+		EVrmJsonToken::BeginObject,
+		EVrmJsonToken::Key, EVrmJsonToken::BeginArray,
+		EVrmJsonToken::Number, EVrmJsonToken::Number, EVrmJsonToken::True, EVrmJsonToken::False, EVrmJsonToken::Null,
+		EVrmJsonToken::EndArray,
+		EVrmJsonToken::Key, EVrmJsonToken::String,
+		EVrmJsonToken::EndObject,
+		EVrmJsonToken::EndOfInput
+	};
+
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Expected); ++Index)
+	{
+		const EVrmJsonToken Token = Reader.Next();
+		TestEqual(FString::Printf(TEXT("Token %d"), Index), static_cast<int32>(Token), static_cast<int32>(Expected[Index]));
+		if (Index == 4)
+		{
+			TestEqual(TEXT("Exponent number value"), Reader.GetNumber(), -25.0);
+		}
+	}
+
+	// 100 spelled with more digits than a fixed parse buffer would hold is read whole
+	const FString LongJson = TEXT("[0.") + FString::ChrN(65, TEXT('0')) + TEXT("1e68]");
+	const FTCHARToUTF8 LongUtf8(*LongJson);
+	FVrmJsonReader LongReader(TArrayView<const uint8>(reinterpret_cast<const uint8*>(LongUtf8.Get()), LongUtf8.Length()));
+	LongReader.Next();
+	TestTrue(TEXT("Long number token"), LongReader.Next() == EVrmJsonToken::Number);
+	TestEqual(TEXT("Long number value"), LongReader.GetNumber(), 100.0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonReaderSkipTest, "VrmToolchain.Json.Reader.SkipAndKeys", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonReaderSkipTest::RunTest(const FString& Parameters)
+{
+	FVrmJsonReader Reader(AsJsonBytes(R"({"accessors":[{"name":"}]\"{"},[[]]],"asset":{"version":"2.0"}})"));
+
+	FString Version;
+	const bool bValid = Reader.ForEachMember([&]()
+	{
+		if (!Reader.KeyEquals("asset"))
+		{
+			return false;
+		}
+
+		Reader.ForEachMember([&]()
+		{
+			if (Reader.KeyEquals("version") && Reader.Next() == EVrmJsonToken::String)
+			{
+				Version = Reader.GetString();
+				return true;
+			}
+			return false;
+		});
+		return true;
+	});
+
+	TestTrue(TEXT("Object walk should succeed"), bValid);
+	TestEqual(TEXT("Nested value after skipped subtree"), Version, FString(TEXT("2.0")));
+	TestEqual(TEXT("Root is complete"), static_cast<int32>(Reader.Next()), static_cast<int32>(EVrmJsonToken::EndOfInput));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonReaderStringsTest, "VrmToolchain.Json.Reader.Strings", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonReaderStringsTest::RunTest(const FString& Parameters)
+{
+	// UTF-8 multibyte text, escapes and a surrogate pair
+	FVrmJsonReader Reader(AsJsonBytes("[\"\xE3\x81\x82\", \"a\\n\\\"b\\u00e9\\ud83d\\ude00\"]"));
+
+	Reader.Next();
+	TestEqual(TEXT("String token"), static_cast<int32>(Reader.Next()), static_cast<int32>(EVrmJsonToken::String));
+	TestEqual(TEXT("UTF-8 string decodes"), Reader.GetString(), FString(TEXT("\u3042")));
+
+	Reader.Next();
+	const FString Decoded = Reader.GetString();
+	TestTrue(TEXT("Escapes decode"), Decoded.StartsWith(TEXT("a\n\"b\u00e9")));
+	TestFalse(TEXT("Escaped strings never match raw ASCII keys"), Reader.RawEquals("a"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonReaderMalformedTest, "VrmToolchain.Json.Reader.Malformed", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonReaderMalformedTest::RunTest(const FString& Parameters)
+{
+	const ANSICHAR* Cases[] =
+	{
+		R"({"a":1,})",
+		R"({"a" 1})",
+		R"([1 2])",
+		R"({"a":[1,2})",
+		R"({"a":"unterminated)",
+		R"({} {})",
+		R"({"a":tru})"
+	};
+
+	for (const ANSICHAR* Case : Cases)
+	{
+		FVrmJsonReader Reader(AsJsonBytes(Case));
+		EVrmJsonToken Token = EVrmJsonToken::None;
+		do
+		{
+			Token = Reader.Next();
+		}
+		while (Token != EVrmJsonToken::Error && Token != EVrmJsonToken::EndOfInput);
+
+		TestEqual(FString::Printf(TEXT("Malformed input should fail: %s"), ANSI_TO_TCHAR(Case)), static_cast<int32>(Token), static_cast<int32>(EVrmJsonToken::Error));
+		TestFalse(TEXT("Error message should be set"), Reader.GetError().IsEmpty());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonDeserializeUtf8Test, "VrmToolchain.Json.DeserializeUtf8", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonDeserializeUtf8Test::RunTest(const FString& Parameters)
+{
+	TSharedPtr<FJsonObject> Root;
+	TestTrue(TEXT("UTF-8 JSON should parse"), VrmJson::DeserializeUtf8(AsJsonBytes("{\"name\":\"\xE3\x81\x82\"}"), Root));
+	TestEqual(TEXT("UTF-8 value survives"), Root.IsValid() ? Root->GetStringField(TEXT("name")) : FString(), FString(TEXT("\u3042")));
+
+	TestFalse(TEXT("Invalid JSON should fail"), VrmJson::DeserializeUtf8(AsJsonBytes("{"), Root));
+	TestFalse(TEXT("Root is reset on failure"), Root.IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonPathScannerTest, "VrmToolchain.Json.PathScanner", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonPathScannerTest::RunTest(const FString& Parameters)
+{
+	const TArrayView<const uint8> Json = AsJsonBytes(R"({"accessors":[{"extensions":{"VRM":{}}}],"extensions":{"VRM":{"humanoid":{}},"other":1},"thumbnail":"x"})");
+
+	FVrmJsonPathScanner Scanner;
+	const int32 Extensions = Scanner.AddPath("extensions");
+	const int32 Vrm = Scanner.AddPath("extensions.VRM");
+	const int32 Humanoid = Scanner.AddPath("extensions.VRM.humanoid");
+	const int32 Missing = Scanner.AddPath("extensions.VRMC_vrm");
+	const int32 Thumbnail = Scanner.AddPath("thumbnail");
+
+	TestTrue(TEXT("Scan should succeed"), Scanner.Scan(Json));
+	TestTrue(TEXT("extensions found"), Scanner.WasFound(Extensions));
+	TestTrue(TEXT("extensions completed"), Scanner.WasCompleted(Extensions));
+	TestTrue(TEXT("extensions.VRM found"), Scanner.WasFound(Vrm));
+	TestTrue(TEXT("extensions.VRM.humanoid found"), Scanner.WasFound(Humanoid));
+	TestFalse(TEXT("extensions.VRMC_vrm not found"), Scanner.WasFound(Missing));
+	TestTrue(TEXT("Scalar member found"), Scanner.WasFound(Thumbnail));
+	TestFalse(TEXT("Scalar member is never completed"), Scanner.WasCompleted(Thumbnail));
+	TestFalse(TEXT("Full scan when a path is missing"), Scanner.StoppedEarly());
+
+	// Early stop: the malformed tail is never reached
+	Scanner.SetStopCondition([Extensions](const FVrmJsonPathScanner& State) { return State.WasCompleted(Extensions); });
+	TestTrue(TEXT("Early stop should succeed"), Scanner.Scan(AsJsonBytes(R"({"extensions":{"VRM":{}},"accessors":[)")));
+	TestTrue(TEXT("Scan stopped early"), Scanner.StoppedEarly());
+	TestTrue(TEXT("Path before stop found"), Scanner.WasFound(Vrm));
+
+	// Malformed before the answer is known
+	TestFalse(TEXT("Malformed JSON should fail"), Scanner.Scan(AsJsonBytes(R"({"accessors":[)")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonDomParseTest, "VrmToolchain.Json.Dom.Parse", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonDomParseTest::RunTest(const FString& Parameters)
+{
+	FVrmJsonDom Dom;
+	FString Error;
+	const bool bParsed = Dom.Parse(AsJsonBytes("{\"nodes\":[{\"name\":\"hips\",\"children\":[1,2]},{\"name\":\"a\\n\\u00e9\"},{}],"
+		"\"asset\":{\"version\":\"2.0\"},\"flag\":true,\"none\":null,\"scale\":-2.5e1,\"empty\":[]}"), Error);
+
+	TestTrue(TEXT("Valid JSON should parse"), bParsed);
+	TestTrue(TEXT("Error is empty on success"), Error.IsEmpty());
+
+	const FVrmJsonValue& Root = Dom.GetRoot();
+	TestTrue(TEXT("Root is an object"), Root.IsObject());
+	TestEqual(TEXT("Members keep document order"), Root.GetMembers().Num() > 0 ? FString(Root.GetMembers()[0].Key->View()) : FString(), FString(TEXT("nodes")));
+
+	const TConstArrayView<FVrmJsonValue> Nodes = Root.FindArray("nodes");
+	TestEqual(TEXT("Array elements are contiguous"), Nodes.Num(), 3);
+	if (Nodes.Num() == 3)
+	{
+		TestEqual(TEXT("String member"), Nodes[0].Find("name") ? Nodes[0].Find("name")->AsString() : FString(), FString(TEXT("hips")));
+		TestEqual(TEXT("Nested array"), Nodes[0].FindArray("children").Num(), 2);
+		TestEqual(TEXT("Escaped string decodes"), Nodes[1].Find("name") ? Nodes[1].Find("name")->AsString() : FString(), FString(TEXT("a\n\u00e9")));
+		TestTrue(TEXT("Empty object"), Nodes[2].IsObject() && Nodes[2].GetMembers().Num() == 0);
+	}
+
+	FString Version;
+	TestTrue(TEXT("Nested string lookup"), Root.FindObject("asset") && Root.FindObject("asset")->TryGetString("version", Version));
+	TestEqual(TEXT("Nested string value"), Version, FString(TEXT("2.0")));
+
+	double Scale = 0.0;
+	TestTrue(TEXT("Number lookup"), Root.TryGetNumber("scale", Scale));
+	TestEqual(TEXT("Number value"), Scale, -25.0);
+	TestTrue(TEXT("Boolean value"), Root.Find("flag") && Root.Find("flag")->AsBool());
+	TestTrue(TEXT("Null value"), Root.Find("none") && Root.Find("none")->IsNull());
+	TestTrue(TEXT("Empty array"), Root.Find("empty") && Root.Find("empty")->IsArray() && Root.FindArray("empty").Num() == 0);
+
+	// Wrong-type and missing lookups return defaults instead of asserting
+	TestNull(TEXT("Missing key"), Root.Find("missing"));
+	TestNull(TEXT("Object lookup on a string"), Root.FindObject("flag"));
+	TestNull(TEXT("Member lookup on an array"), Root.Find("nodes")->Find("name"));
+	TestNull(TEXT("Out of range element"), Root.Find("nodes")->At(3));
+	TestEqual(TEXT("Int default on non-number"), Root.Find("asset")->AsInt(), static_cast<int32>(INDEX_NONE));
+
+	// Keys are interned once per document and resolve to the same pointer everywhere
+	const FVrmJsonKey* NameKey = Dom.FindKey("name");
+	TestNotNull(TEXT("Interned key exists"), NameKey);
+	TestTrue(TEXT("Lookup by interned key"), Nodes.Num() == 3 && Nodes[0].Find(NameKey) == Nodes[0].Find("name"));
+	TestNull(TEXT("Unknown key is not interned"), Dom.FindKey("skins"));
+	TestTrue(TEXT("Arena holds the document"), Dom.GetAllocatedSize() > 0);
+
+	// Moving transfers ownership of the arena
+	FVrmJsonDom Moved = MoveTemp(Dom);
+	TestTrue(TEXT("Moved root stays valid"), Moved.GetRoot().FindArray("nodes").Num() == 3);
+	TestTrue(TEXT("Moved-from DOM is empty"), Dom.GetRoot().IsNull() && Dom.GetAllocatedSize() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonDomIntegersTest, "VrmToolchain.Json.Dom.Integers", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonDomIntegersTest::RunTest(const FString& Parameters)
+{
+	FVrmJsonDom Dom;
+	FString Error;
+	TestTrue(TEXT("Integer document parses"), Dom.Parse(AsJsonBytes(R"({"max":2147483647,"min":-2147483648,"whole":4.0,)"
+		R"("fraction":2.5,"over":3e9,"under":-3e9,"huge":1e300})"), Error));
+
+	const FVrmJsonValue& Root = Dom.GetRoot();
+	int32 Value = 0;
+	TestTrue(TEXT("Largest int32"), Root.TryGetInt("max", Value) && Value == MAX_int32);
+	TestTrue(TEXT("Smallest int32"), Root.TryGetInt("min", Value) && Value == MIN_int32);
+	TestTrue(TEXT("Integral number written with a decimal point"), Root.TryGetInt("whole", Value) && Value == 4);
+
+	// Fractions and out-of-range numbers are not truncated or wrapped
+	for (const ANSICHAR* Key : { "fraction", "over", "under", "huge" })
+	{
+		TestFalse(FString::Printf(TEXT("TryGetInt rejects '%hs'"), Key), Root.TryGetInt(Key, Value));
+		TestEqual(FString::Printf(TEXT("AsInt defaults for '%hs'"), Key), Root.Find(Key) ? Root.Find(Key)->AsInt() : 0, static_cast<int32>(INDEX_NONE));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonDomMalformedTest, "VrmToolchain.Json.Dom.Malformed", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonDomMalformedTest::RunTest(const FString& Parameters)
+{
+	const ANSICHAR* Cases[] =
+	{
+		R"({"a":1,})",
+		R"({"a":[1,2})",
+		R"({} {})",
+		R"([1,)",
+		""
+	};
+
+	for (const ANSICHAR* Case : Cases)
+	{
+		FVrmJsonDom Dom;
+		FString Error;
+		TestFalse(FString::Printf(TEXT("Malformed input should fail: %s"), ANSI_TO_TCHAR(Case)), Dom.Parse(AsJsonBytes(Case), Error));
+		TestFalse(TEXT("Error message should be set"), Error.IsEmpty());
+		TestTrue(TEXT("Root is reset on failure"), Dom.GetRoot().IsNull());
+	}
+
+	// Nesting beyond the depth limit is rejected instead of exhausting the stack
+	TArray<ANSICHAR> Deep;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		Deep.Add('[');
+	}
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		Deep.Add(']');
+	}
+	FVrmJsonDom Dom;
+	FString Error;
+	TestFalse(TEXT("Excessive nesting should fail"), Dom.Parse(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Deep.GetData()), Deep.Num()), Error));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonTapeTest, "VrmToolchain.Json.Tape", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonTapeTest::RunTest(const FString& Parameters)
+{
+	// Large subtrees before the wanted members exercise the container skip jumps
+	const ANSICHAR* Json = "{\"accessors\":[{\"count\":3,\"min\":[0,0,0]},[[[]]],{}],\"nodes\":[{\"name\":\"hips\",\"children\":[1,2]},{\"name\":\"a\\n\\u00e9\"},{}],"
+		"\"ext\\u0065nsions\":{\"VRM\":{\"meta\":{\"title\":\"T\"}}},\"flag\":true,\"off\":false,\"none\":null,\"scale\":-2.5e1,\"empty\":[]}";
+
+	FVrmJsonTape Tape;
+	FString Error;
+	TestFalse(TEXT("Invalid before a build"), Tape.GetRoot().IsValid());
+	TestTrue(TEXT("Valid JSON should index"), Tape.Build(AsJsonBytes(Json), Error));
+	TestTrue(TEXT("Error is empty on success"), Error.IsEmpty());
+
+	const FVrmJsonTapeValue Root = Tape.GetRoot();
+	TestTrue(TEXT("Root is an object"), Root.IsObject());
+	TestEqual(TEXT("Member count"), Root.Num(), 8);
+
+	int32 NodeCount = 0;
+	for (const FVrmJsonTapeValue Node : Root.FindArray("nodes"))
+	{
+		TestTrue(TEXT("Array elements are objects"), Node.IsObject());
+		++NodeCount;
+	}
+	TestEqual(TEXT("Array iteration skips nested containers"), NodeCount, 3);
+	TestEqual(TEXT("Skipped subtree does not affect later lookups"), Root.Find("accessors").Num(), 3);
+
+	const FVrmJsonTapeValue Nodes = Root.Find("nodes");
+	TestEqual(TEXT("String member"), Nodes.At(0).Find("name").AsString(), FString(TEXT("hips")));
+	TestEqual(TEXT("Nested array"), Nodes.At(0).Find("children").Num(), 2);
+	TestEqual(TEXT("Nested number"), Nodes.At(0).Find("children").At(1).AsInt(), 2);
+	TestEqual(TEXT("Escaped string decodes"), Nodes.At(1).Find("name").AsString(), FString(TEXT("a\n\u00e9")));
+	TestTrue(TEXT("Empty object"), Nodes.At(2).IsObject() && Nodes.At(2).Num() == 0);
+
+	FString Title;
+	TestTrue(TEXT("Escaped key matches"), Root.FindObject("extensions").FindObject("VRM").FindObject("meta").TryGetString("title", Title));
+	TestEqual(TEXT("Nested string value"), Title, FString(TEXT("T")));
+
+	double Scale = 0.0;
+	TestTrue(TEXT("Number lookup"), Root.TryGetNumber("scale", Scale));
+	TestEqual(TEXT("Number value"), Scale, -25.0);
+	TestTrue(TEXT("True value"), Root.Find("flag").AsBool());
+	TestFalse(TEXT("False value"), Root.Find("off").AsBool(true));
+	TestTrue(TEXT("Null value"), Root.Find("none").IsNull());
+	TestTrue(TEXT("Empty array"), Root.Find("empty").IsArray() && Root.Find("empty").Num() == 0);
+
+	// Wrong-type and missing lookups return invalid handles that chain safely
+	TestFalse(TEXT("Missing key"), Root.Find("missing").IsValid());
+	TestFalse(TEXT("Chained lookup on a missing key"), Root.Find("missing").Find("deeper").At(0).IsValid());
+	TestFalse(TEXT("Object lookup on a boolean"), Root.FindObject("flag").IsValid());
+	TestFalse(TEXT("Member lookup on an array"), Nodes.Find("name").IsValid());
+	TestFalse(TEXT("Out of range element"), Nodes.At(3).IsValid());
+	TestEqual(TEXT("Int default on non-number"), Root.Find("flag").AsInt(), static_cast<int32>(INDEX_NONE));
+	TestTrue(TEXT("String default on non-string"), Root.Find("scale").AsString().IsEmpty());
+
+	// One 8-byte entry per token, no per-node strings
+	TestTrue(TEXT("Tape has one entry per token"), Tape.Num() > 0 && Tape.GetAllocatedSize() >= Tape.Num() * 8);
+
+	const ANSICHAR* Malformed[] =
+	{
+		R"({"a":1,})",
+		R"({"a":[1,2})",
+		R"({} {})",
+		""
+	};
+	for (const ANSICHAR* Case : Malformed)
+	{
+		FVrmJsonTape BadTape;
+		FString BadError;
+		TestFalse(FString::Printf(TEXT("Malformed input should fail: %s"), ANSI_TO_TCHAR(Case)), BadTape.Build(AsJsonBytes(Case), BadError));
+		TestFalse(TEXT("Error message should be set"), BadError.IsEmpty());
+		TestFalse(TEXT("Tape is reset on failure"), BadTape.GetRoot().IsValid());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmJsonTapeIntegersTest, "VrmToolchain.Json.Tape.Integers", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmJsonTapeIntegersTest::RunTest(const FString& Parameters)
+{
+	// "long" is 100 spelled with more digits than a fixed parse buffer would hold
+	const FString LongNumber = TEXT("0.") + FString::ChrN(65, TEXT('0')) + TEXT("1e68");
+	const FString Json = FString::Printf(TEXT("{\"max\":2147483647,\"min\":-2147483648,\"long\":%s,\"fraction\":2.5,\"over\":3e9,\"under\":-3e9,\"huge\":1e300}"), *LongNumber);
+	const FTCHARToUTF8 Utf8(*Json);
+
+	FVrmJsonTape Tape;
+	FString Error;
+	TestTrue(TEXT("Integer document indexes"), Tape.Build(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()), Error));
+
+	const FVrmJsonTapeValue Root = Tape.GetRoot();
+	int32 Value = 0;
+	TestTrue(TEXT("Largest int32"), Root.TryGetInt("max", Value) && Value == MAX_int32);
+	TestTrue(TEXT("Smallest int32"), Root.TryGetInt("min", Value) && Value == MIN_int32);
+	TestEqual(TEXT("Long number is parsed whole"), Root.Find("long").AsInt(), 100);
+
+	// Fractions and out-of-range numbers are not truncated or wrapped
+	for (const ANSICHAR* Key : { "fraction", "over", "under", "huge" })
+	{
+		TestFalse(FString::Printf(TEXT("TryGetInt rejects '%hs'"), Key), Root.TryGetInt(Key, Value));
+		TestEqual(FString::Printf(TEXT("AsInt defaults for '%hs'"), Key), Root.Find(Key).AsInt(), static_cast<int32>(INDEX_NONE));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
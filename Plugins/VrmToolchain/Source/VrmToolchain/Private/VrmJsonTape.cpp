@@ -0,0 +1,244 @@
+#include "VrmToolchain/VrmJsonTape.h"
+#include "VrmToolchain/VrmJsonReader.h"
+
+// ---------------------------------------------------------------------------
+// FVrmJsonTape
+
+void FVrmJsonTape::Reset()
+{
+	Json = TArrayView<const uint8>();
+	Entries.Reset();
+}
+
+bool FVrmJsonTape::Build(TArrayView<const uint8> Utf8, FString& OutError)
+{
+	Reset();
+	OutError.Reset();
+
+	// Offsets and lengths are stored as 32 bits with the top payload bit reserved; an int32-sized view always fits
+	static_assert(sizeof(TArrayView<const uint8>::SizeType) <= sizeof(int32), "Tape offsets cannot hold 64-bit JSON sizes");
+
+	// Rough token density of glTF JSON; avoids most regrowth on large chunks
+	Entries.Reserve(Utf8.Num() / 8);
+
+	TArray<int32, TInlineAllocator<64>> OpenContainers;
+	FVrmJsonReader Reader(Utf8);
+
+	for (EVrmJsonToken Token = Reader.Next(); Token != EVrmJsonToken::EndOfInput; Token = Reader.Next())
+	{
+		switch (Token)
+		{
+		case EVrmJsonToken::BeginObject:
+		case EVrmJsonToken::BeginArray:
+			OpenContainers.Add(Entries.Num());
+			Entries.Add({ static_cast<uint32>(Reader.GetTokenOffset()), 0 });
+			break;
+
+		case EVrmJsonToken::EndObject:
+		case EVrmJsonToken::EndArray:
+			Entries[OpenContainers.Pop(EAllowShrinking::No)].Payload = static_cast<uint32>(Entries.Num());
+			break;
+
+		case EVrmJsonToken::Error:
+			OutError = Reader.GetError();
+			Reset();
+			return false;
+
+		default:
+		{
+			uint32 Payload = static_cast<uint32>(Reader.GetTokenEndOffset() - Reader.GetTokenOffset());
+			if ((Token == EVrmJsonToken::Key || Token == EVrmJsonToken::String) && Reader.HasEscapes())
+			{
+				Payload |= EscapeFlag;
+			}
+			Entries.Add({ static_cast<uint32>(Reader.GetTokenOffset()), Payload });
+			break;
+		}
+		}
+	}
+
+	Json = Utf8;
+	return true;
+}
+
+int32 FVrmJsonTape::NextIndex(int32 Index) const
+{
+	const uint8 First = Json[Entries[Index].Offset];
+	return (First == '{' || First == '[') ? static_cast<int32>(Entries[Index].Payload) : Index + 1;
+}
+
+// ---------------------------------------------------------------------------
+// FVrmJsonTapeValue
+
+FVrmJsonTapeValue::FIterator& FVrmJsonTapeValue::FIterator::operator++()
+{
+	Index = Tape->NextIndex(bObjectValues ? Index + 1 : Index);
+	return *this;
+}
+
+uint8 FVrmJsonTapeValue::FirstByte() const
+{
+	return Tape ? Tape->Json[Tape->Entries[Index].Offset] : 0;
+}
+
+bool FVrmJsonTapeValue::IsNumber() const
+{
+	const uint8 First = FirstByte();
+	return First == '-' || (First >= '0' && First <= '9');
+}
+
+FUtf8StringView FVrmJsonTapeValue::GetRawString() const
+{
+	if (!IsString())
+	{
+		return FUtf8StringView();
+	}
+
+	// Strip the quotes
+	const FVrmJsonTape::FEntry& Entry = Tape->Entries[Index];
+	const int32 Length = static_cast<int32>(Entry.Payload & ~FVrmJsonTape::EscapeFlag);
+	return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Tape->Json.GetData() + Entry.Offset + 1), Length - 2);
+}
+
+bool FVrmJsonTapeValue::RawEquals(FAnsiStringView Ascii) const
+{
+	const FUtf8StringView Raw = GetRawString();
+	if ((Tape->Entries[Index].Payload & FVrmJsonTape::EscapeFlag) == 0)
+	{
+		return Raw.Len() == Ascii.Len() && FMemory::Memcmp(Raw.GetData(), Ascii.GetData(), Ascii.Len()) == 0;
+	}
+
+	TArray<ANSICHAR> Unescaped;
+	FVrmJsonReader::UnescapeString(Raw, Unescaped);
+	return Unescaped.Num() == Ascii.Len() && FMemory::Memcmp(Unescaped.GetData(), Ascii.GetData(), Ascii.Len()) == 0;
+}
+
+double FVrmJsonTapeValue::AsNumber(double Default) const
+{
+	if (!IsNumber())
+	{
+		return Default;
+	}
+
+	const FVrmJsonTape::FEntry& Entry = Tape->Entries[Index];
+	return FVrmJsonReader::ParseNumber(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Tape->Json.GetData() + Entry.Offset), static_cast<int32>(Entry.Payload)));
+}
+
+int32 FVrmJsonTapeValue::AsInt(int32 Default) const
+{
+	int32 Value = Default;
+	return IsNumber() && VrmJson::TryConvertToInt32(AsNumber(), Value) ? Value : Default;
+}
+
+bool FVrmJsonTapeValue::AsBool(bool bDefault) const
+{
+	const uint8 First = FirstByte();
+	return First == 't' ? true : First == 'f' ? false : bDefault;
+}
+
+FString FVrmJsonTapeValue::AsString() const
+{
+	return IsString() ? FVrmJsonReader::DecodeString(GetRawString()) : FString();
+}
+
+bool FVrmJsonTapeValue::StringEquals(FAnsiStringView Ascii) const
+{
+	return IsString() && RawEquals(Ascii);
+}
+
+int32 FVrmJsonTapeValue::Num() const
+{
+	if (!IsObject() && !IsArray())
+	{
+		return 0;
+	}
+
+	const bool bObject = IsObject();
+	const int32 End = static_cast<int32>(Tape->Entries[Index].Payload);
+	int32 Count = 0;
+	for (int32 Child = Index + 1; Child < End; Child = Tape->NextIndex(bObject ? Child + 1 : Child))
+	{
+		++Count;
+	}
+	return Count;
+}
+
+FVrmJsonTapeValue FVrmJsonTapeValue::Find(FAnsiStringView Key) const
+{
+	if (!IsObject())
+	{
+		return FVrmJsonTapeValue();
+	}
+
+	// Members are key/value pairs; each step jumps over the value's whole subtree
+	const int32 End = static_cast<int32>(Tape->Entries[Index].Payload);
+	for (int32 KeyIndex = Index + 1; KeyIndex < End; KeyIndex = Tape->NextIndex(KeyIndex + 1))
+	{
+		if (FVrmJsonTapeValue(Tape, KeyIndex).RawEquals(Key))
+		{
+			return FVrmJsonTapeValue(Tape, KeyIndex + 1);
+		}
+	}
+	return FVrmJsonTapeValue();
+}
+
+FVrmJsonTapeValue FVrmJsonTapeValue::At(int32 ElementIndex) const
+{
+	if (!IsArray() || ElementIndex < 0)
+	{
+		return FVrmJsonTapeValue();
+	}
+
+	const int32 End = static_cast<int32>(Tape->Entries[Index].Payload);
+	int32 Child = Index + 1;
+	for (int32 Skipped = 0; Skipped < ElementIndex && Child < End; ++Skipped)
+	{
+		Child = Tape->NextIndex(Child);
+	}
+	return Child < End ? FVrmJsonTapeValue(Tape, Child) : FVrmJsonTapeValue();
+}
+
+FVrmJsonTapeValue FVrmJsonTapeValue::FindObject(FAnsiStringView Key) const
+{
+	const FVrmJsonTapeValue Value = Find(Key);
+	return Value.IsObject() ? Value : FVrmJsonTapeValue();
+}
+
+FVrmJsonTapeValue::FRange FVrmJsonTapeValue::AsArray() const
+{
+	if (!IsArray())
+	{
+		return FRange{ FIterator(nullptr, 0, false), FIterator(nullptr, 0, false) };
+	}
+
+	const int32 End = static_cast<int32>(Tape->Entries[Index].Payload);
+	return FRange{ FIterator(Tape, Index + 1, false), FIterator(Tape, End, false) };
+}
+
+bool FVrmJsonTapeValue::TryGetNumber(FAnsiStringView Key, double& OutValue) const
+{
+	const FVrmJsonTapeValue Value = Find(Key);
+	if (!Value.IsNumber())
+	{
+		return false;
+	}
+	OutValue = Value.AsNumber();
+	return true;
+}
+
+bool FVrmJsonTapeValue::TryGetInt(FAnsiStringView Key, int32& OutValue) const
+{
+	double Number = 0.0;
+	return TryGetNumber(Key, Number) && VrmJson::TryConvertToInt32(Number, OutValue);
+}
+
+bool FVrmJsonTapeValue::TryGetString(FAnsiStringView Key, FString& OutValue) const
+{
+	const FVrmJsonTapeValue Value = Find(Key);
+	if (!Value.IsString())
+	{
+		return false;
+	}
+	OutValue = Value.AsString();
+	return true;
+}
@@ -0,0 +1,53 @@
+#include "VrmToolchain/VrmMappedFile.h"
+#include "VrmToolchain.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+FVrmMappedFile::~FVrmMappedFile()
+{
+	// Release the region before the handle that owns the mapping
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+TUniquePtr<FVrmMappedFile> FVrmMappedFile::Open(const FString& FilePath, FString& OutError, bool bAllowMapping)
+{
+	OutError.Reset();
+
+	TUniquePtr<FVrmMappedFile> File(new FVrmMappedFile());
+	File->FilePath = FilePath;
+
+	if (bAllowMapping)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*FilePath);
+		if (MappedResult.HasValue())
+		{
+			TUniquePtr<IMappedFileHandle> Handle = MappedResult.StealValue();
+			const int64 FileSize = Handle->GetFileSize();
+			if (FileSize > 0 && FileSize <= MAX_int32)
+			{
+				IMappedFileRegion* Region = Handle->MapRegion(0, FileSize);
+				if (Region)
+				{
+					File->MappedHandle = MoveTemp(Handle);
+					File->MappedRegion.Reset(Region);
+					File->View = TArrayView<const uint8>(File->MappedRegion->GetMappedPtr(), static_cast<int32>(File->MappedRegion->GetMappedSize()));
+					return File;
+				}
+			}
+		}
+
+		UE_LOG(LogVrmToolchain, Verbose, TEXT("Memory mapping unavailable for %s; falling back to buffered read"), *FilePath);
+	}
+
+	if (!FFileHelper::LoadFileToArray(File->BufferedBytes, *FilePath))
+	{
+		OutError = FString::Printf(TEXT("Failed to read file: %s"), *FilePath);
+		return nullptr;
+	}
+
+	File->View = File->BufferedBytes;
+	return File;
+}
@@ -1,22 +1,15 @@
 #include "VrmToolchain/VrmMetadata.h"
+#include "VrmToolchain/VrmGlbDocument.h"
+#include "VrmToolchain/VrmGlbContainer.h"
+#include "VrmToolchain/VrmMappedFile.h"
+#include "VrmToolchain/VrmJsonDom.h"
+#include "VrmToolchain/VrmJsonTape.h"
+#include "VrmToolchain/VrmJsonPathScanner.h"
 #include "VrmToolchain.h"
-#include "Misc/FileHelper.h"
+#include "HAL/PlatformFileManager.h"
 #include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
 
-// GLB file format constants
-static const uint32 Test_GLB_MAGIC = 0x46546C67; // "glTF" in little-endian
-static const uint32 GLB_VERSION_2 = 2;
-static const uint32 Test_GLB_CHUNK_TYPE_JSON = 0x4E4F534A; // "JSON" in little-endian
-// GLB_CHUNK_TYPE_BIN not used in current implementation (0x004E4942) but defined for completeness
-
-struct FGlbHeader
-{
-	uint32 Magic;
-	uint32 Version;
-	uint32 Length;
-};
-
 struct FGlbChunkHeader
 {
 	uint32 Length;
@@ -25,242 +18,112 @@ struct FGlbChunkHeader
 
 bool FVrmParser::ReadGlbJsonChunkFromMemory(const uint8* Data, int64 DataSize, FString& OutJsonString)
 {
-	if (!Data || DataSize < sizeof(FGlbHeader))
-	{
-		UE_LOG(LogVrmToolchain, Warning, TEXT("Invalid GLB data: insufficient size for header"));
-		return false;
-	}
-
-	// Read and validate GLB header
-	const FGlbHeader* Header = reinterpret_cast<const FGlbHeader*>(Data);
-	if (Header->Magic != Test_GLB_MAGIC)
-	{
-		UE_LOG(LogVrmToolchain, Warning, TEXT("Invalid GLB file: incorrect magic number"));
-		return false;
-	}
-
-	if (Header->Version != GLB_VERSION_2)
+	if (DataSize > MAX_int32)
 	{
-		UE_LOG(LogVrmToolchain, Warning, TEXT("Unsupported GLB version: %u (expected 2)"), Header->Version);
+		UE_LOG(LogVrmToolchain, Warning, TEXT("GLB data too large for an in-memory read (%lld bytes)"), DataSize);
 		return false;
 	}
 
-	if (Header->Length > DataSize)
+	FVrmGlbContainer Container;
+	FString ContainerError;
+	if (!Container.Parse(TArrayView<const uint8>(Data, static_cast<int32>(DataSize)), ContainerError))
 	{
-		UE_LOG(LogVrmToolchain, Warning, TEXT("Invalid GLB file: header length (%u) exceeds data size (%lld)"), Header->Length, DataSize);
+		UE_LOG(LogVrmToolchain, Warning, TEXT("%s"), *ContainerError);
 		return false;
 	}
 
-	// Read chunks
-	int64 Offset = sizeof(FGlbHeader);
-	while (Offset + sizeof(FGlbChunkHeader) <= Header->Length &&
-		(uint32)(Offset + sizeof(FGlbChunkHeader)) <= (uint32)DataSize)
-	{
-		// Ensure proper alignment for chunk header (GLB chunks should be 4-byte aligned)
-		if (Offset % 4 != 0)
-		{
-			UE_LOG(LogVrmToolchain, Warning, TEXT("Invalid GLB chunk alignment at offset %lld"), Offset);
-			return false;
-		}
-
-		const FGlbChunkHeader* ChunkHeader = reinterpret_cast<const FGlbChunkHeader*>(Data + Offset);
-		Offset += sizeof(FGlbChunkHeader);
-
-		// Check for bounds - ensure chunk doesn't exceed file size or declared GLB length
-		uint32 ChunkLength = ChunkHeader->Length;
-		if (Offset > DataSize || Offset > Header->Length || ChunkLength > static_cast<uint64>(Header->Length) - Offset)
-		{
-			UE_LOG(LogVrmToolchain, Warning, TEXT("Invalid GLB chunk: length (%u) exceeds remaining file size"), ChunkLength);
-			return false;
-		}
-
-		if (ChunkHeader->Type == Test_GLB_CHUNK_TYPE_JSON)
-		{
-			// Found JSON chunk - use explicit length conversion to handle non-null-terminated strings
-			const uint8* JsonData = Data + Offset;
-			FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(JsonData), ChunkLength);
-			OutJsonString = FString(Converter.Length(), Converter.Get());
-			return true;
-		}
-
-		// Skip to next chunk - check for overflow before advancing
-		if (ChunkLength > static_cast<uint64>(INT64_MAX) - Offset)
-		{
-			UE_LOG(LogVrmToolchain, Warning, TEXT("Invalid GLB chunk: offset overflow for chunk length (%u)"), ChunkLength);
-			return false;
-		}
-		Offset += ChunkLength;
-	}
-
-	UE_LOG(LogVrmToolchain, Warning, TEXT("GLB file does not contain a JSON chunk"));
-	return false;
+	// Use explicit length conversion to handle non-null-terminated JSON
+	const TArrayView<const uint8> JsonChunk = Container.GetJsonChunk();
+	FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(JsonChunk.GetData()), JsonChunk.Num());
+	OutJsonString = FString(Converter.Length(), Converter.Get());
+	return true;
 }
 
 bool FVrmParser::ReadGlbJsonChunk(const FString& FilePath, FString& OutJsonString)
 {
-	// Read the entire file into memory
-	TArray<uint8> FileData;
-	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	// Map the file; only the pages covering the header and JSON chunk are touched
+	FString OpenError;
+	const TUniquePtr<FVrmMappedFile> File = FVrmMappedFile::Open(FilePath, OpenError);
+	if (!File.IsValid())
 	{
-		UE_LOG(LogVrmToolchain, Warning, TEXT("Failed to read file: %s"), *FilePath);
+		UE_LOG(LogVrmToolchain, Warning, TEXT("%s"), *OpenError);
 		return false;
 	}
 
+	const TArrayView<const uint8> FileData = File->GetView();
 	return ReadGlbJsonChunkFromMemory(FileData.GetData(), FileData.Num(), OutJsonString);
 }
 
-EVrmVersion FVrmParser::DetectVrmVersion(const FString& FilePath)
-{
-	FString JsonString;
-	if (!ReadGlbJsonChunk(FilePath, JsonString))
-	{
-		return EVrmVersion::Unknown;
-	}
-
-	// Parse JSON
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
-	{
-		UE_LOG(LogVrmToolchain, Warning, TEXT("Failed to parse JSON from GLB file"));
-		return EVrmVersion::Unknown;
-	}
-
-	// Check for extensions object
-	const TSharedPtr<FJsonObject>* ExtensionsObject;
-	if (!JsonObject->TryGetObjectField(TEXT("extensions"), ExtensionsObject))
-	{
-		UE_LOG(LogVrmToolchain, Verbose, TEXT("No extensions field found in JSON"));
-		return EVrmVersion::Unknown;
-	}
-
-	// Check for VRM1 (VRMC_vrm extension)
-	if ((*ExtensionsObject)->HasField(TEXT("VRMC_vrm")))
-	{
-		return EVrmVersion::VRM1;
-	}
-
-	// Check for VRM0 (VRM extension)
-	if ((*ExtensionsObject)->HasField(TEXT("VRM")))
-	{
-		return EVrmVersion::VRM0;
-	}
-
-	return EVrmVersion::Unknown;
-}
-
-FVrmMetadata FVrmParser::ExtractVrmMetadata(const FString& FilePath)
+/**
+ * Reads the VRM meta fields from a glTF root. JsonValueType is either FVrmJsonValue (DOM; lookups
+ * return pointers) or FVrmJsonTapeValue (tape; lookups return handles with the same interface).
+ */
+template<typename JsonValueType>
+static FVrmMetadata ExtractVrmMetadataFromJsonRoot(const JsonValueType& JsonRoot)
 {
 	FVrmMetadata Metadata;
 
-	FString JsonString;
-	if (!ReadGlbJsonChunk(FilePath, JsonString))
-	{
-		return Metadata;
-	}
-
-	// Parse JSON
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
-	{
-		UE_LOG(LogVrmToolchain, Warning, TEXT("Failed to parse JSON from GLB file"));
-		return Metadata;
-	}
-
 	// Check for extensions object
-	const TSharedPtr<FJsonObject>* ExtensionsObject;
-	if (!JsonObject->TryGetObjectField(TEXT("extensions"), ExtensionsObject))
+	const auto ExtensionsObject = JsonRoot.FindObject("extensions");
+	if (!ExtensionsObject)
 	{
 		return Metadata;
 	}
 
 	// Try VRM1 first
-	const TSharedPtr<FJsonObject>* VrmcVrmObject;
-	if ((*ExtensionsObject)->TryGetObjectField(TEXT("VRMC_vrm"), VrmcVrmObject))
+	if (const auto VrmcVrmObject = ExtensionsObject->FindObject("VRMC_vrm"))
 	{
 		Metadata.Version = EVrmVersion::VRM1;
 
 		// Extract VRM1 metadata
-		const TSharedPtr<FJsonObject>* MetaObject;
-		if ((*VrmcVrmObject)->TryGetObjectField(TEXT("meta"), MetaObject))
+		if (const auto MetaObject = VrmcVrmObject->FindObject("meta"))
 		{
 			// Name
-			FString Name;
-			if ((*MetaObject)->TryGetStringField(TEXT("name"), Name))
-			{
-				Metadata.Name = Name;
-			}
+			MetaObject->TryGetString("name", Metadata.Name);
 
 			// Version
-			FString Version;
-			if ((*MetaObject)->TryGetStringField(TEXT("version"), Version))
-			{
-				Metadata.ModelVersion = Version;
-			}
+			MetaObject->TryGetString("version", Metadata.ModelVersion);
 
 			// Authors
-			const TArray<TSharedPtr<FJsonValue>>* AuthorsArray;
-			if ((*MetaObject)->TryGetArrayField(TEXT("authors"), AuthorsArray))
+			for (const auto& AuthorValue : MetaObject->FindArray("authors"))
 			{
-				for (const TSharedPtr<FJsonValue>& AuthorValue : *AuthorsArray)
+				if (AuthorValue.IsString())
 				{
-					FString Author;
-					if (AuthorValue->TryGetString(Author))
-					{
-						Metadata.Authors.Add(Author);
-					}
+					Metadata.Authors.Add(AuthorValue.AsString());
 				}
 			}
 
 			// Copyright
-			FString CopyrightInfo;
-			if ((*MetaObject)->TryGetStringField(TEXT("copyrightInformation"), CopyrightInfo))
-			{
-				Metadata.Copyright = CopyrightInfo;
-			}
+			MetaObject->TryGetString("copyrightInformation", Metadata.Copyright);
 
 			// License - in VRM1 this is under licenseUrl
-			FString LicenseUrl;
-			if ((*MetaObject)->TryGetStringField(TEXT("licenseUrl"), LicenseUrl))
-			{
-				Metadata.License = LicenseUrl;
-			}
+			MetaObject->TryGetString("licenseUrl", Metadata.License);
 		}
 	}
 	// Try VRM0
-	else if ((*ExtensionsObject)->TryGetObjectField(TEXT("VRM"), VrmcVrmObject))
+	else if (const auto VrmObject = ExtensionsObject->FindObject("VRM"))
 	{
 		Metadata.Version = EVrmVersion::VRM0;
 
 		// Extract VRM0 metadata
-		const TSharedPtr<FJsonObject>* MetaObject;
-		if ((*VrmcVrmObject)->TryGetObjectField(TEXT("meta"), MetaObject))
+		if (const auto MetaObject = VrmObject->FindObject("meta"))
 		{
 			// Title (VRM0 uses "title" instead of "name")
-			FString Title;
-			if ((*MetaObject)->TryGetStringField(TEXT("title"), Title))
-			{
-				Metadata.Name = Title;
-			}
+			MetaObject->TryGetString("title", Metadata.Name);
 
 			// Version
-			FString Version;
-			if ((*MetaObject)->TryGetStringField(TEXT("version"), Version))
-			{
-				Metadata.ModelVersion = Version;
-			}
+			MetaObject->TryGetString("version", Metadata.ModelVersion);
 
 			// Author (VRM0 uses "author" string instead of "authors" array)
 			FString Author;
-			if ((*MetaObject)->TryGetStringField(TEXT("author"), Author))
+			if (MetaObject->TryGetString("author", Author))
 			{
 				Metadata.Authors.Add(Author);
 			}
 
 			// Contact information (stored in the Copyright metadata field)
 			FString ContactInfo;
-			if ((*MetaObject)->TryGetStringField(TEXT("contactInformation"), ContactInfo))
+			if (MetaObject->TryGetString("contactInformation", ContactInfo))
 			{
 				if (!ContactInfo.IsEmpty())
 				{
@@ -269,22 +132,222 @@ FVrmMetadata FVrmParser::ExtractVrmMetadata(const FString& FilePath)
 			}
 
 			// License Name
-			FString OtherLicenseUrl;
-			if ((*MetaObject)->TryGetStringField(TEXT("otherLicenseUrl"), OtherLicenseUrl))
-			{
-				Metadata.License = OtherLicenseUrl;
-			}
-			else
+			if (!MetaObject->TryGetString("otherLicenseUrl", Metadata.License))
 			{
 				// Try to get license name as fallback
-				FString LicenseName;
-				if ((*MetaObject)->TryGetStringField(TEXT("licenseName"), LicenseName))
-				{
-					Metadata.License = LicenseName;
-				}
+				MetaObject->TryGetString("licenseName", Metadata.License);
 			}
 		}
 	}
 
 	return Metadata;
 }
+
+bool FVrmParser::ScanVrmFeatures(TArrayView<const uint8> JsonUtf8, FVrmProbeResult& OutProbe)
+{
+	// Only root.extensions and the VRM extension objects are descended into; every other subtree
+	// (accessors, meshes, nodes, ...) is skipped without being tokenized
+	FVrmJsonPathScanner Scanner;
+	const int32 Extensions = Scanner.AddPath("extensions");
+	const int32 Vrm0 = Scanner.AddPath("extensions.VRM");
+	const int32 Vrm0Humanoid = Scanner.AddPath("extensions.VRM.humanoid");
+	const int32 Vrm0SecondaryAnimation = Scanner.AddPath("extensions.VRM.secondaryAnimation");
+	const int32 Vrm0BlendShapeMaster = Scanner.AddPath("extensions.VRM.blendShapeMaster");
+	const int32 Vrm0Thumbnail = Scanner.AddPath("extensions.VRM.meta.texture");
+	const int32 Vrm1 = Scanner.AddPath("extensions.VRMC_vrm");
+	const int32 Vrm1Humanoid = Scanner.AddPath("extensions.VRMC_vrm.humanoid");
+	const int32 Vrm1Expressions = Scanner.AddPath("extensions.VRMC_vrm.expressions");
+	const int32 Vrm1BlendShapeMaster = Scanner.AddPath("extensions.VRMC_vrm.blendShapeMaster");
+	const int32 Vrm1Thumbnail = Scanner.AddPath("extensions.VRMC_vrm.thumbnail");
+	const int32 Vrm1SpringBone = Scanner.AddPath("extensions.VRMC_vrm.springBone");
+	const int32 SpringBoneExtension = Scanner.AddPath("extensions.VRMC_springBone");
+	const int32 RootSecondaryAnimation = Scanner.AddPath("secondaryAnimation");
+	const int32 RootBlendShapeMaster = Scanner.AddPath("blendShapeMaster");
+	const int32 RootThumbnail = Scanner.AddPath("thumbnail");
+
+	// VRM0 flags are read where the VRM0 spec puts them, or at the root where older exporters wrote them
+	auto HasVrm0SpringBones = [=](const FVrmJsonPathScanner& State) { return State.WasFound(Vrm0SecondaryAnimation) || State.WasFound(RootSecondaryAnimation); };
+	auto HasVrm0BlendShapes = [=](const FVrmJsonPathScanner& State) { return State.WasFound(Vrm0BlendShapeMaster) || State.WasFound(RootBlendShapeMaster); };
+	auto HasVrm0Thumbnail = [=](const FVrmJsonPathScanner& State) { return State.WasFound(Vrm0Thumbnail) || State.WasFound(RootThumbnail); };
+
+	// The version is known once the extensions object has been read. VRM1 flags all live inside it;
+	// VRM0 flags may still follow at the root until every one of them has been found
+	Scanner.SetStopCondition([=](const FVrmJsonPathScanner& State)
+	{
+		const bool bVrm0FlagsFound = HasVrm0SpringBones(State) && HasVrm0BlendShapes(State) && HasVrm0Thumbnail(State);
+		return State.WasCompleted(Extensions) && (State.WasFound(Vrm1) || !State.WasFound(Vrm0) || bVrm0FlagsFound);
+	});
+
+	if (!Scanner.Scan(JsonUtf8))
+	{
+		return false;
+	}
+
+	// VRMC_vrm takes precedence, matching DetectVrmVersion
+	OutProbe.Version = EVrmVersion::Unknown;
+	OutProbe.bHasHumanoid = false;
+	OutProbe.bHasSpringBones = false;
+	OutProbe.bHasBlendShapesOrExpressions = false;
+	OutProbe.bHasThumbnail = false;
+	if (Scanner.WasFound(Vrm1))
+	{
+		OutProbe.Version = EVrmVersion::VRM1;
+		OutProbe.bHasHumanoid = Scanner.WasFound(Vrm1Humanoid);
+		OutProbe.bHasBlendShapesOrExpressions = Scanner.WasFound(Vrm1Expressions) || Scanner.WasFound(Vrm1BlendShapeMaster);
+		OutProbe.bHasThumbnail = Scanner.WasFound(Vrm1Thumbnail);
+		OutProbe.bHasSpringBones = Scanner.WasFound(SpringBoneExtension) || Scanner.WasFound(Vrm1SpringBone);
+	}
+	else if (Scanner.WasFound(Vrm0))
+	{
+		OutProbe.Version = EVrmVersion::VRM0;
+		OutProbe.bHasHumanoid = Scanner.WasFound(Vrm0Humanoid);
+		OutProbe.bHasSpringBones = HasVrm0SpringBones(Scanner);
+		OutProbe.bHasBlendShapesOrExpressions = HasVrm0BlendShapes(Scanner);
+		OutProbe.bHasThumbnail = HasVrm0Thumbnail(Scanner);
+	}
+	return true;
+}
+
+EVrmVersion FVrmParser::DetectVrmVersion(const FString& FilePath)
+{
+	FVrmProbeResult Probe;
+	FString ProbeError;
+	if (!ProbeVrmFile(FilePath, Probe, ProbeError))
+	{
+		UE_LOG(LogVrmToolchain, Warning, TEXT("%s"), *ProbeError);
+		return EVrmVersion::Unknown;
+	}
+
+	return Probe.Version;
+}
+
+EVrmVersion FVrmParser::DetectVrmVersion(const FVrmGlbDocument& Document)
+{
+	// Resolved once when the document's glTF model was built
+	return Document.GetModel().Vrm.Version;
+}
+
+FVrmMetadata FVrmParser::ExtractVrmMetadata(const FString& FilePath)
+{
+	FVrmProbeResult Probe;
+	FString ProbeError;
+	if (!ProbeVrmFile(FilePath, Probe, ProbeError))
+	{
+		UE_LOG(LogVrmToolchain, Warning, TEXT("%s"), *ProbeError);
+		return FVrmMetadata();
+	}
+
+	return ExtractVrmMetadata(Probe);
+}
+
+FVrmMetadata FVrmParser::ExtractVrmMetadata(const FVrmGlbDocument& Document)
+{
+	return ExtractVrmMetadataFromJsonRoot(Document.GetJsonRoot());
+}
+
+FVrmMetadata FVrmParser::ExtractVrmMetadata(const FVrmProbeResult& Probe)
+{
+	// Only a few meta fields are read, so index the chunk instead of materializing a DOM
+	FVrmJsonTape Tape;
+	FString JsonError;
+	if (!Tape.Build(Probe.JsonChunk, JsonError))
+	{
+		return FVrmMetadata();
+	}
+	return ExtractVrmMetadataFromJsonRoot(Tape.GetRoot());
+}
+
+bool FVrmParser::ProbeVrmFile(const FString& FilePath, FVrmProbeResult& OutProbe, FString& OutError)
+{
+	OutProbe = FVrmProbeResult();
+	OutError.Reset();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const TUniquePtr<IFileHandle> Handle(PlatformFile.OpenRead(*FilePath));
+	if (!Handle.IsValid())
+	{
+		OutError = FString::Printf(TEXT("Failed to open file: %s"), *FilePath);
+		return false;
+	}
+
+	const int64 FileSize = Handle->Size();
+
+	// Positioned read helper; every read is bounds-checked against the file size
+	auto ReadAt = [&Handle, FileSize](int64 Offset, void* Destination, int64 Count) -> bool
+	{
+		return Offset >= 0 && Count >= 0 && Offset + Count <= FileSize
+			&& Handle->Seek(Offset)
+			&& Handle->Read(static_cast<uint8*>(Destination), Count);
+	};
+
+	// GLB header followed by the first chunk header, which must be JSON
+	uint8 HeaderBytes[FVrmGlbContainer::HeaderSize];
+	FGlbChunkHeader JsonChunkHeader;
+	if (!ReadAt(0, HeaderBytes, sizeof(HeaderBytes)) || !ReadAt(sizeof(HeaderBytes), &JsonChunkHeader, sizeof(FGlbChunkHeader)))
+	{
+		OutError = FString::Printf(TEXT("Invalid GLB data: insufficient size for header (%s)"), *FilePath);
+		return false;
+	}
+
+	// Same header validation as every in-memory reader (FVrmGlbContainer)
+	uint32 GlbLength = 0;
+	FString HeaderError;
+	if (!FVrmGlbContainer::ValidateHeader(HeaderBytes, FileSize, GlbLength, HeaderError))
+	{
+		OutError = FString::Printf(TEXT("%s (%s)"), *HeaderError, *FilePath);
+		return false;
+	}
+
+	if (JsonChunkHeader.Type != EVrmGlbChunkType::Json)
+	{
+		OutError = FString::Printf(TEXT("GLB file does not start with a JSON chunk (%s)"), *FilePath);
+		return false;
+	}
+
+	const int64 JsonOffset = FVrmGlbContainer::HeaderSize + FVrmGlbContainer::ChunkHeaderSize;
+	if (JsonChunkHeader.Length > static_cast<int64>(GlbLength) - JsonOffset)
+	{
+		OutError = FString::Printf(TEXT("Invalid GLB chunk: length (%u) exceeds remaining file size"), JsonChunkHeader.Length);
+		return false;
+	}
+
+	OutProbe.GlbLength = GlbLength;
+	OutProbe.JsonLength = JsonChunkHeader.Length;
+
+	// Optional BIN chunk header directly after the JSON chunk; its payload is never read
+	uint32 BinLength = 0;
+	const int64 BinHeaderOffset = JsonOffset + JsonChunkHeader.Length;
+	if (BinHeaderOffset + static_cast<int64>(sizeof(FGlbChunkHeader)) <= GlbLength)
+	{
+		FGlbChunkHeader BinChunkHeader;
+		if (ReadAt(BinHeaderOffset, &BinChunkHeader, sizeof(FGlbChunkHeader)) && BinChunkHeader.Type == EVrmGlbChunkType::Bin)
+		{
+			BinLength = BinChunkHeader.Length;
+		}
+	}
+
+	OutProbe.BinLength = BinLength;
+
+	TArray<uint8> JsonBytes;
+	JsonBytes.SetNumUninitialized(JsonChunkHeader.Length);
+	if (!ReadAt(JsonOffset, JsonBytes.GetData(), JsonBytes.Num()))
+	{
+		OutError = FString::Printf(TEXT("Failed to read JSON chunk: %s"), *FilePath);
+		return false;
+	}
+
+	// Version and feature flags straight from the UTF-8 bytes; no DOM is built
+	if (!ScanVrmFeatures(JsonBytes, OutProbe))
+	{
+		// The container is valid; an unparsable JSON chunk simply yields no VRM information
+		OutProbe = FVrmProbeResult();
+		OutProbe.GlbLength = GlbLength;
+		OutProbe.JsonLength = JsonChunkHeader.Length;
+		OutProbe.BinLength = BinLength;
+		UE_LOG(LogVrmToolchain, Warning, TEXT("Failed to parse JSON from GLB file: %s"), *FilePath);
+		return true;
+	}
+
+	OutProbe.JsonChunk = MoveTemp(JsonBytes);
+	return true;
+}
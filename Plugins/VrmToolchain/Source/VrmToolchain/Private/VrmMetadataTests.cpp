@@ -1,9 +1,14 @@
 #include "VrmToolchain/VrmMetadata.h"
+#include "VrmToolchain/VrmGlbDocument.h"
+#include "VrmToolchain/VrmGlbContainer.h"
+#include "VrmToolchain/VrmGltfModel.h"
+#include "VrmToolchain/VrmBase64.h"
 #include "Misc/AutomationTest.h"
 #include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Base64.h"
 #include "HAL/FileManager.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -355,4 +360,476 @@ bool FVrmParserNonNullTerminatedJsonTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGlbDocumentSharedParseTest, "VrmToolchain.VrmParser.GlbDocument", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGlbDocumentSharedParseTest::RunTest(const FString& Parameters)
+{
+	FString Vrm0Json = TEXT(R"({"asset":{"version":"2.0"},"extensions":{"VRM":{"meta":{"title":"Doc Model","author":"Doc Author"}}}})");
+	TArray<uint8> GlbData = CreateSyntheticGlb(Vrm0Json);
+
+	// Append a BIN chunk so the chunk table has two entries
+	const uint32 BinChunkLength = 8;
+	const uint32 BinChunkType = 0x004E4942; // "BIN\0"
+	GlbData.Append(reinterpret_cast<const uint8*>(&BinChunkLength), sizeof(uint32));
+	GlbData.Append(reinterpret_cast<const uint8*>(&BinChunkType), sizeof(uint32));
+	for (uint32 i = 0; i < BinChunkLength; ++i)
+	{
+		GlbData.Add(static_cast<uint8>(0xA0 + i));
+	}
+	const uint32 TotalLength = GlbData.Num();
+	FMemory::Memcpy(GlbData.GetData() + 8, &TotalLength, sizeof(uint32));
+
+	FString Error;
+	TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromView(GlbData, Error);
+	TestTrue(TEXT("Document should parse"), Document.IsValid());
+	if (!Document.IsValid())
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Chunk table should contain JSON and BIN"), Document->GetChunks().Num(), 2);
+	TestEqual(TEXT("BIN chunk length"), Document->GetBinChunk().Num(), 8);
+	TestEqual(TEXT("BIN chunk is a view into the source bytes"), Document->GetBinChunk().GetData(), static_cast<const uint8*>(GlbData.GetData() + GlbData.Num() - 8));
+	TestTrue(TEXT("JSON DOM should be parsed once at load"), Document->GetJsonRoot().IsObject());
+
+	TestEqual(TEXT("Version from document"), FVrmParser::DetectVrmVersion(*Document), EVrmVersion::VRM0);
+	const FVrmMetadata Metadata = FVrmParser::ExtractVrmMetadata(*Document);
+	TestEqual(TEXT("Title from document"), Metadata.Name, FString(TEXT("Doc Model")));
+
+	// Invalid container
+	TArray<uint8> InvalidData = { 0x00, 0x01, 0x02 };
+	TSharedPtr<FVrmGlbDocument> Invalid = FVrmGlbDocument::LoadFromView(InvalidData, Error);
+	TestFalse(TEXT("Invalid GLB should not produce a document"), Invalid.IsValid());
+	TestFalse(TEXT("Invalid GLB should report an error"), Error.IsEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGlbContainerTest, "VrmToolchain.VrmParser.GlbContainer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGlbContainerTest::RunTest(const FString& Parameters)
+{
+	TArray<uint8> GlbData = CreateSyntheticGlb(TEXT(R"({"asset":{"version":"2.0"}})"));
+	const int32 JsonOnlyLength = GlbData.Num();
+
+	// Unknown chunk followed by two BIN chunks; only the first BIN chunk is "the" BIN chunk
+	auto AppendChunk = [&GlbData](uint32 Type, uint32 Length, uint8 Fill)
+	{
+		GlbData.Append(reinterpret_cast<const uint8*>(&Length), sizeof(uint32));
+		GlbData.Append(reinterpret_cast<const uint8*>(&Type), sizeof(uint32));
+		for (uint32 i = 0; i < Length; ++i)
+		{
+			GlbData.Add(Fill);
+		}
+	};
+	const uint32 ExtraChunkType = 0x54584558; // "XEXT"
+	AppendChunk(ExtraChunkType, 4, 0x11);
+	AppendChunk(EVrmGlbChunkType::Bin, 8, 0x22);
+	AppendChunk(EVrmGlbChunkType::Bin, 4, 0x33);
+	const uint32 TotalLength = GlbData.Num();
+	FMemory::Memcpy(GlbData.GetData() + 8, &TotalLength, sizeof(uint32));
+
+	FVrmGlbContainer Container;
+	FString Error;
+	TestTrue(TEXT("Container should parse"), Container.Parse(GlbData, Error));
+	TestEqual(TEXT("Declared length"), Container.GetLength(), TotalLength);
+	TestEqual(TEXT("Every chunk is recorded"), Container.GetChunks().Num(), 4);
+	TestEqual(TEXT("Unknown chunk lookup"), Container.FindChunk(ExtraChunkType), 1);
+	TestEqual(TEXT("First BIN chunk wins"), Container.FindChunk(EVrmGlbChunkType::Bin), 2);
+	TestEqual(TEXT("BIN chunk payload"), Container.GetBinChunk().Num() == 8 ? Container.GetBinChunk()[0] : 0, static_cast<uint8>(0x22));
+	TestEqual(TEXT("Missing chunk type"), Container.FindChunk(0x12345678), static_cast<int32>(INDEX_NONE));
+	TestTrue(TEXT("Invalid chunk index gives an empty view"), Container.GetChunkData(7).Num() == 0);
+
+	// A chunk running past the declared length invalidates the whole container
+	TArray<uint8> Truncated = GlbData;
+	Truncated.SetNum(Truncated.Num() - 2);
+	const uint32 TruncatedLength = Truncated.Num();
+	FMemory::Memcpy(Truncated.GetData() + 8, &TruncatedLength, sizeof(uint32));
+	TestFalse(TEXT("Truncated chunk should fail"), Container.Parse(Truncated, Error));
+	TestTrue(TEXT("Truncation error is reported"), Error.Contains(TEXT("exceeds")));
+	TestFalse(TEXT("Container is reset on failure"), Container.IsValid() || Container.GetChunks().Num() > 0);
+
+	// A container without a JSON chunk is rejected
+	TArray<uint8> NoJson;
+	NoJson.Append(GlbData.GetData(), 12);
+	NoJson.Append(GlbData.GetData() + JsonOnlyLength, GlbData.Num() - JsonOnlyLength);
+	const uint32 NoJsonLength = NoJson.Num();
+	FMemory::Memcpy(NoJson.GetData() + 8, &NoJsonLength, sizeof(uint32));
+	TestFalse(TEXT("Missing JSON chunk should fail"), Container.Parse(NoJson, Error));
+
+	// Header validation alone (used by the probe, which never reads the whole file)
+	uint32 HeaderLength = 0;
+	TestTrue(TEXT("Header validates"), FVrmGlbContainer::ValidateHeader(GlbData.GetData(), GlbData.Num(), HeaderLength, Error));
+	TestEqual(TEXT("Header length"), HeaderLength, TotalLength);
+	TestFalse(TEXT("Declared length beyond the data is rejected"), FVrmGlbContainer::ValidateHeader(GlbData.GetData(), GlbData.Num() - 1, HeaderLength, Error));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGltfModelTest, "VrmToolchain.VrmParser.GltfModel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGltfModelTest::RunTest(const FString& Parameters)
+{
+	const FString Json = TEXT(R"({"asset":{"version":"2.0"},)")
+		TEXT(R"("buffers":[{"byteLength":64}],)")
+		TEXT(R"("bufferViews":[{"buffer":0,"byteOffset":4,"byteLength":36,"byteStride":12},{"buffer":0,"byteOffset":40,"byteLength":6,)")
+		TEXT(R"("extensions":{"EXT_meshopt_compression":{"buffer":0,"byteOffset":48,"byteLength":20,"byteStride":2,"count":3,"mode":"TRIANGLES"}}}],)")
+		TEXT(R"("accessors":[{"bufferView":0,"componentType":5126,"count":3,"type":"VEC3"},{"bufferView":1,"byteOffset":2,"componentType":5123,"count":2,"type":"SCALAR","normalized":true},)")
+		TEXT(R"({"componentType":5126,"count":8,"type":"VEC3","sparse":{"count":2,"indices":{"bufferView":1,"componentType":5123},"values":{"bufferView":0,"byteOffset":12}}}],)")
+		TEXT(R"("meshes":[{"name":"Body","extras":{"targetNames":["Blink","Joy"]},"primitives":[{"attributes":{"POSITION":0,"TEXCOORD_1":0,"JOINTS_0":1},"indices":1,"material":0,)")
+		TEXT(R"("targets":[{"POSITION":2},{"POSITION":0,"NORMAL":0}]},{"attributes":{"POSITION":0},"mode":1}]}],)")
+		TEXT(R"("nodes":[{"name":"Root","children":[1,2]},{"name":"Hips","translation":[1,2,3],"mesh":0,"skin":0},{"matrix":[1,0,0,0,0,1,0,0,0,0,1,0,5,6,7,1]}],)")
+		TEXT(R"("skins":[{"joints":[1,2],"inverseBindMatrices":0}],)")
+		TEXT(R"("images":[{"bufferView":1,"mimeType":"image/png"}],"textures":[{"source":0}],)")
+		TEXT(R"("materials":[{"name":"Skin","pbrMetallicRoughness":{"baseColorFactor":[1,0.5,0.25,1],"baseColorTexture":{"index":0}},"alphaMode":"MASK","doubleSided":true}],)")
+		TEXT(R"("extensions":{"VRMC_vrm":{"humanoid":{"humanBones":{"hips":{"node":1}}},"meta":{"thumbnailImage":0},"expressions":{"preset":{"happy":{}},"custom":{"wink":{}}}},"VRMC_springBone":{}}})");
+
+	FString Error;
+	TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(CreateSyntheticGlb(Json), Error);
+	TestTrue(TEXT("Document should parse"), Document.IsValid());
+	if (!Document.IsValid())
+	{
+		return false;
+	}
+
+	const FVrmGltfModel& Model = Document->GetModel();
+	TestEqual(TEXT("Buffers"), Model.Buffers.Num(), 1);
+	TestEqual(TEXT("BufferViews"), Model.BufferViews.Num(), 2);
+	TestEqual(TEXT("BufferView stride"), Model.BufferViews[0].ByteStride, 12);
+	TestFalse(TEXT("Plain bufferView"), Model.BufferViews[0].IsCompressed());
+	TestTrue(TEXT("Compressed bufferView"), Model.BufferViews[1].IsCompressed());
+	TestTrue(TEXT("Meshopt mode"), Model.BufferViews[1].Meshopt.Mode == EVrmGltfMeshoptMode::Triangles);
+	TestTrue(TEXT("Meshopt filter defaults to NONE"), Model.BufferViews[1].Meshopt.Filter == EVrmGltfMeshoptFilter::None);
+	TestEqual(TEXT("Meshopt count"), Model.BufferViews[1].Meshopt.Count, 3);
+	TestEqual(TEXT("Accessors"), Model.Accessors.Num(), 3);
+	TestEqual(TEXT("Accessor type"), Model.Accessors[0].GetComponentCount(), 3);
+	TestEqual(TEXT("Accessor element size"), Model.Accessors[0].GetElementSize(), 12);
+	TestTrue(TEXT("Accessor normalized"), Model.Accessors[1].bNormalized);
+	TestEqual(TEXT("Accessor byte offset"), Model.Accessors[1].ByteOffset, static_cast<int64>(2));
+	TestFalse(TEXT("Dense accessor"), Model.Accessors[0].IsSparse());
+	TestTrue(TEXT("Sparse accessor"), Model.Accessors[2].IsSparse());
+	TestEqual(TEXT("Sparse base is zeros"), Model.Accessors[2].BufferView, static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("Sparse count"), Model.Accessors[2].Sparse.Count, 2);
+	TestEqual(TEXT("Sparse indices type"), Model.Accessors[2].Sparse.IndicesComponentType, static_cast<int32>(EVrmGltfComponentType::UnsignedShort));
+	TestEqual(TEXT("Sparse values offset"), Model.Accessors[2].Sparse.ValuesByteOffset, static_cast<int64>(12));
+
+	TestEqual(TEXT("Primitives are flattened"), Model.Primitives.Num(), 2);
+	TestEqual(TEXT("Mesh primitive range"), Model.GetPrimitives(Model.Meshes[0]).Num(), 2);
+	const FVrmGltfPrimitive& Primitive = Model.Primitives[0];
+	TestEqual(TEXT("POSITION accessor"), Primitive.Position, 0);
+	TestEqual(TEXT("TEXCOORD_1 accessor"), Primitive.TexCoords[1], 0);
+	TestEqual(TEXT("Missing TEXCOORD_0"), Primitive.TexCoords[0], static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("JOINTS_0 accessor"), Primitive.Joints[0], 1);
+	TestEqual(TEXT("Indices accessor"), Primitive.Indices, 1);
+	TestEqual(TEXT("Default mode is triangles"), Primitive.Mode, 4);
+	TestEqual(TEXT("Explicit mode"), Model.Primitives[1].Mode, 1);
+	TestEqual(TEXT("Morph targets"), Model.GetTargets(Primitive).Num(), 2);
+	TestEqual(TEXT("Morph target POSITION"), Model.GetTargets(Primitive)[0].Position, 2);
+	TestEqual(TEXT("Morph target NORMAL"), Model.GetTargets(Primitive)[1].Normal, 0);
+	TestEqual(TEXT("Missing morph target NORMAL"), Model.GetTargets(Primitive)[0].Normal, static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("Primitive without targets"), Model.GetTargets(Model.Primitives[1]).Num(), 0);
+	TestTrue(TEXT("Morph target names"), Model.Meshes[0].TargetNames == TArray<FString>({ TEXT("Blink"), TEXT("Joy") }));
+
+	TestEqual(TEXT("Nodes"), Model.Nodes.Num(), 3);
+	TestEqual(TEXT("Root has no parent"), Model.Nodes[0].Parent, static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("Parent resolved from children"), Model.Nodes[2].Parent, 0);
+	TestEqual(TEXT("Children range"), Model.GetChildren(Model.Nodes[0]).Num(), 2);
+	TestEqual(TEXT("Node translation"), Model.Nodes[1].Translation, FVector(1.0, 2.0, 3.0));
+	TestTrue(TEXT("Node matrix"), Model.Nodes[2].bHasMatrix);
+	TestEqual(TEXT("Matrix origin"), Model.Nodes[2].Matrix.GetOrigin(), FVector(5.0, 6.0, 7.0));
+	TestEqual(TEXT("Skin joints"), Model.GetJoints(Model.Skins[0]).Num(), 2);
+
+	TestEqual(TEXT("Image buffer view"), Model.Images[0].BufferView, 1);
+	TestEqual(TEXT("Texture source"), Model.Textures[0].Source, 0);
+	TestEqual(TEXT("Material base color texture"), Model.Materials[0].BaseColorTexture, 0);
+	TestEqual(TEXT("Material base color factor"), Model.Materials[0].BaseColorFactor.G, 0.5f);
+	TestEqual(TEXT("Material alpha mode"), Model.Materials[0].AlphaMode, EVrmGltfAlphaMode::Mask);
+	TestTrue(TEXT("Material double sided"), Model.Materials[0].bDoubleSided);
+
+	TestEqual(TEXT("VRM version"), Model.Vrm.Version, EVrmVersion::VRM1);
+	TestEqual(TEXT("Humanoid hips"), Model.Vrm.FindHumanBoneNode(TEXT("hips")), 1);
+	TestEqual(TEXT("Thumbnail image"), Model.Vrm.ThumbnailImage, 0);
+	TestEqual(TEXT("Expressions"), Model.Vrm.NumExpressions, 2);
+	TestTrue(TEXT("Spring bones"), Model.Vrm.bHasSpringBones);
+
+	// VRM0 humanoid is an array of {bone, node}
+	TSharedPtr<FVrmGlbDocument> Vrm0Document = FVrmGlbDocument::LoadFromBytes(CreateSyntheticGlb(TEXT(R"({"materials":[{}],"extensions":{"VRM":{"humanoid":{"humanBones":[{"bone":"head","node":4}]},"meta":{"texture":2},"materialProperties":[{"shader":"VRM/MToon"}]}}})")), Error);
+	TestTrue(TEXT("VRM0 document should parse"), Vrm0Document.IsValid());
+	if (Vrm0Document.IsValid())
+	{
+		const FVrmGltfModel& Vrm0 = Vrm0Document->GetModel();
+		TestEqual(TEXT("VRM0 version"), Vrm0.Vrm.Version, EVrmVersion::VRM0);
+		TestEqual(TEXT("VRM0 humanoid head"), Vrm0.Vrm.FindHumanBoneNode(TEXT("head")), 4);
+		TestEqual(TEXT("VRM0 thumbnail texture"), Vrm0.Vrm.ThumbnailTexture, 2);
+		TestTrue(TEXT("VRM0 MToon material"), Vrm0.Materials[0].bMToon);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGltfModelIntegerTest, "VrmToolchain.VrmParser.GltfModelIntegers", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGltfModelIntegerTest::RunTest(const FString& Parameters)
+{
+	// Sizes, offsets and counts that do not convert exactly fail the model instead of being truncated
+	const TCHAR* MalformedCases[] = {
+		TEXT(R"({"accessors":[{"componentType":5126,"count":2.5,"type":"SCALAR"}]})"),
+		TEXT(R"({"accessors":[{"componentType":5126,"count":3000000000,"type":"SCALAR"}]})"),
+		TEXT(R"({"accessors":[{"componentType":5126,"count":1,"byteOffset":-4,"type":"SCALAR"}]})"),
+		TEXT(R"({"accessors":[{"componentType":5126,"count":2,"type":"SCALAR","sparse":{"count":1e12}}]})"),
+		TEXT(R"({"bufferViews":[{"buffer":0,"byteLength":1e300}]})"),
+		TEXT(R"({"bufferViews":[{"buffer":0,"byteLength":8,"byteStride":4.5}]})"),
+		TEXT(R"({"bufferViews":[{"buffer":0,"byteLength":8,"extensions":{"EXT_meshopt_compression":{"buffer":0,"byteLength":8,"byteStride":4,"count":-1}}}]})"),
+		TEXT(R"({"bufferViews":[{"buffer":0,"byteLength":8,"extensions":{"EXT_meshopt_compression":{"buffer":0,"byteLength":8,"byteStride":2147483648,"count":2}}}]})"),
+	};
+
+	for (const TCHAR* Json : MalformedCases)
+	{
+		FString Error;
+		const TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(CreateSyntheticGlb(Json), Error);
+		TestFalse(FString::Printf(TEXT("Rejected: %s"), Json), Document.IsValid());
+		TestTrue(FString::Printf(TEXT("Reported as an integer error: %s"), *Error), Error.Contains(TEXT("not an integer")));
+	}
+
+	// Limits themselves are fine
+	FString Error;
+	const TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(CreateSyntheticGlb(
+		TEXT(R"({"accessors":[{"componentType":5126,"count":2147483647,"byteOffset":4294967296,"type":"SCALAR"}]})")), Error);
+	TestTrue(FString::Printf(TEXT("In-range values parse (%s)"), *Error), Document.IsValid());
+	if (Document.IsValid())
+	{
+		TestEqual(TEXT("Largest int32 count"), Document->GetModel().Accessors[0].Count, MAX_int32);
+		TestEqual(TEXT("Offset past 4 GB"), Document->GetModel().Accessors[0].ByteOffset, static_cast<int64>(4294967296));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGlbDocumentMappedReadTest, "VrmToolchain.VrmParser.GlbDocumentMapped", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGlbDocumentMappedReadTest::RunTest(const FString& Parameters)
+{
+	FString Vrm1Json = TEXT(R"({"asset":{"version":"2.0"},"extensions":{"VRMC_vrm":{"specVersion":"1.0","meta":{"name":"Mapped Model"}}}})");
+	TArray<uint8> GlbData = CreateSyntheticGlb(Vrm1Json);
+
+	FString TempFilePath = GetTestTempFilePath(TEXT("test_mapped.glb"));
+	FFileHelper::SaveArrayToFile(GlbData, *TempFilePath);
+
+	{
+		FString Error;
+		TSharedPtr<FVrmGlbDocument> Mapped = FVrmGlbDocument::LoadFromFile(TempFilePath, Error, EVrmGlbReadMode::MemoryMapped);
+		TSharedPtr<FVrmGlbDocument> Buffered = FVrmGlbDocument::LoadFromFile(TempFilePath, Error, EVrmGlbReadMode::Buffered);
+
+		TestTrue(TEXT("Mapped document should load"), Mapped.IsValid());
+		TestTrue(TEXT("Buffered document should load"), Buffered.IsValid());
+		if (Mapped.IsValid() && Buffered.IsValid())
+		{
+			TestFalse(TEXT("Buffered mode never maps"), Buffered->IsMemoryMapped());
+			TestEqual(TEXT("Both modes see the same file size"), Mapped->GetBytes().Num(), GlbData.Num());
+
+			const TArrayView<const uint8> MappedJson = Mapped->GetJsonChunk();
+			const TArrayView<const uint8> BufferedJson = Buffered->GetJsonChunk();
+			TestEqual(TEXT("JSON chunk length matches"), MappedJson.Num(), BufferedJson.Num());
+			TestTrue(TEXT("JSON chunk bytes match"), MappedJson.Num() == BufferedJson.Num() && FMemory::Memcmp(MappedJson.GetData(), BufferedJson.GetData(), MappedJson.Num()) == 0);
+			TestEqual(TEXT("Version from mapped document"), FVrmParser::DetectVrmVersion(*Mapped), EVrmVersion::VRM1);
+		}
+	}
+
+	// Documents (and their mappings) are released before the file is deleted
+	IFileManager::Get().Delete(*TempFilePath);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGltfBufferUriTest, "VrmToolchain.VrmParser.BufferUris", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGltfBufferUriTest::RunTest(const FString& Parameters)
+{
+	// Base64: long enough to cover the vector loop, plus every padding length
+	TArray<uint8> Original;
+	for (int32 i = 0; i < 200; ++i)
+	{
+		Original.Add(static_cast<uint8>(i * 37 + 11));
+	}
+	for (int32 Length : { 0, 1, 2, 3, 48, 200 })
+	{
+		const TArray<uint8> Slice(Original.GetData(), Length);
+		const FTCHARToUTF8 Encoded(*FBase64::Encode(Slice));
+		TArray<uint8> Decoded;
+		TestTrue(FString::Printf(TEXT("Base64 round-trip of %d bytes"), Length), VrmBase64::Decode(FAnsiStringView(Encoded.Get(), Encoded.Length()), Decoded) && Decoded == Slice);
+	}
+
+	TArray<uint8> Rejected;
+	TestFalse(TEXT("Character outside the alphabet"), VrmBase64::Decode("AAAAAAAAAAAAAAAAAAAA*AAAAAAAAAAA", Rejected));
+	TestFalse(TEXT("Impossible length"), VrmBase64::Decode("AAAAA", Rejected));
+	TestEqual(TEXT("Decoded size without padding"), VrmBase64::GetDecodedSize("QUJDRA"), int64(4));
+	TestEqual(TEXT("Decoded size with padding"), VrmBase64::GetDecodedSize("QUJDRA=="), int64(4));
+
+	// A plain .gltf with an embedded buffer and an external sibling file
+	const TArray<uint8> External = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	const FString GltfPath = GetTestTempFilePath(TEXT("test_buffers.gltf"));
+	const FString BinPath = GetTestTempFilePath(TEXT("test buffers.bin"));
+	FFileHelper::SaveArrayToFile(External, *BinPath);
+
+	const FString Json = TEXT(R"({"asset":{"version":"2.0"},"buffers":[)")
+		TEXT(R"({"byteLength":3,"uri":"data:application/octet-stream;base64,QUJD"},)")
+		TEXT(R"({"byteLength":8,"uri":"test%20buffers.bin"},)")
+		TEXT(R"({"byteLength":4,"uri":"missing.bin"},)")
+		TEXT(R"({"byteLength":4,"uri":"data:text/plain,abcd"}]})");
+	const FTCHARToUTF8 JsonUtf8(*Json);
+	TArray<uint8> JsonBytes(reinterpret_cast<const uint8*>(JsonUtf8.Get()), JsonUtf8.Length());
+
+	// Unresolvable buffers are logged and left empty rather than failing the load
+	AddExpectedError(TEXT("is unavailable"), EAutomationExpectedErrorFlags::Contains, 2);
+	{
+		FString Error;
+		TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(MoveTemp(JsonBytes), Error, GltfPath);
+		TestTrue(TEXT(".gltf document should load"), Document.IsValid());
+		if (Document.IsValid())
+		{
+			TestFalse(TEXT(".gltf is not a GLB container"), Document->IsGlb());
+			TestEqual(TEXT("All buffers parsed"), Document->GetModel().Buffers.Num(), 4);
+			TestTrue(TEXT("data: URI flagged"), Document->GetModel().Buffers[0].bDataUri);
+			TestEqual(TEXT("Only the data: URI header is kept"), Document->GetModel().Buffers[0].Uri, FString(TEXT("data:application/octet-stream;base64")));
+
+			const TArrayView<const uint8> Embedded = Document->GetBufferData(0);
+			TestTrue(TEXT("data: URI decoded"), Embedded.Num() == 3 && Embedded[0] == 'A' && Embedded[2] == 'C');
+
+			const TArrayView<const uint8> Sibling = Document->GetBufferData(1);
+			TestTrue(TEXT("Percent-encoded sibling file loaded"), Sibling.Num() == 8 && FMemory::Memcmp(Sibling.GetData(), External.GetData(), 8) == 0);
+
+			TestEqual(TEXT("Missing file leaves the buffer empty"), Document->GetBufferData(2).Num(), 0);
+			TestEqual(TEXT("Non-base64 data: URI is rejected"), Document->GetBufferData(3).Num(), 0);
+			TestEqual(TEXT("Out-of-range buffer is empty"), Document->GetBufferData(4).Num(), 0);
+		}
+	}
+
+	// Embedding the sibling file makes the bytes load without it, as a .gltf and as a GLB
+	const FString SiblingJson = TEXT(R"({"asset":{"version":"2.0"},"buffers":[)")
+		TEXT(R"({"byteLength":3,"uri":"data:application/octet-stream;base64,QUJD"},)")
+		TEXT(R"({"byteLength":8,"uri":"test%20buffers.bin"}],"nodes":[{"name":"after"}]})");
+	const FTCHARToUTF8 SiblingUtf8(*SiblingJson);
+	for (const bool bGlb : { false, true })
+	{
+		TArray<uint8> Bytes = bGlb ? CreateSyntheticGlb(SiblingJson) : TArray<uint8>(reinterpret_cast<const uint8*>(SiblingUtf8.Get()), SiblingUtf8.Length());
+		FString Error;
+		const bool bEmbedded = FVrmGlbDocument::EmbedExternalBuffers(Bytes, GltfPath, Error);
+		TestTrue(FString::Printf(TEXT("External buffers embed (%s)"), *Error), bEmbedded);
+
+		TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(MoveTemp(Bytes), Error);
+		if (TestTrue(TEXT("Embedded document loads without a source path"), Document.IsValid()))
+		{
+			TestEqual(TEXT("Container kind kept"), Document->IsGlb(), bGlb);
+			const TArrayView<const uint8> Sibling = Document->GetBufferData(1);
+			TestTrue(TEXT("Sibling file embedded"), Sibling.Num() == 8 && FMemory::Memcmp(Sibling.GetData(), External.GetData(), 8) == 0);
+			TestEqual(TEXT("Embedded data: URI untouched"), Document->GetBufferData(0).Num(), 3);
+			TestTrue(TEXT("JSON after the buffers intact"), Document->GetModel().Nodes.Num() == 1);
+		}
+	}
+
+	// A sibling file that cannot be read fails the embedding and names it, leaving the bytes as they were
+	{
+		const FTCHARToUTF8 MissingUtf8(TEXT(R"({"asset":{"version":"2.0"},"buffers":[{"byteLength":4,"uri":"missing.bin"}]})"));
+		const TArray<uint8> MissingBytes(reinterpret_cast<const uint8*>(MissingUtf8.Get()), MissingUtf8.Length());
+		TArray<uint8> Bytes = MissingBytes;
+		FString Error;
+		AddExpectedError(TEXT("is unavailable"), EAutomationExpectedErrorFlags::Contains, 1);
+		TestFalse(TEXT("Missing sibling file fails"), FVrmGlbDocument::EmbedExternalBuffers(Bytes, GltfPath, Error));
+		TestTrue(TEXT("Error names the file"), Error.Contains(TEXT("missing.bin")));
+		TestTrue(TEXT("Bytes unchanged on failure"), Bytes == MissingBytes);
+	}
+
+	IFileManager::Get().Delete(*BinPath);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGlbDocumentContentHashTest, "VrmToolchain.VrmParser.ContentHash", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGlbDocumentContentHashTest::RunTest(const FString& Parameters)
+{
+	FString Error;
+	const TArray<uint8> GlbData = CreateSyntheticGlb(TEXT(R"({"asset":{"version":"2.0"}})"));
+	TSharedPtr<FVrmGlbDocument> Viewed = FVrmGlbDocument::LoadFromView(GlbData, Error);
+	TSharedPtr<FVrmGlbDocument> Owned = FVrmGlbDocument::LoadFromBytes(TArray<uint8>(GlbData), Error);
+	TestTrue(TEXT("Documents should parse"), Viewed.IsValid() && Owned.IsValid());
+	if (!Viewed.IsValid() || !Owned.IsValid())
+	{
+		return false;
+	}
+	TestEqual(TEXT("Same bytes, same hash however they are held"), Viewed->ComputeContentHash(), Owned->ComputeContentHash());
+
+	// A .gltf whose only buffer is a sibling file: the JSON is unchanged, the buffer content is not
+	const FString GltfPath = GetTestTempFilePath(TEXT("test_hash.gltf"));
+	const FString BinPath = GetTestTempFilePath(TEXT("test_hash.bin"));
+	const FTCHARToUTF8 JsonUtf8(TEXT(R"({"asset":{"version":"2.0"},"buffers":[{"byteLength":4,"uri":"test_hash.bin"}]})"));
+	const TArray<uint8> JsonBytes(reinterpret_cast<const uint8*>(JsonUtf8.Get()), JsonUtf8.Length());
+
+	FIoHash Hashes[2];
+	for (int32 Variant = 0; Variant < 2; ++Variant)
+	{
+		const TArray<uint8> BinData = { 1, 2, 3, static_cast<uint8>(4 + Variant) };
+		FFileHelper::SaveArrayToFile(BinData, *BinPath);
+
+		// Buffered so the sibling file is not left mapped when it is rewritten
+		FFileHelper::SaveArrayToFile(JsonBytes, *GltfPath);
+		TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromFile(GltfPath, Error, EVrmGlbReadMode::Buffered);
+		TestTrue(TEXT(".gltf document should load"), Document.IsValid() && Document->GetBufferData(0).Num() == 4);
+		if (Document.IsValid())
+		{
+			Hashes[Variant] = Document->ComputeContentHash();
+		}
+	}
+	TestNotEqual(TEXT("External buffer content is part of the hash"), Hashes[0], Hashes[1]);
+
+	IFileManager::Get().Delete(*GltfPath);
+	IFileManager::Get().Delete(*BinPath);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmParserProbeTest, "VrmToolchain.VrmParser.Probe", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmParserProbeTest::RunTest(const FString& Parameters)
+{
+	FString Vrm1Json = TEXT(R"({"asset":{"version":"2.0"},"extensions":{"VRMC_vrm":{"specVersion":"1.0","meta":{"name":"Probe Model"},"humanoid":{"humanBones":{}},"expressions":{}},"VRMC_springBone":{}}})");
+	TArray<uint8> GlbData = CreateSyntheticGlb(Vrm1Json);
+	const uint32 JsonChunkLength = GlbData.Num() - 20;
+
+	// Append a BIN chunk; the probe must report its length without reading it
+	const uint32 BinChunkLength = 64;
+	const uint32 BinChunkType = 0x004E4942; // "BIN\0"
+	GlbData.Append(reinterpret_cast<const uint8*>(&BinChunkLength), sizeof(uint32));
+	GlbData.Append(reinterpret_cast<const uint8*>(&BinChunkType), sizeof(uint32));
+	GlbData.AddZeroed(BinChunkLength);
+	const uint32 TotalLength = GlbData.Num();
+	FMemory::Memcpy(GlbData.GetData() + 8, &TotalLength, sizeof(uint32));
+
+	FString TempFilePath = GetTestTempFilePath(TEXT("test_probe.vrm"));
+	FFileHelper::SaveArrayToFile(GlbData, *TempFilePath);
+
+	FVrmProbeResult Probe;
+	FString Error;
+	TestTrue(TEXT("Probe should succeed"), FVrmParser::ProbeVrmFile(TempFilePath, Probe, Error));
+	TestEqual(TEXT("Probe version"), Probe.Version, EVrmVersion::VRM1);
+	TestEqual(TEXT("Probe GLB length"), Probe.GlbLength, TotalLength);
+	TestEqual(TEXT("Probe JSON length"), Probe.JsonLength, JsonChunkLength);
+	TestEqual(TEXT("Probe BIN length"), Probe.BinLength, BinChunkLength);
+	TestTrue(TEXT("Probe humanoid flag"), Probe.bHasHumanoid);
+	TestTrue(TEXT("Probe spring bone flag"), Probe.bHasSpringBones);
+	TestTrue(TEXT("Probe expressions flag"), Probe.bHasBlendShapesOrExpressions);
+	TestFalse(TEXT("Probe thumbnail flag"), Probe.bHasThumbnail);
+	TestEqual(TEXT("Metadata from probe"), FVrmParser::ExtractVrmMetadata(Probe).Name, FString(TEXT("Probe Model")));
+
+	// Truncated file: header only
+	TArray<uint8> Truncated(GlbData.GetData(), 12);
+	FFileHelper::SaveArrayToFile(Truncated, *TempFilePath);
+	TestFalse(TEXT("Truncated file should fail the probe"), FVrmParser::ProbeVrmFile(TempFilePath, Probe, Error));
+	TestFalse(TEXT("Truncated file should report an error"), Error.IsEmpty());
+
+	IFileManager::Get().Delete(*TempFilePath);
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
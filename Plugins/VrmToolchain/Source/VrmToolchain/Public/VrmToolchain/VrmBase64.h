@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Base64 decoding for glTF data: URIs.
+ *
+ * Standard alphabet (RFC 4648), optional '=' padding, no whitespace. Full runs of characters are
+ * validated and packed with SSE2/NEON; the remainder and the padding go through a lookup table.
+ */
+namespace VrmBase64
+{
+	/** Decoded size of an encoded string, or INDEX_NONE if no valid encoding has that length */
+	VRMTOOLCHAIN_API int64 GetDecodedSize(FAnsiStringView Encoded);
+
+	/**
+	 * Decodes a base64 string
+	 * @param Encoded Base64 text
+	 * @param OutBytes Decoded bytes (reset on failure)
+	 * @return False on characters outside the alphabet or an invalid length
+	 */
+	VRMTOOLCHAIN_API bool Decode(FAnsiStringView Encoded, TArray<uint8>& OutBytes);
+}
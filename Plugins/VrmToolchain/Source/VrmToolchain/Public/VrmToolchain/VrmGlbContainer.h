@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** GLB chunk type tags (ASCII, little-endian uint32) */
+namespace EVrmGlbChunkType
+{
+	enum Type : uint32
+	{
+		Json = 0x4E4F534A, // "JSON"
+		Bin = 0x004E4942 // "BIN\0"
+	};
+}
+
+/** Entry of the GLB chunk table */
+struct FVrmGlbChunk
+{
+	/** Chunk type (see EVrmGlbChunkType; unknown types are recorded too) */
+	uint32 Type = 0;
+
+	/** Offset of the chunk payload from the start of the file */
+	int64 Offset = 0;
+
+	/** Length of the chunk payload in bytes */
+	uint32 Length = 0;
+};
+
+/**
+ * Validated GLB header and chunk table.
+ *
+ * Parse checks the header once and records every chunk (type, payload offset, length) in file
+ * order, so readers look chunks up by index instead of re-walking the container with their own
+ * bounds checks. The container references the bytes passed to Parse; the caller keeps them alive.
+ */
+class VRMTOOLCHAIN_API FVrmGlbContainer
+{
+public:
+	static constexpr uint32 Magic = 0x46546C67; // "glTF"
+	static constexpr uint32 Version = 2;
+	static constexpr int64 HeaderSize = 12;
+	static constexpr int64 ChunkHeaderSize = 8;
+
+	/**
+	 * Validates the 12-byte GLB header (magic, version, declared length)
+	 * @param HeaderBytes At least HeaderSize bytes
+	 * @param DataSize Number of bytes actually available (file or buffer size)
+	 * @param OutLength Declared container length on success
+	 * @param OutError Error description on failure
+	 */
+	static bool ValidateHeader(const uint8* HeaderBytes, int64 DataSize, uint32& OutLength, FString& OutError);
+
+	/**
+	 * Validates the header and builds the chunk table, replacing any previous contents
+	 * @param Bytes GLB file contents; must outlive the container and every chunk view
+	 * @param OutError Error description on failure
+	 * @return True if the container is well formed and has a JSON chunk
+	 */
+	bool Parse(TArrayView<const uint8> Bytes, FString& OutError);
+
+	void Reset();
+
+	bool IsValid() const { return JsonChunkIndex != INDEX_NONE; }
+
+	/** Length declared in the GLB header */
+	uint32 GetLength() const { return Length; }
+
+	/** All chunks found in the container, in file order */
+	const TArray<FVrmGlbChunk>& GetChunks() const { return Chunks; }
+
+	/** Index of the first chunk of the given type, or INDEX_NONE */
+	int32 FindChunk(uint32 Type) const;
+
+	/** Payload of a chunk from the table (empty for invalid indices) */
+	TArrayView<const uint8> GetChunkData(int32 ChunkIndex) const;
+
+	/** Raw (UTF-8) payload of the JSON chunk */
+	TArrayView<const uint8> GetJsonChunk() const { return GetChunkData(JsonChunkIndex); }
+
+	/** Payload of the first BIN chunk (empty if the file has none) */
+	TArrayView<const uint8> GetBinChunk() const { return GetChunkData(BinChunkIndex); }
+
+private:
+	TArrayView<const uint8> Bytes;
+	TArray<FVrmGlbChunk> Chunks;
+	uint32 Length = 0;
+
+	/** First JSON/BIN chunks, resolved during Parse */
+	int32 JsonChunkIndex = INDEX_NONE;
+	int32 BinChunkIndex = INDEX_NONE;
+};
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VrmToolchain/VrmMappedFile.h"
+#include "VrmToolchain/VrmGlbContainer.h"
+#include "VrmToolchain/VrmJsonDom.h"
+#include "VrmToolchain/VrmGltfModel.h"
+#include "IO/IoHash.h"
+
+/** How FVrmGlbDocument::LoadFromFile accesses the file */
+enum class EVrmGlbReadMode : uint8
+{
+	/** Memory-map the file; chunk views point into the mapping (falls back to Buffered when mapping fails) */
+	MemoryMapped,
+
+	/** Read the whole file into a heap buffer owned by the document */
+	Buffered,
+};
+
+/**
+ * Parsed-once GLB/VRM document.
+ *
+ * Holds the file bytes, the chunk table, the parsed JSON DOM, the typed glTF model built from it
+ * and the data of every glTF buffer: the BIN chunk, sibling files referenced by relative URI
+ * (memory-mapped like the document) and decoded data: URIs. Plain .gltf JSON files load too; their
+ * buffers are all external or embedded.
+ * One import reads and parses the file once and hands this object to every stage
+ * (metadata extraction, feature detection, skeleton extraction, accessor decoding, conversion).
+ */
+class VRMTOOLCHAIN_API FVrmGlbDocument
+{
+public:
+	using FChunk = FVrmGlbChunk;
+
+	/**
+	 * Opens a .vrm/.glb file from disk and parses it.
+	 * In MemoryMapped mode the JSON and BIN chunk views read straight from the page cache,
+	 * so the file contents are never copied onto the heap.
+	 * @param FilePath Path to the VRM/GLB file
+	 * @param OutError Error description when loading fails
+	 * @param ReadMode File access strategy
+	 * @return The parsed document, or nullptr on failure
+	 */
+	static TSharedPtr<FVrmGlbDocument> LoadFromFile(const FString& FilePath, FString& OutError, EVrmGlbReadMode ReadMode = EVrmGlbReadMode::MemoryMapped);
+
+	/**
+	 * Parses a GLB container that is already in memory; the document takes ownership of the bytes
+	 * @param Bytes GLB file contents
+	 * @param OutError Error description when parsing fails
+	 * @param SourcePath File the bytes came from, used to resolve external buffer URIs (optional)
+	 * @return The parsed document, or nullptr on failure
+	 */
+	static TSharedPtr<FVrmGlbDocument> LoadFromBytes(TArray<uint8>&& Bytes, FString& OutError, const FString& SourcePath = FString());
+
+	/**
+	 * Parses a GLB container without copying it. The caller must keep the bytes alive
+	 * for as long as the document (or any view obtained from it) is in use.
+	 * @param Bytes GLB file contents
+	 * @param OutError Error description when parsing fails
+	 * @param SourcePath File the bytes came from, used to resolve external buffer URIs (optional)
+	 * @return The parsed document, or nullptr on failure
+	 */
+	static TSharedPtr<FVrmGlbDocument> LoadFromView(TArrayView<const uint8> Bytes, FString& OutError, const FString& SourcePath = FString());
+
+	/**
+	 * Makes .gltf/.glb bytes self-contained: every buffer read from a sibling file is embedded as a base64
+	 * data: URI in the JSON (GLB chunks are rewritten around the new JSON chunk), so the bytes load without
+	 * the files next to SourcePath. Bytes without external buffers, or that do not parse, are left untouched.
+	 * @param InOutBytes File contents, replaced by the embedded document
+	 * @param SourcePath File the bytes came from, to resolve external buffer URIs against
+	 * @param OutError Which buffer could not be read, or why the result cannot be stored
+	 * @return False (bytes unchanged) when an external buffer is missing or shorter than its byteLength
+	 */
+	static bool EmbedExternalBuffers(TArray<uint8>& InOutBytes, const FString& SourcePath, FString& OutError);
+
+	/** Path the document was loaded from (empty for in-memory documents) */
+	const FString& GetSourcePath() const { return SourcePath; }
+
+	/** True for LoadFromView documents: the bytes belong to the caller, who must keep them alive for every use */
+	bool BorrowsBytes() const { return bBorrowedBytes; }
+
+	/** True if the document bytes are a memory mapping of the source file */
+	bool IsMemoryMapped() const { return MappedFile.IsValid() && MappedFile->IsMapped(); }
+
+	/** Full GLB file contents */
+	TArrayView<const uint8> GetBytes() const { return Bytes; }
+
+	/** Validated header and chunk table shared by every reader of this document */
+	const FVrmGlbContainer& GetContainer() const { return Container; }
+
+	/** All chunks found in the container, in file order */
+	const TArray<FChunk>& GetChunks() const { return Container.GetChunks(); }
+
+	/** True for a GLB container, false for a plain .gltf JSON document */
+	bool IsGlb() const { return Container.IsValid(); }
+
+	/** Raw (UTF-8) payload of the JSON chunk (the whole file for .gltf) */
+	TArrayView<const uint8> GetJsonChunk() const { return JsonBytes; }
+
+	/** Payload of the first BIN chunk (empty if the file has none) */
+	TArrayView<const uint8> GetBinChunk() const { return Container.GetBinChunk(); }
+
+	/**
+	 * Data of a glTF buffer, resolved at load time: the BIN chunk, an external file or a decoded data: URI.
+	 * Empty for invalid indices and for buffers that could not be resolved (the reason is logged) or carry
+	 * no data, such as EXT_meshopt_compression fallback buffers.
+	 */
+	TArrayView<const uint8> GetBufferData(int32 BufferIndex) const
+	{
+		return BufferData.IsValidIndex(BufferIndex) ? BufferData[BufferIndex] : TArrayView<const uint8>();
+	}
+
+	/**
+	 * Hash of everything the document was built from: the file bytes plus the data of buffers that live
+	 * outside them (sibling files, decoded data: URIs). Equal hashes mean equal content wherever it was loaded from.
+	 */
+	FIoHash ComputeContentHash() const;
+
+	/** Parsed JSON DOM (arena-backed; lives as long as the document) */
+	const FVrmJsonDom& GetJson() const { return Json; }
+
+	/** Root of the JSON DOM; not an object if the JSON chunk could not be parsed */
+	const FVrmJsonValue& GetJsonRoot() const { return Json.GetRoot(); }
+
+	/** Typed glTF model (accessors, meshes, nodes, skins, ...); empty if the JSON chunk could not be parsed */
+	const FVrmGltfModel& GetModel() const { return Model; }
+
+private:
+	FVrmGlbDocument() = default;
+
+	/** Builds the chunk table and parses the JSON chunk */
+	bool Parse(FString& OutError);
+
+	/** Loads or decodes the data of every glTF buffer into BufferData */
+	void ResolveBuffers();
+
+	FString SourcePath;
+
+	/** Whether external buffers may be memory-mapped (follows the document's own read mode) */
+	bool bMapExternalBuffers = true;
+
+	/** Set by LoadFromView */
+	bool bBorrowedBytes = false;
+
+	/** Storage when the document owns its bytes (empty for borrowed views) */
+	TArray<uint8> OwnedBytes;
+
+	/** Backing file when loaded from disk (mapped, or buffered fallback) */
+	TUniquePtr<FVrmMappedFile> MappedFile;
+
+	/** View over the document bytes (OwnedBytes, MappedFile or caller-owned memory) */
+	TArrayView<const uint8> Bytes;
+
+	FVrmGlbContainer Container;
+
+	/** JSON text: the GLB JSON chunk, or the whole file for .gltf */
+	TArrayView<const uint8> JsonBytes;
+
+	/** Data of every glTF buffer, index-aligned with Model.Buffers */
+	TArray<TArrayView<const uint8>> BufferData;
+
+	/** Storage for buffers decoded from data: URIs */
+	TArray<TArray<uint8>> DecodedBuffers;
+
+	/** Sibling files backing external buffers */
+	TArray<TUniquePtr<FVrmMappedFile>> ExternalBuffers;
+
+	FVrmJsonDom Json;
+	FVrmGltfModel Model;
+};
@@ -0,0 +1,397 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VrmToolchain/VrmMetadata.h"
+
+struct FVrmJsonValue;
+
+/** glTF accessor componentType values */
+namespace EVrmGltfComponentType
+{
+	enum Type : int32
+	{
+		None = 0,
+		Byte = 5120,
+		UnsignedByte = 5121,
+		Short = 5122,
+		UnsignedShort = 5123,
+		UnsignedInt = 5125,
+		Float = 5126
+	};
+
+	/** Size of one component in bytes, or 0 if the type is invalid */
+	VRMTOOLCHAIN_API int32 GetSize(int32 ComponentType);
+
+	/**
+	 * Reads one component as float. Normalized integers map to [0, 1] (unsigned) or [-1, 1] (signed)
+	 * as in the glTF spec and KHR_mesh_quantization; other integers keep their value.
+	 */
+	inline float ReadAsFloat(const uint8* Component, int32 ComponentType, bool bNormalized)
+	{
+		switch (ComponentType)
+		{
+		case Byte:
+		{
+			const int8 Value = static_cast<int8>(Component[0]);
+			return bNormalized ? FMath::Max(Value / 127.0f, -1.0f) : static_cast<float>(Value);
+		}
+		case UnsignedByte:
+			return bNormalized ? Component[0] / 255.0f : static_cast<float>(Component[0]);
+		case Short:
+		{
+			int16 Value;
+			FMemory::Memcpy(&Value, Component, sizeof(Value));
+			return bNormalized ? FMath::Max(Value / 32767.0f, -1.0f) : static_cast<float>(Value);
+		}
+		case UnsignedShort:
+		{
+			uint16 Value;
+			FMemory::Memcpy(&Value, Component, sizeof(Value));
+			return bNormalized ? Value / 65535.0f : static_cast<float>(Value);
+		}
+		default:
+		{
+			float Value;
+			FMemory::Memcpy(&Value, Component, sizeof(Value));
+			return Value;
+		}
+		}
+	}
+}
+
+/** glTF accessor element type */
+enum class EVrmGltfAccessorType : uint8
+{
+	Unknown,
+	Scalar,
+	Vec2,
+	Vec3,
+	Vec4,
+	Mat2,
+	Mat3,
+	Mat4
+};
+
+/** glTF material alpha mode */
+enum class EVrmGltfAlphaMode : uint8
+{
+	Opaque,
+	Mask,
+	Blend
+};
+
+/** Contiguous range into one of the FVrmGltfModel index pools */
+struct FVrmGltfRange
+{
+	int32 First = 0;
+	int32 Num = 0;
+};
+
+struct FVrmGltfBuffer
+{
+	int64 ByteLength = 0;
+
+	/**
+	 * External URI, as authored (relative to the document, possibly percent-encoded); empty for the GLB
+	 * BIN chunk. For data: URIs only the header up to the comma is kept; the payload stays in the JSON DOM.
+	 */
+	FString Uri;
+
+	bool bDataUri = false;
+};
+
+/** EXT_meshopt_compression bitstream kind */
+enum class EVrmGltfMeshoptMode : uint8
+{
+	Unknown,
+	Attributes,
+	Triangles,
+	Indices
+};
+
+/** EXT_meshopt_compression post-decode filter (ATTRIBUTES only) */
+enum class EVrmGltfMeshoptFilter : uint8
+{
+	Unknown,
+	None,
+	Octahedral,
+	Quaternion,
+	Exponential
+};
+
+/** bufferView.extensions.EXT_meshopt_compression: where the compressed bytes live and how to decode them */
+struct FVrmGltfMeshoptCompression
+{
+	/** Buffer holding the compressed stream; INDEX_NONE when the view is not compressed */
+	int32 Buffer = INDEX_NONE;
+	int64 ByteOffset = 0;
+	int64 ByteLength = 0;
+
+	/** Size of one decoded element (vertex or index) */
+	int32 ByteStride = 0;
+
+	/** Number of decoded elements */
+	int32 Count = 0;
+
+	EVrmGltfMeshoptMode Mode = EVrmGltfMeshoptMode::Unknown;
+	EVrmGltfMeshoptFilter Filter = EVrmGltfMeshoptFilter::None;
+};
+
+struct FVrmGltfBufferView
+{
+	/** For compressed views this is the uncompressed fallback, which may carry no data */
+	int32 Buffer = INDEX_NONE;
+	int64 ByteOffset = 0;
+	int64 ByteLength = 0;
+
+	/** 0 when the view is tightly packed */
+	int32 ByteStride = 0;
+
+	FVrmGltfMeshoptCompression Meshopt;
+
+	bool IsCompressed() const { return Meshopt.Buffer != INDEX_NONE; }
+};
+
+/** accessor.sparse: Count elements substituted over the base; indices and values are tightly packed */
+struct FVrmGltfAccessorSparse
+{
+	int32 Count = 0;
+
+	int32 IndicesBufferView = INDEX_NONE;
+	int64 IndicesByteOffset = 0;
+	int32 IndicesComponentType = EVrmGltfComponentType::None;
+
+	/** Values share the accessor's componentType and type */
+	int32 ValuesBufferView = INDEX_NONE;
+	int64 ValuesByteOffset = 0;
+};
+
+struct FVrmGltfAccessor
+{
+	/** INDEX_NONE for sparse accessors whose base is all zeros */
+	int32 BufferView = INDEX_NONE;
+	int64 ByteOffset = 0;
+	int32 ComponentType = EVrmGltfComponentType::None;
+	int32 Count = 0;
+	EVrmGltfAccessorType Type = EVrmGltfAccessorType::Unknown;
+	bool bNormalized = false;
+	FVrmGltfAccessorSparse Sparse;
+
+	bool IsSparse() const { return Sparse.Count > 0; }
+
+	/** Number of components per element (0 for unknown types) */
+	int32 GetComponentCount() const;
+
+	/** Size of one tightly packed element in bytes */
+	int32 GetElementSize() const { return EVrmGltfComponentType::GetSize(ComponentType) * GetComponentCount(); }
+};
+
+/** One morph target of a primitive; attribute deltas are accessor indices (INDEX_NONE when absent) */
+struct FVrmGltfMorphTarget
+{
+	int32 Position = INDEX_NONE;
+	int32 Normal = INDEX_NONE;
+	int32 Tangent = INDEX_NONE;
+};
+
+/** One primitive of a mesh; attribute values are accessor indices (INDEX_NONE when absent) */
+struct FVrmGltfPrimitive
+{
+	static constexpr int32 MaxTexCoordSets = 4;
+	static constexpr int32 MaxInfluenceSets = 4;
+
+	int32 Position = INDEX_NONE;
+	int32 Normal = INDEX_NONE;
+	int32 Tangent = INDEX_NONE;
+	int32 Color0 = INDEX_NONE;
+	int32 TexCoords[MaxTexCoordSets] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	int32 Joints[MaxInfluenceSets] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	int32 Weights[MaxInfluenceSets] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+
+	int32 Indices = INDEX_NONE;
+	int32 Material = INDEX_NONE;
+
+	/** Topology; 4 = TRIANGLES */
+	int32 Mode = 4;
+
+	/** Owning mesh */
+	int32 Mesh = INDEX_NONE;
+
+	/** Range into FVrmGltfModel::MorphTargets (every primitive of a mesh has the same number of targets) */
+	FVrmGltfRange Targets;
+};
+
+struct FVrmGltfMesh
+{
+	FString Name;
+
+	/** Morph target names from extras.targetNames (the de-facto convention; empty if not authored) */
+	TArray<FString> TargetNames;
+
+	/** Range into FVrmGltfModel::Primitives */
+	FVrmGltfRange Primitives;
+};
+
+struct FVrmGltfNode
+{
+	FString Name;
+
+	/** Derived from the children lists (INDEX_NONE for roots) */
+	int32 Parent = INDEX_NONE;
+
+	/** Range into FVrmGltfModel::NodeChildren */
+	FVrmGltfRange Children;
+
+	int32 Mesh = INDEX_NONE;
+	int32 Skin = INDEX_NONE;
+
+	/** Local TRS; when bHasMatrix is set, Matrix holds the authored transform instead */
+	FVector Translation = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector Scale = FVector::OneVector;
+	bool bHasMatrix = false;
+
+	/** glTF column-major matrix loaded as-is, i.e. UE row-vector convention (origin in row 3) */
+	FMatrix Matrix = FMatrix::Identity;
+};
+
+struct FVrmGltfSkin
+{
+	FString Name;
+	int32 InverseBindMatrices = INDEX_NONE;
+	int32 Skeleton = INDEX_NONE;
+
+	/** Range into FVrmGltfModel::SkinJoints (node indices) */
+	FVrmGltfRange Joints;
+};
+
+struct FVrmGltfImage
+{
+	FString Name;
+	FString MimeType;
+	FString Uri;
+	int32 BufferView = INDEX_NONE;
+};
+
+struct FVrmGltfTexture
+{
+	int32 Source = INDEX_NONE;
+	int32 Sampler = INDEX_NONE;
+};
+
+struct FVrmGltfMaterial
+{
+	FString Name;
+	FLinearColor BaseColorFactor = FLinearColor::White;
+	int32 BaseColorTexture = INDEX_NONE;
+	float MetallicFactor = 1.0f;
+	float RoughnessFactor = 1.0f;
+	int32 MetallicRoughnessTexture = INDEX_NONE;
+	int32 NormalTexture = INDEX_NONE;
+	int32 EmissiveTexture = INDEX_NONE;
+	FLinearColor EmissiveFactor = FLinearColor::Black;
+	EVrmGltfAlphaMode AlphaMode = EVrmGltfAlphaMode::Opaque;
+	float AlphaCutoff = 0.5f;
+	bool bDoubleSided = false;
+
+	/** KHR_materials_unlit */
+	bool bUnlit = false;
+
+	/** VRMC_materials_mtoon (VRM1) or a VRM/MToon materialProperties entry (VRM0) */
+	bool bMToon = false;
+};
+
+/** Humanoid bone mapping from the VRM extension */
+struct FVrmGltfHumanBone
+{
+	/** VRM bone name (e.g. "hips", "leftUpperArm") */
+	FName Bone;
+	int32 Node = INDEX_NONE;
+};
+
+/** The parts of the VRM0 "VRM" / VRM1 "VRMC_vrm" extensions that the import pipeline consumes */
+struct FVrmGltfVrmExtension
+{
+	EVrmVersion Version = EVrmVersion::Unknown;
+	TArray<FVrmGltfHumanBone> HumanBones;
+
+	/** VRM1 meta.thumbnailImage (image index) */
+	int32 ThumbnailImage = INDEX_NONE;
+
+	/** VRM0 meta.texture (texture index) */
+	int32 ThumbnailTexture = INDEX_NONE;
+
+	/** VRM0 blendShapeMaster groups or VRM1 preset + custom expressions */
+	int32 NumExpressions = 0;
+
+	/** VRM0 secondaryAnimation (in the extension or at the root) or VRMC_springBone / VRMC_vrm.springBone */
+	bool bHasSpringBones = false;
+
+	/** Node mapped to the given bone, or INDEX_NONE */
+	int32 FindHumanBoneNode(FName Bone) const;
+};
+
+/**
+ * Typed glTF model built once from the JSON DOM.
+ *
+ * Every glTF top-level array is a flat TArray of POD-style structs and every cross reference is
+ * an int32 index (INDEX_NONE when absent), so the import stages index arrays instead of looking
+ * up JSON members by name. Variable-length lists (mesh primitives, node children, skin joints)
+ * are ranges into shared pools. Indices are stored as authored; use the IsValid* helpers before
+ * dereferencing them.
+ */
+class VRMTOOLCHAIN_API FVrmGltfModel
+{
+public:
+	/**
+	 * Builds the model from a parsed glTF JSON root, replacing any previous contents
+	 * @param Root glTF JSON root object
+	 * @param OutError Error description on failure
+	 * @return False if the root is not an object, or a size, offset or count is not an integer in range
+	 *         (the model is still built, with 0 in place of the malformed values)
+	 */
+	bool Build(const FVrmJsonValue& Root, FString& OutError);
+
+	void Reset();
+
+	TArray<FVrmGltfBuffer> Buffers;
+	TArray<FVrmGltfBufferView> BufferViews;
+	TArray<FVrmGltfAccessor> Accessors;
+	TArray<FVrmGltfMesh> Meshes;
+	TArray<FVrmGltfPrimitive> Primitives;
+	TArray<FVrmGltfNode> Nodes;
+	TArray<FVrmGltfSkin> Skins;
+	TArray<FVrmGltfImage> Images;
+	TArray<FVrmGltfTexture> Textures;
+	TArray<FVrmGltfMaterial> Materials;
+	FVrmGltfVrmExtension Vrm;
+
+	/** Index pools referenced by FVrmGltfRange members */
+	TArray<int32> NodeChildren;
+	TArray<int32> SkinJoints;
+	TArray<FVrmGltfMorphTarget> MorphTargets;
+
+	TConstArrayView<FVrmGltfPrimitive> GetPrimitives(const FVrmGltfMesh& Mesh) const { return Slice(Primitives, Mesh.Primitives); }
+	TConstArrayView<int32> GetChildren(const FVrmGltfNode& Node) const { return Slice(NodeChildren, Node.Children); }
+	TConstArrayView<int32> GetJoints(const FVrmGltfSkin& Skin) const { return Slice(SkinJoints, Skin.Joints); }
+	TConstArrayView<FVrmGltfMorphTarget> GetTargets(const FVrmGltfPrimitive& Primitive) const { return Slice(MorphTargets, Primitive.Targets); }
+
+	bool IsValidAccessor(int32 Index) const { return Accessors.IsValidIndex(Index); }
+	bool IsValidBufferView(int32 Index) const { return BufferViews.IsValidIndex(Index); }
+	bool IsValidNode(int32 Index) const { return Nodes.IsValidIndex(Index); }
+
+	/** Local transform of a node (its matrix, or TRS composed), glTF axes, UE row-vector convention */
+	static FMatrix GetLocalMatrix(const FVrmGltfNode& Node);
+
+	/** Transform of a node composed with its ancestors', glTF axes (identity for invalid indices) */
+	FMatrix GetWorldMatrix(int32 NodeIndex) const;
+
+private:
+	template<typename T>
+	static TConstArrayView<T> Slice(const TArray<T>& Pool, const FVrmGltfRange& Range)
+	{
+		return (Range.Num > 0 && Range.First >= 0 && Range.First + Range.Num <= Pool.Num())
+			? TConstArrayView<T>(Pool.GetData() + Range.First, Range.Num)
+			: TConstArrayView<T>();
+	}
+};
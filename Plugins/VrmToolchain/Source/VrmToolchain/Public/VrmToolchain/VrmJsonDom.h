@@ -0,0 +1,166 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+struct FVrmJsonMember;
+
+/** Value type of an FVrmJsonValue */
+enum class EVrmJsonType : uint8
+{
+	Null,
+	Boolean,
+	Number,
+	String,
+	Array,
+	Object
+};
+
+/** Interned object key; every distinct key string exists once per FVrmJsonDom */
+struct FVrmJsonKey
+{
+	const ANSICHAR* Chars = nullptr;
+	int32 Len = 0;
+	uint32 Hash = 0;
+
+	FAnsiStringView View() const { return FAnsiStringView(Chars, Len); }
+};
+
+/**
+ * Immutable JSON value living in an FVrmJsonDom arena (16 bytes, no reference counting).
+ * Arrays and objects are contiguous spans; strings are null-terminated UTF-8.
+ * Lookups on the wrong type return nullptr / defaults instead of asserting.
+ */
+struct VRMTOOLCHAIN_API FVrmJsonValue
+{
+	EVrmJsonType Type = EVrmJsonType::Null;
+	bool bBoolean = false;
+
+	/** String length in bytes, array element count or object member count */
+	int32 Count = 0;
+
+	union
+	{
+		double Number;
+		const ANSICHAR* Chars;
+		const FVrmJsonValue* Elements;
+		const FVrmJsonMember* Members;
+	};
+
+	FVrmJsonValue() : Number(0.0) {}
+
+	bool IsNull() const { return Type == EVrmJsonType::Null; }
+	bool IsObject() const { return Type == EVrmJsonType::Object; }
+	bool IsArray() const { return Type == EVrmJsonType::Array; }
+	bool IsString() const { return Type == EVrmJsonType::String; }
+	bool IsNumber() const { return Type == EVrmJsonType::Number; }
+
+	double AsNumber(double Default = 0.0) const { return IsNumber() ? Number : Default; }
+	/** Number that is an exact int32; Default for other types, fractions and out-of-range values */
+	int32 AsInt(int32 Default = INDEX_NONE) const;
+	bool AsBool(bool bDefault = false) const { return Type == EVrmJsonType::Boolean ? bBoolean : bDefault; }
+
+	/** UTF-8 bytes of a string value (empty for other types) */
+	FAnsiStringView AsUtf8() const { return IsString() ? FAnsiStringView(Chars, Count) : FAnsiStringView(); }
+
+	/** Decoded string value (empty for other types) */
+	FString AsString() const;
+
+	/** True if this is a string equal to the given ASCII text */
+	bool StringEquals(FAnsiStringView Ascii) const;
+
+	/** Elements of an array value (empty for other types) */
+	TConstArrayView<FVrmJsonValue> AsArray() const { return IsArray() ? TConstArrayView<FVrmJsonValue>(Elements, Count) : TConstArrayView<FVrmJsonValue>(); }
+
+	/** Members of an object value, in document order (empty for other types) */
+	TConstArrayView<FVrmJsonMember> GetMembers() const;
+
+	/** Member lookup by key text; nullptr if this is not an object or the key is absent */
+	const FVrmJsonValue* Find(FAnsiStringView Key) const;
+
+	/** Member lookup by interned key (pointer compare); see FVrmJsonDom::FindKey */
+	const FVrmJsonValue* Find(const FVrmJsonKey* Key) const;
+
+	/** Array element lookup; nullptr if this is not an array or the index is out of range */
+	const FVrmJsonValue* At(int32 Index) const { return (IsArray() && Index >= 0 && Index < Count) ? &Elements[Index] : nullptr; }
+
+	bool HasField(FAnsiStringView Key) const { return Find(Key) != nullptr; }
+
+	/** Member that is an object; nullptr otherwise */
+	const FVrmJsonValue* FindObject(FAnsiStringView Key) const;
+
+	/** Member that is an array; empty view otherwise */
+	TConstArrayView<FVrmJsonValue> FindArray(FAnsiStringView Key) const;
+
+	bool TryGetNumber(FAnsiStringView Key, double& OutValue) const;
+	/** False when the member is absent, not a number, or not an exact int32 */
+	bool TryGetInt(FAnsiStringView Key, int32& OutValue) const;
+	bool TryGetString(FAnsiStringView Key, FString& OutValue) const;
+};
+
+/** Object member: interned key plus value */
+struct FVrmJsonMember
+{
+	const FVrmJsonKey* Key = nullptr;
+	FVrmJsonValue Value;
+};
+
+/**
+ * Arena-backed JSON DOM.
+ *
+ * Every node, string and key is bump-allocated from large blocks owned by the DOM and released
+ * together when it is destroyed, so a parse costs a handful of block allocations instead of one
+ * heap allocation (plus a reference count) per node. Object keys are interned: callers that look up
+ * the same key in many objects can resolve it once with FindKey and compare pointers.
+ */
+class VRMTOOLCHAIN_API FVrmJsonDom
+{
+public:
+	FVrmJsonDom();
+	~FVrmJsonDom();
+
+	FVrmJsonDom(FVrmJsonDom&&);
+	FVrmJsonDom& operator=(FVrmJsonDom&&);
+	FVrmJsonDom(const FVrmJsonDom&) = delete;
+	FVrmJsonDom& operator=(const FVrmJsonDom&) = delete;
+
+	/**
+	 * Parses UTF-8 JSON text, replacing any previous contents
+	 * @param Utf8 JSON text (e.g. a GLB JSON chunk); not referenced after the call
+	 * @param OutError Error description on failure
+	 * @return True if the text is valid JSON
+	 */
+	bool Parse(TArrayView<const uint8> Utf8, FString& OutError);
+
+	/** Root value (Null before a successful parse) */
+	const FVrmJsonValue& GetRoot() const { return Root; }
+
+	/** Interned key for the given text, or nullptr if no object in the document uses it */
+	const FVrmJsonKey* FindKey(FAnsiStringView Key) const;
+
+	/** Bytes reserved by the arena */
+	int64 GetAllocatedSize() const { return AllocatedSize; }
+
+	/** Releases all nodes */
+	void Reset();
+
+private:
+	struct FParseContext;
+
+	void* Allocate(int64 Size, int64 Alignment);
+	const FVrmJsonKey* InternKey(FAnsiStringView Key);
+	const ANSICHAR* CopyString(FAnsiStringView Text);
+	bool ParseValue(FParseContext& Context, FVrmJsonValue& OutValue, int32 Depth);
+
+	/** Arena blocks */
+	TArray<TUniquePtr<uint8[]>> Blocks;
+	uint8* BlockCursor = nullptr;
+	int64 BlockRemaining = 0;
+	int64 AllocatedSize = 0;
+
+	/** Open-addressing key table (power-of-two size) */
+	TArray<const FVrmJsonKey*> KeyTable;
+	int32 NumKeys = 0;
+
+	FVrmJsonValue Root;
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FVrmJsonReader;
+
+/**
+ * Streaming presence scanner for a fixed set of JSON member paths.
+ *
+ * Callers register dotted member paths (e.g. "extensions.VRM.humanoid"), then scan UTF-8 JSON once.
+ * Only objects on a registered path are descended into; every other subtree (accessors, meshes,
+ * nodes, ...) is skipped by bracket counting without being tokenized or allocated. Scanning stops
+ * as soon as every path is found or the optional stop condition reports the answer is known.
+ */
+class VRMTOOLCHAIN_API FVrmJsonPathScanner
+{
+public:
+	/**
+	 * Registers a member path to look for
+	 * @param DottedPath Member names separated by '.', starting at the root object (ASCII)
+	 * @return Index used with WasFound/WasCompleted
+	 */
+	int32 AddPath(FAnsiStringView DottedPath);
+
+	/**
+	 * Optional early-out, evaluated every time a path is found or completed.
+	 * Return true once the caller's result can no longer change.
+	 */
+	void SetStopCondition(TFunction<bool(const FVrmJsonPathScanner&)> InStopCondition) { StopCondition = MoveTemp(InStopCondition); }
+
+	/**
+	 * Scans the JSON text. Results from a previous scan are cleared first.
+	 * Input after an early stop is not validated.
+	 * @param Utf8 JSON text (e.g. the JSON chunk of a GLB file)
+	 * @return False if the root is not an object or the text is malformed before the scan finished
+	 */
+	bool Scan(TArrayView<const uint8> Utf8);
+
+	/** True if the member at the path exists (any value type) */
+	bool WasFound(int32 PathIndex) const { return Found.IsValidIndex(PathIndex) && Found[PathIndex]; }
+
+	/** True if the member at the path is an object that was scanned to its end */
+	bool WasCompleted(int32 PathIndex) const { return Completed.IsValidIndex(PathIndex) && Completed[PathIndex]; }
+
+	/** True if the last scan ended through the stop condition or because every path was found */
+	bool StoppedEarly() const { return bStoppedEarly; }
+
+private:
+	enum class EScanResult : uint8
+	{
+		Continue,
+		Stop,
+		Error
+	};
+
+	EScanResult ScanObject(FVrmJsonReader& Reader, int32 Depth, TConstArrayView<int32> Candidates);
+	bool ShouldStop() const;
+
+	struct FPath
+	{
+		/** Segment boundaries into Text */
+		TArray<ANSICHAR> Text;
+		TArray<TPair<int32, int32>> Segments;
+	};
+
+	TArray<FPath> Paths;
+	TBitArray<> Found;
+	TBitArray<> Completed;
+	int32 NumFound = 0;
+	bool bStoppedEarly = false;
+	TFunction<bool(const FVrmJsonPathScanner&)> StopCondition;
+};
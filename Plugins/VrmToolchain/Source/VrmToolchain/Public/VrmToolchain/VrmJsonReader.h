@@ -0,0 +1,188 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/**
+ * Token kinds produced by FVrmJsonReader
+ */
+enum class EVrmJsonToken : uint8
+{
+	None,
+	BeginObject,
+	EndObject,
+	BeginArray,
+	EndArray,
+	Key,
+	String,
+	Number,
+	True,
+	False,
+	Null,
+	EndOfInput,
+	Error
+};
+
+/**
+ * Forward-only pull reader over UTF-8 JSON (e.g. the JSON chunk of a GLB file).
+ *
+ * Reads the chunk bytes in place: nothing is transcoded to TCHAR and no strings are allocated
+ * unless a caller asks for a decoded value. Keys are compared as raw bytes against ASCII
+ * literals, which is how every glTF/VRM schema key is spelled.
+ *
+ * Typical use:
+ *   FVrmJsonReader Reader(JsonBytes);
+ *   while (Reader.Next() == EVrmJsonToken::Key)
+ *   {
+ *       if (Reader.KeyEquals("asset")) { ... } else { Reader.SkipValue(); }
+ *   }
+ */
+class VRMTOOLCHAIN_API FVrmJsonReader
+{
+public:
+	explicit FVrmJsonReader(TArrayView<const uint8> InJson);
+
+	/** Advances to the next token. Returns EndOfInput after the root value, Error on malformed input */
+	EVrmJsonToken Next();
+
+	/** Current token */
+	EVrmJsonToken GetToken() const { return Token; }
+
+	/**
+	 * Skips the value at the current position without tokenizing it.
+	 * On a Key token the value that follows is read and skipped; on BeginObject/BeginArray the reader
+	 * moves to the matching end token; on scalar tokens this is a no-op.
+	 * @return False if the input ended or was malformed
+	 */
+	bool SkipValue();
+
+	/**
+	 * Visits each member of the object starting at the current BeginObject token (after a Key, the
+	 * value is read first). OnMember is called on each Key token and returns true if it consumed the
+	 * member value itself; otherwise the value is skipped. Non-object values are skipped.
+	 * @return False if the input was malformed
+	 */
+	template <typename FuncType>
+	bool ForEachMember(FuncType&& OnMember)
+	{
+		if (Token == EVrmJsonToken::Key)
+		{
+			Next();
+		}
+		if (Token != EVrmJsonToken::BeginObject)
+		{
+			return SkipValue();
+		}
+		while (Next() == EVrmJsonToken::Key)
+		{
+			if (!OnMember() && !SkipValue())
+			{
+				return false;
+			}
+		}
+		return Token == EVrmJsonToken::EndObject;
+	}
+
+	/** True if the current token is a key whose raw bytes equal the given ASCII string */
+	bool KeyEquals(FAnsiStringView AsciiKey) const;
+
+	/** True if the current token is a key or string whose raw bytes equal the given ASCII string */
+	bool RawEquals(FAnsiStringView Ascii) const;
+
+	/** Raw bytes of the current key or string token, between the quotes (escape sequences not decoded) */
+	FUtf8StringView GetRawString() const;
+
+	/** True if the raw bytes of the current key or string token contain escape sequences */
+	bool HasEscapes() const { return bStringHasEscapes; }
+
+	/** Decoded value of the current key or string token */
+	FString GetString() const;
+
+	/** Value of the current number token */
+	double GetNumber() const;
+
+	/** Container nesting depth at the current position (0 at the root) */
+	int32 GetDepth() const { return ContainerStack.Num(); }
+
+	/** Byte offset of the current token in the input */
+	int64 GetTokenOffset() const { return TokenOffset; }
+
+	/** Byte offset just past the current token */
+	int64 GetTokenEndOffset() const { return TokenEndOffset; }
+
+	/** Error description once Next() has returned Error */
+	const FString& GetError() const { return Error; }
+
+	/**
+	 * Decodes a raw JSON string body (the bytes between the quotes) to an FString
+	 * @param Raw String body; may contain escape sequences
+	 */
+	static FString DecodeString(FUtf8StringView Raw);
+
+	/**
+	 * Resolves escape sequences in a raw JSON string body, keeping the result as UTF-8
+	 * @param Raw String body; may contain escape sequences
+	 * @param Utf8 Receives the unescaped UTF-8 bytes (not null-terminated)
+	 */
+	static void UnescapeString(FUtf8StringView Raw, TArray<ANSICHAR>& Utf8);
+
+	/**
+	 * Value of a raw JSON number token
+	 * @param Raw Number text, of any length
+	 */
+	static double ParseNumber(FUtf8StringView Raw);
+
+private:
+	void SkipWhitespace();
+	bool ScanString();
+	bool ScanNumber();
+	bool ScanLiteral(FAnsiStringView Literal, EVrmJsonToken LiteralToken);
+	void CompleteValue();
+	EVrmJsonToken Fail(const TCHAR* Message);
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	int64 Pos = 0;
+
+	EVrmJsonToken Token = EVrmJsonToken::None;
+	int64 TokenOffset = 0;
+	int64 TokenEndOffset = 0;
+
+	/** For string/key tokens: payload range between the quotes */
+	int64 StringBegin = 0;
+	int64 StringEnd = 0;
+	bool bStringHasEscapes = false;
+
+	/** Open containers: '{' or '[' */
+	TArray<uint8, TInlineAllocator<32>> ContainerStack;
+
+	bool bNeedsSeparator = false;
+	bool bAfterKey = false;
+	bool bRootDone = false;
+
+	FString Error;
+};
+
+namespace VrmJson
+{
+	/**
+	 * Builds an FJsonObject DOM straight from UTF-8 bytes (no intermediate TCHAR copy of the text)
+	 * @param Utf8 JSON text
+	 * @param OutRoot Parsed root object
+	 * @return True if the text is a valid JSON object
+	 */
+	VRMTOOLCHAIN_API bool DeserializeUtf8(TArrayView<const uint8> Utf8, TSharedPtr<FJsonObject>& OutRoot);
+
+	/** Exact int32 value of a JSON number; false when it is not finite, has a fraction or is out of range */
+	inline bool TryConvertToInt32(double Number, int32& OutValue)
+	{
+		// MIN_int32 and MAX_int32 + 1 are powers of two, so both bounds are exact in double (NaN fails them)
+		if (!(Number >= static_cast<double>(MIN_int32) && Number < static_cast<double>(MAX_int32) + 1.0) || Number != FMath::FloorToDouble(Number))
+		{
+			return false;
+		}
+		OutValue = static_cast<int32>(Number);
+		return true;
+	}
+}
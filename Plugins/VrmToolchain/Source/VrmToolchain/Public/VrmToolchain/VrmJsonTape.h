@@ -0,0 +1,165 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FVrmJsonTape;
+
+/**
+ * Handle to one value on an FVrmJsonTape (tape pointer + entry index, passed by value).
+ *
+ * Nothing is decoded until it is asked for: strings and numbers are read from the JSON bytes on
+ * access. Lookups on missing members or the wrong type return an invalid handle, which tests false
+ * and behaves like an empty value, so chained lookups need no intermediate checks.
+ */
+class VRMTOOLCHAIN_API FVrmJsonTapeValue
+{
+public:
+	/** Iterates the elements of an array (or the values of an object) */
+	class FIterator
+	{
+	public:
+		FIterator(const FVrmJsonTape* InTape, int32 InIndex, bool bInObjectValues)
+			: Tape(InTape), Index(InIndex), bObjectValues(bInObjectValues)
+		{
+		}
+
+		FVrmJsonTapeValue operator*() const { return FVrmJsonTapeValue(Tape, bObjectValues ? Index + 1 : Index); }
+		FIterator& operator++();
+		bool operator!=(const FIterator& Other) const { return Index != Other.Index; }
+
+	private:
+		const FVrmJsonTape* Tape;
+		int32 Index;
+		bool bObjectValues;
+	};
+
+	/** Range-for adaptor over FIterator */
+	struct FRange
+	{
+		FIterator Begin;
+		FIterator End;
+
+		FIterator begin() const { return Begin; }
+		FIterator end() const { return End; }
+	};
+
+	FVrmJsonTapeValue() = default;
+
+	bool IsValid() const { return Tape != nullptr; }
+	explicit operator bool() const { return IsValid(); }
+
+	/** Pointer-style access, so a handle can stand in for the `const FVrmJsonValue*` returned by DOM lookups */
+	const FVrmJsonTapeValue* operator->() const { return this; }
+
+	bool IsObject() const { return FirstByte() == '{'; }
+	bool IsArray() const { return FirstByte() == '['; }
+	bool IsString() const { return FirstByte() == '"'; }
+	bool IsNumber() const;
+	bool IsNull() const { return FirstByte() == 'n'; }
+
+	double AsNumber(double Default = 0.0) const;
+	/** Number that is an exact int32; Default for other types, fractions and out-of-range values */
+	int32 AsInt(int32 Default = INDEX_NONE) const;
+	bool AsBool(bool bDefault = false) const;
+
+	/** Decoded string value (empty for other types) */
+	FString AsString() const;
+
+	/** True if this is a string equal to the given ASCII text */
+	bool StringEquals(FAnsiStringView Ascii) const;
+
+	/** Number of array elements or object members (walks the container's children) */
+	int32 Num() const;
+
+	/** Member lookup by key; invalid if this is not an object or the key is absent */
+	FVrmJsonTapeValue Find(FAnsiStringView Key) const;
+
+	/** Array element lookup; invalid if this is not an array or the index is out of range */
+	FVrmJsonTapeValue At(int32 Index) const;
+
+	bool HasField(FAnsiStringView Key) const { return Find(Key).IsValid(); }
+
+	/** Member that is an object; invalid otherwise */
+	FVrmJsonTapeValue FindObject(FAnsiStringView Key) const;
+
+	/** Elements of a member that is an array; empty otherwise */
+	FRange FindArray(FAnsiStringView Key) const { return Find(Key).AsArray(); }
+
+	/** Elements of an array value (empty for other types) */
+	FRange AsArray() const;
+
+	bool TryGetNumber(FAnsiStringView Key, double& OutValue) const;
+	/** False when the member is absent, not a number, or not an exact int32 */
+	bool TryGetInt(FAnsiStringView Key, int32& OutValue) const;
+	bool TryGetString(FAnsiStringView Key, FString& OutValue) const;
+
+private:
+	friend class FVrmJsonTape;
+
+	FVrmJsonTapeValue(const FVrmJsonTape* InTape, int32 InIndex)
+		: Tape(InTape), Index(InIndex)
+	{
+	}
+
+	uint8 FirstByte() const;
+	FUtf8StringView GetRawString() const;
+	bool RawEquals(FAnsiStringView Ascii) const;
+
+	const FVrmJsonTape* Tape = nullptr;
+	int32 Index = INDEX_NONE;
+};
+
+/**
+ * Structural index ("tape") over UTF-8 JSON for on-demand field access.
+ *
+ * Build makes one pass over the text and records, for every token, its byte offset and either its
+ * length (scalars) or the tape index just past its matching end (containers). That is 8 bytes per
+ * token and no strings, nodes or hash tables, so a handful of fields can be read from JSON chunks
+ * of hundreds of megabytes without building a DOM. Skipping a subtree is a single jump.
+ *
+ * The tape references the JSON bytes passed to Build; the caller keeps them alive.
+ */
+class VRMTOOLCHAIN_API FVrmJsonTape
+{
+public:
+	/**
+	 * Indexes UTF-8 JSON text, replacing any previous contents
+	 * @param Utf8 JSON text; must outlive the tape and every handle obtained from it
+	 * @param OutError Error description on failure
+	 * @return True if the text is valid JSON
+	 */
+	bool Build(TArrayView<const uint8> Utf8, FString& OutError);
+
+	/** Root value (invalid before a successful build) */
+	FVrmJsonTapeValue GetRoot() const { return Entries.Num() > 0 ? FVrmJsonTapeValue(this, 0) : FVrmJsonTapeValue(); }
+
+	/** Number of tape entries (one per token, container ends excluded) */
+	int32 Num() const { return Entries.Num(); }
+
+	/** Bytes used by the tape itself */
+	int64 GetAllocatedSize() const { return Entries.GetAllocatedSize(); }
+
+	void Reset();
+
+private:
+	friend class FVrmJsonTapeValue;
+	friend class FVrmJsonTapeValue::FIterator;
+
+	struct FEntry
+	{
+		/** Byte offset of the token */
+		uint32 Offset;
+
+		/** Containers: tape index past the matching end. Scalars: token length in bytes, plus EscapeFlag */
+		uint32 Payload;
+	};
+
+	/** Set in the payload of strings/keys whose raw bytes contain escape sequences */
+	static constexpr uint32 EscapeFlag = 1u << 31;
+
+	/** Index of the value following the one at Index in its container */
+	int32 NextIndex(int32 Index) const;
+
+	TArrayView<const uint8> Json;
+	TArray<FEntry> Entries;
+};
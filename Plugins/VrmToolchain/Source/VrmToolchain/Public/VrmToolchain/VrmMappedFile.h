@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Read-only view over a file on disk.
+ *
+ * Uses the platform memory-mapping API (IMappedFileHandle/IMappedFileRegion) so callers read
+ * straight from the page cache without an intermediate heap copy. Platforms or files that
+ * cannot be mapped fall back to a single buffered read into an owned array.
+ */
+class VRMTOOLCHAIN_API FVrmMappedFile
+{
+public:
+	~FVrmMappedFile();
+
+	FVrmMappedFile(const FVrmMappedFile&) = delete;
+	FVrmMappedFile& operator=(const FVrmMappedFile&) = delete;
+
+	/**
+	 * Maps a file for reading
+	 * @param FilePath Path of the file to open
+	 * @param OutError Error description when the file cannot be opened or read
+	 * @param bAllowMapping If false, always use a buffered read (e.g. for files that may change while in use)
+	 * @return The opened file, or nullptr on failure
+	 */
+	static TUniquePtr<FVrmMappedFile> Open(const FString& FilePath, FString& OutError, bool bAllowMapping = true);
+
+	/** File contents; valid for the lifetime of this object */
+	TArrayView<const uint8> GetView() const { return View; }
+
+	/** True if the view points into a memory mapping rather than a heap copy */
+	bool IsMapped() const { return MappedRegion.IsValid(); }
+
+	const FString& GetFilePath() const { return FilePath; }
+
+private:
+	FVrmMappedFile() = default;
+
+	FString FilePath;
+
+	/** Declared before the region so the region is released first */
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** Fallback storage when mapping is unavailable */
+	TArray<uint8> BufferedBytes;
+
+	TArrayView<const uint8> View;
+};
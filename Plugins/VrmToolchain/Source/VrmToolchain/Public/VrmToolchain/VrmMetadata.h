@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "VrmMetadata.generated.h"
 
+class FVrmGlbDocument;
+
 /**
  * VRM version enumeration
  */
@@ -52,6 +54,40 @@ struct VRMTOOLCHAIN_API FVrmMetadata
 	}
 };
 
+/**
+ * Result of a header-only probe of a .vrm/.glb file.
+ * Only the GLB header, the chunk headers and the JSON chunk are read; the BIN payload is never touched.
+ */
+struct FVrmProbeResult
+{
+	/** Detected VRM version (Unknown for plain glTF or unparsable JSON) */
+	EVrmVersion Version = EVrmVersion::Unknown;
+
+	/** Total length declared in the GLB header */
+	uint32 GlbLength = 0;
+
+	/** Length of the JSON chunk payload */
+	uint32 JsonLength = 0;
+
+	/** Length of the BIN chunk payload (0 if the file has none) */
+	uint32 BinLength = 0;
+
+	/** Whether the VRM extension defines a humanoid */
+	bool bHasHumanoid = false;
+
+	/** Whether spring bones are defined (VRM0 secondaryAnimation / VRMC_springBone) */
+	bool bHasSpringBones = false;
+
+	/** Whether blend shapes (VRM0) or expressions (VRM1) are defined */
+	bool bHasBlendShapesOrExpressions = false;
+
+	/** Whether a thumbnail is referenced */
+	bool bHasThumbnail = false;
+
+	/** Raw UTF-8 JSON chunk, kept so callers can extract metadata without reading the file again */
+	TArray<uint8> JsonChunk;
+};
+
 /**
  * VRM file parsing and metadata extraction utilities
  */
@@ -65,6 +101,13 @@ public:
 	 */
 	static EVrmVersion DetectVrmVersion(const FString& FilePath);
 
+	/**
+	 * Detects the VRM version from an already parsed GLB document, with the rules of ScanVrmFeatures
+	 * @param Document The parsed GLB document
+	 * @return The detected VRM version (Unknown, VRM0, or VRM1)
+	 */
+	static EVrmVersion DetectVrmVersion(const FVrmGlbDocument& Document);
+
 	/**
 	 * Extracts VRM metadata from a .vrm or .glb file
 	 * @param FilePath Path to the VRM/GLB file
@@ -72,6 +115,44 @@ public:
 	 */
 	static FVrmMetadata ExtractVrmMetadata(const FString& FilePath);
 
+	/**
+	 * Extracts VRM metadata from an already parsed GLB document
+	 * @param Document The parsed GLB document
+	 * @return A struct with populated metadata fields (empty if parsing fails)
+	 */
+	static FVrmMetadata ExtractVrmMetadata(const FVrmGlbDocument& Document);
+
+	/**
+	 * Extracts VRM metadata from the JSON chunk captured by a probe
+	 * @param Probe Result of ProbeVrmFile
+	 * @return A struct with populated metadata fields (empty if the probe has no JSON)
+	 */
+	static FVrmMetadata ExtractVrmMetadata(const FVrmProbeResult& Probe);
+
+	/**
+	 * Probes a .vrm or .glb file using positioned reads of the GLB header, the chunk headers
+	 * and the JSON chunk only. Suitable for scanning large libraries.
+	 * @param FilePath Path to the VRM/GLB file
+	 * @param OutProbe Version, chunk lengths and basic feature flags
+	 * @param OutError Error description when the file is not a readable GLB container
+	 * @return True if the GLB container was read (an unparsable JSON chunk still succeeds with Version Unknown)
+	 */
+	static bool ProbeVrmFile(const FString& FilePath, FVrmProbeResult& OutProbe, FString& OutError);
+
+	/**
+	 * Detects the VRM version and feature flags of glTF JSON text without building a DOM; the one rule
+	 * set behind ProbeVrmFile and the editor's meta feature detection. VRMC_vrm takes precedence over VRM.
+	 * VRM0 flags: humanoid, secondaryAnimation, blendShapeMaster and meta.texture (thumbnail) in extensions.VRM,
+	 * or secondaryAnimation, blendShapeMaster and thumbnail at the root as some exporters write them.
+	 * VRM1 flags: humanoid, expressions or blendShapeMaster, thumbnail and springBone in extensions.VRMC_vrm,
+	 * or extensions.VRMC_springBone for spring bones.
+	 * The scan stops once the result is final; text after that point is not validated.
+	 * @param JsonUtf8 UTF-8 JSON text
+	 * @param OutProbe Receives Version and the feature flags (other fields are left alone)
+	 * @return False if the JSON is malformed before the result is final (version and flags are then left alone)
+	 */
+	static bool ScanVrmFeatures(TArrayView<const uint8> JsonUtf8, FVrmProbeResult& OutProbe);
+
 	/**
 	 * Reads the GLB file and extracts the JSON chunk
 	 * @param FilePath Path to the GLB file
@@ -109,6 +109,7 @@ private:
 #if WITH_EDITORONLY_DATA
     /**
      * Raw source bytes (never cooked by default).
+     * Self-contained: buffers a .gltf/.glb read from sibling files are embedded as data: URIs on import.
      * Private to prevent Details panel from freezing on large files (~15MB).
      * Use GetSourceBytes()/SetSourceBytes() for access.
      */
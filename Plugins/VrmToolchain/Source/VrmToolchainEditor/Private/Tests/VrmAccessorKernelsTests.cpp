@@ -0,0 +1,224 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "VrmAccessorKernels.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmAccessorKernels_MatchScalar,
+    "VrmToolchain.Editor.Import.AccessorKernels.MatchScalar",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmAccessorKernels_MatchScalar::RunTest(const FString& Parameters)
+{
+    // Source bytes with a recognizable pattern; counts cover empty, tails and full SIMD blocks
+    TArray<uint8> Source;
+    Source.SetNumUninitialized(4096);
+    for (int32 i = 0; i < Source.Num(); ++i)
+    {
+        Source[i] = uint8((i * 7 + 3) & 0xFF);
+    }
+
+    TArray<float> FloatSource;
+    FloatSource.SetNumUninitialized(1024);
+    for (int32 i = 0; i < FloatSource.Num(); ++i)
+    {
+        FloatSource[i] = (i % 2 == 0) ? float(i) * 0.5f : -float(i) * 0.25f;
+    }
+    const uint8* FloatBytes = reinterpret_cast<const uint8*>(FloatSource.GetData());
+
+    const int32 Counts[] = { 0, 1, 3, 4, 5, 17, 33 };
+    for (const int32 Count : Counts)
+    {
+        // FLOAT VEC3 with axis conversion, packed (stride 12) and interleaved (stride 20)
+        for (const int32 Stride : { 12, 20 })
+        {
+            TArray<FVector3f> Decoded;
+            Decoded.SetNumZeroed(Count);
+            VrmAccessorKernels::DecodeFloat3SwapYZ(FloatBytes, Stride, Count, Decoded.GetData());
+
+            bool bMatches = true;
+            for (int32 i = 0; i < Count; ++i)
+            {
+                const float* In = reinterpret_cast<const float*>(FloatBytes + i * Stride);
+                bMatches &= Decoded[i] == FVector3f(In[0], In[2], -In[1]);
+            }
+            TestTrue(FString::Printf(TEXT("Float3 swap matches scalar (count %d, stride %d)"), Count, Stride), bMatches);
+        }
+
+        // UNSIGNED_BYTE and UNSIGNED_SHORT widening, packed and strided
+        for (const int32 Lanes : { 1, 4 })
+        {
+            for (const int32 Padding : { 0, 4 })
+            {
+                TArray<uint32> Widened8;
+                Widened8.SetNumZeroed(Count * Lanes);
+                const int32 Stride8 = Lanes + Padding;
+                VrmAccessorKernels::WidenU8ToU32(Source.GetData(), Stride8, Lanes, Count, Widened8.GetData());
+
+                TArray<uint32> Widened16;
+                Widened16.SetNumZeroed(Count * Lanes);
+                const int32 Stride16 = Lanes * 2 + Padding;
+                VrmAccessorKernels::WidenU16ToU32(Source.GetData(), Stride16, Lanes, Count, Widened16.GetData());
+
+                bool bMatches = true;
+                for (int32 i = 0; i < Count; ++i)
+                {
+                    for (int32 Lane = 0; Lane < Lanes; ++Lane)
+                    {
+                        const uint16* Shorts = reinterpret_cast<const uint16*>(Source.GetData() + i * Stride16);
+                        bMatches &= Widened8[i * Lanes + Lane] == Source[i * Stride8 + Lane];
+                        bMatches &= Widened16[i * Lanes + Lane] == Shorts[Lane];
+                    }
+                }
+                TestTrue(FString::Printf(TEXT("Widening matches scalar (count %d, lanes %d, padding %d)"), Count, Lanes, Padding), bMatches);
+            }
+        }
+
+        // Straight copies
+        TArray<FVector2f> Copied;
+        Copied.SetNumZeroed(Count);
+        VrmAccessorKernels::CopyElements(FloatBytes, 12, sizeof(FVector2f), Count, Copied.GetData());
+        bool bCopyMatches = true;
+        for (int32 i = 0; i < Count; ++i)
+        {
+            bCopyMatches &= Copied[i] == FVector2f(FloatSource[i * 3], FloatSource[i * 3 + 1]);
+        }
+        TestTrue(FString::Printf(TEXT("Strided copy (count %d)"), Count), bCopyMatches);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmAccessorKernels_Dequantize,
+    "VrmToolchain.Editor.Import.AccessorKernels.Dequantize",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmAccessorKernels_Dequantize::RunTest(const FString& Parameters)
+{
+    // Byte pattern that covers the extremes of every integer type (0x80 / 0x8000 hit the -1 clamp)
+    TArray<uint8> Source;
+    Source.SetNumUninitialized(1024);
+    for (int32 i = 0; i < Source.Num(); ++i)
+    {
+        Source[i] = uint8((i * 37 + 0x7F) & 0xFF);
+    }
+
+    const int32 ComponentTypes[] = {
+        EVrmGltfComponentType::Byte,
+        EVrmGltfComponentType::UnsignedByte,
+        EVrmGltfComponentType::Short,
+        EVrmGltfComponentType::UnsignedShort
+    };
+
+    for (const int32 ComponentType : ComponentTypes)
+    {
+        const int32 ComponentSize = EVrmGltfComponentType::GetSize(ComponentType);
+        for (const bool bNormalized : { false, true })
+        {
+            for (const int32 Lanes : { 2, 3, 4 })
+            {
+                // Packed and 4-byte aligned vertex strides (the layouts KHR_mesh_quantization produces)
+                const int32 Stride = Align(Lanes * ComponentSize, 4);
+                const bool bSwapYZ = Lanes == 3;
+                for (const int32 Count : { 0, 1, 2, 7, 33 })
+                {
+                    TArray<float> Decoded;
+                    Decoded.SetNumZeroed(Count * Lanes);
+                    VrmAccessorKernels::DequantizeToFloat(Source.GetData(), Stride, ComponentType, bNormalized, Lanes, bSwapYZ, Count, Decoded.GetData());
+
+                    bool bMatches = true;
+                    for (int32 i = 0; i < Count; ++i)
+                    {
+                        float Expected[4];
+                        for (int32 Lane = 0; Lane < Lanes; ++Lane)
+                        {
+                            Expected[Lane] = EVrmGltfComponentType::ReadAsFloat(Source.GetData() + i * Stride + Lane * ComponentSize, ComponentType, bNormalized);
+                        }
+                        if (bSwapYZ)
+                        {
+                            const float Y = Expected[1];
+                            Expected[1] = Expected[2];
+                            Expected[2] = -Y;
+                        }
+
+                        for (int32 Lane = 0; Lane < Lanes; ++Lane)
+                        {
+                            bMatches &= FMath::IsNearlyEqual(Decoded[i * Lanes + Lane], Expected[Lane], 1e-6f * FMath::Max(1.0f, FMath::Abs(Expected[Lane])));
+                        }
+                    }
+                    TestTrue(FString::Printf(TEXT("Dequantize matches scalar (type %d, normalized %d, lanes %d, count %d)"), ComponentType, bNormalized, Lanes, Count), bMatches);
+                }
+            }
+        }
+    }
+
+    // Spec mapping at the extremes
+    const uint8 MinByte = 0x80;
+    const uint8 MaxByte = 0xFF;
+    TestEqual(TEXT("Normalized BYTE -128 clamps to -1"), EVrmGltfComponentType::ReadAsFloat(&MinByte, EVrmGltfComponentType::Byte, true), -1.0f);
+    TestEqual(TEXT("Normalized UNSIGNED_BYTE 255 is 1"), EVrmGltfComponentType::ReadAsFloat(&MaxByte, EVrmGltfComponentType::UnsignedByte, true), 1.0f);
+    TestEqual(TEXT("Unnormalized BYTE keeps its value"), EVrmGltfComponentType::ReadAsFloat(&MinByte, EVrmGltfComponentType::Byte, false), -128.0f);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmAccessorKernels_ReduceInfluences,
+    "VrmToolchain.Editor.Import.AccessorKernels.ReduceInfluences",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmAccessorKernels_ReduceInfluences::RunTest(const FString& Parameters)
+{
+    // Vertex 0: one set spread over two joints plus a negative weight. Vertex 1: three sets, nine positive
+    // weights, of which only the six largest fit. Vertex 2: no weight at all.
+    const FVector4f Set0[] = { FVector4f(3.0f, 1.0f, 0.0f, -1.0f), FVector4f(9.0f, 1.0f, 8.0f, 2.0f), FVector4f(0.0f) };
+    const FVector4f Set1[] = { FVector4f(0.0f), FVector4f(7.0f, 0.0f, 3.0f, 6.0f), FVector4f(0.0f) };
+    const FVector4f Set2[] = { FVector4f(0.0f), FVector4f(0.0f, 5.0f, 4.0f, 0.0f), FVector4f(0.0f) };
+    const FIntVector4 Joints0[] = { FIntVector4(10, 11, 12, 13), FIntVector4(0, 1, 2, 3), FIntVector4(0) };
+    const FIntVector4 Joints1[] = { FIntVector4(0), FIntVector4(4, 5, 6, 7), FIntVector4(0) };
+    const FIntVector4 Joints2[] = { FIntVector4(0), FIntVector4(8, 9, 10, 11), FIntVector4(0) };
+
+    const FVector4f* SetWeights[] = { Set0, Set1, Set2 };
+    const FIntVector4* SetJoints[] = { Joints0, Joints1, Joints2 };
+
+    constexpr int32 MaxInfluences = 6;
+    float Weights[3 * MaxInfluences];
+    int32 Joints[3 * MaxInfluences];
+    uint8 Counts[3];
+    VrmAccessorKernels::ReduceInfluences(SetWeights, SetJoints, 3, 3, MaxInfluences, Weights, Joints, Counts);
+
+    // Sorted per vertex so the test does not depend on the order influences are kept in
+    auto Influences = [&](int32 Vertex)
+    {
+        TArray<TPair<int32, float>> Result;
+        for (int32 Influence = 0; Influence < Counts[Vertex]; ++Influence)
+        {
+            Result.Emplace(Joints[Vertex * MaxInfluences + Influence], Weights[Vertex * MaxInfluences + Influence]);
+        }
+        Result.Sort([](const TPair<int32, float>& A, const TPair<int32, float>& B) { return A.Key < B.Key; });
+        return Result;
+    };
+
+    const TArray<TPair<int32, float>> Vertex0 = Influences(0);
+    TestEqual(TEXT("Zero and negative weights dropped"), Vertex0.Num(), 2);
+    TestTrue(TEXT("Weights renormalized"), Vertex0.Num() == 2 && Vertex0[0].Key == 10 && FMath::IsNearlyEqual(Vertex0[0].Value, 0.75f)
+        && Vertex0[1].Key == 11 && FMath::IsNearlyEqual(Vertex0[1].Value, 0.25f));
+
+    // Kept: 9, 8, 7, 6, 5, 4 (joints 0, 2, 4, 7, 9, 10); dropped: 3, 2, 1
+    const TArray<TPair<int32, float>> Vertex1 = Influences(1);
+    TArray<int32> KeptJoints;
+    float Sum = 0.0f;
+    for (const TPair<int32, float>& Influence : Vertex1)
+    {
+        KeptJoints.Add(Influence.Key);
+        Sum += Influence.Value;
+    }
+    TestTrue(TEXT("Top-K across sets"), KeptJoints == TArray<int32>({ 0, 2, 4, 7, 9, 10 }));
+    TestTrue(TEXT("Top-K weights sum to 1"), FMath::IsNearlyEqual(Sum, 1.0f, 1e-5f));
+    TestTrue(TEXT("Top-K weight scaled by the kept total"), Vertex1.Num() == 6 && FMath::IsNearlyEqual(Vertex1[0].Value, 9.0f / 39.0f, 1e-6f));
+
+    TestEqual(TEXT("Unweighted vertex has no influences"), int32(Counts[2]), 0);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
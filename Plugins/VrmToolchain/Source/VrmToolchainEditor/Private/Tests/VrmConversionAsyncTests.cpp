@@ -0,0 +1,115 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Engine/SkeletalMesh.h"
+#include "Rendering/SkeletalMeshModel.h"
+
+#include "VrmConversionService.h"
+#include "VrmAssetNaming.h"
+#include "VrmToolchain/VrmGlbDocument.h"
+#include "VrmToolchain/VrmSourceAsset.h"
+#include "Tests/VrmTestGlb.h"
+
+namespace
+{
+    /** What OnComplete reported */
+    struct FConversionOutcome
+    {
+        bool bDone = false;
+        bool bSuccess = false;
+        USkeletalMesh* Mesh = nullptr;
+        FString Error;
+    };
+
+    UVrmSourceAsset* MakeSkinnedQuadSource(const FString& BaseName)
+    {
+        UPackage* Package = CreatePackage(*FVrmAssetNaming::MakeVrmSourcePackagePath(TEXT("/Game/TestAssets"), BaseName));
+        UVrmSourceAsset* Source = NewObject<UVrmSourceAsset>(Package, *FVrmAssetNaming::MakeVrmSourceAssetName(BaseName), RF_Public | RF_Standalone);
+        Source->SetSourceBytes(VrmTestGlb::MakeSkinnedQuadGlb());
+        return Source;
+    }
+
+    FVrmConversionService::FOnConversionComplete MakeRecorder(const TSharedRef<FConversionOutcome>& Outcome)
+    {
+        return [Outcome](bool bSuccess, USkeletalMesh* SkeletalMesh, USkeleton*, const FString& Error)
+        {
+            Outcome->bDone = true;
+            Outcome->bSuccess = bSuccess;
+            Outcome->Mesh = SkeletalMesh;
+            Outcome->Error = Error;
+        };
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmConversionAsyncTest,
+    "VrmToolchain.Conversion.Async",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmConversionAsyncTest::RunTest(const FString& Parameters)
+{
+    FVrmConvertOptions Options = FVrmConversionService::MakeDefaultConvertOptions();
+    Options.bOverwriteExisting = true;
+
+    // Converted from a document borrowing the source's bytes, as the import factory hands it over; the bytes
+    // are replaced (as a reimport does) and the document dropped while the worker runs
+    UVrmSourceAsset* Source = MakeSkinnedQuadSource(TEXT("TestVrmAsync"));
+    TSharedPtr<const FVrmGlbDocument> Document;
+    {
+        FString DocumentError;
+        Document = FVrmGlbDocument::LoadFromView(Source->GetSourceBytes(), DocumentError);
+        TestTrue(TEXT("Borrowed document parses"), Document.IsValid() && Document->BorrowsBytes());
+    }
+
+    const TSharedRef<FConversionOutcome> Converted = MakeShared<FConversionOutcome>();
+    FString Error;
+    TestTrue(TEXT("Async conversion starts"), FVrmConversionService::ConvertSourceToSkeletalMeshAsync(Source, Options, Document, MakeRecorder(Converted), Error));
+    Document.Reset();
+    Source->SetSourceBytes(TArray<uint8>());
+
+    // Cancelled before the game thread gets back to it: no asset is created
+    UVrmSourceAsset* CancelledSource = MakeSkinnedQuadSource(TEXT("TestVrmAsyncCancel"));
+    const TSharedRef<FConversionOutcome> Cancelled = MakeShared<FConversionOutcome>();
+    TSharedPtr<FVrmConversionService::FAsyncConversionControl> Control;
+    TestTrue(TEXT("Cancelled conversion starts"), FVrmConversionService::ConvertSourceToSkeletalMeshAsync(CancelledSource, Options, nullptr, MakeRecorder(Cancelled), Error, &Control));
+    TestTrue(TEXT("Control returned"), Control.IsValid());
+    if (Control.IsValid())
+    {
+        Control->Cancel();
+    }
+
+    const double Deadline = FPlatformTime::Seconds() + 60.0;
+    ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Converted, Cancelled, Deadline]()
+    {
+        if (!Converted->bDone || !Cancelled->bDone)
+        {
+            if (FPlatformTime::Seconds() < Deadline)
+            {
+                return false;
+            }
+            AddError(TEXT("Async conversions did not complete in time"));
+            return true;
+        }
+
+        TestTrue(FString::Printf(TEXT("Conversion succeeds (%s)"), *Converted->Error), Converted->bSuccess);
+        if (Converted->Mesh)
+        {
+            const FSkeletalMeshModel* Model = Converted->Mesh->GetImportedModel();
+            TestTrue(TEXT("Mesh built from the copied bytes"), Model && Model->LODModels.Num() > 0 && Model->LODModels[0].Sections.Num() == 1);
+            TestEqual(TEXT("Morph target built"), Converted->Mesh->GetMorphTargets().Num(), 1);
+        }
+        else
+        {
+            AddError(TEXT("No mesh returned"));
+        }
+
+        TestFalse(TEXT("Cancelled conversion fails"), Cancelled->bSuccess);
+        TestNull(TEXT("Cancelled conversion creates no mesh"), Cancelled->Mesh);
+        TestEqual(TEXT("Cancellation is reported"), Cancelled->Error, FString(TEXT("Conversion cancelled")));
+        return true;
+    }));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,465 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "VrmGlbAccessorReader.h"
+#include "VrmMeshoptDecoder.h"
+#include "VrmMorphTargetDecoder.h"
+#include "VrmToolchain/VrmGlbContainer.h"
+#include "VrmToolchain/VrmGlbDocument.h"
+#include "Tests/VrmTestGlb.h"
+
+namespace VrmGlbAccessorReaderTests
+{
+    using VrmTestGlb::MakeGlb;
+    using VrmTestGlb::AppendValues;
+
+    /**
+     * One skinned triangle: POSITION (0..35), JOINTS_0 as UNSIGNED_BYTE (36..47),
+     * WEIGHTS_0 (48..95) and UNSIGNED_SHORT indices (96..101)
+     */
+    static TArray<uint8> MakeTriangleBin()
+    {
+        TArray<uint8> Bin;
+        AppendValues<float>(Bin, { 0, 0, 0,  1, 2, 3,  0, 1, 0 });
+        AppendValues<uint8>(Bin, { 0, 1, 0, 0,  1, 0, 0, 0,  0, 0, 0, 0 });
+        AppendValues<float>(Bin, { 1, 0, 0, 0,  0.5f, 0.5f, 0, 0,  1, 0, 0, 0 });
+        AppendValues<uint16>(Bin, { 0, 1, 2 });
+        return Bin;
+    }
+
+    static const TCHAR* TriangleBuffers = TEXT(R"(
+        "buffers":[{"byteLength":104}],
+        "bufferViews":[
+            {"buffer":0,"byteOffset":0,"byteLength":36},
+            {"buffer":0,"byteOffset":36,"byteLength":12},
+            {"buffer":0,"byteOffset":48,"byteLength":48},
+            {"buffer":0,"byteOffset":96,"byteLength":6}],
+        "accessors":[
+            {"bufferView":0,"componentType":5126,"count":3,"type":"VEC3"},
+            {"bufferView":1,"componentType":5121,"count":3,"type":"VEC4"},
+            {"bufferView":2,"componentType":5126,"count":3,"type":"VEC4"},
+            {"bufferView":3,"componentType":5123,"count":3,"type":"SCALAR"}])");
+
+    static bool DecodeGlb(const FString& Json, TArray<uint8> Bin, FVrmGlbAccessorReader& Reader, FString& OutError)
+    {
+        const TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(MakeGlb(Json, MoveTemp(Bin)), OutError);
+        if (!Document.IsValid())
+        {
+            return false;
+        }
+
+        FVrmGlbAccessorReader::FDecodeResult Result = Reader.LoadGlbDocument(Document.ToSharedRef());
+        if (Result.bSuccess)
+        {
+            Result = Reader.DecodeAccessors();
+        }
+        OutError = Result.ErrorMessage;
+        return Result.bSuccess;
+    }
+
+    static bool DecodeGlb(const FString& Json, FVrmGlbAccessorReader& Reader, FString& OutError)
+    {
+        return DecodeGlb(Json, MakeTriangleBin(), Reader, OutError);
+    }
+
+    /**
+     * Encodes vertices as an EXT_meshopt_compression ATTRIBUTES stream. Byte groups are stored raw
+     * (or skipped when all deltas are zero): valid for the decoder, just not compact.
+     */
+    static TArray<uint8> EncodeMeshoptVertices(TConstArrayView<uint8> Vertices, int32 VertexSize)
+    {
+        TArray<uint8> Stream;
+        Stream.Add(0xA0);
+
+        const int32 Count = Vertices.Num() / VertexSize;
+        const int32 BlockSize = FMath::Min((8192 / VertexSize) & ~15, 256);
+
+        // The baseline vertex is stored in the tail; keep it zero
+        TArray<uint8> Previous;
+        Previous.SetNumZeroed(VertexSize);
+
+        for (int32 First = 0; First < Count; First += BlockSize)
+        {
+            const int32 NumInBlock = FMath::Min(BlockSize, Count - First);
+            const int32 NumGroups = Align(NumInBlock, 16) / 16;
+            for (int32 Channel = 0; Channel < VertexSize; ++Channel)
+            {
+                TArray<uint8> Deltas;
+                Deltas.SetNumZeroed(NumGroups * 16);
+                for (int32 Vertex = 0; Vertex < NumInBlock; ++Vertex)
+                {
+                    const uint8 Value = Vertices[(First + Vertex) * VertexSize + Channel];
+                    const int8 Delta = static_cast<int8>(Value - Previous[Channel]);
+                    Deltas[Vertex] = static_cast<uint8>((static_cast<uint32>(Delta) << 1) ^ static_cast<uint32>(Delta >> 7));
+                    Previous[Channel] = Value;
+                }
+
+                TArray<uint8> Header;
+                Header.SetNumZeroed((NumGroups + 3) / 4);
+                TArray<uint8> Groups;
+                for (int32 Group = 0; Group < NumGroups; ++Group)
+                {
+                    const TConstArrayView<uint8> Bytes(Deltas.GetData() + Group * 16, 16);
+                    if (Bytes.ContainsByPredicate([](uint8 Byte) { return Byte != 0; }))
+                    {
+                        Header[Group / 4] |= 3 << ((Group % 4) * 2);
+                        Groups.Append(Bytes);
+                    }
+                }
+                Stream.Append(Header);
+                Stream.Append(Groups);
+            }
+        }
+
+        Stream.AddZeroed(FMath::Max(VertexSize, 32));
+        return Stream;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGlbAccessorReader_AllPrimitives,
+    "VrmToolchain.Editor.Import.AccessorReader.AllPrimitives",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGlbAccessorReader_AllPrimitives::RunTest(const FString& Parameters)
+{
+    using namespace VrmGlbAccessorReaderTests;
+
+    // Two meshes; the LINES primitive (flat index 2) cannot be built and is skipped
+    const FString Json = FString(TEXT(R"({"asset":{"version":"2.0"},)")) + TriangleBuffers + TEXT(R"(,
+        "meshes":[
+            {"primitives":[
+                {"attributes":{"POSITION":0,"JOINTS_0":1,"WEIGHTS_0":2},"indices":3,"material":0},
+                {"attributes":{"POSITION":0,"JOINTS_0":1,"WEIGHTS_0":2},"indices":3,"material":1}]},
+            {"primitives":[
+                {"attributes":{"POSITION":0},"indices":3,"mode":1},
+                {"attributes":{"POSITION":0},"indices":3,"material":0}]}]})");
+
+    FVrmGlbAccessorReader Reader;
+    FString Error;
+    if (!TestTrue(TEXT("Decode succeeds"), DecodeGlb(Json, Reader, Error)))
+    {
+        AddError(Error);
+        return false;
+    }
+
+    if (!TestEqual(TEXT("Triangle primitives of every mesh"), Reader.Primitives.Num(), 3))
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("First primitive mesh"), Reader.Primitives[0].MeshIndex, 0);
+    TestEqual(TEXT("Second primitive material"), Reader.Primitives[1].Material, 1);
+    TestEqual(TEXT("Skipped primitive leaves model order"), Reader.Primitives[2].PrimitiveIndex, 3);
+    TestEqual(TEXT("Last primitive mesh"), Reader.Primitives[2].MeshIndex, 1);
+
+    TestTrue(TEXT("Skinned primitive"), Reader.Primitives[0].IsSkinned());
+    TestFalse(TEXT("Rigid primitive"), Reader.Primitives[2].IsSkinned());
+    TestEqual(TEXT("Position converted"), Reader.Primitives[1].Positions[1], FVector3f(1.0f, 3.0f, -2.0f));
+    TestEqual(TEXT("Joints widened"), Reader.Primitives[0].Joints[0], FIntVector4(0, 1, 0, 0));
+    TestEqual(TEXT("Indices"), Reader.Primitives[2].Indices[2], 2u);
+
+    // Every primitive references the same accessors: each (accessor, type) pair is resolved once and shared
+    TestEqual(TEXT("One cache entry per accessor"), Reader.GetNumCachedAccessors(), 4);
+    TestTrue(TEXT("Shared POSITION view"), Reader.Primitives[0].Positions == Reader.Primitives[2].Positions);
+    TestTrue(TEXT("Shared JOINTS_0 view"), Reader.Primitives[0].Joints == Reader.Primitives[1].Joints);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGlbAccessorReader_PrimitiveErrors,
+    "VrmToolchain.Editor.Import.AccessorReader.PrimitiveErrors",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGlbAccessorReader_PrimitiveErrors::RunTest(const FString& Parameters)
+{
+    using namespace VrmGlbAccessorReaderTests;
+
+    // JOINTS_0 without WEIGHTS_0 in the second primitive fails the whole decode and names it
+    const FString Json = FString(TEXT(R"({"asset":{"version":"2.0"},)")) + TriangleBuffers + TEXT(R"(,
+        "meshes":[{"primitives":[
+            {"attributes":{"POSITION":0,"JOINTS_0":1,"WEIGHTS_0":2},"indices":3},
+            {"attributes":{"POSITION":0,"JOINTS_0":1},"indices":3}]}]})");
+
+    FVrmGlbAccessorReader Reader;
+    FString Error;
+    TestFalse(TEXT("Decode fails"), DecodeGlb(Json, Reader, Error));
+    TestTrue(TEXT("Error names the primitive"), Error.Contains(TEXT("primitive 1")));
+    TestEqual(TEXT("No partial results"), Reader.Primitives.Num(), 0);
+
+    // A second influence set is read; an unpaired third one is ignored with a warning
+    const FString InfluenceSetsJson = FString(TEXT(R"({"asset":{"version":"2.0"},)")) + TriangleBuffers + TEXT(R"(,
+        "meshes":[{"primitives":[{"attributes":{"POSITION":0,"JOINTS_0":1,"WEIGHTS_0":2,"JOINTS_1":1,"WEIGHTS_1":2,"WEIGHTS_2":2},"indices":3}]}]})");
+    AddExpectedError(TEXT("Ignoring influence set 2"), EAutomationExpectedErrorFlags::Contains, 1);
+    TestTrue(TEXT("Extra influence sets decode"), DecodeGlb(InfluenceSetsJson, Reader, Error));
+    TestEqual(TEXT("Two influence sets"), Reader.Primitives.Num() == 1 ? Reader.Primitives[0].NumInfluenceSets() : 0, 2);
+
+    // Rigid primitives alone cannot make a skinned mesh
+    const FString RigidJson = FString(TEXT(R"({"asset":{"version":"2.0"},)")) + TriangleBuffers + TEXT(R"(,
+        "meshes":[{"primitives":[{"attributes":{"POSITION":0},"indices":3}]}]})");
+    TestFalse(TEXT("Unskinned document fails"), DecodeGlb(RigidJson, Reader, Error));
+
+    // An accessor running past its bufferView fails even though the buffer behind it is long enough
+    FString OverrunJson = FString(TEXT(R"({"asset":{"version":"2.0"},)")) + TriangleBuffers + TEXT(R"(,
+        "meshes":[{"primitives":[{"attributes":{"POSITION":0,"JOINTS_0":1,"WEIGHTS_0":2},"indices":3}]}]})");
+    OverrunJson.ReplaceInline(TEXT(R"({"bufferView":0,"componentType":5126,"count":3,)"), TEXT(R"({"bufferView":0,"byteOffset":12,"componentType":5126,"count":3,)"));
+    TestFalse(TEXT("Accessor past its bufferView fails"), DecodeGlb(OverrunJson, Reader, Error));
+    TestTrue(TEXT("Error names the bufferView"), Error.Contains(TEXT("bufferView 0")));
+
+    // Negative offsets never reach the reader: the document is rejected while parsing
+    FString NegativeJson = OverrunJson.Replace(TEXT(R"("byteOffset":12)"), TEXT(R"("byteOffset":-12)"));
+    TestFalse(TEXT("Negative accessor byteOffset fails"), DecodeGlb(NegativeJson, Reader, Error));
+    TestTrue(TEXT("Error names the offset"), Error.Contains(TEXT("byteOffset")));
+    NegativeJson = RigidJson.Replace(TEXT(R"("byteOffset":36,)"), TEXT(R"("byteOffset":-36,)"));
+    TestFalse(TEXT("Negative bufferView byteOffset fails"), DecodeGlb(NegativeJson, Reader, Error));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGlbAccessorReader_Sparse,
+    "VrmToolchain.Editor.Import.AccessorReader.Sparse",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGlbAccessorReader_Sparse::RunTest(const FString& Parameters)
+{
+    using namespace VrmGlbAccessorReaderTests;
+
+    // Accessor 4: no base, elements 1 and 2 substituted with the last two positions (so it equals accessor 0).
+    // Accessor 5: POSITION as base, element 1 substituted with the last position.
+    const FString Json = TEXT(R"({"asset":{"version":"2.0"},
+        "buffers":[{"byteLength":104}],
+        "bufferViews":[
+            {"buffer":0,"byteOffset":0,"byteLength":36},
+            {"buffer":0,"byteOffset":36,"byteLength":12},
+            {"buffer":0,"byteOffset":48,"byteLength":48},
+            {"buffer":0,"byteOffset":96,"byteLength":6}],
+        "accessors":[
+            {"bufferView":0,"componentType":5126,"count":3,"type":"VEC3"},
+            {"bufferView":1,"componentType":5121,"count":3,"type":"VEC4"},
+            {"bufferView":2,"componentType":5126,"count":3,"type":"VEC4"},
+            {"bufferView":3,"componentType":5123,"count":3,"type":"SCALAR"},
+            {"componentType":5126,"count":3,"type":"VEC3","sparse":{"count":2,
+                "indices":{"bufferView":3,"byteOffset":2,"componentType":5123},
+                "values":{"bufferView":0,"byteOffset":12}}},
+            {"bufferView":0,"componentType":5126,"count":3,"type":"VEC3","sparse":{"count":1,
+                "indices":{"bufferView":3,"byteOffset":2,"componentType":5123},
+                "values":{"bufferView":0,"byteOffset":24}}}],
+        "meshes":[{"primitives":[{"attributes":{"POSITION":4,"JOINTS_0":1,"WEIGHTS_0":2},"indices":3}]}]})");
+
+    FVrmGlbAccessorReader Reader;
+    FString Error;
+    if (!TestTrue(TEXT("Decode succeeds"), DecodeGlb(Json, Reader, Error)))
+    {
+        AddError(Error);
+        return false;
+    }
+
+    // Dense consumers see the merged accessor
+    const TGltfAccessorView<FVector3f>& Positions = Reader.Primitives[0].Positions;
+    TestEqual(TEXT("Merged count"), Positions.Num(), 3);
+    TestEqual(TEXT("Unsubstituted element is zero"), Positions[0], FVector3f::ZeroVector);
+    TestEqual(TEXT("Substituted element converted"), Positions[1], FVector3f(1.0f, 3.0f, -2.0f));
+
+    // Delta consumers get only the substitutions when there is no base
+    TGltfSparseAccessorView<FVector3f> Deltas;
+    TestTrue(TEXT("Sparse view without base"), Reader.GetSparseAccessorView(4, Deltas).bSuccess);
+    TestFalse(TEXT("No base"), Deltas.HasBase());
+
+    TArray<int32> Visited;
+    Deltas.ForEach([&Visited](int32 Index, const FVector3f& Value) { Visited.Add(Index); });
+    TestTrue(TEXT("Only substituted elements are visited"), Visited == TArray<int32>({ 1, 2 }));
+
+    // With a base, the merge visits every element in order
+    TGltfSparseAccessorView<FVector3f> WithBase;
+    TestTrue(TEXT("Sparse view with base"), Reader.GetSparseAccessorView(5, WithBase).bSuccess);
+
+    TArray<FVector3f> Merged;
+    WithBase.ForEach([&Merged](int32 Index, const FVector3f& Value) { Merged.Add(Value); });
+    TArray<FVector3f> Copied;
+    Copied.SetNumZeroed(WithBase.Num());
+    WithBase.CopyTo(Copied.GetData());
+
+    TestEqual(TEXT("Merge visits every element"), Merged.Num(), 3);
+    TestEqual(TEXT("Base element kept"), Merged[0], FVector3f::ZeroVector);
+    TestEqual(TEXT("Substitution applied"), Merged[1], FVector3f(0.0f, 0.0f, -1.0f));
+    TestEqual(TEXT("Base element after substitution"), Merged[2], FVector3f(0.0f, 0.0f, -1.0f));
+    TestTrue(TEXT("CopyTo matches the merge"), Copied == Merged);
+
+    // Dense accessors come back as a base with nothing substituted
+    TGltfSparseAccessorView<FVector3f> Dense;
+    TestTrue(TEXT("Dense accessor as sparse"), Reader.GetSparseAccessorView(0, Dense).bSuccess);
+    TestTrue(TEXT("Dense base"), Dense.HasBase() && Dense.Indices.IsEmpty());
+
+    // Without a base only the count bounds the merge, so 2.4 GB of VEC3 floats is rejected before allocating
+    const FString OversizedJson = Json.Replace(TEXT(R"({"componentType":5126,"count":3,)"), TEXT(R"({"componentType":5126,"count":200000000,)"));
+    FVrmGlbAccessorReader OversizedReader;
+    TestFalse(TEXT("Oversized base-less sparse accessor fails"), DecodeGlb(OversizedJson, OversizedReader, Error));
+    TestTrue(TEXT("Error names the merge size"), Error.Contains(TEXT("too large to merge")));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGlbAccessorReader_MorphTargets,
+    "VrmToolchain.Editor.Import.AccessorReader.MorphTargets",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGlbAccessorReader_MorphTargets::RunTest(const FString& Parameters)
+{
+    using namespace VrmGlbAccessorReaderTests;
+
+    // Target 0: sparse POSITION deltas (accessor 4). Target 1: dense POSITION deltas plus an all-zero NORMAL
+    // accessor without bufferView (5). Target 2: an index accessor as POSITION, which cannot be read as deltas.
+    const FString Json = TEXT(R"({"asset":{"version":"2.0"},
+        "buffers":[{"byteLength":104}],
+        "bufferViews":[
+            {"buffer":0,"byteOffset":0,"byteLength":36},
+            {"buffer":0,"byteOffset":36,"byteLength":12},
+            {"buffer":0,"byteOffset":48,"byteLength":48},
+            {"buffer":0,"byteOffset":96,"byteLength":6}],
+        "accessors":[
+            {"bufferView":0,"componentType":5126,"count":3,"type":"VEC3"},
+            {"bufferView":1,"componentType":5121,"count":3,"type":"VEC4"},
+            {"bufferView":2,"componentType":5126,"count":3,"type":"VEC4"},
+            {"bufferView":3,"componentType":5123,"count":3,"type":"SCALAR"},
+            {"componentType":5126,"count":3,"type":"VEC3","sparse":{"count":1,
+                "indices":{"bufferView":3,"byteOffset":2,"componentType":5123},
+                "values":{"bufferView":0,"byteOffset":12}}},
+            {"componentType":5126,"count":3,"type":"VEC3"}],
+        "meshes":[{"extras":{"targetNames":["Sparse","Dense","Broken"]},"primitives":[{
+            "attributes":{"POSITION":0,"JOINTS_0":1,"WEIGHTS_0":2},"indices":3,
+            "targets":[{"POSITION":4},{"POSITION":0,"NORMAL":5},{"POSITION":3}]}]}]})");
+
+    AddExpectedError(TEXT("Failed to decode morph target 2 POSITION"), EAutomationExpectedErrorFlags::Contains, 1);
+
+    FVrmGlbAccessorReader Reader;
+    FString Error;
+    if (!TestTrue(TEXT("Decode succeeds"), DecodeGlb(Json, Reader, Error)))
+    {
+        AddError(Error);
+        return false;
+    }
+
+    const FVrmGlbAccessorReader::FPrimitive& Primitive = Reader.Primitives[0];
+    TestEqual(TEXT("One view per target"), Primitive.NumMorphTargets(), 3);
+    TestEqual(TEXT("Normal views parallel to positions"), Primitive.MorphNormals.Num(), 3);
+
+    // Sparse target: only the displaced vertex survives decoding
+    FVrmMorphDeltas Deltas;
+    VrmMorphTargetDecoder::Decode(Primitive.MorphPositions[0], Primitive.MorphNormals[0],
+        VrmMorphTargetDecoder::DefaultPositionThreshold, VrmMorphTargetDecoder::DefaultNormalThreshold, Deltas);
+    TestTrue(TEXT("Sparse target keeps its displaced vertex"), Deltas.Vertices == TArray<int32>({ 1 }));
+    TestEqual(TEXT("Sparse delta converted to UE axes"), Deltas.GetPosition(0), FVector3f(1.0f, 3.0f, -2.0f));
+
+    // Dense target: the zero first vertex is culled, the zero normal accessor contributes nothing
+    TestFalse(TEXT("All-zero NORMAL has no data"), Primitive.MorphNormals[1].HasBase());
+    VrmMorphTargetDecoder::Decode(Primitive.MorphPositions[1], Primitive.MorphNormals[1],
+        VrmMorphTargetDecoder::DefaultPositionThreshold, VrmMorphTargetDecoder::DefaultNormalThreshold, Deltas);
+    TestTrue(TEXT("Dense target culls the zero delta"), Deltas.Vertices == TArray<int32>({ 1, 2 }));
+    TestEqual(TEXT("Dense target has no normal deltas"), Deltas.GetNormal(0), FVector3f::ZeroVector);
+
+    // Broken target degrades to no deltas
+    TestEqual(TEXT("Broken target spans the primitive"), Primitive.MorphPositions[2].Num(), 3);
+    VrmMorphTargetDecoder::Decode(Primitive.MorphPositions[2], Primitive.MorphNormals[2],
+        VrmMorphTargetDecoder::DefaultPositionThreshold, VrmMorphTargetDecoder::DefaultNormalThreshold, Deltas);
+    TestEqual(TEXT("Broken target has no deltas"), Deltas.Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGlbAccessorReader_Meshopt,
+    "VrmToolchain.Editor.Import.AccessorReader.Meshopt",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGlbAccessorReader_Meshopt::RunTest(const FString& Parameters)
+{
+    using namespace VrmGlbAccessorReaderTests;
+
+    // Compressed copies of POSITION and the indices follow the plain triangle data in the BIN chunk
+    TArray<uint8> Bin = MakeTriangleBin();
+    while (Bin.Num() % 4 != 0)
+    {
+        Bin.Add(0);
+    }
+
+    const int32 PositionsOffset = Bin.Num();
+    Bin.Append(EncodeMeshoptVertices(TConstArrayView<uint8>(Bin.GetData(), 36), 12));
+    const int32 PositionsLength = Bin.Num() - PositionsOffset;
+
+    // TRIANGLES: one code byte reading codeaux table entry 0 (three new vertices), then the 16-byte table
+    const int32 TrianglesOffset = Bin.Num();
+    Bin.Add(0xE0);
+    Bin.Add(0xF0);
+    Bin.AddZeroed(16);
+
+    // INDICES: zigzag deltas 0, +1, +1 against baseline 0, then the 4-byte tail
+    const int32 SequenceOffset = Bin.Num();
+    AppendValues<uint8>(Bin, { 0xD0, 0x00, 0x04, 0x04, 0, 0, 0, 0 });
+
+    const FString Json = FString::Printf(TEXT(R"({"asset":{"version":"2.0"},
+        "extensionsUsed":["EXT_meshopt_compression"],
+        "buffers":[{"byteLength":%d},{"byteLength":48,"extensions":{"EXT_meshopt_compression":{"fallback":true}}}],
+        "bufferViews":[
+            {"buffer":0,"byteOffset":0,"byteLength":36},
+            {"buffer":0,"byteOffset":36,"byteLength":12},
+            {"buffer":0,"byteOffset":48,"byteLength":48},
+            {"buffer":0,"byteOffset":96,"byteLength":6},
+            {"buffer":1,"byteOffset":0,"byteLength":36,"byteStride":12,"extensions":{"EXT_meshopt_compression":
+                {"buffer":0,"byteOffset":%d,"byteLength":%d,"byteStride":12,"count":3,"mode":"ATTRIBUTES"}}},
+            {"buffer":1,"byteOffset":36,"byteLength":6,"extensions":{"EXT_meshopt_compression":
+                {"buffer":0,"byteOffset":%d,"byteLength":18,"byteStride":2,"count":3,"mode":"TRIANGLES"}}},
+            {"buffer":1,"byteOffset":44,"byteLength":6,"extensions":{"EXT_meshopt_compression":
+                {"buffer":0,"byteOffset":%d,"byteLength":8,"byteStride":2,"count":3,"mode":"INDICES"}}}],
+        "accessors":[
+            {"bufferView":4,"componentType":5126,"count":3,"type":"VEC3"},
+            {"bufferView":1,"componentType":5121,"count":3,"type":"VEC4"},
+            {"bufferView":2,"componentType":5126,"count":3,"type":"VEC4"},
+            {"bufferView":5,"componentType":5123,"count":3,"type":"SCALAR"},
+            {"bufferView":6,"componentType":5123,"count":3,"type":"SCALAR"}],
+        "meshes":[{"primitives":[
+            {"attributes":{"POSITION":0,"JOINTS_0":1,"WEIGHTS_0":2},"indices":3},
+            {"attributes":{"POSITION":0,"JOINTS_0":1,"WEIGHTS_0":2},"indices":4}]}]})"),
+        Bin.Num(), PositionsOffset, PositionsLength, TrianglesOffset, SequenceOffset);
+
+    FVrmGlbAccessorReader Reader;
+    FString Error;
+    if (!TestTrue(TEXT("Decode succeeds"), DecodeGlb(Json, Bin, Reader, Error)))
+    {
+        AddError(Error);
+        return false;
+    }
+
+    TestEqual(TEXT("Every compressed view decompressed"), Reader.GetNumDecompressedBufferViews(), 3);
+    TestEqual(TEXT("Decompressed position converted"), Reader.Primitives[0].Positions[1], FVector3f(1.0f, 3.0f, -2.0f));
+    TestEqual(TEXT("Decompressed position"), Reader.Primitives[0].Positions[2], FVector3f(0.0f, 0.0f, -1.0f));
+
+    for (int32 PrimitiveIndex = 0; PrimitiveIndex < 2; ++PrimitiveIndex)
+    {
+        const TGltfAccessorView<uint32>& Indices = Reader.Primitives[PrimitiveIndex].Indices;
+        TestTrue(FString::Printf(TEXT("Decompressed indices of primitive %d"), PrimitiveIndex),
+            Indices.Num() == 3 && Indices[0] == 0 && Indices[1] == 1 && Indices[2] == 2);
+    }
+
+    // A truncated stream is rejected, not read past
+    const FString Truncated = Json.Replace(*FString::Printf(TEXT("\"byteLength\":%d,\"byteStride\":12"), PositionsLength), TEXT("\"byteLength\":20,\"byteStride\":12"));
+    TestFalse(TEXT("Truncated stream fails"), DecodeGlb(Truncated, Bin, Reader, Error));
+    TestTrue(TEXT("Error names the bufferView"), Error.Contains(TEXT("bufferView 4")));
+
+    // Filters
+    int8 Octahedral[4] = { 127, 0, 127, 5 };
+    VrmMeshoptDecoder::ApplyOctahedralFilter(reinterpret_cast<uint8*>(Octahedral), 1, 4);
+    TestTrue(TEXT("Octahedral filter"), Octahedral[0] == 127 && Octahedral[1] == 0 && Octahedral[2] == 0 && Octahedral[3] == 5);
+
+    int16 Quaternion[4] = { 0, 0, 0, 3 };
+    VrmMeshoptDecoder::ApplyQuaternionFilter(reinterpret_cast<uint8*>(Quaternion), 1);
+    TestTrue(TEXT("Quaternion filter restores the dropped W"), Quaternion[0] == 0 && Quaternion[1] == 0 && Quaternion[2] == 0 && Quaternion[3] == 32767);
+
+    uint32 Exponential = 0xFF000003u;
+    VrmMeshoptDecoder::ApplyExponentialFilter(reinterpret_cast<uint8*>(&Exponential), 1, 4);
+    float Decoded;
+    FMemory::Memcpy(&Decoded, &Exponential, sizeof(Decoded));
+    TestEqual(TEXT("Exponential filter"), Decoded, 1.5f);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,118 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "VrmGltfAccessorView.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGltfAccessorView_Interleaved,
+    "VrmToolchain.Editor.Import.AccessorView.Interleaved",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGltfAccessorView_Interleaved::RunTest(const FString& Parameters)
+{
+    // Interleaved vertex layout: POSITION (float3) | TEXCOORD_0 (float2) | JOINTS_0 (ushort4) = 28 bytes
+    constexpr int32 Stride = 28;
+    constexpr int32 NumVertices = 5;
+
+    TArray<uint8> Buffer;
+    Buffer.SetNumZeroed(Stride * NumVertices);
+    for (int32 i = 0; i < NumVertices; ++i)
+    {
+        uint8* Vertex = Buffer.GetData() + i * Stride;
+        const float Position[3] = { float(i), float(i) + 0.5f, -float(i) };
+        const float TexCoord[2] = { 0.25f * i, 1.0f - 0.25f * i };
+        const uint16 Joints[4] = { uint16(i), uint16(300 + i), 0, 7 };
+        FMemory::Memcpy(Vertex, Position, sizeof(Position));
+        FMemory::Memcpy(Vertex + 12, TexCoord, sizeof(TexCoord));
+        FMemory::Memcpy(Vertex + 20, Joints, sizeof(Joints));
+    }
+
+    const TGltfAccessorView<FVector3f> Positions(Buffer.GetData(), Stride, NumVertices, EVrmGltfComponentType::Float);
+    const TGltfAccessorView<FVector2f> TexCoords(Buffer.GetData() + 12, Stride, NumVertices, EVrmGltfComponentType::Float);
+    const TGltfAccessorView<FIntVector4> Joints(Buffer.GetData() + 20, Stride, NumVertices, EVrmGltfComponentType::UnsignedShort);
+
+    TestEqual(TEXT("Num"), Positions.Num(), NumVertices);
+    TestEqual(TEXT("Position converted on access"), Positions[2], FVector3f(2.0f, -2.0f, -2.5f));
+    TestEqual(TEXT("TexCoord read in place"), TexCoords[3], FVector2f(0.75f, 0.25f));
+    TestEqual(TEXT("Joints widened on access"), Joints[4], FIntVector4(4, 304, 0, 7));
+
+    // Range-for visits every element in order
+    int32 Visited = 0;
+    bool bIterationMatches = true;
+    for (const FVector3f Position : Positions)
+    {
+        bIterationMatches &= Position == Positions[Visited];
+        ++Visited;
+    }
+    TestEqual(TEXT("Range-for visits every element"), Visited, NumVertices);
+    TestTrue(TEXT("Range-for matches indexing"), bIterationMatches);
+
+    // Bulk conversion into a caller buffer matches per-element access
+    TArray<FVector3f> Copied;
+    Copied.SetNumZeroed(NumVertices);
+    Positions.CopyTo(Copied.GetData());
+
+    TArray<FIntVector4> CopiedJoints;
+    CopiedJoints.SetNumZeroed(NumVertices);
+    Joints.CopyTo(CopiedJoints.GetData());
+
+    bool bCopyMatches = true;
+    for (int32 i = 0; i < NumVertices; ++i)
+    {
+        bCopyMatches &= Copied[i] == Positions[i];
+        bCopyMatches &= CopiedJoints[i] == Joints[i];
+    }
+    TestTrue(TEXT("CopyTo matches indexing"), bCopyMatches);
+
+    // An empty view iterates nothing
+    const TGltfAccessorView<uint32> Empty;
+    TestTrue(TEXT("Default view is empty"), Empty.IsEmpty());
+    TestTrue(TEXT("Empty view begin == end"), Empty.begin() == Empty.end());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmGltfAccessorView_Formats,
+    "VrmToolchain.Editor.Import.AccessorView.Formats",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmGltfAccessorView_Formats::RunTest(const FString& Parameters)
+{
+    TestTrue(TEXT("FLOAT VEC3 as FVector3f"), TGltfAccessorView<FVector3f>::SupportsFormat(EVrmGltfComponentType::Float, 3));
+    TestFalse(TEXT("FLOAT VEC4 as FIntVector4"), TGltfAccessorView<FIntVector4>::SupportsFormat(EVrmGltfComponentType::Float, 4));
+    TestFalse(TEXT("FLOAT SCALAR as indices"), TGltfAccessorView<uint32>::SupportsFormat(EVrmGltfComponentType::Float, 1));
+    TestTrue(TEXT("Quantized SHORT VEC3 as FVector3f"), TGltfAccessorView<FVector3f>::SupportsFormat(EVrmGltfComponentType::Short, 3));
+    TestTrue(TEXT("Normalized UNSIGNED_BYTE VEC4 as FVector4f"), TGltfAccessorView<FVector4f>::SupportsFormat(EVrmGltfComponentType::UnsignedByte, 4));
+    TestFalse(TEXT("UNSIGNED_INT VEC2 as FVector2f"), TGltfAccessorView<FVector2f>::SupportsFormat(EVrmGltfComponentType::UnsignedInt, 2));
+
+    // Normalized UNSIGNED_BYTE weights and SHORT positions dequantize on access and in bulk
+    const uint8 Weights[] = { 255, 0, 51, 204 };
+    const TGltfAccessorView<FVector4f> WeightView(Weights, 4, 1, EVrmGltfComponentType::UnsignedByte, true);
+    TestTrue(TEXT("Normalized weights"), WeightView[0].Equals(FVector4f(1.0f, 0.0f, 0.2f, 0.8f), 1e-6f));
+
+    const int16 Positions[] = { 100, -200, 300, 0 };
+    const TGltfAccessorView<FVector3f> PositionView(reinterpret_cast<const uint8*>(Positions), 8, 1, EVrmGltfComponentType::Short, false);
+    FVector3f Copied;
+    PositionView.CopyTo(&Copied);
+    TestEqual(TEXT("Quantized position keeps its value, converted to UE axes"), PositionView[0], FVector3f(100.0f, 300.0f, 200.0f));
+    TestEqual(TEXT("Bulk dequantization matches"), Copied, PositionView[0]);
+
+    // Indices of every supported width read back as uint32
+    const uint8 Bytes[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    const TGltfAccessorView<uint32> U8(Bytes, 1, 8, EVrmGltfComponentType::UnsignedByte);
+    const TGltfAccessorView<uint32> U16(Bytes, 2, 4, EVrmGltfComponentType::UnsignedShort);
+    const TGltfAccessorView<uint32> U32(Bytes, 4, 2, EVrmGltfComponentType::UnsignedInt);
+
+    uint16 Short;
+    FMemory::Memcpy(&Short, Bytes + 2, sizeof(Short));
+    uint32 Int;
+    FMemory::Memcpy(&Int, Bytes + 4, sizeof(Int));
+
+    TestEqual(TEXT("UNSIGNED_BYTE index"), U8[7], 8u);
+    TestEqual(TEXT("UNSIGNED_SHORT index"), U16[1], uint32(Short));
+    TestEqual(TEXT("UNSIGNED_INT index"), U32[1], Int);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
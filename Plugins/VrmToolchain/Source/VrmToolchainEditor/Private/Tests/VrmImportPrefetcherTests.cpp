@@ -0,0 +1,121 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+
+#include "VrmImportPrefetcher.h"
+#include "VrmSourceFactory.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmImportPrefetcher_ReadAhead,
+    "VrmToolchain.Editor.Import.Prefetcher.ReadAhead",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmImportPrefetcher_ReadAhead::RunTest(const FString& Parameters)
+{
+    const FString TempDir = FPaths::ProjectIntermediateDir() / TEXT("VrmToolchainTests");
+    IFileManager::Get().MakeDirectory(*TempDir, true);
+
+    // Five files of increasing size with distinct contents
+    TArray<FString> Files;
+    for (int32 FileIndex = 0; FileIndex < 5; ++FileIndex)
+    {
+        TArray<uint8> Bytes;
+        Bytes.SetNumUninitialized(1024 * (FileIndex + 1));
+        for (int32 i = 0; i < Bytes.Num(); ++i)
+        {
+            Bytes[i] = uint8((i + FileIndex * 31) & 0xFF);
+        }
+
+        const FString Path = TempDir / FString::Printf(TEXT("Prefetch%d.vrm"), FileIndex);
+        TestTrue(TEXT("Write temp file"), FFileHelper::SaveArrayToFile(Bytes, *Path));
+        Files.Add(Path);
+    }
+
+    FVrmImportPrefetcher Prefetcher;
+    Prefetcher.SetLimits(2, 64 * 1024);
+    Prefetcher.Enqueue(Files);
+    TestEqual(TEXT("Read-ahead depth is respected"), Prefetcher.GetNumActive(), 2);
+
+    // Acquiring in order returns the right bytes and keeps the window full
+    for (int32 FileIndex = 0; FileIndex < Files.Num(); ++FileIndex)
+    {
+        TArray<uint8> Bytes;
+        FString Error;
+        TestTrue(TEXT("Acquire succeeds"), Prefetcher.Acquire(Files[FileIndex], Bytes, Error));
+        TestEqual(TEXT("File size"), Bytes.Num(), 1024 * (FileIndex + 1));
+        TestTrue(TEXT("File contents"), Bytes.Num() > 1 && Bytes[1] == uint8((1 + FileIndex * 31) & 0xFF));
+        TestTrue(TEXT("Window never exceeds the depth"), Prefetcher.GetNumActive() <= 2);
+    }
+    TestEqual(TEXT("Queue drained"), Prefetcher.GetNumActive(), 0);
+
+    // Memory cap: only files that fit are held; skipping ahead drops earlier reads
+    Prefetcher.SetLimits(4, 3 * 1024);
+    Prefetcher.Enqueue(Files);
+    TestTrue(TEXT("Held bytes stay under the cap"), Prefetcher.GetActiveBytes() <= 3 * 1024);
+    {
+        TArray<uint8> Bytes;
+        FString Error;
+        TestTrue(TEXT("Out-of-order acquire succeeds"), Prefetcher.Acquire(Files[4], Bytes, Error));
+        TestEqual(TEXT("Out-of-order file size"), Bytes.Num(), 5 * 1024);
+        TestEqual(TEXT("Earlier reads are released"), Prefetcher.GetNumActive(), 0);
+    }
+
+    // Skipped reads release their reservation: with the cap exactly fitting the next two files,
+    // acquiring the second file first must still leave room to read both ahead
+    Prefetcher.SetLimits(2, 7 * 1024);
+    Prefetcher.Enqueue(Files);
+    TestEqual(TEXT("First two files read ahead"), Prefetcher.GetActiveBytes(), int64(3 * 1024));
+    {
+        TArray<uint8> Bytes;
+        FString Error;
+        TestTrue(TEXT("Acquire of the second file succeeds"), Prefetcher.Acquire(Files[1], Bytes, Error));
+        TestEqual(TEXT("Second file size"), Bytes.Num(), 2 * 1024);
+        TestEqual(TEXT("Remaining files are read ahead"), Prefetcher.GetNumActive(), 2);
+        TestEqual(TEXT("Held bytes are the remaining files only"), Prefetcher.GetActiveBytes(), int64(7 * 1024));
+    }
+
+    // Files that were never queued, or are missing, go through the synchronous path
+    {
+        TArray<uint8> Bytes;
+        FString Error;
+        TestTrue(TEXT("Unqueued acquire succeeds"), Prefetcher.Acquire(Files[2], Bytes, Error));
+        TestFalse(TEXT("Missing file fails"), Prefetcher.Acquire(TempDir / TEXT("DoesNotExist.vrm"), Bytes, Error));
+        TestFalse(TEXT("Missing file reports an error"), Error.IsEmpty());
+    }
+
+    // A file rewritten after its read-ahead started is read again rather than served stale
+    Prefetcher.SetLimits(2, 64 * 1024);
+    Prefetcher.Enqueue(Files);
+    TestEqual(TEXT("First file read ahead"), Prefetcher.GetNumActive(), 2);
+    {
+        TArray<uint8> Rewritten;
+        Rewritten.Init(0xAB, 100);
+        TestTrue(TEXT("Rewrite temp file"), FFileHelper::SaveArrayToFile(Rewritten, *Files[0]));
+
+        TArray<uint8> Bytes;
+        FString Error;
+        TestTrue(TEXT("Acquire of the rewritten file succeeds"), Prefetcher.Acquire(Files[0], Bytes, Error));
+        TestTrue(TEXT("Rewritten contents are returned"), Bytes == Rewritten);
+    }
+
+    // The factory drops whatever the batch left unacquired once the batch ends
+    FVrmImportPrefetcher& Shared = FVrmImportPrefetcher::Get();
+    Shared.SetLimits(2, 64 * 1024);
+    Shared.Enqueue(Files);
+    TestEqual(TEXT("Batch read ahead"), Shared.GetNumActive(), 2);
+    NewObject<UVrmSourceFactory>()->CleanUp();
+    TestEqual(TEXT("Batch end releases reads"), Shared.GetNumActive(), 0);
+    TestEqual(TEXT("Batch end releases memory"), Shared.GetActiveBytes(), int64(0));
+
+    Prefetcher.Reset();
+    for (const FString& Path : Files)
+    {
+        IFileManager::Get().Delete(*Path);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,116 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "VrmMeshOptimizer.h"
+
+namespace
+{
+    /** Triangles of an index list, each rotated to start at its lowest index and sorted: equal for reorderings */
+    TArray<FIntVector> GetTriangleSet(TConstArrayView<uint32> Indices)
+    {
+        TArray<FIntVector> Triangles;
+        for (int32 Corner = 0; Corner + 2 < Indices.Num(); Corner += 3)
+        {
+            const int32 A = Indices[Corner];
+            const int32 B = Indices[Corner + 1];
+            const int32 C = Indices[Corner + 2];
+            if (A <= B && A <= C)
+            {
+                Triangles.Emplace(A, B, C);
+            }
+            else if (B <= C)
+            {
+                Triangles.Emplace(B, C, A);
+            }
+            else
+            {
+                Triangles.Emplace(C, A, B);
+            }
+        }
+        Triangles.Sort([](const FIntVector& L, const FIntVector& R)
+        {
+            return L.X != R.X ? L.X < R.X : L.Y != R.Y ? L.Y < R.Y : L.Z < R.Z;
+        });
+        return Triangles;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmMeshOptimizer_WeldAndReorder,
+    "VrmToolchain.Editor.Import.MeshOptimizer.WeldAndReorder",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmMeshOptimizer_WeldAndReorder::RunTest(const FString& Parameters)
+{
+    // Two copies of a vertex weld onto the first; the same position with another UV stays apart
+    {
+        const TArray<FVector3f> Positions = { FVector3f(1, 2, 3), FVector3f(4, 5, 6), FVector3f(1, 2, 3), FVector3f(1, 2, 3), FVector3f(4, 5, 6) };
+        const TArray<FVector2f> TexCoords = { FVector2f(0, 0), FVector2f(1, 1), FVector2f(0, 0), FVector2f(0, 1), FVector2f(1, 1) };
+
+        VrmMeshOptimizer::FVertexStreams Streams;
+        Streams.Add(Positions.GetData(), sizeof(FVector3f));
+        Streams.Add(TexCoords.GetData(), sizeof(FVector2f));
+
+        TArray<uint32> Remap;
+        TestEqual(TEXT("Distinct vertices"), VrmMeshOptimizer::WeldVertices(Positions.Num(), Streams, Remap), 3);
+        TestEqual(TEXT("Identical vertex welds onto the first"), Remap[2], 0u);
+        TestEqual(TEXT("Other UV is kept"), Remap[3], 3u);
+        TestEqual(TEXT("Second identical pair welds"), Remap[4], 1u);
+        TestEqual(TEXT("Representatives map to themselves"), Remap[1], 1u);
+    }
+
+    // A regular grid drawn in shuffled triangle order
+    constexpr int32 GridSize = 48;
+    TArray<FVector3f> Positions;
+    for (int32 Y = 0; Y <= GridSize; ++Y)
+    {
+        for (int32 X = 0; X <= GridSize; ++X)
+        {
+            Positions.Emplace(float(X), float(Y), FMath::Sin(X * 0.3f));
+        }
+    }
+
+    TArray<uint32> Grid;
+    for (int32 Y = 0; Y < GridSize; ++Y)
+    {
+        for (int32 X = 0; X < GridSize; ++X)
+        {
+            const uint32 Corner = Y * (GridSize + 1) + X;
+            const uint32 Above = Corner + GridSize + 1;
+            Grid.Append({ Corner, Corner + 1, Above + 1, Corner, Above + 1, Above });
+        }
+    }
+
+    FRandomStream Random(7);
+    const int32 NumTriangles = Grid.Num() / 3;
+    TArray<uint32> Indices;
+    TArray<int32> Order;
+    for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+    {
+        Order.Add(Triangle);
+    }
+    for (int32 Triangle = NumTriangles - 1; Triangle > 0; --Triangle)
+    {
+        Order.Swap(Triangle, Random.RandRange(0, Triangle));
+    }
+    for (const int32 Triangle : Order)
+    {
+        Indices.Append(Grid.GetData() + Triangle * 3, 3);
+    }
+
+    const TArray<FIntVector> Expected = GetTriangleSet(Indices);
+    const float ShuffledAcmr = VrmMeshOptimizer::ComputeAcmr(Indices, Positions.Num());
+
+    VrmMeshOptimizer::OptimizeVertexCache(Indices, Positions.Num());
+    const float CacheAcmr = VrmMeshOptimizer::ComputeAcmr(Indices, Positions.Num());
+    TestTrue(TEXT("Vertex cache order keeps every triangle and its winding"), GetTriangleSet(Indices) == Expected);
+    TestTrue(TEXT("Vertex cache order cuts cache misses"), CacheAcmr < 0.5f * ShuffledAcmr && CacheAcmr < 1.0f);
+
+    VrmMeshOptimizer::OptimizeOverdraw(Indices, Positions);
+    TestTrue(TEXT("Overdraw order keeps every triangle and its winding"), GetTriangleSet(Indices) == Expected);
+    TestTrue(TEXT("Overdraw order stays cache friendly"), VrmMeshOptimizer::ComputeAcmr(Indices, Positions.Num()) <= CacheAcmr * 1.5f);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -2,6 +2,14 @@
 
 #include "Misc/AutomationTest.h"
 #include "VrmMetaFeatureDetection.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "VrmToolchain/VrmGlbDocument.h"
+#include "Tests/VrmTestGlb.h"
 
 using namespace VrmMetaDetection;
 
@@ -240,6 +248,133 @@ bool FVrmMetaDetection_VrmcVrmNotObject::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmMetaDetection_StreamingMatchesDom, "VrmToolchain.MetaDetection.StreamingMatchesDom", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmMetaDetection_StreamingMatchesDom::RunTest(const FString& Parameters)
+{
+	// The streaming scanner must agree with the DOM rules on every shape of input
+	const TCHAR* Cases[] =
+	{
+		TEXT(R"({"extensions":{"VRM":{"humanoid":{}}},"secondaryAnimation":[],"blendShapeMaster":[],"thumbnail":{}})"),
+		TEXT(R"({"accessors":[{"count":3}],"extensions":{"VRM":{}}})"),
+		TEXT(R"({"extensions":{"VRMC_vrm":{"humanoid":{},"expressions":{},"thumbnail":0},"VRMC_springBone":{}}})"),
+		TEXT(R"({"extensions":{"VRMC_vrm":{"blendShapeMaster":{},"springBone":[]}},"meshes":[]})"),
+		TEXT(R"({"extensions":{"VRMC_vrm":{}, "VRM":{}}})"),
+		TEXT(R"({"extensions":{"VRMC_vrm":"not an object"}})"),
+		TEXT(R"({"extensions":[]})"),
+		TEXT(R"({"asset":{"version":"2.0"}})")
+	};
+
+	for (const TCHAR* Case : Cases)
+	{
+		TSharedPtr<FJsonObject> Root;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Case);
+		FJsonSerializer::Deserialize(Reader, Root);
+
+		const FVrmMetaFeatures FromDom = ParseMetaFeaturesFromJsonObject(Root);
+		const FVrmMetaFeatures FromStream = ParseMetaFeaturesFromJson(Case);
+		TestEqual(FString::Printf(TEXT("Streaming and DOM detection agree: %s"), Case),
+			FormatMetaFeaturesForDiagnostics(FromStream), FormatMetaFeaturesForDiagnostics(FromDom));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmMetaDetection_ProbeMatchesDetection, "VrmToolchain.MetaDetection.ProbeMatchesDetection", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmMetaDetection_ProbeMatchesDetection::RunTest(const FString& Parameters)
+{
+	// The runtime probe, the streaming detection, the DOM detection and the loaded document read the same rules
+	const TCHAR* Cases[] =
+	{
+		TEXT(R"({"extensions":{"VRM":{"humanoid":{}}},"secondaryAnimation":[],"blendShapeMaster":[],"thumbnail":{}})"),
+		TEXT(R"({"extensions":{"VRM":{"humanoid":{},"secondaryAnimation":{},"blendShapeMaster":{},"meta":{"texture":0}}}})"),
+		TEXT(R"({"extensions":{"VRM":{"meta":{"title":"No texture"}}},"blendShapeMaster":[]})"),
+		TEXT(R"({"accessors":[{"count":3}],"extensions":{"VRM":{}}})"),
+		TEXT(R"({"extensions":{"VRMC_vrm":{"humanoid":{},"expressions":{},"thumbnail":0},"VRMC_springBone":{}}})"),
+		TEXT(R"({"extensions":{"VRMC_vrm":{"blendShapeMaster":{},"springBone":[]}},"meshes":[]})"),
+		TEXT(R"({"extensions":{"VRM":{"humanoid":{}},"VRMC_vrm":{"thumbnail":0}}})"),
+		TEXT(R"({"extensions":{"VRMC_vrm":"not an object","VRMC_springBone":{}}})"),
+		TEXT(R"({"extensions":{"VRMC_vrm":null}})"),
+		TEXT(R"({"extensions":{"VRM":true},"secondaryAnimation":[]})"),
+		TEXT(R"({"extensions":{"VRM":{"humanoid":{}}},"secondaryAnimation":{}})"),
+		TEXT(R"({"extensions":[]})"),
+		TEXT(R"({"asset":{"version":"2.0"}})")
+	};
+
+	const FString TempFile = FPaths::ProjectIntermediateDir() / TEXT("VrmToolchainTests") / TEXT("ProbeMatchesDetection.vrm");
+	for (const TCHAR* Case : Cases)
+	{
+		TSharedPtr<FJsonObject> Root;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Case);
+		FJsonSerializer::Deserialize(Reader, Root);
+		const FString FromDom = FormatMetaFeaturesForDiagnostics(ParseMetaFeaturesFromJsonObject(Root));
+		TestEqual(FString::Printf(TEXT("Streaming and DOM detection agree: %s"), Case), FormatMetaFeaturesForDiagnostics(ParseMetaFeaturesFromJson(Case)), FromDom);
+
+		FVrmProbeResult Probe;
+		FString Error;
+		const TArray<uint8> Glb = VrmTestGlb::MakeGlb(Case, TArray<uint8>());
+		if (!TestTrue(TEXT("Fixture written"), FFileHelper::SaveArrayToFile(Glb, *TempFile))
+			|| !TestTrue(FString::Printf(TEXT("Probe reads the fixture (%s)"), *Error), FVrmParser::ProbeVrmFile(TempFile, Probe, Error)))
+		{
+			continue;
+		}
+
+		FVrmMetaFeatures FromProbe;
+		FromProbe.SpecVersion = Probe.Version;
+		FromProbe.bHasHumanoid = Probe.bHasHumanoid;
+		FromProbe.bHasSpringBones = Probe.bHasSpringBones;
+		FromProbe.bHasBlendShapesOrExpressions = Probe.bHasBlendShapesOrExpressions;
+		FromProbe.bHasThumbnail = Probe.bHasThumbnail;
+		TestEqual(FString::Printf(TEXT("Probe and DOM detection agree: %s"), Case), FormatMetaFeaturesForDiagnostics(FromProbe), FromDom);
+
+		// The document's typed model resolves the version and spring bones from its own DOM
+		const TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(CopyTemp(Glb), Error);
+		if (TestTrue(FString::Printf(TEXT("Document loads (%s)"), *Error), Document.IsValid()))
+		{
+			TestEqual(FString::Printf(TEXT("Probe and document version agree: %s"), Case), FVrmParser::DetectVrmVersion(*Document), Probe.Version);
+			TestEqual(FString::Printf(TEXT("Probe and document spring bones agree: %s"), Case), Document->GetModel().Vrm.bHasSpringBones, Probe.bHasSpringBones);
+			TestEqual(FString::Printf(TEXT("Probe and document detection agree: %s"), Case), FormatMetaFeaturesForDiagnostics(ParseMetaFeaturesFromDocument(*Document)), FromDom);
+		}
+	}
+	IFileManager::Get().Delete(*TempFile);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmMetaDetection_EarlyStopSkipsTrailingJson, "VrmToolchain.MetaDetection.EarlyStopSkipsTrailingJson", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmMetaDetection_EarlyStopSkipsTrailingJson::RunTest(const FString& Parameters)
+{
+	// Malformed only after the extensions object of a VRM1 file: the scan has stopped before the damage
+	const TCHAR* TrailingDamage = TEXT(R"({"extensions":{"VRMC_vrm":{"humanoid":{}}},"meshes":[)");
+	TestEqual(TEXT("Streaming detection does not read past the final result"),
+		FormatMetaFeaturesForDiagnostics(ParseMetaFeaturesFromJson(TrailingDamage)), FString(TEXT("spec=vrm1 humanoid=1 spring=0 blendOrExpr=0 thumb=0")));
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(TrailingDamage);
+	TestFalse(TEXT("The DOM path rejects the same text"), FJsonSerializer::Deserialize(Reader, Root));
+
+	// A GLB document has parsed its whole JSON chunk, so the damage is seen there
+	AddExpectedError(TEXT("Failed to parse JSON from GLB file"), EAutomationExpectedErrorFlags::Contains, 1);
+	FString Error;
+	const TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(VrmTestGlb::MakeGlb(TrailingDamage, TArray<uint8>()), Error);
+	if (TestTrue(FString::Printf(TEXT("Document loads (%s)"), *Error), Document.IsValid()))
+	{
+		TestEqual(TEXT("Document detection follows the DOM"), ParseMetaFeaturesFromDocument(*Document).SpecVersion, EVrmVersion::Unknown);
+	}
+
+	// Damage before the result is final still fails
+	TestEqual(TEXT("Malformed inside the extensions object"),
+		ParseMetaFeaturesFromJson(TEXT(R"({"extensions":{"VRMC_vrm":{"humanoid":{})")).SpecVersion, EVrmVersion::Unknown);
+
+	// VRM0 root flags may follow anywhere, so a VRM0 file missing one is read to the end
+	TestEqual(TEXT("Malformed after the extensions object of a VRM0 file"),
+		ParseMetaFeaturesFromJson(TEXT(R"({"extensions":{"VRM":{"humanoid":{}}},"meshes":[)")).SpecVersion, EVrmVersion::Unknown);
+
+	return true;
+}
+
 // Formatter tests
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmMetaDetection_FormatterVrm0Full, "VrmToolchain.MetaDetection.FormatterVrm0Full", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
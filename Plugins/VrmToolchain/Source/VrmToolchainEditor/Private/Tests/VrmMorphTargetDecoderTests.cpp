@@ -0,0 +1,83 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "VrmMorphTargetDecoder.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmMorphTargetDecoder_Cull,
+    "VrmToolchain.Editor.Import.MorphTargetDecoder.Cull",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmMorphTargetDecoder_Cull::RunTest(const FString& Parameters)
+{
+    // Odd count so both the vector steps and the scalar tail run; every third vertex moves,
+    // every fifth only has a normal delta, the rest sit just below the threshold
+    constexpr int32 NumVertices = 103;
+    constexpr float Threshold = VrmMorphTargetDecoder::DefaultPositionThreshold;
+
+    TArray<float> PositionData;
+    TArray<float> NormalData;
+    TArray<int32> Expected;
+    for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+    {
+        const bool bMoves = Vertex % 3 == 0;
+        const bool bBends = Vertex % 5 == 0;
+        const float Y = bMoves ? 0.01f * (Vertex + 1) : Threshold * 0.5f;
+        PositionData.Append({ 0.0f, bMoves ? -Y : Y, 0.0f });
+        NormalData.Append({ bBends ? 0.25f : 0.0f, 0.0f, 0.0f });
+        if (bMoves || bBends)
+        {
+            Expected.Add(Vertex);
+        }
+    }
+
+    TGltfSparseAccessorView<FVector3f> Positions;
+    Positions.Base = TGltfAccessorView<FVector3f>(reinterpret_cast<const uint8*>(PositionData.GetData()), 12, NumVertices, EVrmGltfComponentType::Float);
+    Positions.Count = NumVertices;
+
+    TGltfSparseAccessorView<FVector3f> Normals;
+    Normals.Base = TGltfAccessorView<FVector3f>(reinterpret_cast<const uint8*>(NormalData.GetData()), 12, NumVertices, EVrmGltfComponentType::Float);
+    Normals.Count = NumVertices;
+
+    FVrmMorphDeltas Deltas;
+    VrmMorphTargetDecoder::Decode(Positions, Normals, Threshold, VrmMorphTargetDecoder::DefaultNormalThreshold, Deltas);
+
+    TestTrue(TEXT("Only moving or bending vertices survive, in order"), Deltas.Vertices == Expected);
+    TestEqual(TEXT("Every stream is culled alike"), Deltas.PositionZ.Num(), Expected.Num());
+    TestEqual(TEXT("Normal-only delta kept with a zero position"), Deltas.GetPosition(Expected.IndexOfByKey(5)), FVector3f(0.0f, 0.0f, -Threshold * 0.5f));
+
+    bool bValuesMatch = true;
+    for (int32 Entry = 0; Entry < Deltas.Num(); ++Entry)
+    {
+        const int32 Vertex = Deltas.Vertices[Entry];
+        bValuesMatch &= Deltas.GetPosition(Entry) == Positions.Base[Vertex];
+        bValuesMatch &= Deltas.GetNormal(Entry) == Normals.Base[Vertex];
+    }
+    TestTrue(TEXT("Surviving entries keep their deltas"), bValuesMatch);
+
+    // Culling again is a no-op
+    TestEqual(TEXT("Cull is idempotent"), VrmMorphTargetDecoder::CullNearZero(Deltas, Threshold, VrmMorphTargetDecoder::DefaultNormalThreshold), Expected.Num());
+
+    // Sparse position deltas merge with sparse normal deltas on other vertices
+    const float SparseValues[] = { 1.0f, 0.0f, 0.0f,  0.0f, 0.0f, 1.0f };
+    const uint32 PositionIndices[] = { 2, 7 };
+    const uint32 NormalIndices[] = { 4, 7 };
+
+    TGltfSparseAccessorView<FVector3f> SparsePositions;
+    SparsePositions.Indices = TGltfAccessorView<uint32>(reinterpret_cast<const uint8*>(PositionIndices), 4, 2, EVrmGltfComponentType::UnsignedInt);
+    SparsePositions.Values = TGltfAccessorView<FVector3f>(reinterpret_cast<const uint8*>(SparseValues), 12, 2, EVrmGltfComponentType::Float);
+    SparsePositions.Count = 10;
+
+    TGltfSparseAccessorView<FVector3f> SparseNormals = SparsePositions;
+    SparseNormals.Indices = TGltfAccessorView<uint32>(reinterpret_cast<const uint8*>(NormalIndices), 4, 2, EVrmGltfComponentType::UnsignedInt);
+
+    VrmMorphTargetDecoder::Decode(SparsePositions, SparseNormals, Threshold, VrmMorphTargetDecoder::DefaultNormalThreshold, Deltas);
+    TestTrue(TEXT("Union of both index lists"), Deltas.Vertices == TArray<int32>({ 2, 4, 7 }));
+    TestEqual(TEXT("Position-only vertex has no normal delta"), Deltas.GetNormal(0), FVector3f::ZeroVector);
+    TestEqual(TEXT("Normal-only vertex has no position delta"), Deltas.GetPosition(1), FVector3f::ZeroVector);
+    TestEqual(TEXT("Shared vertex carries both"), Deltas.GetNormal(2), Deltas.GetPosition(2));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
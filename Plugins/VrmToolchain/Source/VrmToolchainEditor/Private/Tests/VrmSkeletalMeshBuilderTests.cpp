@@ -0,0 +1,572 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Animation/MorphTarget.h"
+#include "Engine/SkeletalMesh.h"
+#include "HAL/PlatformTime.h"
+#include "ReferenceSkeleton.h"
+#include "Rendering/SkeletalMeshLODModel.h"
+#include "Rendering/SkeletalMeshModel.h"
+
+#include "VrmAssetNaming.h"
+#include "VrmConversionService.h"
+#include "VrmGlbAccessorReader.h"
+#include "VrmGltfParser.h"
+#include "VrmImportSettings.h"
+#include "VrmSkeletalMeshBuilder.h"
+#include "VrmToolchain/VrmGlbDocument.h"
+#include "VrmToolchain/VrmSourceAsset.h"
+#include "Tests/VrmTestGlb.h"
+
+namespace VrmSkeletalMeshBuilderTests
+{
+    /**
+     * Two skins and a rigid mesh: Hips (0) > Spine (1), Head (2, at y=2) > Hat (5, at x=5).
+     * Body (node 3, mesh 0) is skinned to skin 0 [Hips, Spine]; Hair (node 4, mesh 1) to skin 1 [Head], so its
+     * JOINTS_0 ordinal 0 is Head, not Hips. Hat (mesh 2) has no skin and follows its own node.
+     * @param ExtraNodes Further nodes appended after Hat (",{...}")
+     */
+    static TArray<uint8> MakeTwoSkinGlb(const TCHAR* ExtraNodes = TEXT(""))
+    {
+        VrmTestGlb::FGlbBuilder Builder;
+        const int32 BodyPositions = Builder.AddAccessor<float>({ 0, 0, 0,  1, 0, 0,  1, 1, 0,  0, 1, 0 }, EVrmGltfComponentType::Float, TEXT("VEC3"));
+        const int32 BodyJoints = Builder.AddAccessor<uint8>({ 0, 0, 0, 0,  0, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0 }, EVrmGltfComponentType::UnsignedByte, TEXT("VEC4"));
+        const int32 BodyWeights = Builder.AddAccessor<float>({ 1, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0 }, EVrmGltfComponentType::Float, TEXT("VEC4"));
+        const int32 BodyIndices = Builder.AddAccessor<uint16>({ 0, 1, 2,  0, 2, 3 }, EVrmGltfComponentType::UnsignedShort, TEXT("SCALAR"));
+        const int32 HairPositions = Builder.AddAccessor<float>({ 10, 0, 0,  11, 0, 0,  10, 1, 0 }, EVrmGltfComponentType::Float, TEXT("VEC3"));
+        const int32 HairJoints = Builder.AddAccessor<uint8>({ 0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0 }, EVrmGltfComponentType::UnsignedByte, TEXT("VEC4"));
+        const int32 HairWeights = Builder.AddAccessor<float>({ 1, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0 }, EVrmGltfComponentType::Float, TEXT("VEC4"));
+        const int32 TriangleIndices = Builder.AddAccessor<uint16>({ 0, 1, 2 }, EVrmGltfComponentType::UnsignedShort, TEXT("SCALAR"));
+        const int32 HatPositions = Builder.AddAccessor<float>({ 0, 0, 0,  1, 0, 0,  0, 1, 0 }, EVrmGltfComponentType::Float, TEXT("VEC3"));
+
+        return Builder.Build(FString::Printf(TEXT(
+            "\"nodes\":[{\"name\":\"Hips\",\"children\":[1,2]},{\"name\":\"Spine\",\"translation\":[0,1,0]},"
+            "{\"name\":\"Head\",\"translation\":[0,2,0],\"children\":[5]},"
+            "{\"name\":\"Body\",\"mesh\":0,\"skin\":0},{\"name\":\"Hair\",\"mesh\":1,\"skin\":1},"
+            "{\"name\":\"Hat\",\"translation\":[5,0,0],\"mesh\":2}%s],"
+            "\"skins\":[{\"joints\":[0,1]},{\"joints\":[2]}],"
+            "\"meshes\":["
+            "{\"name\":\"Body\",\"primitives\":[{\"attributes\":{\"POSITION\":%d,\"JOINTS_0\":%d,\"WEIGHTS_0\":%d},\"indices\":%d}]},"
+            "{\"name\":\"Hair\",\"primitives\":[{\"attributes\":{\"POSITION\":%d,\"JOINTS_0\":%d,\"WEIGHTS_0\":%d},\"indices\":%d}]},"
+            "{\"name\":\"Hat\",\"primitives\":[{\"attributes\":{\"POSITION\":%d},\"indices\":%d}]}]"),
+            ExtraNodes, BodyPositions, BodyJoints, BodyWeights, BodyIndices, HairPositions, HairJoints, HairWeights, TriangleIndices,
+            HatPositions, TriangleIndices));
+    }
+
+    static int32 FindBone(const FVrmGltfSkeleton& Skeleton, int32 NodeIndex)
+    {
+        return Skeleton.Bones.IndexOfByPredicate([NodeIndex](const FVrmGltfBone& Bone) { return Bone.GltfNodeIndex == NodeIndex; });
+    }
+
+    static FReferenceSkeleton MakeRefSkeleton(const FVrmGltfSkeleton& Skeleton)
+    {
+        FReferenceSkeleton RefSkeleton;
+        FReferenceSkeletonModifier Modifier(RefSkeleton, nullptr);
+        for (const FVrmGltfBone& Bone : Skeleton.Bones)
+        {
+            Modifier.Add(FMeshBoneInfo(Bone.Name, Bone.Name.ToString(), Bone.ParentIndex), Bone.LocalTransform);
+        }
+        return RefSkeleton;
+    }
+
+    /** Converts a GLB fixture through the conversion service with the given build path */
+    static USkeletalMesh* ConvertFixture(const TArray<uint8>& Glb, const FString& BaseName, bool bBuildFromMeshDescription, FString& OutError, bool bWeldAndOptimize = false)
+    {
+        UVrmImportSettings* ImportSettings = GetMutableDefault<UVrmImportSettings>();
+        const bool bSavedBuildPath = ImportSettings->bBuildFromMeshDescription;
+        const bool bSavedUseCache = ImportSettings->bUseDerivedDataCache;
+        const bool bSavedWeld = ImportSettings->bWeldAndOptimizeMeshes;
+        ImportSettings->bBuildFromMeshDescription = bBuildFromMeshDescription;
+        ImportSettings->bUseDerivedDataCache = false;
+        ImportSettings->bWeldAndOptimizeMeshes = bWeldAndOptimize;
+
+        UPackage* Package = CreatePackage(*FVrmAssetNaming::MakeVrmSourcePackagePath(TEXT("/Game/TestAssets"), BaseName));
+        UVrmSourceAsset* Source = NewObject<UVrmSourceAsset>(Package, *FVrmAssetNaming::MakeVrmSourceAssetName(BaseName), RF_Public | RF_Standalone);
+        Source->SetSourceBytes(Glb);
+
+        FVrmConvertOptions Options = FVrmConversionService::MakeDefaultConvertOptions();
+        Options.bOverwriteExisting = true;
+        USkeletalMesh* SkeletalMesh = nullptr;
+        USkeleton* Skeleton = nullptr;
+        const bool bConverted = FVrmConversionService::ConvertSourceToPlaceholderSkeletalMesh(Source, Options, SkeletalMesh, Skeleton, OutError);
+
+        ImportSettings->bBuildFromMeshDescription = bSavedBuildPath;
+        ImportSettings->bUseDerivedDataCache = bSavedUseCache;
+        ImportSettings->bWeldAndOptimizeMeshes = bSavedWeld;
+        return bConverted ? SkeletalMesh : nullptr;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmSkeletalMeshBuilder_MultiSkinBinding,
+    "VrmToolchain.Editor.Import.SkeletalMeshBuilder.MultiSkinBinding",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmSkeletalMeshBuilder_MultiSkinBinding::RunTest(const FString& Parameters)
+{
+    using namespace VrmSkeletalMeshBuilderTests;
+
+    FString Error;
+    const TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(MakeTwoSkinGlb(), Error);
+    if (!TestTrue(FString::Printf(TEXT("Fixture parses (%s)"), *Error), Document.IsValid()))
+    {
+        return false;
+    }
+
+    FVrmGltfSkeleton Skeleton;
+    TestTrue(TEXT("Skeleton extracted"), FVrmGltfParser::ExtractSkeletonFromGlbDocument(*Document, Skeleton, Error));
+    const int32 HipsBone = FindBone(Skeleton, 0);
+    const int32 SpineBone = FindBone(Skeleton, 1);
+    const int32 HeadBone = FindBone(Skeleton, 2);
+    const int32 HatBone = FindBone(Skeleton, 5);
+    TestTrue(TEXT("Joints of both skins and the rigid mesh node are bones"), HipsBone != INDEX_NONE && SpineBone != INDEX_NONE && HeadBone != INDEX_NONE && HatBone != INDEX_NONE);
+    TestEqual(TEXT("Skinned mesh nodes are not bones"), Skeleton.Bones.Num(), 4);
+
+    FVrmGltfMeshBinding Binding;
+    TestTrue(TEXT("Meshes bind"), FVrmGltfParser::ExtractMeshBinding(Document->GetModel(), Skeleton, Binding, Error));
+    TestEqual(TEXT("One joint table per skin"), Binding.SkinJointToBone.Num(), 2);
+    TestEqual(TEXT("Hair uses its node's skin"), Binding.MeshSkins[1], 1);
+    TestEqual(TEXT("Hat is rigid"), Binding.MeshSkins[2], int32(INDEX_NONE));
+    TestEqual(TEXT("Hat follows its node's bone"), Binding.MeshRigidBones[2], HatBone);
+
+    FVrmGlbAccessorReader Reader;
+    TestTrue(TEXT("Accessors decode"), Reader.LoadGlbDocument(Document.ToSharedRef()).bSuccess && Reader.DecodeAccessors().bSuccess);
+
+    FVrmSkeletalMeshBuilder::FPreparedMesh Prepared;
+    if (!TestTrue(TEXT("LOD0 builds"), FVrmSkeletalMeshBuilder::PrepareLod0(Reader, MakeRefSkeleton(Skeleton), Binding, TEXT("MultiSkin"),
+        FVrmSkeletalMeshBuilder::EBuildPath::ImportData, false, FString(), Prepared, Error)))
+    {
+        AddError(Error);
+        return false;
+    }
+
+    // Vertices are told apart by position (UE axes): body x <= 1, hat around x = 5 (moved by Head and Hat), hair x >= 10
+    int32 NumHair = 0;
+    int32 NumHat = 0;
+    for (const FSkelMeshSection& Section : Prepared.LODModel->Sections)
+    {
+        for (const FSoftSkinVertex& Vertex : Section.SoftVertices)
+        {
+            const int32 Bone = Section.BoneMap[Vertex.InfluenceBones[0]];
+            if (Vertex.Position.X > 9.5f)
+            {
+                ++NumHair;
+                TestEqual(TEXT("Hair follows skin 1 joint 0 (Head)"), Bone, HeadBone);
+            }
+            else if (Vertex.Position.X > 4.5f)
+            {
+                ++NumHat;
+                TestEqual(TEXT("Hat follows its node's bone"), Bone, HatBone);
+                TestTrue(TEXT("Hat is placed at its node (glTF y = 2 is UE z = -2)"), FMath::IsNearlyEqual(Vertex.Position.Y, 0.0f, 1e-4f) && Vertex.Position.Z < -1.99f);
+            }
+            else
+            {
+                TestTrue(TEXT("Body follows skin 0"), Bone == HipsBone || Bone == SpineBone);
+            }
+        }
+    }
+    TestEqual(TEXT("Hair vertices"), NumHair, 3);
+    TestEqual(TEXT("Hat vertices"), NumHat, 3);
+
+    // The body mesh instanced again under the hair's skin cannot be bound to both
+    const TSharedPtr<FVrmGlbDocument> Conflicting = FVrmGlbDocument::LoadFromBytes(MakeTwoSkinGlb(TEXT(",{\"name\":\"Body2\",\"mesh\":0,\"skin\":1}")), Error);
+    if (TestTrue(TEXT("Conflicting fixture parses"), Conflicting.IsValid()))
+    {
+        FVrmGltfSkeleton ConflictingSkeleton;
+        FVrmGltfParser::ExtractSkeletonFromGlbDocument(*Conflicting, ConflictingSkeleton, Error);
+        FVrmGltfMeshBinding ConflictingBinding;
+        TestFalse(TEXT("Mesh under two skins is rejected"), FVrmGltfParser::ExtractMeshBinding(Conflicting->GetModel(), ConflictingSkeleton, ConflictingBinding, Error));
+        TestTrue(TEXT("Rejection names the skins conflict"), Error.Contains(TEXT("conflicting skins")));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmSkeletalMeshBuilder_QuantizedNodeTransform,
+    "VrmToolchain.Editor.Import.SkeletalMeshBuilder.QuantizedNodeTransform",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmSkeletalMeshBuilder_QuantizedNodeTransform::RunTest(const FString& Parameters)
+{
+    using namespace VrmSkeletalMeshBuilderTests;
+
+    // KHR_mesh_quantization: SHORT positions, dequantized by the node matrix (scale 0.01, then move to 1,2,3)
+    VrmTestGlb::FGlbBuilder Builder;
+    const int32 Positions = Builder.AddAccessor<int16>({ 0, 0, 0,  1000, 0, 0,  0, 1000, 0 }, EVrmGltfComponentType::Short, TEXT("VEC3"));
+    const int32 Indices = Builder.AddAccessor<uint16>({ 0, 1, 2 }, EVrmGltfComponentType::UnsignedShort, TEXT("SCALAR"));
+    const TArray<uint8> Glb = Builder.Build(FString::Printf(TEXT(
+        "\"extensionsUsed\":[\"KHR_mesh_quantization\"],\"extensionsRequired\":[\"KHR_mesh_quantization\"],"
+        "\"nodes\":[{\"name\":\"Prop\",\"mesh\":0,\"matrix\":[0.01,0,0,0, 0,0.01,0,0, 0,0,0.01,0, 1,2,3,1]}],"
+        "\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":%d},\"indices\":%d}]}]"), Positions, Indices));
+
+    FString Error;
+    const TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(CopyTemp(Glb), Error);
+    if (!TestTrue(FString::Printf(TEXT("Fixture parses (%s)"), *Error), Document.IsValid()))
+    {
+        return false;
+    }
+
+    FVrmGltfSkeleton Skeleton;
+    FVrmGltfMeshBinding Binding;
+    TestTrue(TEXT("Skeleton extracted"), FVrmGltfParser::ExtractSkeletonFromGlbDocument(*Document, Skeleton, Error));
+    TestTrue(TEXT("Mesh binds"), FVrmGltfParser::ExtractMeshBinding(Document->GetModel(), Skeleton, Binding, Error));
+
+    FVrmGlbAccessorReader Reader;
+    TestTrue(TEXT("Accessors decode"), Reader.LoadGlbDocument(Document.ToSharedRef()).bSuccess && Reader.DecodeAccessors().bSuccess);
+
+    FVrmSkeletalMeshBuilder::FPreparedMesh Prepared;
+    if (!TestTrue(TEXT("LOD0 builds"), FVrmSkeletalMeshBuilder::PrepareLod0(Reader, MakeRefSkeleton(Skeleton), Binding, TEXT("Quantized"),
+        FVrmSkeletalMeshBuilder::EBuildPath::ImportData, false, FString(), Prepared, Error)))
+    {
+        AddError(Error);
+        return false;
+    }
+
+    // glTF (1,2,3), (11,2,3), (1,12,3) in UE axes
+    const FVector3f Expected[] = { FVector3f(1, 3, -2), FVector3f(11, 3, -2), FVector3f(1, 3, -12) };
+    TArray<FVector3f> Built;
+    for (const FSkelMeshSection& Section : Prepared.LODModel->Sections)
+    {
+        for (const FSoftSkinVertex& Vertex : Section.SoftVertices)
+        {
+            Built.Add(Vertex.Position);
+        }
+    }
+    TestEqual(TEXT("Vertex count"), Built.Num(), 3);
+    for (const FVector3f& Position : Expected)
+    {
+        TestTrue(FString::Printf(TEXT("Dequantized by the node matrix: %s"), *Position.ToString()),
+            Built.ContainsByPredicate([&Position](const FVector3f& Vertex) { return Vertex.Equals(Position, 1e-3f); }));
+    }
+
+    // Skinned meshes ignore their node transform; their dequantization lives in inverseBindMatrices, which are not read
+    VrmTestGlb::FGlbBuilder SkinnedBuilder;
+    const int32 SkinnedPositions = SkinnedBuilder.AddAccessor<int16>({ 0, 0, 0,  1000, 0, 0,  0, 1000, 0 }, EVrmGltfComponentType::Short, TEXT("VEC3"));
+    const int32 Joints = SkinnedBuilder.AddAccessor<uint8>({ 0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0 }, EVrmGltfComponentType::UnsignedByte, TEXT("VEC4"));
+    const int32 Weights = SkinnedBuilder.AddAccessor<float>({ 1, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0 }, EVrmGltfComponentType::Float, TEXT("VEC4"));
+    const int32 SkinnedIndices = SkinnedBuilder.AddAccessor<uint16>({ 0, 1, 2 }, EVrmGltfComponentType::UnsignedShort, TEXT("SCALAR"));
+    const TSharedPtr<FVrmGlbDocument> Skinned = FVrmGlbDocument::LoadFromBytes(SkinnedBuilder.Build(FString::Printf(TEXT(
+        "\"nodes\":[{\"name\":\"Root\"},{\"name\":\"Body\",\"mesh\":0,\"skin\":0}],\"skins\":[{\"joints\":[0]}],"
+        "\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":%d,\"JOINTS_0\":%d,\"WEIGHTS_0\":%d},\"indices\":%d}]}]"),
+        SkinnedPositions, Joints, Weights, SkinnedIndices)), Error);
+    if (TestTrue(TEXT("Skinned fixture parses"), Skinned.IsValid()))
+    {
+        FVrmGlbAccessorReader SkinnedReader;
+        TestTrue(TEXT("Skinned document loads"), SkinnedReader.LoadGlbDocument(Skinned.ToSharedRef()).bSuccess);
+        const FVrmGlbAccessorReader::FDecodeResult Result = SkinnedReader.DecodeAccessors();
+        TestFalse(TEXT("Skinned quantized positions are rejected"), Result.bSuccess);
+        TestTrue(TEXT("Rejection names inverseBindMatrices"), Result.ErrorMessage.Contains(TEXT("inverseBindMatrices")));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmSkeletalMeshBuilder_MaterialSlotLimit,
+    "VrmToolchain.Editor.Import.SkeletalMeshBuilder.MaterialSlotLimit",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmSkeletalMeshBuilder_MaterialSlotLimit::RunTest(const FString& Parameters)
+{
+    using namespace VrmSkeletalMeshBuilderTests;
+
+    // One more material than the import data's 8-bit material index addresses, each on its own primitive
+    constexpr int32 NumMaterials = MAX_uint8 + 2;
+    VrmTestGlb::FGlbBuilder Builder;
+    const int32 Positions = Builder.AddAccessor<float>({ 0, 0, 0,  1, 0, 0,  0, 1, 0 }, EVrmGltfComponentType::Float, TEXT("VEC3"));
+    const int32 Joints = Builder.AddAccessor<uint8>({ 0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0 }, EVrmGltfComponentType::UnsignedByte, TEXT("VEC4"));
+    const int32 Weights = Builder.AddAccessor<float>({ 1, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0 }, EVrmGltfComponentType::Float, TEXT("VEC4"));
+    const int32 Indices = Builder.AddAccessor<uint16>({ 0, 1, 2 }, EVrmGltfComponentType::UnsignedShort, TEXT("SCALAR"));
+
+    TArray<FString> Materials;
+    TArray<FString> Primitives;
+    for (int32 Material = 0; Material < NumMaterials; ++Material)
+    {
+        Materials.Add(TEXT("{}"));
+        Primitives.Add(FString::Printf(TEXT("{\"attributes\":{\"POSITION\":%d,\"JOINTS_0\":%d,\"WEIGHTS_0\":%d},\"indices\":%d,\"material\":%d}"),
+            Positions, Joints, Weights, Indices, Material));
+    }
+
+    FString Error;
+    const TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromBytes(Builder.Build(FString::Printf(TEXT(
+        "\"nodes\":[{\"name\":\"Root\"},{\"name\":\"Body\",\"mesh\":0,\"skin\":0}],\"skins\":[{\"joints\":[0]}],"
+        "\"materials\":[%s],\"meshes\":[{\"primitives\":[%s]}]"),
+        *FString::Join(Materials, TEXT(",")), *FString::Join(Primitives, TEXT(",")))), Error);
+    if (!TestTrue(FString::Printf(TEXT("Fixture parses (%s)"), *Error), Document.IsValid()))
+    {
+        return false;
+    }
+
+    FVrmGltfSkeleton Skeleton;
+    FVrmGltfMeshBinding Binding;
+    TestTrue(TEXT("Skeleton extracted"), FVrmGltfParser::ExtractSkeletonFromGlbDocument(*Document, Skeleton, Error));
+    TestTrue(TEXT("Mesh binds"), FVrmGltfParser::ExtractMeshBinding(Document->GetModel(), Skeleton, Binding, Error));
+
+    FVrmGlbAccessorReader Reader;
+    TestTrue(TEXT("Accessors decode"), Reader.LoadGlbDocument(Document.ToSharedRef()).bSuccess && Reader.DecodeAccessors().bSuccess);
+
+    // Both build paths refuse the mesh instead of wrapping the material index onto slot 0
+    for (const FVrmSkeletalMeshBuilder::EBuildPath BuildPath : { FVrmSkeletalMeshBuilder::EBuildPath::ImportData, FVrmSkeletalMeshBuilder::EBuildPath::MeshDescription })
+    {
+        FVrmSkeletalMeshBuilder::FPreparedMesh Prepared;
+        Error.Reset();
+        TestFalse(TEXT("Too many material slots fail"), FVrmSkeletalMeshBuilder::PrepareLod0(Reader, MakeRefSkeleton(Skeleton), Binding, TEXT("Materials"),
+            BuildPath, false, FString(), Prepared, Error));
+        TestTrue(FString::Printf(TEXT("Error names the limit (%s)"), *Error), Error.Contains(TEXT("material slots")));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmSkeletalMeshBuilder_BuildPathParity,
+    "VrmToolchain.Editor.Import.SkeletalMeshBuilder.BuildPathParity",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmSkeletalMeshBuilder_BuildPathParity::RunTest(const FString& Parameters)
+{
+    using namespace VrmSkeletalMeshBuilderTests;
+
+    // The mesh description path must give the engine the same mesh the import data path builds
+    FString Error;
+    USkeletalMesh* FromImportData = ConvertFixture(VrmTestGlb::MakeSkinnedQuadGlb(), TEXT("TestVrmBuildPathImportData"), false, Error);
+    if (!TestNotNull(FString::Printf(TEXT("Import data path converts (%s)"), *Error), FromImportData))
+    {
+        return false;
+    }
+    USkeletalMesh* FromMeshDescription = ConvertFixture(VrmTestGlb::MakeSkinnedQuadGlb(), TEXT("TestVrmBuildPathMeshDescription"), true, Error);
+    if (!TestNotNull(FString::Printf(TEXT("Mesh description path converts (%s)"), *Error), FromMeshDescription))
+    {
+        return false;
+    }
+
+    const FSkeletalMeshModel* ImportDataModel = FromImportData->GetImportedModel();
+    const FSkeletalMeshModel* MeshDescriptionModel = FromMeshDescription->GetImportedModel();
+    if (!TestTrue(TEXT("Both paths build LOD0"), ImportDataModel->LODModels.Num() > 0 && MeshDescriptionModel->LODModels.Num() > 0))
+    {
+        return false;
+    }
+
+    const FSkeletalMeshLODModel& Expected = ImportDataModel->LODModels[0];
+    const FSkeletalMeshLODModel& Actual = MeshDescriptionModel->LODModels[0];
+    TestEqual(TEXT("Section count"), Actual.Sections.Num(), Expected.Sections.Num());
+    TestEqual(TEXT("Vertex count"), static_cast<int32>(Actual.NumVertices), static_cast<int32>(Expected.NumVertices));
+    TestEqual(TEXT("Index count"), Actual.IndexBuffer.Num(), Expected.IndexBuffer.Num());
+    TestEqual(TEXT("Material slots"), FromMeshDescription->GetMaterials().Num(), FromImportData->GetMaterials().Num());
+    for (int32 SectionIndex = 0; SectionIndex < FMath::Min(Actual.Sections.Num(), Expected.Sections.Num()); ++SectionIndex)
+    {
+        TestEqual(FString::Printf(TEXT("Section %d triangles"), SectionIndex), Actual.Sections[SectionIndex].NumTriangles, Expected.Sections[SectionIndex].NumTriangles);
+        TestEqual(FString::Printf(TEXT("Section %d vertices"), SectionIndex), Actual.Sections[SectionIndex].GetNumVertices(), Expected.Sections[SectionIndex].GetNumVertices());
+    }
+
+    const TArray<TObjectPtr<UMorphTarget>>& ExpectedMorphs = FromImportData->GetMorphTargets();
+    const TArray<TObjectPtr<UMorphTarget>>& ActualMorphs = FromMeshDescription->GetMorphTargets();
+    if (TestEqual(TEXT("Morph target count"), ActualMorphs.Num(), ExpectedMorphs.Num()) && ExpectedMorphs.Num() == 1)
+    {
+        TestEqual(TEXT("Morph target name"), ActualMorphs[0]->GetFName(), ExpectedMorphs[0]->GetFName());
+        const auto GetNumDeltas = [](const UMorphTarget* Morph) { return Morph->GetMorphLODModels().Num() > 0 ? Morph->GetMorphLODModels()[0].Vertices.Num() : 0; };
+        TestEqual(TEXT("Morph target deltas"), GetNumDeltas(ActualMorphs[0]), GetNumDeltas(ExpectedMorphs[0]));
+        TestTrue(TEXT("Morph target moves vertices"), GetNumDeltas(ExpectedMorphs[0]) > 0);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmSkeletalMeshBuilder_MorphTargetUnion,
+    "VrmToolchain.Editor.Import.SkeletalMeshBuilder.MorphTargetUnion",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmSkeletalMeshBuilder_MorphTargetUnion::RunTest(const FString& Parameters)
+{
+    using namespace VrmSkeletalMeshBuilderTests;
+
+    // The skinned quad split into two material primitives sharing its points. Both carry "Raise" through different
+    // accessors that disagree on the shared corner (1, 1, 0); only the second one's moves (0, 1, 0).
+    // "A.B" and "A_B" are different glTF names that sanitize alike
+    VrmTestGlb::FGlbBuilder Builder;
+    const int32 Positions = Builder.AddAccessor<float>({ 0, 0, 0,  1, 0, 0,  1, 1, 0,  0, 1, 0 }, EVrmGltfComponentType::Float, TEXT("VEC3"));
+    const int32 Joints = Builder.AddAccessor<uint8>({ 0, 0, 0, 0,  0, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0 }, EVrmGltfComponentType::UnsignedByte, TEXT("VEC4"));
+    const int32 Weights = Builder.AddAccessor<float>({ 1, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0 }, EVrmGltfComponentType::Float, TEXT("VEC4"));
+    const int32 FirstIndices = Builder.AddAccessor<uint16>({ 0, 1, 2 }, EVrmGltfComponentType::UnsignedShort, TEXT("SCALAR"));
+    const int32 SecondIndices = Builder.AddAccessor<uint16>({ 0, 2, 3 }, EVrmGltfComponentType::UnsignedShort, TEXT("SCALAR"));
+    const int32 Nudge = Builder.AddAccessor<float>({ 0, 0, 0,  0, 0, 0,  0, 0.25f, 0,  0, 0, 0 }, EVrmGltfComponentType::Float, TEXT("VEC3"));
+    const int32 Raise = Builder.AddAccessor<float>({ 0, 0, 0,  0, 0, 0,  0, 0.5f, 0,  0, 0.5f, 0 }, EVrmGltfComponentType::Float, TEXT("VEC3"));
+    const int32 Push = Builder.AddAccessor<float>({ 0.5f, 0, 0,  0, 0, 0,  0, 0, 0,  0, 0, 0 }, EVrmGltfComponentType::Float, TEXT("VEC3"));
+    const FString Attributes = FString::Printf(TEXT("\"attributes\":{\"POSITION\":%d,\"JOINTS_0\":%d,\"WEIGHTS_0\":%d}"), Positions, Joints, Weights);
+    const TArray<uint8> Glb = Builder.Build(FString::Printf(TEXT(
+        "\"nodes\":[{\"name\":\"Hips\",\"children\":[1]},{\"name\":\"Spine\",\"translation\":[0,1,0]},{\"name\":\"Body\",\"mesh\":0,\"skin\":0}],"
+        "\"skins\":[{\"joints\":[0,1]}],\"materials\":[{},{}],"
+        "\"meshes\":[{\"name\":\"Body\",\"extras\":{\"targetNames\":[\"Raise\",\"A.B\",\"A_B\"]},\"primitives\":["
+        "{%s,\"indices\":%d,\"material\":0,\"targets\":[{\"POSITION\":%d},{\"POSITION\":%d},{\"POSITION\":%d}]},"
+        "{%s,\"indices\":%d,\"material\":1,\"targets\":[{\"POSITION\":%d},{\"POSITION\":%d},{\"POSITION\":%d}]}]}]"),
+        *Attributes, FirstIndices, Nudge, Push, Push, *Attributes, SecondIndices, Raise, Push, Push));
+
+    // Once per build, welded or not: welding gathers the targets without naming them
+    AddExpectedError(TEXT("Morph target \"A_B\" renamed to A_B_1"), EAutomationExpectedErrorFlags::Contains, 4);
+    for (const int32 Build : { 0, 1, 2, 3 })
+    {
+        // Welding must compare every target moving a point, including those of the primitive that does not own it
+        const bool bBuildFromMeshDescription = (Build & 1) != 0;
+        const bool bWeldAndOptimize = (Build & 2) != 0;
+        const FString BuildName = FString::Printf(TEXT("%s%s"), bBuildFromMeshDescription ? TEXT("MeshDescription") : TEXT("ImportData"), bWeldAndOptimize ? TEXT("Welded") : TEXT(""));
+        const TCHAR* PathName = *BuildName;
+        FString Error;
+        USkeletalMesh* SkeletalMesh = ConvertFixture(Glb, FString::Printf(TEXT("TestVrmMorphUnion%s"), PathName), bBuildFromMeshDescription, Error, bWeldAndOptimize);
+        if (!TestNotNull(FString::Printf(TEXT("%s path converts (%s)"), PathName, *Error), SkeletalMesh))
+        {
+            continue;
+        }
+
+        TestEqual(FString::Printf(TEXT("%s: one morph target per glTF name"), PathName), SkeletalMesh->GetMorphTargets().Num(), 3);
+        TestNotNull(FString::Printf(TEXT("%s: first sanitized name kept"), PathName), SkeletalMesh->FindMorphTarget(TEXT("A_B")));
+        TestNotNull(FString::Printf(TEXT("%s: colliding sanitized name suffixed"), PathName), SkeletalMesh->FindMorphTarget(TEXT("A_B_1")));
+
+        const UMorphTarget* RaiseMorph = SkeletalMesh->FindMorphTarget(TEXT("Raise"));
+        if (!TestTrue(FString::Printf(TEXT("%s: Raise has deltas"), PathName), RaiseMorph && RaiseMorph->GetMorphLODModels().Num() > 0))
+        {
+            continue;
+        }
+
+        const FSkeletalMeshLODModel& LODModel = SkeletalMesh->GetImportedModel()->LODModels[0];
+        TArray<FVector3f> RenderPositions;
+        RenderPositions.SetNumZeroed(LODModel.NumVertices);
+        for (const FSkelMeshSection& Section : LODModel.Sections)
+        {
+            for (int32 Vertex = 0; Vertex < Section.SoftVertices.Num(); ++Vertex)
+            {
+                RenderPositions[Section.BaseVertexIndex + Vertex] = Section.SoftVertices[Vertex].Position;
+            }
+        }
+
+        // Each vertex moves once: the shared corner as the first primitive moves it, (0, 1, 0) as the second one does
+        TSet<uint32> Moved;
+        int32 NumShared = 0;
+        int32 NumSecondOnly = 0;
+        for (const FMorphTargetDelta& Delta : RaiseMorph->GetMorphLODModels()[0].Vertices)
+        {
+            bool bAlreadyMoved = false;
+            Moved.Add(Delta.SourceIdx, &bAlreadyMoved);
+            TestFalse(FString::Printf(TEXT("%s: vertex %u has one delta"), PathName, Delta.SourceIdx), bAlreadyMoved);
+
+            const FVector3f Position = RenderPositions.IsValidIndex(Delta.SourceIdx) ? RenderPositions[Delta.SourceIdx] : FVector3f::ZeroVector;
+            if (Position.Equals(FVector3f(1, 0, -1)))
+            {
+                ++NumShared;
+                TestTrue(FString::Printf(TEXT("%s: shared corner moves by the first primitive's delta (%s)"), PathName, *Delta.PositionDelta.ToString()),
+                    Delta.PositionDelta.Equals(FVector3f(0, 0, -0.25f), 1e-4f));
+            }
+            else if (Position.Equals(FVector3f(0, 0, -1)))
+            {
+                ++NumSecondOnly;
+                TestTrue(FString::Printf(TEXT("%s: corner of the second primitive moves by its delta (%s)"), PathName, *Delta.PositionDelta.ToString()),
+                    Delta.PositionDelta.Equals(FVector3f(0, 0, -0.5f), 1e-4f));
+            }
+            else
+            {
+                AddError(FString::Printf(TEXT("%s: Raise moves the unmoved vertex at %s"), PathName, *Position.ToString()));
+            }
+        }
+        TestTrue(FString::Printf(TEXT("%s: both moved corners have deltas"), PathName), NumShared > 0 && NumSecondOnly > 0);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmSkeletalMeshBuilder_DerivedDataRoundTrip,
+    "VrmToolchain.Editor.Import.SkeletalMeshBuilder.DerivedDataRoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmSkeletalMeshBuilder_DerivedDataRoundTrip::RunTest(const FString& Parameters)
+{
+    using namespace VrmSkeletalMeshBuilderTests;
+
+    /** Inputs of both builds and the LOD0 stored first, kept alive for the latent check */
+    struct FRoundTrip
+    {
+        TSharedPtr<FVrmGlbDocument> Document;
+        FVrmGlbAccessorReader Reader;
+        FReferenceSkeleton RefSkeleton;
+        FVrmGltfMeshBinding Binding;
+        FString DerivedDataKey;
+        FVrmSkeletalMeshBuilder::FPreparedMesh Stored;
+    };
+    const TSharedRef<FRoundTrip> RoundTrip = MakeShared<FRoundTrip>();
+
+    FString Error;
+    RoundTrip->Document = FVrmGlbDocument::LoadFromBytes(VrmTestGlb::MakeSkinnedQuadGlb(), Error);
+    if (!TestTrue(FString::Printf(TEXT("Fixture parses (%s)"), *Error), RoundTrip->Document.IsValid()))
+    {
+        return false;
+    }
+
+    FVrmGltfSkeleton Skeleton;
+    TestTrue(TEXT("Skeleton extracted"), FVrmGltfParser::ExtractSkeletonFromGlbDocument(*RoundTrip->Document, Skeleton, Error));
+    TestTrue(TEXT("Mesh binds"), FVrmGltfParser::ExtractMeshBinding(RoundTrip->Document->GetModel(), Skeleton, RoundTrip->Binding, Error));
+    TestTrue(TEXT("Accessors decode"), RoundTrip->Reader.LoadGlbDocument(RoundTrip->Document.ToSharedRef()).bSuccess && RoundTrip->Reader.DecodeAccessors().bSuccess);
+    RoundTrip->RefSkeleton = MakeRefSkeleton(Skeleton);
+
+    // A key no earlier run can have stored: the first build misses and stores
+    RoundTrip->DerivedDataKey = FGuid::NewGuid().ToString();
+    if (!TestTrue(TEXT("LOD0 builds"), FVrmSkeletalMeshBuilder::PrepareLod0(RoundTrip->Reader, RoundTrip->RefSkeleton, RoundTrip->Binding, TEXT("RoundTrip"),
+        FVrmSkeletalMeshBuilder::EBuildPath::ImportData, false, RoundTrip->DerivedDataKey, RoundTrip->Stored, Error)))
+    {
+        AddError(Error);
+        return false;
+    }
+    TestFalse(TEXT("First build misses the cache"), RoundTrip->Stored.bRestoredFromCache);
+
+    // The put completes in the background; prepare again until the cache answers
+    const double Deadline = FPlatformTime::Seconds() + 30.0;
+    ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, RoundTrip, Deadline]()
+    {
+        FString LatentError;
+        FVrmSkeletalMeshBuilder::FPreparedMesh Restored;
+        if (!FVrmSkeletalMeshBuilder::PrepareLod0(RoundTrip->Reader, RoundTrip->RefSkeleton, RoundTrip->Binding, TEXT("RoundTrip"),
+            FVrmSkeletalMeshBuilder::EBuildPath::ImportData, false, RoundTrip->DerivedDataKey, Restored, LatentError))
+        {
+            AddError(LatentError);
+            return true;
+        }
+        if (!Restored.bRestoredFromCache)
+        {
+            if (FPlatformTime::Seconds() < Deadline)
+            {
+                return false;
+            }
+            AddError(TEXT("LOD0 was never restored from the derived data cache"));
+            return true;
+        }
+
+        const FVrmSkeletalMeshBuilder::FPreparedMesh& Stored = RoundTrip->Stored;
+        TestTrue(TEXT("Material slots restored"), Restored.MaterialSlots == Stored.MaterialSlots);
+        TestTrue(TEXT("Point bases restored"), Restored.PointBases == Stored.PointBases);
+        TestEqual(TEXT("Point count restored"), Restored.NumPoints, Stored.NumPoints);
+
+        const FSkeletalMeshLODModel& Expected = *Stored.LODModel;
+        const FSkeletalMeshLODModel& Actual = *Restored.LODModel;
+        TestEqual(TEXT("Vertex count"), static_cast<int32>(Actual.NumVertices), static_cast<int32>(Expected.NumVertices));
+        TestTrue(TEXT("Index buffer"), Actual.IndexBuffer == Expected.IndexBuffer);
+        TestTrue(TEXT("Import point map"), Actual.MeshToImportVertexMap == Expected.MeshToImportVertexMap);
+        if (TestEqual(TEXT("Section count"), Actual.Sections.Num(), Expected.Sections.Num()))
+        {
+            for (int32 SectionIndex = 0; SectionIndex < Expected.Sections.Num(); ++SectionIndex)
+            {
+                const FSkelMeshSection& ExpectedSection = Expected.Sections[SectionIndex];
+                const FSkelMeshSection& ActualSection = Actual.Sections[SectionIndex];
+                TestTrue(FString::Printf(TEXT("Section %d bone map"), SectionIndex), ActualSection.BoneMap == ExpectedSection.BoneMap);
+                if (TestEqual(FString::Printf(TEXT("Section %d vertices"), SectionIndex), ActualSection.SoftVertices.Num(), ExpectedSection.SoftVertices.Num()))
+                {
+                    for (int32 Vertex = 0; Vertex < ExpectedSection.SoftVertices.Num(); ++Vertex)
+                    {
+                        const FSoftSkinVertex& A = ActualSection.SoftVertices[Vertex];
+                        const FSoftSkinVertex& B = ExpectedSection.SoftVertices[Vertex];
+                        TestTrue(FString::Printf(TEXT("Section %d vertex %d"), SectionIndex, Vertex), A.Position == B.Position && A.TangentZ == B.TangentZ
+                            && A.UVs[0] == B.UVs[0] && A.InfluenceBones[0] == B.InfluenceBones[0] && A.InfluenceWeights[0] == B.InfluenceWeights[0]);
+                    }
+                }
+            }
+        }
+        return true;
+    }));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
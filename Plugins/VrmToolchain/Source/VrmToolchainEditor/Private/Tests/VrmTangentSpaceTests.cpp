@@ -0,0 +1,110 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "VrmTangentSpace.h"
+
+namespace
+{
+    /** Unit quads side by side along X in the glTF XZ plane (UE XY), each its own island */
+    struct FQuadStrip
+    {
+        TArray<FVector3f> Positions;
+        TArray<FVector3f> Normals;
+        TArray<FVector2f> TexCoords;
+        TArray<uint32> Indices;
+
+        /** Odd quads map U along UE +Y instead of +X */
+        explicit FQuadStrip(int32 NumQuads)
+        {
+            for (int32 Quad = 0; Quad < NumQuads; ++Quad)
+            {
+                const float X = 2.0f * Quad;
+                const uint32 Base = Positions.Num();
+                Positions.Append({ FVector3f(X, 0, 0), FVector3f(X + 1, 0, 0), FVector3f(X + 1, 0, 1), FVector3f(X, 0, 1) });
+                Normals.Append({ FVector3f(0, -1, 0), FVector3f(0, -1, 0), FVector3f(0, -1, 0), FVector3f(0, -1, 0) });
+                if (Quad % 2 == 0)
+                {
+                    TexCoords.Append({ FVector2f(0, 0), FVector2f(1, 0), FVector2f(1, 1), FVector2f(0, 1) });
+                }
+                else
+                {
+                    TexCoords.Append({ FVector2f(0, 0), FVector2f(0, -1), FVector2f(1, -1), FVector2f(1, 0) });
+                }
+                Indices.Append({ Base, Base + 1, Base + 2, Base, Base + 2, Base + 3 });
+            }
+        }
+
+        TGltfAccessorView<FVector3f> PositionView() const { return TGltfAccessorView<FVector3f>(reinterpret_cast<const uint8*>(Positions.GetData()), 12, Positions.Num(), EVrmGltfComponentType::Float); }
+        TGltfAccessorView<FVector3f> NormalView() const { return TGltfAccessorView<FVector3f>(reinterpret_cast<const uint8*>(Normals.GetData()), 12, Normals.Num(), EVrmGltfComponentType::Float); }
+        TGltfAccessorView<FVector2f> TexCoordView() const { return TGltfAccessorView<FVector2f>(reinterpret_cast<const uint8*>(TexCoords.GetData()), 8, TexCoords.Num(), EVrmGltfComponentType::Float); }
+        TGltfAccessorView<uint32> IndexView() const { return TGltfAccessorView<uint32>(reinterpret_cast<const uint8*>(Indices.GetData()), 4, Indices.Num(), EVrmGltfComponentType::UnsignedInt); }
+    };
+
+    bool IsOrthonormal(const FVrmCornerFrames& Frames, int32 Corner)
+    {
+        const FVector3f& X = Frames.TangentX[Corner];
+        const FVector3f& Y = Frames.TangentY[Corner];
+        const FVector3f& Z = Frames.TangentZ[Corner];
+        return X.IsUnit(1.0e-4f) && Y.IsUnit(1.0e-4f) && Z.IsUnit(1.0e-4f)
+            && FMath::IsNearlyZero(X | Y, 1.0e-4f) && FMath::IsNearlyZero(X | Z, 1.0e-4f) && FMath::IsNearlyZero(Y | Z, 1.0e-4f);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVrmTangentSpace_CornerFrames,
+    "VrmToolchain.Editor.Import.TangentSpace.CornerFrames",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVrmTangentSpace_CornerFrames::RunTest(const FString& Parameters)
+{
+    // Enough islands for several generation chunks
+    const int32 NumQuads = VrmTangentSpace::TrianglesPerChunk + 7;
+    const FQuadStrip Strip(NumQuads);
+
+    FVrmCornerFrames Frames;
+    VrmTangentSpace::ComputeCornerFrames(Strip.PositionView(), Strip.NormalView(), TGltfAccessorView<FVector4f>(), Strip.TexCoordView(), Strip.IndexView(), Frames);
+    TestEqual(TEXT("Three frames per triangle"), Frames.Num(), Strip.Indices.Num());
+
+    // glTF -Y is UE +Z; U runs along UE +X (even quads) or +Y (odd quads), V along UE +Y or -X
+    bool bGeneratedMatch = true;
+    for (int32 Corner = 0; Corner < Frames.Num(); ++Corner)
+    {
+        const bool bEven = (Corner / 6) % 2 == 0;
+        bGeneratedMatch &= Frames.TangentZ[Corner].Equals(FVector3f(0, 0, 1), 1.0e-4f);
+        bGeneratedMatch &= Frames.TangentX[Corner].Equals(bEven ? FVector3f(1, 0, 0) : FVector3f(0, 1, 0), 1.0e-4f);
+        bGeneratedMatch &= Frames.TangentY[Corner].Equals(bEven ? FVector3f(0, -1, 0) : FVector3f(1, 0, 0), 1.0e-4f);
+    }
+    TestTrue(TEXT("MikkTSpace tangents follow each island's UVs"), bGeneratedMatch);
+
+    // No NORMAL and no UVs: flat normals, any orthonormal frame
+    VrmTangentSpace::ComputeCornerFrames(Strip.PositionView(), TGltfAccessorView<FVector3f>(), TGltfAccessorView<FVector4f>(), TGltfAccessorView<FVector2f>(), Strip.IndexView(), Frames);
+    TestTrue(TEXT("Flat normal of the winding"), Frames.TangentZ[0].Equals(FVector3f(0, 0, 1), 1.0e-4f));
+    TestTrue(TEXT("Frame without UVs is orthonormal"), IsOrthonormal(Frames, 0));
+
+    // TANGENT is converted like a direction and its sign flips the bitangent
+    const TArray<FVector4f> TangentData = { FVector4f(0, 0, 1, -1), FVector4f(0, 0, 1, -1), FVector4f(0, 0, 1, -1), FVector4f(0, 0, 1, -1) };
+    const TGltfAccessorView<FVector4f> Tangents(reinterpret_cast<const uint8*>(TangentData.GetData()), 16, 4, EVrmGltfComponentType::Float);
+    const TGltfAccessorView<uint32> FirstQuad(reinterpret_cast<const uint8*>(Strip.Indices.GetData()), 4, 6, EVrmGltfComponentType::UnsignedInt);
+    const TGltfAccessorView<FVector3f> FirstPositions(reinterpret_cast<const uint8*>(Strip.Positions.GetData()), 12, 4, EVrmGltfComponentType::Float);
+    const TGltfAccessorView<FVector3f> FirstNormals(reinterpret_cast<const uint8*>(Strip.Normals.GetData()), 12, 4, EVrmGltfComponentType::Float);
+    VrmTangentSpace::ComputeCornerFrames(FirstPositions, FirstNormals, Tangents, TGltfAccessorView<FVector2f>(), FirstQuad, Frames);
+    TestEqual(TEXT("Two triangles"), Frames.Num(), 6);
+    TestTrue(TEXT("TANGENT in UE axes"), Frames.TangentX[4].Equals(FVector3f(0, 1, 0), 1.0e-4f));
+    TestTrue(TEXT("Negative W mirrors the bitangent"), Frames.TangentY[4].Equals(FVector3f(-1, 0, 0), 1.0e-4f));
+
+    // TANGENT without NORMAL is ignored: flat normals, MikkTSpace tangents along the UVs
+    const TGltfAccessorView<FVector2f> FirstTexCoords(reinterpret_cast<const uint8*>(Strip.TexCoords.GetData()), 8, 4, EVrmGltfComponentType::Float);
+    VrmTangentSpace::ComputeCornerFrames(FirstPositions, TGltfAccessorView<FVector3f>(), Tangents, FirstTexCoords, FirstQuad, Frames);
+    bool bIgnoredTangents = true;
+    for (int32 Corner = 0; Corner < Frames.Num(); ++Corner)
+    {
+        bIgnoredTangents &= Frames.TangentZ[Corner].Equals(FVector3f(0, 0, 1), 1.0e-4f);
+        bIgnoredTangents &= Frames.TangentX[Corner].Equals(FVector3f(1, 0, 0), 1.0e-4f);
+        bIgnoredTangents &= Frames.TangentY[Corner].Equals(FVector3f(0, -1, 0), 1.0e-4f);
+    }
+    TestTrue(TEXT("TANGENT without NORMAL is replaced by generated tangents"), bIgnoredTangents);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VrmToolchain/VrmGlbContainer.h"
+#include "VrmToolchain/VrmGltfModel.h"
+#include <initializer_list>
+
+/** In-memory GLB fixtures shared by the editor automation tests */
+namespace VrmTestGlb
+{
+    /** Builds a GLB with the given JSON and BIN chunk contents */
+    inline TArray<uint8> MakeGlb(const FString& Json, TArray<uint8> Bin)
+    {
+        FTCHARToUTF8 JsonUtf8(*Json);
+        TArray<uint8> JsonBytes(reinterpret_cast<const uint8*>(JsonUtf8.Get()), JsonUtf8.Length());
+        while (JsonBytes.Num() % 4 != 0)
+        {
+            JsonBytes.Add(' ');
+        }
+        while (Bin.Num() % 4 != 0)
+        {
+            Bin.Add(0);
+        }
+
+        const uint32 Header[3] = {
+            FVrmGlbContainer::Magic,
+            FVrmGlbContainer::Version,
+            uint32(FVrmGlbContainer::HeaderSize + 2 * FVrmGlbContainer::ChunkHeaderSize + JsonBytes.Num() + Bin.Num())
+        };
+        const uint32 JsonHeader[2] = { uint32(JsonBytes.Num()), EVrmGlbChunkType::Json };
+        const uint32 BinHeader[2] = { uint32(Bin.Num()), EVrmGlbChunkType::Bin };
+
+        TArray<uint8> Glb;
+        Glb.Append(reinterpret_cast<const uint8*>(Header), sizeof(Header));
+        Glb.Append(reinterpret_cast<const uint8*>(JsonHeader), sizeof(JsonHeader));
+        Glb.Append(JsonBytes);
+        Glb.Append(reinterpret_cast<const uint8*>(BinHeader), sizeof(BinHeader));
+        Glb.Append(Bin);
+        return Glb;
+    }
+
+    template<typename T>
+    void AppendValues(TArray<uint8>& Bin, std::initializer_list<T> Values)
+    {
+        for (const T& Value : Values)
+        {
+            Bin.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+        }
+    }
+
+    /** Accessors packed into one BIN chunk, each in its own buffer view, wrapped with the rest of the glTF JSON */
+    class FGlbBuilder
+    {
+    public:
+        /**
+         * Appends tightly packed values as a new buffer view and accessor
+         * @param Type glTF accessor type ("SCALAR", "VEC3", ...)
+         * @return Accessor index
+         */
+        template<typename T>
+        int32 AddAccessor(std::initializer_list<T> Values, int32 ComponentType, const TCHAR* Type, bool bNormalized = false)
+        {
+            const int32 Offset = Bin.Num();
+            AppendValues<T>(Bin, Values);
+            const int32 Length = Bin.Num() - Offset;
+            while (Bin.Num() % 4 != 0)
+            {
+                Bin.Add(0);
+            }
+
+            BufferViews.Add(FString::Printf(TEXT("{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d}"), Offset, Length));
+            Accessors.Add(FString::Printf(TEXT("{\"bufferView\":%d,\"componentType\":%d,\"count\":%d,\"type\":\"%s\"%s}"),
+                BufferViews.Num() - 1, ComponentType, int32(Values.size()) / GetNumComponents(Type), Type,
+                bNormalized ? TEXT(",\"normalized\":true") : TEXT("")));
+            return Accessors.Num() - 1;
+        }
+
+        /**
+         * GLB of the accessors added so far
+         * @param Members The other top-level members ("nodes":[...],"meshes":[...]), without the enclosing braces
+         */
+        TArray<uint8> Build(const FString& Members) const
+        {
+            const FString Json = FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},%s,\"buffers\":[{\"byteLength\":%d}],\"bufferViews\":[%s],\"accessors\":[%s]}"),
+                *Members, Bin.Num(), *FString::Join(BufferViews, TEXT(",")), *FString::Join(Accessors, TEXT(",")));
+            return MakeGlb(Json, Bin);
+        }
+
+    private:
+        static int32 GetNumComponents(const TCHAR* Type)
+        {
+            const FString TypeString(Type);
+            return TypeString == TEXT("VEC2") ? 2 : TypeString == TEXT("VEC3") ? 3 : TypeString == TEXT("VEC4") ? 4 : TypeString == TEXT("MAT4") ? 16 : 1;
+        }
+
+        TArray<uint8> Bin;
+        TArray<FString> BufferViews;
+        TArray<FString> Accessors;
+    };
+
+    /**
+     * Skinned quad on a two-bone chain: nodes Hips (0) > Spine (1) and the mesh node Body (2) with skin 0.
+     * Vertices 0-1 follow Hips, 2-3 follow Spine; the morph target "Raise" lifts vertices 2-3.
+     */
+    inline TArray<uint8> MakeSkinnedQuadGlb()
+    {
+        FGlbBuilder Builder;
+        const int32 Positions = Builder.AddAccessor<float>({ 0, 0, 0,  1, 0, 0,  1, 1, 0,  0, 1, 0 }, EVrmGltfComponentType::Float, TEXT("VEC3"));
+        const int32 Joints = Builder.AddAccessor<uint8>({ 0, 0, 0, 0,  0, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0 }, EVrmGltfComponentType::UnsignedByte, TEXT("VEC4"));
+        const int32 Weights = Builder.AddAccessor<float>({ 1, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0,  1, 0, 0, 0 }, EVrmGltfComponentType::Float, TEXT("VEC4"));
+        const int32 Indices = Builder.AddAccessor<uint16>({ 0, 1, 2,  0, 2, 3 }, EVrmGltfComponentType::UnsignedShort, TEXT("SCALAR"));
+        const int32 Raise = Builder.AddAccessor<float>({ 0, 0, 0,  0, 0, 0,  0, 0.5f, 0,  0, 0.5f, 0 }, EVrmGltfComponentType::Float, TEXT("VEC3"));
+
+        return Builder.Build(FString::Printf(TEXT(
+            "\"nodes\":[{\"name\":\"Hips\",\"children\":[1]},{\"name\":\"Spine\",\"translation\":[0,1,0]},{\"name\":\"Body\",\"mesh\":0,\"skin\":0}],"
+            "\"skins\":[{\"joints\":[0,1]}],"
+            "\"meshes\":[{\"name\":\"Body\",\"primitives\":[{\"attributes\":{\"POSITION\":%d,\"JOINTS_0\":%d,\"WEIGHTS_0\":%d},\"indices\":%d,"
+            "\"targets\":[{\"POSITION\":%d}]}],\"extras\":{\"targetNames\":[\"Raise\"]}}]"),
+            Positions, Joints, Weights, Indices, Raise));
+    }
+}
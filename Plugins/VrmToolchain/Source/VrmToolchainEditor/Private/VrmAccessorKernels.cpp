@@ -0,0 +1,360 @@
+#include "VrmAccessorKernels.h"
+#include "Math/VectorRegister.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#endif
+
+namespace VrmAccessorKernels
+{
+	/** Widens NumLanes consecutive uint8 values to uint32 */
+	static void WidenPackedU8(const uint8* Src, int64 NumLanes, uint32* Dst)
+	{
+		int64 Lane = 0;
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+		for (; Lane + 16 <= NumLanes; Lane += 16)
+		{
+			const uint8x16_t Bytes = vld1q_u8(Src + Lane);
+			const uint16x8_t Lo = vmovl_u8(vget_low_u8(Bytes));
+			const uint16x8_t Hi = vmovl_u8(vget_high_u8(Bytes));
+			vst1q_u32(Dst + Lane, vmovl_u16(vget_low_u16(Lo)));
+			vst1q_u32(Dst + Lane + 4, vmovl_u16(vget_high_u16(Lo)));
+			vst1q_u32(Dst + Lane + 8, vmovl_u16(vget_low_u16(Hi)));
+			vst1q_u32(Dst + Lane + 12, vmovl_u16(vget_high_u16(Hi)));
+		}
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+		const __m128i Zero = _mm_setzero_si128();
+		for (; Lane + 16 <= NumLanes; Lane += 16)
+		{
+			const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + Lane));
+			const __m128i Lo = _mm_unpacklo_epi8(Bytes, Zero);
+			const __m128i Hi = _mm_unpackhi_epi8(Bytes, Zero);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + Lane), _mm_unpacklo_epi16(Lo, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + Lane + 4), _mm_unpackhi_epi16(Lo, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + Lane + 8), _mm_unpacklo_epi16(Hi, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + Lane + 12), _mm_unpackhi_epi16(Hi, Zero));
+		}
+#endif
+		for (; Lane < NumLanes; ++Lane)
+		{
+			Dst[Lane] = Src[Lane];
+		}
+	}
+
+	/** Widens NumLanes consecutive uint16 values to uint32 */
+	static void WidenPackedU16(const uint8* Src, int64 NumLanes, uint32* Dst)
+	{
+		const uint16* Shorts = reinterpret_cast<const uint16*>(Src);
+		int64 Lane = 0;
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+		for (; Lane + 8 <= NumLanes; Lane += 8)
+		{
+			const uint16x8_t Values = vld1q_u16(Shorts + Lane);
+			vst1q_u32(Dst + Lane, vmovl_u16(vget_low_u16(Values)));
+			vst1q_u32(Dst + Lane + 4, vmovl_u16(vget_high_u16(Values)));
+		}
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+		const __m128i Zero = _mm_setzero_si128();
+		for (; Lane + 8 <= NumLanes; Lane += 8)
+		{
+			const __m128i Values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Shorts + Lane));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + Lane), _mm_unpacklo_epi16(Values, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + Lane + 4), _mm_unpackhi_epi16(Values, Zero));
+		}
+#endif
+		for (; Lane < NumLanes; ++Lane)
+		{
+			Dst[Lane] = Shorts[Lane];
+		}
+	}
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	/** Loads the first four integer lanes at Src as int32 (sign- or zero-extended per component type) */
+	static FORCEINLINE VectorRegister4Int LoadLanesAsInt(const uint8* Src, int32 ComponentType)
+	{
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+		switch (ComponentType)
+		{
+		case EVrmGltfComponentType::Byte:
+		{
+			uint32 Bits;
+			FMemory::Memcpy(&Bits, Src, sizeof(Bits));
+			return vmovl_s16(vget_low_s16(vmovl_s8(vreinterpret_s8_u32(vdup_n_u32(Bits)))));
+		}
+		case EVrmGltfComponentType::UnsignedByte:
+		{
+			uint32 Bits;
+			FMemory::Memcpy(&Bits, Src, sizeof(Bits));
+			return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(Bits))))));
+		}
+		case EVrmGltfComponentType::Short:
+			return vmovl_s16(vld1_s16(reinterpret_cast<const int16*>(Src)));
+		default:
+			return vreinterpretq_s32_u32(vmovl_u16(vld1_u16(reinterpret_cast<const uint16*>(Src))));
+		}
+#else
+		const __m128i Zero = _mm_setzero_si128();
+		switch (ComponentType)
+		{
+		case EVrmGltfComponentType::Byte:
+		{
+			int32 Bits;
+			FMemory::Memcpy(&Bits, Src, sizeof(Bits));
+			__m128i Lanes = _mm_cvtsi32_si128(Bits);
+			Lanes = _mm_unpacklo_epi8(Lanes, Lanes);
+			return _mm_srai_epi32(_mm_unpacklo_epi16(Lanes, Lanes), 24);
+		}
+		case EVrmGltfComponentType::UnsignedByte:
+		{
+			int32 Bits;
+			FMemory::Memcpy(&Bits, Src, sizeof(Bits));
+			return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(Bits), Zero), Zero);
+		}
+		case EVrmGltfComponentType::Short:
+		{
+			const __m128i Lanes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Src));
+			return _mm_srai_epi32(_mm_unpacklo_epi16(Lanes, Lanes), 16);
+		}
+		default:
+			return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Src)), Zero);
+		}
+#endif
+	}
+#endif
+
+	void CopyElements(const uint8* Src, int32 SrcStride, int32 ElementSize, int32 Count, void* Dst)
+	{
+		uint8* Out = static_cast<uint8*>(Dst);
+		if (SrcStride == ElementSize)
+		{
+			FMemory::Memcpy(Out, Src, static_cast<int64>(Count) * ElementSize);
+			return;
+		}
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			FMemory::Memcpy(Out + static_cast<int64>(Index) * ElementSize, Src + static_cast<int64>(Index) * SrcStride, ElementSize);
+		}
+	}
+
+	void DecodeFloat3SwapYZ(const uint8* Src, int32 SrcStride, int32 Count, FVector3f* Dst)
+	{
+		int32 Index = 0;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+		float* Out = reinterpret_cast<float*>(Dst);
+		const VectorRegister4Float SignA = MakeVectorRegisterFloat(1.0f, 1.0f, -1.0f, 1.0f);
+
+		if (SrcStride == sizeof(FVector3f))
+		{
+			// Four packed elements are three registers: (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+			const VectorRegister4Float SignB = MakeVectorRegisterFloat(1.0f, -1.0f, 1.0f, 1.0f);
+			const VectorRegister4Float SignC = MakeVectorRegisterFloat(-1.0f, 1.0f, 1.0f, -1.0f);
+			const float* In = reinterpret_cast<const float*>(Src);
+
+			for (; Index + 4 <= Count; Index += 4, In += 12, Out += 12)
+			{
+				const VectorRegister4Float A = VectorLoad(In);
+				const VectorRegister4Float B = VectorLoad(In + 4);
+				const VectorRegister4Float C = VectorLoad(In + 8);
+
+				// (x0 z0 -y0 x1)
+				const VectorRegister4Float OutA = VectorMultiply(VectorSwizzle(A, 0, 2, 1, 3), SignA);
+
+				// (z1 -y1 x2 z2)
+				const VectorRegister4Float B2B3C0C0 = VectorShuffle(B, C, 2, 3, 0, 0);
+				const VectorRegister4Float OutB = VectorMultiply(VectorShuffle(B, B2B3C0C0, 1, 0, 0, 2), SignB);
+
+				// (-y2 x3 z3 -y3)
+				const VectorRegister4Float B3B3C1C1 = VectorShuffle(B, C, 3, 3, 1, 1);
+				const VectorRegister4Float OutC = VectorMultiply(VectorShuffle(B3B3C1C1, C, 0, 2, 3, 2), SignC);
+
+				VectorStore(OutA, Out);
+				VectorStore(OutB, Out + 4);
+				VectorStore(OutC, Out + 8);
+			}
+		}
+		else
+		{
+			// One element per register. The 16-byte load and store spill into the next element,
+			// which exists for every element but the last (left to the scalar tail).
+			for (; Index + 1 < Count; ++Index)
+			{
+				const VectorRegister4Float V = VectorLoad(reinterpret_cast<const float*>(Src + static_cast<int64>(Index) * SrcStride));
+				VectorStore(VectorMultiply(VectorSwizzle(V, 0, 2, 1, 3), SignA), Out + static_cast<int64>(Index) * 3);
+			}
+		}
+#endif
+
+		for (; Index < Count; ++Index)
+		{
+			const float* In = reinterpret_cast<const float*>(Src + static_cast<int64>(Index) * SrcStride);
+			Dst[Index] = FVector3f(In[0], In[2], -In[1]);
+		}
+	}
+
+	void WidenU8ToU32(const uint8* Src, int32 SrcStride, int32 LanesPerElement, int32 Count, uint32* Dst)
+	{
+		if (SrcStride == LanesPerElement)
+		{
+			WidenPackedU8(Src, static_cast<int64>(Count) * LanesPerElement, Dst);
+			return;
+		}
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const uint8* In = Src + static_cast<int64>(Index) * SrcStride;
+			uint32* Out = Dst + static_cast<int64>(Index) * LanesPerElement;
+			for (int32 Lane = 0; Lane < LanesPerElement; ++Lane)
+			{
+				Out[Lane] = In[Lane];
+			}
+		}
+	}
+
+	void WidenU16ToU32(const uint8* Src, int32 SrcStride, int32 LanesPerElement, int32 Count, uint32* Dst)
+	{
+		if (SrcStride == LanesPerElement * static_cast<int32>(sizeof(uint16)))
+		{
+			WidenPackedU16(Src, static_cast<int64>(Count) * LanesPerElement, Dst);
+			return;
+		}
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const uint16* In = reinterpret_cast<const uint16*>(Src + static_cast<int64>(Index) * SrcStride);
+			uint32* Out = Dst + static_cast<int64>(Index) * LanesPerElement;
+			for (int32 Lane = 0; Lane < LanesPerElement; ++Lane)
+			{
+				Out[Lane] = In[Lane];
+			}
+		}
+	}
+
+	void DequantizeToFloat(const uint8* Src, int32 SrcStride, int32 ComponentType, bool bNormalized, int32 LanesPerElement, bool bSwapYZ, int32 Count, float* Dst)
+	{
+		const int32 ComponentSize = EVrmGltfComponentType::GetSize(ComponentType);
+		int32 Index = 0;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+		float Scale = 1.0f;
+		if (bNormalized)
+		{
+			switch (ComponentType)
+			{
+			case EVrmGltfComponentType::Byte: Scale = 1.0f / 127.0f; break;
+			case EVrmGltfComponentType::UnsignedByte: Scale = 1.0f / 255.0f; break;
+			case EVrmGltfComponentType::Short: Scale = 1.0f / 32767.0f; break;
+			default: Scale = 1.0f / 65535.0f; break;
+			}
+		}
+		const bool bClampToMinusOne = bNormalized && (ComponentType == EVrmGltfComponentType::Byte || ComponentType == EVrmGltfComponentType::Short);
+
+		const VectorRegister4Float ScaleVector = VectorSetFloat1(Scale);
+		const VectorRegister4Float MinusOne = VectorSetFloat1(-1.0f);
+		const VectorRegister4Float SwapSign = MakeVectorRegisterFloat(1.0f, 1.0f, -1.0f, 1.0f);
+
+		// One element per register: the four-lane load and store run past the element, which is
+		// harmless for every element but the last (left to the scalar tail)
+		for (; Index + 1 < Count; ++Index)
+		{
+			VectorRegister4Float Value = VectorMultiply(VectorIntToFloat(LoadLanesAsInt(Src + static_cast<int64>(Index) * SrcStride, ComponentType)), ScaleVector);
+			if (bClampToMinusOne)
+			{
+				Value = VectorMax(Value, MinusOne);
+			}
+			if (bSwapYZ)
+			{
+				Value = VectorMultiply(VectorSwizzle(Value, 0, 2, 1, 3), SwapSign);
+			}
+			VectorStore(Value, Dst + static_cast<int64>(Index) * LanesPerElement);
+		}
+#endif
+
+		for (; Index < Count; ++Index)
+		{
+			const uint8* In = Src + static_cast<int64>(Index) * SrcStride;
+			float* Out = Dst + static_cast<int64>(Index) * LanesPerElement;
+			for (int32 Lane = 0; Lane < LanesPerElement; ++Lane)
+			{
+				Out[Lane] = EVrmGltfComponentType::ReadAsFloat(In + Lane * ComponentSize, ComponentType, bNormalized);
+			}
+			if (bSwapYZ)
+			{
+				const float Y = Out[1];
+				Out[1] = Out[2];
+				Out[2] = -Y;
+			}
+		}
+	}
+
+	void ReduceInfluences(const FVector4f* const* SetWeights, const FIntVector4* const* SetJoints, int32 NumSets, int32 Count, int32 MaxInfluences, float* OutWeights, int32* OutJoints, uint8* OutCounts)
+	{
+		constexpr int32 MaxCandidates = FVrmGltfPrimitive::MaxInfluenceSets * 4;
+		check(NumSets >= 0 && NumSets <= FVrmGltfPrimitive::MaxInfluenceSets);
+		check(MaxInfluences > 0 && MaxInfluences <= MaxCandidates);
+
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		for (int32 Vertex = 0; Vertex < Count; ++Vertex)
+		{
+			// Gather the positive weights of every set: one compare per set, then only the surviving lanes
+			alignas(16) float Weights[MaxCandidates] = {};
+			int32 Joints[MaxCandidates];
+			int32 NumKept = 0;
+			VectorRegister4Float Sum = Zero;
+			for (int32 Set = 0; Set < NumSets; ++Set)
+			{
+				const VectorRegister4Float SetWeight = VectorMax(VectorLoad(&SetWeights[Set][Vertex].X), Zero);
+				uint32 Positive = static_cast<uint32>(VectorMaskBits(VectorCompareGT(SetWeight, Zero)));
+				if (Positive == 0)
+				{
+					continue;
+				}
+				Sum = VectorAdd(Sum, SetWeight);
+
+				alignas(16) float Lanes[4];
+				VectorStoreAligned(SetWeight, Lanes);
+				const FIntVector4& SetJoint = SetJoints[Set][Vertex];
+				while (Positive != 0)
+				{
+					const int32 Lane = static_cast<int32>(FMath::CountTrailingZeros(Positive));
+					Positive &= Positive - 1;
+					Weights[NumKept] = Lanes[Lane];
+					Joints[NumKept] = SetJoint[Lane];
+					++NumKept;
+				}
+			}
+
+			alignas(16) float SumLanes[4];
+			VectorStoreAligned(Sum, SumLanes);
+			float Total = (SumLanes[0] + SumLanes[1]) + (SumLanes[2] + SumLanes[3]);
+
+			// Top-K: drop the smallest until the rest fit (rare; only past MaxInfluences candidates)
+			while (NumKept > MaxInfluences)
+			{
+				int32 Smallest = 0;
+				for (int32 Candidate = 1; Candidate < NumKept; ++Candidate)
+				{
+					Smallest = Weights[Candidate] < Weights[Smallest] ? Candidate : Smallest;
+				}
+				Total -= Weights[Smallest];
+				--NumKept;
+				Weights[Smallest] = Weights[NumKept];
+				Joints[Smallest] = Joints[NumKept];
+			}
+
+			// Renormalize four weights at a time (lanes past NumKept are scratch)
+			const VectorRegister4Float Scale = VectorSetFloat1(Total > 0.0f ? 1.0f / Total : 0.0f);
+			for (int32 First = 0; First < NumKept; First += 4)
+			{
+				VectorStoreAligned(VectorMultiply(VectorLoadAligned(Weights + First), Scale), Weights + First);
+			}
+
+			FMemory::Memcpy(OutWeights + static_cast<int64>(Vertex) * MaxInfluences, Weights, NumKept * sizeof(float));
+			FMemory::Memcpy(OutJoints + static_cast<int64>(Vertex) * MaxInfluences, Joints, NumKept * sizeof(int32));
+			OutCounts[Vertex] = static_cast<uint8>(NumKept);
+		}
+	}
+}
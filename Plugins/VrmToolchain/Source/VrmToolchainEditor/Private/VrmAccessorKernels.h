@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VrmToolchain/VrmGltfModel.h"
+
+/**
+ * Bulk decode kernels for glTF accessor streams.
+ *
+ * Each kernel converts a whole strided run of elements in one call, using SSE2/NEON for the
+ * tightly packed layouts that avatars almost always use and a scalar loop otherwise. Callers
+ * validate bounds beforehand: Src must cover Count elements at SrcStride.
+ */
+namespace VrmAccessorKernels
+{
+	/** Copies Count elements of ElementSize bytes into a packed destination (one memcpy when the source is packed) */
+	void CopyElements(const uint8* Src, int32 SrcStride, int32 ElementSize, int32 Count, void* Dst);
+
+	/** FLOAT VEC3 from glTF (right-handed, Y up) to UE axes: (X, Z, -Y) */
+	void DecodeFloat3SwapYZ(const uint8* Src, int32 SrcStride, int32 Count, FVector3f* Dst);
+
+	/** UNSIGNED_BYTE lanes widened to uint32 (LanesPerElement lanes per element, e.g. 4 for JOINTS, 1 for indices) */
+	void WidenU8ToU32(const uint8* Src, int32 SrcStride, int32 LanesPerElement, int32 Count, uint32* Dst);
+
+	/** UNSIGNED_SHORT lanes widened to uint32 */
+	void WidenU16ToU32(const uint8* Src, int32 SrcStride, int32 LanesPerElement, int32 Count, uint32* Dst);
+
+	/**
+	 * BYTE/UNSIGNED_BYTE/SHORT/UNSIGNED_SHORT lanes converted to float in one pass: scaled to [0, 1] or [-1, 1]
+	 * when normalized (KHR_mesh_quantization, normalized weights and UVs), value-preserving otherwise.
+	 * LanesPerElement is 2 to 4; with bSwapYZ a 3-lane element is also converted to UE axes like DecodeFloat3SwapYZ.
+	 */
+	void DequantizeToFloat(const uint8* Src, int32 SrcStride, int32 ComponentType, bool bNormalized, int32 LanesPerElement, bool bSwapYZ, int32 Count, float* Dst);
+
+	/**
+	 * Reduces the skin influences of Count vertices to at most MaxInfluences each: non-positive weights are
+	 * dropped, the largest weights kept and the kept weights renormalized to sum to 1. Set S of vertex V is
+	 * SetWeights[S][V] / SetJoints[S][V] (JOINTS_S/WEIGHTS_S, up to FVrmGltfPrimitive::MaxInfluenceSets sets).
+	 * Every vertex owns MaxInfluences slots of OutWeights/OutJoints; OutCounts receives how many it uses.
+	 */
+	void ReduceInfluences(const FVector4f* const* SetWeights, const FIntVector4* const* SetJoints, int32 NumSets, int32 Count, int32 MaxInfluences, float* OutWeights, int32* OutJoints, uint8* OutCounts);
+}
@@ -3,6 +3,7 @@
 #include "VrmToolchain/VrmSourceAsset.h"
 #include "VrmToolchain/VrmMetadataAsset.h"
 #include "VrmToolchain/VrmMetadata.h"
+#include "VrmToolchain/VrmGlbDocument.h"
 #include "VrmToolchainEditor.h"
 #include "VrmSdkFacadeEditor.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -14,8 +15,16 @@
 #include "VrmGltfParser.h"
 #include "VrmGlbAccessorReader.h"
 #include "VrmSkeletalMeshBuilder.h"
+#include "VrmImportSettings.h"
 #include "Misc/MessageDialog.h"
 #include "Misc/Paths.h"
+#include "Misc/App.h"
+#include "MeshUtilities.h"
+#include "Tasks/Task.h"
+#include "Containers/Ticker.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include <atomic>
 
 #if WITH_EDITOR
 // Editor-only APIs are needed for applying skeletons in a follow-up PR; keep includes minimal here
@@ -82,286 +91,639 @@ bool FVrmConversionService::DeriveGeneratedPaths(UVrmSourceAsset* Source, FStrin
 // include resolution issues during packaging CI. The parser/types remain and are still
 // useful for B2 implementation (application of bones will be added in a follow-up PR).
 
-bool FVrmConversionService::ConvertSourceToPlaceholderSkeletalMesh(UVrmSourceAsset* Source, const FVrmConvertOptions& Options, USkeletalMesh*& OutSkeletalMesh, USkeleton*& OutSkeleton, FString& OutError)
+TSharedPtr<const FVrmGlbDocument> FVrmConversionService::LoadSourceDocument(UVrmSourceAsset* Source, FString& OutError)
 {
-	OutSkeletalMesh = nullptr;
-	OutSkeleton = nullptr;
 	OutError.Reset();
 
 	if (!Source)
 	{
 		OutError = TEXT("Source is null");
-		return false;
+		return nullptr;
 	}
 
-	FString FolderPath;
-	FString BaseName;
-	if (!DeriveGeneratedPaths(Source, FolderPath, BaseName, OutError))
+#if WITH_EDITORONLY_DATA
+	// Prefer the bytes already held by the source asset: no disk read at all
+	const TArray<uint8>& SourceBytes = Source->GetSourceBytes();
+	if (SourceBytes.Num() > 0)
 	{
-		return false;
+		return FVrmGlbDocument::LoadFromView(SourceBytes, OutError, Source->SourceFilename);
 	}
+#endif
 
-	// Asset names
-	FString SkeletonName = BaseName + TEXT("_Skeleton");
-	FString MeshName = BaseName + TEXT("_SK");
+	FString SourcePath = Source->SourceFilename;
+	if (SourcePath.IsEmpty() && Source->AssetImportData)
+	{
+		SourcePath = Source->AssetImportData->GetFirstFilename();
+	}
+
+	if (SourcePath.IsEmpty())
+	{
+		OutError = TEXT("no source path resolved");
+		return nullptr;
+	}
 
-	// Full package names
-	FString SkeletonPackageName = FolderPath + TEXT("/") + SkeletonName;
-	FString MeshPackageName = FolderPath + TEXT("/") + MeshName;
+	return FVrmGlbDocument::LoadFromFile(SourcePath, OutError);
+}
 
-	// Check existing
+bool FVrmConversionService::ConvertSourceToPlaceholderSkeletalMesh(UVrmSourceAsset* Source, const FVrmConvertOptions& Options, USkeletalMesh*& OutSkeletalMesh, USkeleton*& OutSkeleton, FString& OutError)
+{
+	// Only resolve the source document when a stage actually consumes it
+	TSharedPtr<const FVrmGlbDocument> Document;
+	if (Source && Options.bApplyGltfSkeleton)
 	{
-		FAssetRegistryModule& ARM = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-		if (!Options.bOverwriteExisting)
+		FString DocumentError;
+		Document = LoadSourceDocument(Source, DocumentError);
+		if (!Document.IsValid())
 		{
-			if (ARM.Get().GetAssetByObjectPath(FSoftObjectPath(SkeletonPackageName + TEXT(".") + SkeletonName)).IsValid() ||
-				ARM.Get().GetAssetByObjectPath(FSoftObjectPath(MeshPackageName + TEXT(".") + MeshName)).IsValid())
-			{
-				OutError = TEXT("Target assets already exist");
-				return false;
-			}
+			UE_LOG(LogVrmToolchainEditor, Warning, TEXT("VrmConversionService: source document not loaded for '%s': %s"), *Source->GetName(), *DocumentError);
 		}
 	}
 
-	// Ensure folder exists via AssetTools
-	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
-	AssetToolsModule.Get().CreateUniqueAssetName(SkeletonPackageName, TEXT(""), SkeletonPackageName, SkeletonName);
-	AssetToolsModule.Get().CreateUniqueAssetName(MeshPackageName, TEXT(""), MeshPackageName, MeshName);
-
-	// Convert package names to package objects
-	UPackage* SkeletonPackage = CreatePackage(*SkeletonPackageName);
-	UPackage* MeshPackage = CreatePackage(*MeshPackageName);
+	return ConvertSourceToPlaceholderSkeletalMesh(Source, Options, Document, OutSkeletalMesh, OutSkeleton, OutError);
+}
 
-	if (!SkeletonPackage || !MeshPackage)
+namespace
+{
+	/** Stages of a conversion, in order; the async pipeline reports them as progress */
+	enum class EConversionStage : int32
 	{
-		OutError = TEXT("Failed to create packages");
-		return false;
+		LoadingDocument,
+		ParsingSkeleton,
+		DecodingAccessors,
+		BuildingMesh,
+		CreatingAssets,
+	};
+
+	FText GetStageText(EConversionStage Stage)
+	{
+		switch (Stage)
+		{
+		case EConversionStage::LoadingDocument:   return NSLOCTEXT("VrmConversionService", "StageLoading", "Loading source document");
+		case EConversionStage::ParsingSkeleton:   return NSLOCTEXT("VrmConversionService", "StageSkeleton", "Parsing skeleton");
+		case EConversionStage::DecodingAccessors: return NSLOCTEXT("VrmConversionService", "StageDecoding", "Decoding accessors");
+		case EConversionStage::BuildingMesh:      return NSLOCTEXT("VrmConversionService", "StageBuilding", "Building mesh");
+		default:                                  return NSLOCTEXT("VrmConversionService", "StageAssets", "Creating assets");
+		}
 	}
 
-	// Create skeleton and skeletal mesh
-	USkeleton* NewSkeleton = NewObject<USkeleton>(SkeletonPackage, *SkeletonName, RF_Public | RF_Standalone);
-	USkeletalMesh* NewMesh = NewObject<USkeletalMesh>(MeshPackage, *MeshName, RF_Public | RF_Standalone);
+	/** Everything a conversion computes from the document before any UObject exists */
+	struct FPreparedConversion
+	{
+		FVrmGltfSkeleton GltfSkel;
+		bool bHasGltfSkeleton = false;
+
+		/** Decoded accessors; the prepared mesh and its morph targets are read from them */
+		TUniquePtr<FVrmGlbAccessorReader> AccessorReader;
+		FVrmSkeletalMeshBuilder::FPreparedMesh Mesh;
+		bool bHasMesh = false;
 
-	if (!NewSkeleton || !NewMesh)
+		/** Import warnings of the skeleton (B1.1) and mesh (B2) stages, in order */
+		TArray<FString> SkeletonWarnings;
+		TArray<FString> MeshWarnings;
+	};
+
+	/** Add the parsed glTF bones, in order, through a reference skeleton modifier */
+	void AddGltfBones(FReferenceSkeletonModifier& RefSkelModifier, const FVrmGltfSkeleton& GltfSkel)
 	{
-		OutError = TEXT("Failed to create skeleton or mesh objects");
-		return false;
+		for (int32 Index = 0; Index < GltfSkel.Bones.Num(); ++Index)
+		{
+			const FVrmGltfBone& Bone = GltfSkel.Bones[Index];
+			FName BoneName = Bone.Name;
+
+			// FMeshBoneInfo: (Name, ExportName, ParentIndex)
+			FMeshBoneInfo BoneInfo(BoneName, BoneName.ToString(), Bone.ParentIndex);
+			RefSkelModifier.Add(BoneInfo, Bone.LocalTransform);
+		}
 	}
 
-	// Register assets with AssetRegistry
-	FAssetRegistryModule::AssetCreated(NewSkeleton);
-	FAssetRegistryModule::AssetCreated(NewMesh);
+	bool CheckTargetsAvailable(const FString& FolderPath, const FString& BaseName, const FVrmConvertOptions& Options, FString& OutError)
+	{
+		if (Options.bOverwriteExisting)
+		{
+			return true;
+		}
 
-	// Mark packages dirty
-	NewSkeleton->MarkPackageDirty();
-	NewMesh->MarkPackageDirty();
+		const FString SkeletonName = BaseName + TEXT("_Skeleton");
+		const FString MeshName = BaseName + TEXT("_SK");
+		FAssetRegistryModule& ARM = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+		if (ARM.Get().GetAssetByObjectPath(FSoftObjectPath(FolderPath / SkeletonName + TEXT(".") + SkeletonName)).IsValid() ||
+			ARM.Get().GetAssetByObjectPath(FSoftObjectPath(FolderPath / MeshName + TEXT(".") + MeshName)).IsValid())
+		{
+			OutError = TEXT("Target assets already exist");
+			return false;
+		}
+		return true;
+	}
 
-	// Attach metadata (canonical path: mesh-owned UAssetUserData via facade)
+	/** Import settings a conversion reads, captured on the game thread */
+	struct FConversionSettings
 	{
-		FVrmMetadata Parsed;
+		FVrmSkeletalMeshBuilder::EBuildPath BuildPath = FVrmSkeletalMeshBuilder::EBuildPath::ImportData;
+		bool bUseDerivedDataCache = false;
+		bool bWeldAndOptimize = false;
+	};
 
-		if (UVrmMetadataAsset* Desc = Source->Descriptor)
+	FConversionSettings GetConversionSettings()
+	{
+		const UVrmImportSettings* ImportSettings = GetDefault<UVrmImportSettings>();
+
+		FConversionSettings Settings;
+		Settings.BuildPath = ImportSettings->bBuildFromMeshDescription
+			? FVrmSkeletalMeshBuilder::EBuildPath::MeshDescription
+			: FVrmSkeletalMeshBuilder::EBuildPath::ImportData;
+		Settings.bUseDerivedDataCache = ImportSettings->bUseDerivedDataCache;
+		Settings.bWeldAndOptimize = ImportSettings->bWeldAndOptimizeMeshes;
+		return Settings;
+	}
+
+	/** Derived data cache identity of a mesh: the document content and the options that shape the mesh */
+	FString MakeDerivedDataKey(const FVrmGlbDocument& Document, const FVrmConvertOptions& Options)
+	{
+		// bOverwriteExisting only decides where the assets go, not what is built
+		return FString::Printf(TEXT("%s_Skeleton%d"), *LexToString(Document.ComputeContentHash()), Options.bApplyGltfSkeleton ? 1 : 0);
+	}
+
+	/**
+	 * Parse the skeleton, decode the accessors and prepare LOD0. Touches no UObject, so it runs on a worker
+	 * for async conversions. EnterStage is called before each stage and stops the preparation when it returns false.
+	 */
+	void PrepareConversion(
+		const TSharedPtr<const FVrmGlbDocument>& Document,
+		const FVrmConvertOptions& Options,
+		const FConversionSettings& Settings,
+		const FString& MeshName,
+		FPreparedConversion& Out,
+		TFunctionRef<bool(EConversionStage)> EnterStage)
+	{
+		if (!Options.bApplyGltfSkeleton)
 		{
-			Parsed.Version = Desc->SpecVersion;
-			Parsed.Name = Desc->Metadata.Title;
-			Parsed.ModelVersion = Desc->Metadata.Version;
+			return;
+		}
 
-			if (!Desc->Metadata.Author.IsEmpty())
-			{
-				Parsed.Authors = { Desc->Metadata.Author };
-			}
+		if (!Document.IsValid())
+		{
+			Out.SkeletonWarnings.Add(TEXT("B1.1: Skeleton not applied (no source document resolved)."));
+			Out.MeshWarnings.Add(TEXT("B2: Mesh not built (no source document resolved)."));
+			return;
+		}
 
-			Parsed.License = Desc->Metadata.LicenseName;
+		// B1.1: Parse the glTF skeleton (applied to the assets on the game thread)
+		if (!EnterStage(EConversionStage::ParsingSkeleton))
+		{
+			return;
 		}
 
-		FVrmSdkFacadeEditor::UpsertVrmMetadata(NewMesh, Parsed);
-	}
+		FString ParseError;
+		if (!FVrmGltfParser::ExtractSkeletonFromGlbDocument(*Document, Out.GltfSkel, ParseError))
+		{
+			Out.SkeletonWarnings.Add(FString::Printf(TEXT("B1.1: Skeleton not applied (parse failed): %s"), *ParseError));
+		}
+		else if (Out.GltfSkel.Bones.Num() == 0)
+		{
+			Out.SkeletonWarnings.Add(TEXT("B1.1: Skeleton not applied (zero bones)."));
+		}
+		else
+		{
+			Out.bHasGltfSkeleton = true;
+		}
+
+		// B2: Decode accessors from the shared document (no re-read, no re-parse)
+		if (!EnterStage(EConversionStage::DecodingAccessors))
+		{
+			return;
+		}
 
-	// Add provenance note: (UPackage does not expose SetMetaData; skip explicit package metadata write)
-	// Consider attaching a dedicated UAssetUserData if persistent provenance is required later.
+		Out.AccessorReader = MakeUnique<FVrmGlbAccessorReader>();
+		FVrmGlbAccessorReader& AccessorReader = *Out.AccessorReader;
 
-	// B1.1: Apply glTF skeleton by default when possible (fail-soft with warnings)
-	if (Options.bApplyGltfSkeleton)
+		FVrmGlbAccessorReader::FDecodeResult LoadResult = AccessorReader.LoadGlbDocument(Document.ToSharedRef());
+		if (!LoadResult.bSuccess)
+		{
+			Out.MeshWarnings.Add(FString::Printf(TEXT("B2: Mesh not built (GLB load failed): %s"), *LoadResult.ErrorMessage));
+			return;
+		}
+
+		FVrmGlbAccessorReader::FDecodeResult DecodeResult = AccessorReader.DecodeAccessors();
+		if (!DecodeResult.bSuccess)
+		{
+			Out.MeshWarnings.Add(FString::Printf(TEXT("B2: Mesh not built (accessor decode failed): %s"), *DecodeResult.ErrorMessage));
+			return;
+		}
+
+		// Bind every mesh to the skeleton: the joint table of its node's skin, or its node's bone when rigid
+		FVrmGltfMeshBinding MeshBinding;
+		if (!Out.bHasGltfSkeleton)
+		{
+			Out.MeshWarnings.Add(TEXT("B2: Mesh not built (no joint mapping available)."));
+			return;
+		}
+
+		FString BindingError;
+		if (!FVrmGltfParser::ExtractMeshBinding(Document->GetModel(), Out.GltfSkel, MeshBinding, BindingError))
+		{
+			Out.MeshWarnings.Add(FString::Printf(TEXT("B2: Mesh not built (%s)."), *BindingError));
+			return;
+		}
+
+		if (!EnterStage(EConversionStage::BuildingMesh))
+		{
+			return;
+		}
+
+		// The same bones ApplyGltfSkeletonToAssets gives the skeleton asset later
+		FReferenceSkeleton RefSkeleton;
+		{
+			FReferenceSkeletonModifier RefSkelModifier(RefSkeleton, nullptr);
+			AddGltfBones(RefSkelModifier, Out.GltfSkel);
+		}
+
+		const FString DerivedDataKey = Settings.bUseDerivedDataCache ? MakeDerivedDataKey(*Document, Options) : FString();
+
+		FString BuildError;
+		if (!FVrmSkeletalMeshBuilder::PrepareLod0(AccessorReader, RefSkeleton, MeshBinding, MeshName, Settings.BuildPath, Settings.bWeldAndOptimize, DerivedDataKey, Out.Mesh, BuildError))
+		{
+			Out.MeshWarnings.Add(FString::Printf(TEXT("B2: Mesh build failed: %s"), *BuildError));
+			return;
+		}
+
+		Out.bHasMesh = true;
+	}
+
+	/** Create, register and fill the generated assets from a prepared conversion; game thread only */
+	bool FinishConversion(
+		UVrmSourceAsset* Source,
+		const FVrmConvertOptions& Options,
+		const FString& FolderPath,
+		const FString& BaseName,
+		FPreparedConversion& Prepared,
+		USkeletalMesh*& OutSkeletalMesh,
+		USkeleton*& OutSkeleton,
+		FString& OutError)
 	{
-		auto ResolveSourcePath = [](UVrmSourceAsset* InSource, FString& OutPath) -> bool
+		check(IsInGameThread());
+
+		// Asset names
+		FString SkeletonName = BaseName + TEXT("_Skeleton");
+		FString MeshName = BaseName + TEXT("_SK");
+
+		// Full package names
+		FString SkeletonPackageName = FolderPath + TEXT("/") + SkeletonName;
+		FString MeshPackageName = FolderPath + TEXT("/") + MeshName;
+
+		// Check existing (again for async conversions: assets may have appeared meanwhile)
+		if (!CheckTargetsAvailable(FolderPath, BaseName, Options, OutError))
 		{
-			OutPath.Reset();
-			if (!InSource)
-			{
-				return false;
-			}
+			return false;
+		}
 
-			if (!InSource->SourceFilename.IsEmpty())
-			{
-				OutPath = InSource->SourceFilename;
-				return true;
-			}
+		// Ensure folder exists via AssetTools
+		FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+		AssetToolsModule.Get().CreateUniqueAssetName(SkeletonPackageName, TEXT(""), SkeletonPackageName, SkeletonName);
+		AssetToolsModule.Get().CreateUniqueAssetName(MeshPackageName, TEXT(""), MeshPackageName, MeshName);
 
-			if (InSource->AssetImportData)
-			{
-				const FString First = InSource->AssetImportData->GetFirstFilename();
-				if (!First.IsEmpty())
-				{
-					OutPath = First;
-					return true;
-				}
-			}
+		// Convert package names to package objects
+		UPackage* SkeletonPackage = CreatePackage(*SkeletonPackageName);
+		UPackage* MeshPackage = CreatePackage(*MeshPackageName);
 
+		if (!SkeletonPackage || !MeshPackage)
+		{
+			OutError = TEXT("Failed to create packages");
 			return false;
-		};
+		}
 
-		FString SourcePath;
-		if (!ResolveSourcePath(Source, SourcePath))
+		// Create skeleton and skeletal mesh
+		USkeleton* NewSkeleton = NewObject<USkeleton>(SkeletonPackage, *SkeletonName, RF_Public | RF_Standalone);
+		USkeletalMesh* NewMesh = NewObject<USkeletalMesh>(MeshPackage, *MeshName, RF_Public | RF_Standalone);
+
+		if (!NewSkeleton || !NewMesh)
 		{
-			Source->ImportWarnings.Add(TEXT("B1.1: Skeleton not applied (no source path resolved)."));
+			OutError = TEXT("Failed to create skeleton or mesh objects");
+			return false;
 		}
-		else
+
+		// Register assets with AssetRegistry
+		FAssetRegistryModule::AssetCreated(NewSkeleton);
+		FAssetRegistryModule::AssetCreated(NewMesh);
+
+		// Mark packages dirty
+		NewSkeleton->MarkPackageDirty();
+		NewMesh->MarkPackageDirty();
+
+		// Attach metadata (canonical path: mesh-owned UAssetUserData via facade)
 		{
-			FVrmGltfSkeleton GltfSkel;
-			FString ParseError;
+			FVrmMetadata Parsed;
 
-			if (!FVrmGltfParser::ExtractSkeletonFromGlbFile(SourcePath, GltfSkel, ParseError))
-			{
-				Source->ImportWarnings.Add(FString::Printf(TEXT("B1.1: Skeleton not applied (parse failed): %s"), *ParseError));
-			}
-			else if (GltfSkel.Bones.Num() == 0)
+			if (UVrmMetadataAsset* Desc = Source->Descriptor)
 			{
-				Source->ImportWarnings.Add(TEXT("B1.1: Skeleton not applied (zero bones)."));
+				Parsed.Version = Desc->SpecVersion;
+				Parsed.Name = Desc->Metadata.Title;
+				Parsed.ModelVersion = Desc->Metadata.Version;
+
+				if (!Desc->Metadata.Author.IsEmpty())
+				{
+					Parsed.Authors = { Desc->Metadata.Author };
+				}
+
+				Parsed.License = Desc->Metadata.LicenseName;
 			}
-			else
+
+			FVrmSdkFacadeEditor::UpsertVrmMetadata(NewMesh, Parsed);
+		}
+
+		// Add provenance note: (UPackage does not expose SetMetaData; skip explicit package metadata write)
+		// Consider attaching a dedicated UAssetUserData if persistent provenance is required later.
+
+		// B1.1: Apply glTF skeleton by default when possible (fail-soft with warnings)
+		if (Options.bApplyGltfSkeleton)
+		{
+			Source->ImportWarnings.Append(Prepared.SkeletonWarnings);
+
+			if (Prepared.bHasGltfSkeleton)
 			{
 				FString ApplyError;
-				if (!FVrmConversionService::ApplyGltfSkeletonToAssets(GltfSkel, NewSkeleton, NewMesh, ApplyError))
+				if (!FVrmConversionService::ApplyGltfSkeletonToAssets(Prepared.GltfSkel, NewSkeleton, NewMesh, ApplyError))
 				{
 					Source->ImportWarnings.Add(FString::Printf(TEXT("B1.1: Skeleton not applied (apply failed): %s"), *ApplyError));
+
+					// The mesh was skinned to bones the skeleton asset does not have
+					if (Prepared.bHasMesh)
+					{
+						Prepared.bHasMesh = false;
+						Prepared.MeshWarnings.Add(TEXT("B2: Mesh not built (no joint mapping available)."));
+					}
 				}
 			}
+
+			Source->MarkPackageDirty();
 		}
 
-		Source->MarkPackageDirty();
+		// B2: Build actual skinned mesh geometry from the prepared LOD0
+		if (Options.bApplyGltfSkeleton)
+		{
+			if (Prepared.bHasMesh)
+			{
+				FVrmSkeletalMeshBuilder::FBuildResult BuildResult = FVrmSkeletalMeshBuilder::FinalizeLod0(
+					MoveTemp(Prepared.Mesh), *Prepared.AccessorReader, NewSkeleton, MeshPackageName, MeshName);
+
+				if (!BuildResult.bSuccess)
+				{
+					Prepared.MeshWarnings.Add(FString::Printf(TEXT("B2: Mesh build failed: %s"), *BuildResult.ErrorMessage));
+				}
+				else
+				{
+					// Replace the placeholder mesh with the built mesh
+					NewMesh = BuildResult.BuiltMesh;
+				}
+			}
+
+			Source->ImportWarnings.Append(Prepared.MeshWarnings);
+		}
+
+		OutSkeletalMesh = NewMesh;
+		OutSkeleton = NewSkeleton;
+
+		return true;
 	}
 
-	// B2: Build actual skinned mesh geometry using MeshUtilities
-	if (Options.bApplyGltfSkeleton)
+	/**
+	 * State shared by the stages of an async conversion. The worker only touches the prepared data and the
+	 * atomics; the source asset and the notification stay on the game thread.
+	 */
+	struct FAsyncConversion
+	{
+		TWeakObjectPtr<UVrmSourceAsset> Source;
+		FString SourceName;
+		FVrmConvertOptions Options;
+		FString FolderPath;
+		FString BaseName;
+		FConversionSettings Settings;
+
+		/** The document, or what LoadSourceDocument would parse when none was given */
+		TSharedPtr<const FVrmGlbDocument> Document;
+		TArray<uint8> SourceBytes;
+		FString SourcePath;
+
+		FPreparedConversion Prepared;
+		FVrmConversionService::FOnConversionComplete OnComplete;
+
+		std::atomic<int32> Stage{ static_cast<int32>(EConversionStage::LoadingDocument) };
+		TSharedRef<FVrmConversionService::FAsyncConversionControl> Control = MakeShared<FVrmConversionService::FAsyncConversionControl>();
+	};
+
+	/** Worker part of an async conversion: document load and PrepareConversion */
+	void RunConversionWorker(FAsyncConversion& State)
 	{
-		auto ResolveSourcePath = [](UVrmSourceAsset* InSource, FString& OutPath) -> bool
+		auto EnterStage = [&State](EConversionStage Stage)
 		{
-			OutPath.Reset();
-			if (!InSource)
+			State.Stage = static_cast<int32>(Stage);
+			return !State.Control->IsCancelled();
+		};
+
+		if (!EnterStage(EConversionStage::LoadingDocument))
+		{
+			return;
+		}
+
+		if (!State.Document.IsValid() && State.Options.bApplyGltfSkeleton)
+		{
+			FString DocumentError;
+			if (State.SourceBytes.Num() > 0)
 			{
-				return false;
+				State.Document = FVrmGlbDocument::LoadFromBytes(MoveTemp(State.SourceBytes), DocumentError, State.SourcePath);
 			}
-
-			if (!InSource->SourceFilename.IsEmpty())
+			else if (!State.SourcePath.IsEmpty())
+			{
+				State.Document = FVrmGlbDocument::LoadFromFile(State.SourcePath, DocumentError);
+			}
+			else
 			{
-				OutPath = InSource->SourceFilename;
-				return true;
+				DocumentError = TEXT("no source path resolved");
 			}
 
-			if (InSource->AssetImportData)
+			if (!State.Document.IsValid())
 			{
-				const FString First = InSource->AssetImportData->GetFirstFilename();
-				if (!First.IsEmpty())
-				{
-					OutPath = First;
-					return true;
-				}
+				UE_LOG(LogVrmToolchainEditor, Warning, TEXT("VrmConversionService: source document not loaded for '%s': %s"), *State.SourceName, *DocumentError);
 			}
+		}
 
-			return false;
-		};
+		const FString MeshName = State.FolderPath / State.BaseName + TEXT("_SK");
+		PrepareConversion(State.Document, State.Options, State.Settings, MeshName, State.Prepared, EnterStage);
+	}
 
-		FString SourcePath;
-		if (!ResolveSourcePath(Source, SourcePath))
+	/** Game-thread part of an async conversion, once the worker is done */
+	void FinishAsyncConversion(FAsyncConversion& State, const TSharedPtr<SNotificationItem>& Notification)
+	{
+		USkeletalMesh* Mesh = nullptr;
+		USkeleton* Skeleton = nullptr;
+		FString Error;
+		bool bSuccess = false;
+
+		UVrmSourceAsset* Source = State.Source.Get();
+		if (State.Control->IsCancelled())
 		{
-			Source->ImportWarnings.Add(TEXT("B2: Mesh not built (no source path resolved)."));
+			Error = TEXT("Conversion cancelled");
+		}
+		else if (!Source)
+		{
+			Error = TEXT("Source asset no longer exists");
 		}
 		else
 		{
-			// Load and decode GLB data
-			FVrmGlbAccessorReader AccessorReader;
-			FString JsonString;
-			
-			FVrmGlbAccessorReader::FDecodeResult LoadResult = AccessorReader.LoadGlbFile(SourcePath, JsonString);
-			if (!LoadResult.bSuccess)
-			{
-				Source->ImportWarnings.Add(FString::Printf(TEXT("B2: Mesh not built (GLB load failed): %s"), *LoadResult.ErrorMessage));
-			}
-			else
+			State.Stage = static_cast<int32>(EConversionStage::CreatingAssets);
+			bSuccess = FinishConversion(Source, State.Options, State.FolderPath, State.BaseName, State.Prepared, Mesh, Skeleton, Error);
+		}
+
+		if (Notification.IsValid())
+		{
+			Notification->SetText(bSuccess
+				? FText::Format(NSLOCTEXT("VrmConversionService", "ConvertDone", "Converted {0}"), FText::FromString(State.SourceName))
+				: FText::Format(NSLOCTEXT("VrmConversionService", "ConvertFailed", "Conversion of {0} stopped: {1}"), FText::FromString(State.SourceName), FText::FromString(Error)));
+			Notification->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+			Notification->ExpireAndFadeout();
+		}
+
+		if (State.OnComplete)
+		{
+			State.OnComplete(bSuccess, Mesh, Skeleton, Error);
+		}
+	}
+}
+
+bool FVrmConversionService::ConvertSourceToPlaceholderSkeletalMesh(UVrmSourceAsset* Source, const FVrmConvertOptions& Options, const TSharedPtr<const FVrmGlbDocument>& Document, USkeletalMesh*& OutSkeletalMesh, USkeleton*& OutSkeleton, FString& OutError)
+{
+	OutSkeletalMesh = nullptr;
+	OutSkeleton = nullptr;
+	OutError.Reset();
+
+	if (!Source)
+	{
+		OutError = TEXT("Source is null");
+		return false;
+	}
+
+	FString FolderPath;
+	FString BaseName;
+	if (!DeriveGeneratedPaths(Source, FolderPath, BaseName, OutError))
+	{
+		return false;
+	}
+
+	if (!CheckTargetsAvailable(FolderPath, BaseName, Options, OutError))
+	{
+		return false;
+	}
+
+	// Same stages as the async pipeline, run inline
+	FPreparedConversion Prepared;
+	PrepareConversion(Document, Options, GetConversionSettings(), FolderPath / BaseName + TEXT("_SK"), Prepared, [](EConversionStage) { return true; });
+
+	return FinishConversion(Source, Options, FolderPath, BaseName, Prepared, OutSkeletalMesh, OutSkeleton, OutError);
+}
+
+bool FVrmConversionService::ConvertSourceToSkeletalMeshAsync(
+	UVrmSourceAsset* Source,
+	const FVrmConvertOptions& Options,
+	const TSharedPtr<const FVrmGlbDocument>& Document,
+	FOnConversionComplete OnComplete,
+	FString& OutError,
+	TSharedPtr<FAsyncConversionControl>* OutControl)
+{
+	check(IsInGameThread());
+	OutError.Reset();
+
+	if (!Source)
+	{
+		OutError = TEXT("Source is null");
+		return false;
+	}
+
+	TSharedRef<FAsyncConversion> State = MakeShared<FAsyncConversion>();
+	if (!DeriveGeneratedPaths(Source, State->FolderPath, State->BaseName, OutError))
+	{
+		return false;
+	}
+
+	// Fail early; FinishConversion checks again once the assets are about to be created
+	if (!CheckTargetsAvailable(State->FolderPath, State->BaseName, Options, OutError))
+	{
+		return false;
+	}
+
+	State->Source = Source;
+	State->SourceName = Source->GetName();
+	State->Options = Options;
+	State->Settings = GetConversionSettings();
+	State->OnComplete = MoveTemp(OnComplete);
+
+	// A document borrowing the source's bytes dies with them (reimport, delete, GC) while the worker may still
+	// read it: copy what LoadSourceDocument would read instead, so the worker never touches the source asset
+	if (Document.IsValid() && !Document->BorrowsBytes())
+	{
+		State->Document = Document;
+	}
+	else if (Options.bApplyGltfSkeleton)
+	{
+#if WITH_EDITORONLY_DATA
+		State->SourceBytes = Source->GetSourceBytes();
+#endif
+		State->SourcePath = Source->SourceFilename;
+		if (State->SourceBytes.Num() == 0 && State->SourcePath.IsEmpty() && Source->AssetImportData)
+		{
+			State->SourcePath = Source->AssetImportData->GetFirstFilename();
+		}
+	}
+
+	// Modules load on the game thread only; the worker's mesh build needs this one
+	FModuleManager::Get().LoadModuleChecked<IMeshUtilities>("MeshUtilities");
+
+	// Progress notification with a Cancel button (interactive sessions only)
+	TSharedPtr<SNotificationItem> Notification;
+	if (!IsRunningCommandlet() && !GIsAutomationTesting && !FApp::IsUnattended())
+	{
+		FNotificationInfo Info(FText::Format(NSLOCTEXT("VrmConversionService", "Converting", "Converting {0}: {1}"),
+			FText::FromString(State->SourceName), GetStageText(EConversionStage::LoadingDocument)));
+		Info.bFireAndForget = false;
+		Info.bUseThrobber = true;
+		Info.ExpireDuration = 5.0f;
+		Info.ButtonDetails.Add(FNotificationButtonInfo(
+			NSLOCTEXT("VrmConversionService", "Cancel", "Cancel"),
+			NSLOCTEXT("VrmConversionService", "CancelTooltip", "Stop the conversion; no assets are created"),
+			FSimpleDelegate::CreateLambda([State]() { State->Control->Cancel(); }),
+			SNotificationItem::CS_Pending));
+
+		Notification = FSlateNotificationManager::Get().AddNotification(Info);
+		if (Notification.IsValid())
+		{
+			Notification->SetCompletionState(SNotificationItem::CS_Pending);
+		}
+	}
+
+	if (OutControl)
+	{
+		*OutControl = State->Control;
+	}
+
+	const UE::Tasks::FTask Worker = UE::Tasks::Launch(UE_SOURCE_LOCATION, [State]() { RunConversionWorker(*State); });
+
+	// Poll from the game thread: progress text while the worker runs, then the asset stage
+	int32 ShownStage = static_cast<int32>(EConversionStage::LoadingDocument);
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([State, Worker, Notification, ShownStage](float) mutable
+	{
+		if (!Worker.IsCompleted())
+		{
+			const int32 Stage = State->Stage;
+			if (Notification.IsValid() && Stage != ShownStage)
 			{
-				FVrmGlbAccessorReader::FDecodeResult DecodeResult = AccessorReader.DecodeAccessors(JsonString);
-				if (!DecodeResult.bSuccess)
-				{
-					Source->ImportWarnings.Add(FString::Printf(TEXT("B2: Mesh not built (accessor decode failed): %s"), *DecodeResult.ErrorMessage));
-				}
-				else
-				{
-					// Compute joint ordinal to bone index mapping
-					TMap<int32, int32> JointOrdinalToBoneIndex;
-					
-					// Parse JSON to extract skin joints
-					TSharedPtr<FJsonObject> RootObject;
-					TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-					
-					if (FJsonSerializer::Deserialize(Reader, RootObject) && RootObject.IsValid())
-					{
-						TArray<int32> SkinJoints;
-						if (FVrmGltfParser::TryExtractSkin0Joints(RootObject, SkinJoints))
-						{
-							// Get the skeleton we applied to build node index to bone index mapping
-							FVrmGltfSkeleton GltfSkel;
-							FString ParseError;
-							if (FVrmGltfParser::ExtractSkeletonFromGlbFile(SourcePath, GltfSkel, ParseError))
-							{
-								// Build node index to bone index mapping
-								TMap<int32, int32> NodeToBoneIndex;
-								for (int32 BoneIndex = 0; BoneIndex < GltfSkel.Bones.Num(); ++BoneIndex)
-								{
-									NodeToBoneIndex.Add(GltfSkel.Bones[BoneIndex].GltfNodeIndex, BoneIndex);
-								}
-								
-								// Map skin joint node indices to bone indices
-								for (int32 JointOrdinal = 0; JointOrdinal < SkinJoints.Num(); ++JointOrdinal)
-								{
-									int32 NodeIndex = SkinJoints[JointOrdinal];
-									const int32* BoneIndexPtr = NodeToBoneIndex.Find(NodeIndex);
-									if (BoneIndexPtr)
-									{
-										JointOrdinalToBoneIndex.Add(JointOrdinal, *BoneIndexPtr);
-									}
-								}
-							}
-						}
-					}
-					
-					if (JointOrdinalToBoneIndex.Num() == 0)
-					{
-						Source->ImportWarnings.Add(TEXT("B2: Mesh not built (no joint mapping available)."));
-					}
-					else
-					{
-						// Build the mesh
-						FVrmSkeletalMeshBuilder::FBuildResult BuildResult = FVrmSkeletalMeshBuilder::BuildLod0SkinnedPrimitive(
-							AccessorReader, NewSkeleton, JointOrdinalToBoneIndex, MeshPackageName, MeshName);
-							
-						if (!BuildResult.bSuccess)
-						{
-							Source->ImportWarnings.Add(FString::Printf(TEXT("B2: Mesh build failed: %s"), *BuildResult.ErrorMessage));
-						}
-						else
-						{
-							// Replace the placeholder mesh with the built mesh
-							NewMesh = BuildResult.BuiltMesh;
-							OutSkeletalMesh = NewMesh;
-						}
-					}
-				}
+				ShownStage = Stage;
+				Notification->SetText(FText::Format(NSLOCTEXT("VrmConversionService", "Converting", "Converting {0}: {1}"),
+					FText::FromString(State->SourceName), GetStageText(static_cast<EConversionStage>(Stage))));
 			}
+			return true;
 		}
-	}
 
-	OutSkeletalMesh = NewMesh;
-	OutSkeleton = NewSkeleton;
+		FinishAsyncConversion(*State, Notification);
+		return false;
+	}));
 
 	return true;
 }
@@ -387,20 +749,7 @@ bool FVrmConversionService::ApplyGltfSkeletonToAssets(const FVrmGltfSkeleton& Gl
 	FReferenceSkeletonModifier RefSkelModifier(MeshRefSkel, TargetSkeleton);
 
 	// Add bones in order from the parsed GLTF skeleton
-	for (int32 Index = 0; Index < GltfSkel.Bones.Num(); ++Index)
-	{
-		const FVrmGltfBone& Bone = GltfSkel.Bones[Index];
-		FName BoneName = Bone.Name;
-		FName ParentName = NAME_None;
-		if (Bone.ParentIndex != INDEX_NONE && GltfSkel.Bones.IsValidIndex(Bone.ParentIndex))
-		{
-			ParentName = GltfSkel.Bones[Bone.ParentIndex].Name;
-		}
-
-		// FMeshBoneInfo: (Name, ExportName, ParentIndex)
-		FMeshBoneInfo BoneInfo(BoneName, BoneName.ToString(), Bone.ParentIndex);
-		RefSkelModifier.Add(BoneInfo, Bone.LocalTransform);
-	}
+	AddGltfBones(RefSkelModifier, GltfSkel);
 
 	// Ensure the skeleton asset is aware of bones added to the mesh
 	TargetSkeleton->MergeAllBonesToBoneTree(TargetMesh);
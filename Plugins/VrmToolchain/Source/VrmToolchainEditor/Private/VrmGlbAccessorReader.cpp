@@ -1,73 +1,51 @@
 #include "VrmGlbAccessorReader.h"
-#include "VrmToolchain/VrmMetadata.h" // for FVrmParser::ReadGlbJsonChunk
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
-#include "Misc/FileHelper.h"
+#include "VrmToolchain/VrmGlbDocument.h"
+#include "VrmToolchain/VrmGltfModel.h"
+#include "VrmToolchainEditor.h"
+#include "VrmAccessorKernels.h"
+#include "VrmMeshoptDecoder.h"
 #include "Math/UnrealMathUtility.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeLock.h"
 
-FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::LoadGlbFile(const FString& FilePath, FString& OutJsonString)
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::LoadGlbFile(const FString& FilePath)
 {
     FDecodeResult Result;
-    
-    // First try to read JSON chunk using existing utility
-    if (!FVrmParser::ReadGlbJsonChunk(FilePath, OutJsonString))
-    {
-        Result.bSuccess = false;
-        Result.ErrorMessage = FString::Printf(TEXT("Failed to read GLB JSON chunk from: %s"), *FilePath);
-        return Result;
-    }
 
-    // Read the entire file for BIN chunk extraction
-    TArray<uint8> FileData;
-    if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+    FString LoadError;
+    const TSharedPtr<FVrmGlbDocument> LoadedDocument = FVrmGlbDocument::LoadFromFile(FilePath, LoadError);
+    if (!LoadedDocument.IsValid())
     {
         Result.bSuccess = false;
-        Result.ErrorMessage = FString::Printf(TEXT("Failed to read GLB file: %s"), *FilePath);
+        Result.ErrorMessage = FString::Printf(TEXT("Failed to read GLB file: %s (%s)"), *FilePath, *LoadError);
         return Result;
     }
 
-    // Parse GLB header
-    if (FileData.Num() < 12)
-    {
-        Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("GLB file too small for header");
-        return Result;
-    }
+    return LoadGlbDocument(LoadedDocument.ToSharedRef());
+}
 
-    // Check magic number (should be "glTF")
-    uint32 Magic = *reinterpret_cast<const uint32*>(&FileData[0]);
-    if (Magic != 0x46546C67) // "glTF" in little endian
-    {
-        Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("Invalid GLB magic number");
-        return Result;
-    }
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::LoadGlbDocument(const TSharedRef<const FVrmGlbDocument>& InDocument)
+{
+    FDecodeResult Result;
 
-    // Skip version (4 bytes) and total length (4 bytes), start reading chunks
-    int64 Offset = 12;
+    Document = InDocument;
+    Primitives.Reset();
+    AccessorCache.Reset();
+    DecompressedArena.Empty();
+    DecompressedViewOffsets.Reset();
+    NumDecompressedViews = 0;
 
-    while (Offset < FileData.Num())
+    // Accessors may live in any buffer; a document without a single resolved buffer has nothing to decode
+    bool bAnyBufferData = false;
+    for (int32 BufferIndex = 0; BufferIndex < InDocument->GetModel().Buffers.Num() && !bAnyBufferData; ++BufferIndex)
     {
-        FGlbChunk Chunk;
-        if (!ReadChunk(FileData, Offset, Chunk))
-        {
-            Result.bSuccess = false;
-            Result.ErrorMessage = TEXT("Failed to read GLB chunk");
-            return Result;
-        }
-
-        // Check chunk type
-        if (Chunk.Type == 0x4E4942) // "BIN" in little endian
-        {
-            BinData = TArray<uint8>(Chunk.Data.GetData(), Chunk.Data.Num());
-            break; // We only need the BIN chunk for now
-        }
+        bAnyBufferData = InDocument->GetBufferData(BufferIndex).Num() > 0;
     }
 
-    if (BinData.Num() == 0)
+    if (!bAnyBufferData)
     {
         Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("No BIN chunk found in GLB file");
+        Result.ErrorMessage = TEXT("No buffer data found (no BIN chunk and no loadable buffer URI)");
         return Result;
     }
 
@@ -75,516 +53,786 @@ FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::LoadGlbFile(const FS
     return Result;
 }
 
-bool FVrmGlbAccessorReader::ReadChunk(const TArray<uint8>& Data, int64& Offset, FGlbChunk& OutChunk)
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::DecodeAccessors()
 {
-    if (Offset + 8 > Data.Num())
-    {
-        return false;
-    }
+    FDecodeResult Result;
 
-    OutChunk.Length = *reinterpret_cast<const uint32*>(&Data[Offset]);
-    Offset += 4;
-    
-    OutChunk.Type = *reinterpret_cast<const uint32*>(&Data[Offset]);
-    Offset += 4;
+    Primitives.Reset();
+    AccessorCache.Reset();
 
-    if (Offset + OutChunk.Length > Data.Num())
+    if (!Document.IsValid())
     {
-        return false;
+        Result.bSuccess = false;
+        Result.ErrorMessage = TEXT("No GLB document loaded");
+        return Result;
     }
 
-    OutChunk.Data = TArrayView<const uint8>(&Data[Offset], OutChunk.Length);
-    Offset += OutChunk.Length;
-
-    return true;
-}
-
-FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::DecodeAccessors(const FString& JsonString)
-{
-    FDecodeResult Result;
-
-    // Parse JSON
-    TSharedPtr<FJsonObject> RootObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-    
-    if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+    // Reuse the document's typed glTF model (built once at load time)
+    if (!Document->GetJsonRoot().IsObject())
     {
         Result.bSuccess = false;
         Result.ErrorMessage = TEXT("Failed to parse GLB JSON");
         return Result;
     }
 
+    const FVrmGltfModel& Model = Document->GetModel();
+
     // Get required arrays
-    const TArray<TSharedPtr<FJsonValue>>* AccessorsArray = nullptr;
-    if (!RootObject->TryGetArrayField(TEXT("accessors"), AccessorsArray) || !AccessorsArray)
+    if (Model.Accessors.Num() == 0)
     {
         Result.bSuccess = false;
         Result.ErrorMessage = TEXT("No accessors array in GLB JSON");
         return Result;
     }
 
-    const TArray<TSharedPtr<FJsonValue>>* BufferViewsArray = nullptr;
-    if (!RootObject->TryGetArrayField(TEXT("bufferViews"), BufferViewsArray) || !BufferViewsArray)
+    if (Model.BufferViews.Num() == 0)
     {
         Result.bSuccess = false;
         Result.ErrorMessage = TEXT("No bufferViews array in GLB JSON");
         return Result;
     }
 
-    // Get meshes to find the primitive we want
-    const TArray<TSharedPtr<FJsonValue>>* MeshesArray = nullptr;
-    if (!RootObject->TryGetArrayField(TEXT("meshes"), MeshesArray) || !MeshesArray || MeshesArray->Num() == 0)
+    if (Model.Meshes.Num() == 0)
     {
         Result.bSuccess = false;
         Result.ErrorMessage = TEXT("No meshes in GLB JSON");
         return Result;
     }
 
-    // For now, take the first mesh and first primitive
-    const TSharedPtr<FJsonObject> FirstMesh = (*MeshesArray)[0]->AsObject();
-    if (!FirstMesh.IsValid())
+    // Every primitive of every mesh, in model order (the model stores them flat, grouped by mesh)
+    const int32 NumPrimitives = Model.Primitives.Num();
+    if (NumPrimitives == 0)
     {
         Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("Invalid mesh object");
+        Result.ErrorMessage = TEXT("No primitives in GLB meshes");
         return Result;
     }
 
-    const TArray<TSharedPtr<FJsonValue>>* PrimitivesArray = nullptr;
-    if (!FirstMesh->TryGetArrayField(TEXT("primitives"), PrimitivesArray) || !PrimitivesArray || PrimitivesArray->Num() == 0)
+    // Compressed views must be in the arena before any accessor view points into it
+    FDecodeResult DecompressResult = DecompressBufferViews(Model);
+    if (!DecompressResult.bSuccess)
     {
-        Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("No primitives in first mesh");
-        return Result;
+        return DecompressResult;
     }
 
-    const TSharedPtr<FJsonObject> FirstPrimitive = (*PrimitivesArray)[0]->AsObject();
-    if (!FirstPrimitive.IsValid())
-    {
-        Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("Invalid primitive object");
-        return Result;
-    }
+    // Each primitive is an independent task writing only its own slot
+    Primitives.SetNum(NumPrimitives);
+    TArray<FDecodeResult> PrimitiveResults;
+    PrimitiveResults.SetNum(NumPrimitives);
 
-    // Get attributes
-    const TSharedPtr<FJsonObject>* AttributesObject = nullptr;
-    if (!FirstPrimitive->TryGetObjectField(TEXT("attributes"), AttributesObject) || !AttributesObject)
+    ParallelFor(NumPrimitives, [this, &Model, &PrimitiveResults](int32 PrimitiveIndex)
     {
-        Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("No attributes in primitive");
-        return Result;
-    }
+        PrimitiveResults[PrimitiveIndex] = DecodePrimitive(Model, PrimitiveIndex, Primitives[PrimitiveIndex]);
+    });
 
-    // Decode POSITION (required)
-    int32 PositionAccessorIndex = INDEX_NONE;
-    if ((*AttributesObject)->TryGetNumberField(TEXT("POSITION"), PositionAccessorIndex))
+    bool bAnySkinned = false;
+    for (int32 PrimitiveIndex = 0; PrimitiveIndex < NumPrimitives; ++PrimitiveIndex)
     {
-        if (PositionAccessorIndex >= 0 && PositionAccessorIndex < AccessorsArray->Num())
+        const FDecodeResult& PrimitiveResult = PrimitiveResults[PrimitiveIndex];
+        if (!PrimitiveResult.bSuccess)
         {
-            const TSharedPtr<FJsonObject> AccessorObj = (*AccessorsArray)[PositionAccessorIndex]->AsObject();
-            if (AccessorObj.IsValid())
-            {
-                FDecodeResult PosResult = DecodeAccessor(AccessorObj, *BufferViewsArray, Positions);
-                if (!PosResult.bSuccess)
-                {
-                    Result.bSuccess = false;
-                    Result.ErrorMessage = FString::Printf(TEXT("Failed to decode POSITION: %s"), *PosResult.ErrorMessage);
-                    return Result;
-                }
-            }
+            Result.bSuccess = false;
+            Result.ErrorMessage = FString::Printf(TEXT("Mesh %d primitive %d: %s"), Primitives[PrimitiveIndex].MeshIndex, PrimitiveIndex, *PrimitiveResult.ErrorMessage);
+            Primitives.Reset();
+            return Result;
         }
+        bAnySkinned |= Primitives[PrimitiveIndex].IsSkinned();
     }
 
-    // Decode NORMAL (optional)
-    int32 NormalAccessorIndex = INDEX_NONE;
-    if ((*AttributesObject)->TryGetNumberField(TEXT("NORMAL"), NormalAccessorIndex))
+    // Primitives that cannot be built (non-triangle topology) were left empty
+    Primitives.RemoveAll([](const FPrimitive& Primitive) { return Primitive.Positions.IsEmpty(); });
+
+    if (Primitives.Num() == 0)
     {
-        if (NormalAccessorIndex >= 0 && NormalAccessorIndex < AccessorsArray->Num())
-        {
-            const TSharedPtr<FJsonObject> AccessorObj = (*AccessorsArray)[NormalAccessorIndex]->AsObject();
-            if (AccessorObj.IsValid())
-            {
-                FDecodeResult NormalResult = DecodeAccessor(AccessorObj, *BufferViewsArray, Normals);
-                if (!NormalResult.bSuccess)
-                {
-                    // Normals are optional, so we don't fail here
-                    UE_LOG(LogTemp, Warning, TEXT("Failed to decode NORMAL: %s"), *NormalResult.ErrorMessage);
-                }
-            }
-        }
+        Result.bSuccess = false;
+        Result.ErrorMessage = TEXT("No triangle primitives found");
+        return Result;
     }
 
-    // Decode TEXCOORD_0 (optional)
-    int32 TexCoordAccessorIndex = INDEX_NONE;
-    if ((*AttributesObject)->TryGetNumberField(TEXT("TEXCOORD_0"), TexCoordAccessorIndex))
+    if (!bAnySkinned)
     {
-        if (TexCoordAccessorIndex >= 0 && TexCoordAccessorIndex < AccessorsArray->Num())
-        {
-            const TSharedPtr<FJsonObject> AccessorObj = (*AccessorsArray)[TexCoordAccessorIndex]->AsObject();
-            if (AccessorObj.IsValid())
-            {
-                FDecodeResult TexCoordResult = DecodeAccessor(AccessorObj, *BufferViewsArray, TexCoords);
-                if (!TexCoordResult.bSuccess)
-                {
-                    // TexCoords are optional, so we don't fail here
-                    UE_LOG(LogTemp, Warning, TEXT("Failed to decode TEXCOORD_0: %s"), *TexCoordResult.ErrorMessage);
-                }
-            }
-        }
+        Primitives.Reset();
+        Result.bSuccess = false;
+        Result.ErrorMessage = TEXT("Skinned mesh requires WEIGHTS_0 and JOINTS_0 data");
+        return Result;
     }
 
-    // Decode WEIGHTS_0 (required for skinned mesh)
-    int32 WeightsAccessorIndex = INDEX_NONE;
-    if ((*AttributesObject)->TryGetNumberField(TEXT("WEIGHTS_0"), WeightsAccessorIndex))
+    Result.bSuccess = true;
+    return Result;
+}
+
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::DecompressBufferViews(const FVrmGltfModel& Model)
+{
+    FDecodeResult Result;
+
+    DecompressedArena.Empty();
+    DecompressedViewOffsets.Init(INDEX_NONE, Model.BufferViews.Num());
+    NumDecompressedViews = 0;
+
+    // Lay the decompressed views out back to back so one allocation serves the whole document
+    TArray<int32> CompressedViews;
+    int64 ArenaSize = 0;
+    for (int32 ViewIndex = 0; ViewIndex < Model.BufferViews.Num(); ++ViewIndex)
     {
-        if (WeightsAccessorIndex >= 0 && WeightsAccessorIndex < AccessorsArray->Num())
+        const FVrmGltfBufferView& View = Model.BufferViews[ViewIndex];
+        if (!View.IsCompressed())
         {
-            const TSharedPtr<FJsonObject> AccessorObj = (*AccessorsArray)[WeightsAccessorIndex]->AsObject();
-            if (AccessorObj.IsValid())
-            {
-                FDecodeResult WeightsResult = DecodeAccessor(AccessorObj, *BufferViewsArray, Weights);
-                if (!WeightsResult.bSuccess)
-                {
-                    Result.bSuccess = false;
-                    Result.ErrorMessage = FString::Printf(TEXT("Failed to decode WEIGHTS_0: %s"), *WeightsResult.ErrorMessage);
-                    return Result;
-                }
-            }
+            continue;
         }
-    }
 
-    // Decode JOINTS_0 (required for skinned mesh)
-    int32 JointsAccessorIndex = INDEX_NONE;
-    if ((*AttributesObject)->TryGetNumberField(TEXT("JOINTS_0"), JointsAccessorIndex))
-    {
-        if (JointsAccessorIndex >= 0 && JointsAccessorIndex < AccessorsArray->Num())
+        const FVrmGltfMeshoptCompression& Meshopt = View.Meshopt;
+        const TArrayView<const uint8> CompressedBuffer = Document->GetBufferData(Meshopt.Buffer);
+        if (CompressedBuffer.Num() == 0)
         {
-            const TSharedPtr<FJsonObject> AccessorObj = (*AccessorsArray)[JointsAccessorIndex]->AsObject();
-            if (AccessorObj.IsValid())
-            {
-                FDecodeResult JointsResult = DecodeAccessor(AccessorObj, *BufferViewsArray, Joints);
-                if (!JointsResult.bSuccess)
-                {
-                    Result.bSuccess = false;
-                    Result.ErrorMessage = FString::Printf(TEXT("Failed to decode JOINTS_0: %s"), *JointsResult.ErrorMessage);
-                    return Result;
-                }
-            }
+            Result.bSuccess = false;
+            Result.ErrorMessage = FString::Printf(TEXT("Compressed bufferView %d: buffer %d has no data (missing file or unsupported URI)"), ViewIndex, Meshopt.Buffer);
+            return Result;
         }
-    }
 
-    // Decode indices (required)
-    int32 IndicesAccessorIndex = INDEX_NONE;
-    if (FirstPrimitive->TryGetNumberField(TEXT("indices"), IndicesAccessorIndex))
-    {
-        if (IndicesAccessorIndex >= 0 && IndicesAccessorIndex < AccessorsArray->Num())
+        const int64 DecodedSize = static_cast<int64>(Meshopt.Count) * Meshopt.ByteStride;
+        if (Meshopt.Count < 0 || Meshopt.ByteStride <= 0 || DecodedSize > View.ByteLength
+            || Meshopt.ByteOffset < 0 || Meshopt.ByteLength < 0 || Meshopt.ByteOffset + Meshopt.ByteLength > CompressedBuffer.Num())
         {
-            const TSharedPtr<FJsonObject> AccessorObj = (*AccessorsArray)[IndicesAccessorIndex]->AsObject();
-            if (AccessorObj.IsValid())
-            {
-                FDecodeResult IndicesResult = DecodeAccessor(AccessorObj, *BufferViewsArray, Indices);
-                if (!IndicesResult.bSuccess)
-                {
-                    Result.bSuccess = false;
-                    Result.ErrorMessage = FString::Printf(TEXT("Failed to decode indices: %s"), *IndicesResult.ErrorMessage);
-                    return Result;
-                }
-            }
+            Result.bSuccess = false;
+            Result.ErrorMessage = FString::Printf(TEXT("Compressed bufferView %d has an invalid layout"), ViewIndex);
+            return Result;
         }
+
+        DecompressedViewOffsets[ViewIndex] = ArenaSize;
+        ArenaSize = Align(ArenaSize + View.ByteLength, 16);
+        CompressedViews.Add(ViewIndex);
     }
 
-    // Validate that we have the minimum required data
-    if (Positions.Num() == 0)
+    if (CompressedViews.Num() == 0)
     {
-        Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("No POSITION data found");
+        Result.bSuccess = true;
         return Result;
     }
 
-    if (Weights.Num() == 0 || Joints.Num() == 0)
+    if (ArenaSize > MAX_int32)
     {
         Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("Skinned mesh requires WEIGHTS_0 and JOINTS_0 data");
+        Result.ErrorMessage = FString::Printf(TEXT("Decompressed bufferViews are too large (%lld bytes)"), ArenaSize);
         return Result;
     }
+    DecompressedArena.SetNumUninitialized(static_cast<int32>(ArenaSize));
 
-    if (Indices.Num() == 0)
+    // Views are independent streams, so each decodes on its own task into its own arena range
+    TArray<FString> ViewErrors;
+    ViewErrors.SetNum(CompressedViews.Num());
+    ParallelFor(CompressedViews.Num(), [this, &Model, &CompressedViews, &ViewErrors](int32 Task)
     {
-        Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("No indices data found");
-        return Result;
-    }
+        const int32 ViewIndex = CompressedViews[Task];
+        const FVrmGltfBufferView& View = Model.BufferViews[ViewIndex];
+        const FVrmGltfMeshoptCompression& Meshopt = View.Meshopt;
+        uint8* Decoded = DecompressedArena.GetData() + DecompressedViewOffsets[ViewIndex];
+
+        // byteLength may be padded past count * byteStride; keep the padding deterministic
+        const int64 DecodedSize = static_cast<int64>(Meshopt.Count) * Meshopt.ByteStride;
+        FMemory::Memzero(Decoded + DecodedSize, View.ByteLength - DecodedSize);
 
-    // Validate array sizes match
-    if (Weights.Num() != Positions.Num() || Joints.Num() != Positions.Num())
+        const TConstArrayView<uint8> Compressed(Document->GetBufferData(Meshopt.Buffer).GetData() + Meshopt.ByteOffset, Meshopt.ByteLength);
+        VrmMeshoptDecoder::Decode(Meshopt, Compressed, Decoded, ViewErrors[Task]);
+    });
+
+    for (int32 Task = 0; Task < CompressedViews.Num(); ++Task)
     {
-        Result.bSuccess = false;
-        Result.ErrorMessage = FString::Printf(TEXT("Array size mismatch: Positions=%d, Weights=%d, Joints=%d"), 
-                                             Positions.Num(), Weights.Num(), Joints.Num());
-        return Result;
+        if (!ViewErrors[Task].IsEmpty())
+        {
+            DecompressedArena.Empty();
+            DecompressedViewOffsets.Reset();
+            Result.bSuccess = false;
+            Result.ErrorMessage = FString::Printf(TEXT("Failed to decompress bufferView %d: %s"), CompressedViews[Task], *ViewErrors[Task]);
+            return Result;
+        }
     }
 
+    NumDecompressedViews = CompressedViews.Num();
+    UE_LOG(LogVrmToolchainEditor, Verbose, TEXT("Decompressed %d EXT_meshopt_compression bufferViews (%lld bytes)"), NumDecompressedViews, ArenaSize);
+
     Result.bSuccess = true;
     return Result;
 }
 
-template<typename T>
-FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::DecodeAccessor(
-    const TSharedPtr<FJsonObject>& AccessorJson, 
-    const TArray<TSharedPtr<FJsonValue>>& BufferViewsJson,
-    TArray<T>& OutArray)
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::DecodePrimitive(
+    const FVrmGltfModel& Model,
+    int32 PrimitiveIndex,
+    FPrimitive& OutPrimitive)
 {
     FDecodeResult Result;
 
-    // Get accessor properties
-    int32 BufferViewIndex = INDEX_NONE;
-    if (!AccessorJson->TryGetNumberField(TEXT("bufferView"), BufferViewIndex) || BufferViewIndex < 0)
+    const FVrmGltfPrimitive& Source = Model.Primitives[PrimitiveIndex];
+    OutPrimitive.MeshIndex = Source.Mesh;
+    OutPrimitive.PrimitiveIndex = PrimitiveIndex;
+    OutPrimitive.Material = Source.Material;
+
+    // Only TRIANGLES can be built into a skeletal mesh; other topologies are skipped
+    if (Source.Mode != 4)
     {
-        Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("Accessor missing bufferView");
+        UE_LOG(LogVrmToolchainEditor, Warning, TEXT("Skipping mesh %d primitive %d: unsupported mode %d"), Source.Mesh, PrimitiveIndex, Source.Mode);
+        Result.bSuccess = true;
         return Result;
     }
 
-    int32 Count = 0;
-    if (!AccessorJson->TryGetNumberField(TEXT("count"), Count) || Count <= 0)
+    // Decode POSITION (required)
+    if (!Model.IsValidAccessor(Source.Position))
     {
         Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("Accessor missing or invalid count");
+        Result.ErrorMessage = TEXT("No POSITION data found");
         return Result;
     }
 
-    int32 ComponentType = 0;
-    if (!AccessorJson->TryGetNumberField(TEXT("componentType"), ComponentType))
+    FDecodeResult PosResult = GetAccessorView(Model, Source.Position, OutPrimitive.Positions);
+    if (!PosResult.bSuccess)
     {
         Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("Accessor missing componentType");
+        Result.ErrorMessage = FString::Printf(TEXT("Failed to decode POSITION: %s"), *PosResult.ErrorMessage);
         return Result;
     }
+    const int32 NumVertices = OutPrimitive.Positions.Num();
 
-    FString TypeString;
-    if (!AccessorJson->TryGetStringField(TEXT("type"), TypeString))
+    // Decode NORMAL (optional)
+    if (Model.IsValidAccessor(Source.Normal))
     {
-        Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("Accessor missing type");
-        return Result;
+        FDecodeResult NormalResult = GetAccessorView(Model, Source.Normal, OutPrimitive.Normals);
+        if (!NormalResult.bSuccess || OutPrimitive.Normals.Num() != NumVertices)
+        {
+            // Normals are optional, so we don't fail here
+            UE_LOG(LogVrmToolchainEditor, Warning, TEXT("Failed to decode NORMAL of primitive %d: %s"), PrimitiveIndex,
+                NormalResult.bSuccess ? TEXT("count does not match POSITION") : *NormalResult.ErrorMessage);
+            OutPrimitive.Normals.Reset();
+        }
     }
 
-    // Get buffer view
-    if (BufferViewIndex >= BufferViewsJson.Num())
+    // Decode TANGENT (optional)
+    if (Model.IsValidAccessor(Source.Tangent))
+    {
+        FDecodeResult TangentResult = GetAccessorView(Model, Source.Tangent, OutPrimitive.Tangents);
+        if (!TangentResult.bSuccess || OutPrimitive.Tangents.Num() != NumVertices)
+        {
+            // Missing tangents are generated by the mesh builder
+            UE_LOG(LogVrmToolchainEditor, Warning, TEXT("Failed to decode TANGENT of primitive %d: %s"), PrimitiveIndex,
+                TangentResult.bSuccess ? TEXT("count does not match POSITION") : *TangentResult.ErrorMessage);
+            OutPrimitive.Tangents.Reset();
+        }
+    }
+
+    // Decode TEXCOORD_0 (optional)
+    if (Model.IsValidAccessor(Source.TexCoords[0]))
+    {
+        FDecodeResult TexCoordResult = GetAccessorView(Model, Source.TexCoords[0], OutPrimitive.TexCoords);
+        if (!TexCoordResult.bSuccess)
+        {
+            // TexCoords are optional, so we don't fail here
+            UE_LOG(LogVrmToolchainEditor, Warning, TEXT("Failed to decode TEXCOORD_0 of primitive %d: %s"), PrimitiveIndex, *TexCoordResult.ErrorMessage);
+            OutPrimitive.TexCoords.Reset();
+        }
+    }
+
+    // Decode WEIGHTS_0 and JOINTS_0 (together or not at all)
+    const bool bHasWeights = Model.IsValidAccessor(Source.Weights[0]);
+    const bool bHasJoints = Model.IsValidAccessor(Source.Joints[0]);
+    if (bHasWeights != bHasJoints)
     {
         Result.bSuccess = false;
-        Result.ErrorMessage = FString::Printf(TEXT("BufferView index %d out of range"), BufferViewIndex);
+        Result.ErrorMessage = TEXT("Skinned primitive requires both WEIGHTS_0 and JOINTS_0 data");
         return Result;
     }
 
-    const TSharedPtr<FJsonObject> BufferViewObj = BufferViewsJson[BufferViewIndex]->AsObject();
-    if (!BufferViewObj.IsValid())
+    if (bHasWeights)
+    {
+        FDecodeResult WeightsResult = GetAccessorView(Model, Source.Weights[0], OutPrimitive.Weights);
+        if (!WeightsResult.bSuccess)
+        {
+            Result.bSuccess = false;
+            Result.ErrorMessage = FString::Printf(TEXT("Failed to decode WEIGHTS_0: %s"), *WeightsResult.ErrorMessage);
+            return Result;
+        }
+
+        FDecodeResult JointsResult = GetAccessorView(Model, Source.Joints[0], OutPrimitive.Joints);
+        if (!JointsResult.bSuccess)
+        {
+            Result.bSuccess = false;
+            Result.ErrorMessage = FString::Printf(TEXT("Failed to decode JOINTS_0: %s"), *JointsResult.ErrorMessage);
+            return Result;
+        }
+
+        // Validate array sizes match
+        if (OutPrimitive.Weights.Num() != NumVertices || OutPrimitive.Joints.Num() != NumVertices)
+        {
+            Result.bSuccess = false;
+            Result.ErrorMessage = FString::Printf(TEXT("Array size mismatch: Positions=%d, Weights=%d, Joints=%d"),
+                                                 NumVertices, OutPrimitive.Weights.Num(), OutPrimitive.Joints.Num());
+            return Result;
+        }
+
+        // Quantized positions are node-local: the dequantization transform sits on the node, which rigid meshes
+        // are placed with, but for skinned meshes KHR_mesh_quantization folds it into inverseBindMatrices
+        if (OutPrimitive.Positions.GetComponentType() != EVrmGltfComponentType::Float)
+        {
+            Result.bSuccess = false;
+            Result.ErrorMessage = TEXT("Quantized POSITION on a skinned primitive needs inverseBindMatrices, which are not applied");
+            return Result;
+        }
+
+        // Further influence sets (JOINTS_1/WEIGHTS_1, ...) are read up to the first incomplete set
+        for (int32 Set = 1; Set < FVrmGltfPrimitive::MaxInfluenceSets; ++Set)
+        {
+            const bool bHasSetWeights = Model.IsValidAccessor(Source.Weights[Set]);
+            const bool bHasSetJoints = Model.IsValidAccessor(Source.Joints[Set]);
+            if (!bHasSetWeights && !bHasSetJoints)
+            {
+                break;
+            }
+
+            TGltfAccessorView<FVector4f> SetWeights;
+            TGltfAccessorView<FIntVector4> SetJoints;
+            FDecodeResult SetResult;
+            if (bHasSetWeights != bHasSetJoints)
+            {
+                SetResult.ErrorMessage = TEXT("WEIGHTS and JOINTS must come in pairs");
+            }
+            else
+            {
+                SetResult = GetAccessorView(Model, Source.Weights[Set], SetWeights);
+                if (SetResult.bSuccess)
+                {
+                    SetResult = GetAccessorView(Model, Source.Joints[Set], SetJoints);
+                }
+                if (SetResult.bSuccess && (SetWeights.Num() != NumVertices || SetJoints.Num() != NumVertices))
+                {
+                    SetResult.bSuccess = false;
+                    SetResult.ErrorMessage = TEXT("count does not match POSITION");
+                }
+            }
+
+            if (!SetResult.bSuccess)
+            {
+                UE_LOG(LogVrmToolchainEditor, Warning, TEXT("Ignoring influence set %d and above of primitive %d: %s"), Set, PrimitiveIndex, *SetResult.ErrorMessage);
+                break;
+            }
+
+            OutPrimitive.ExtraWeights.Add(SetWeights);
+            OutPrimitive.ExtraJoints.Add(SetJoints);
+        }
+    }
+
+    // Decode indices (required)
+    if (!Model.IsValidAccessor(Source.Indices))
     {
         Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("Invalid bufferView object");
+        Result.ErrorMessage = TEXT("No indices data found");
         return Result;
     }
 
-    int32 BufferIndex = 0;
-    if (!BufferViewObj->TryGetNumberField(TEXT("buffer"), BufferIndex) || BufferIndex != 0)
+    FDecodeResult IndicesResult = GetAccessorView(Model, Source.Indices, OutPrimitive.Indices);
+    if (!IndicesResult.bSuccess)
     {
         Result.bSuccess = false;
-        Result.ErrorMessage = TEXT("Only buffer index 0 (BIN chunk) is supported");
+        Result.ErrorMessage = FString::Printf(TEXT("Failed to decode indices: %s"), *IndicesResult.ErrorMessage);
         return Result;
     }
 
-    int32 ByteOffset = 0;
-    BufferViewObj->TryGetNumberField(TEXT("byteOffset"), ByteOffset);
+    // Decode morph targets (optional): kept sparse so only displaced vertices are ever visited.
+    // A broken target degrades to no deltas rather than failing the mesh.
+    const TConstArrayView<FVrmGltfMorphTarget> Targets = Model.GetTargets(Source);
+    OutPrimitive.MorphPositions.SetNum(Targets.Num());
+    OutPrimitive.MorphNormals.SetNum(Targets.Num());
+    for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+    {
+        FDecodeResult PositionResult = GetMorphTargetView(Model, Targets[TargetIndex].Position, NumVertices, OutPrimitive.MorphPositions[TargetIndex]);
+        if (!PositionResult.bSuccess)
+        {
+            UE_LOG(LogVrmToolchainEditor, Warning, TEXT("Failed to decode morph target %d POSITION of primitive %d: %s"), TargetIndex, PrimitiveIndex, *PositionResult.ErrorMessage);
+            GetMorphTargetView(Model, INDEX_NONE, NumVertices, OutPrimitive.MorphPositions[TargetIndex]);
+        }
 
-    int32 ByteStride = 0;
-    BufferViewObj->TryGetNumberField(TEXT("byteStride"), ByteStride);
+        FDecodeResult NormalResult = GetMorphTargetView(Model, Targets[TargetIndex].Normal, NumVertices, OutPrimitive.MorphNormals[TargetIndex]);
+        if (!NormalResult.bSuccess)
+        {
+            UE_LOG(LogVrmToolchainEditor, Warning, TEXT("Failed to decode morph target %d NORMAL of primitive %d: %s"), TargetIndex, PrimitiveIndex, *NormalResult.ErrorMessage);
+            GetMorphTargetView(Model, INDEX_NONE, NumVertices, OutPrimitive.MorphNormals[TargetIndex]);
+        }
+    }
 
-    int32 AccessorByteOffset = 0;
-    AccessorJson->TryGetNumberField(TEXT("byteOffset"), AccessorByteOffset);
+    Result.bSuccess = true;
+    return Result;
+}
 
-    // Calculate sizes
-    int32 ComponentSize = GetComponentTypeSize(ComponentType);
-    if (ComponentSize == 0)
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::GetMorphTargetView(
+    const FVrmGltfModel& Model,
+    int32 AccessorIndex,
+    int32 NumVertices,
+    TGltfSparseAccessorView<FVector3f>& OutView) const
+{
+    FDecodeResult Result;
+
+    // All-zero deltas: nothing to view
+    if (!Model.IsValidAccessor(AccessorIndex) || (!Model.Accessors[AccessorIndex].IsSparse() && Model.Accessors[AccessorIndex].BufferView < 0))
     {
-        Result.bSuccess = false;
-        Result.ErrorMessage = FString::Printf(TEXT("Unsupported componentType: %d"), ComponentType);
+        OutView = TGltfSparseAccessorView<FVector3f>();
+        OutView.Count = NumVertices;
+        Result.bSuccess = true;
         return Result;
     }
 
-    int32 ComponentCount = GetTypeComponentCount(TypeString);
-    if (ComponentCount == 0)
+    Result = GetSparseAccessorView(AccessorIndex, OutView);
+    if (Result.bSuccess && OutView.Num() != NumVertices)
     {
         Result.bSuccess = false;
-        Result.ErrorMessage = FString::Printf(TEXT("Unsupported type: %s"), *TypeString);
-        return Result;
+        Result.ErrorMessage = FString::Printf(TEXT("count %d does not match POSITION (%d)"), OutView.Num(), NumVertices);
     }
+    return Result;
+}
 
-    int32 ElementSize = ComponentSize * ComponentCount;
-    int32 Stride = (ByteStride > 0) ? ByteStride : ElementSize;
-    int32 TotalOffset = ByteOffset + AccessorByteOffset;
+int32 FVrmGlbAccessorReader::GetNumCachedAccessors() const
+{
+    FScopeLock CacheLock(&AccessorCacheLock);
+    return AccessorCache.Num();
+}
 
-    // Validate bounds
-    int64 RequiredSize = (int64)TotalOffset + (int64)Count * Stride;
-    if (RequiredSize > BinData.Num())
+template<typename T>
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::GetAccessorView(
+    const FVrmGltfModel& Model,
+    int32 AccessorIndex,
+    TGltfAccessorView<T>& OutView)
+{
+    // Find or add the slot under the map lock; entries are heap-allocated so they stay put while the map grows
+    FCachedAccessor* Cached = nullptr;
     {
-        Result.bSuccess = false;
-        Result.ErrorMessage = FString::Printf(TEXT("Accessor data exceeds BIN chunk size: %lld > %d"), RequiredSize, BinData.Num());
-        return Result;
+        FScopeLock CacheLock(&AccessorCacheLock);
+        const uint64 Key = (static_cast<uint64>(static_cast<uint32>(AccessorIndex)) << 8) | TGltfAccessorElement<T>::TypeId;
+        TUniquePtr<FCachedAccessor>& Slot = AccessorCache.FindOrAdd(Key);
+        if (!Slot.IsValid())
+        {
+            Slot = MakeUnique<FCachedAccessor>();
+        }
+        Cached = Slot.Get();
     }
 
-    // Decode elements
-    OutArray.Reserve(Count);
-    for (int32 i = 0; i < Count; ++i)
+    // Resolve once under the slot lock; other primitives waiting on the same accessor reuse the result
+    FScopeLock SlotLock(&Cached->Lock);
+    if (!Cached->bResolved)
     {
-        int64 ElementOffset = TotalOffset + i * Stride;
-        const uint8* ElementData = &BinData[ElementOffset];
+        const FVrmGltfAccessor& Accessor = Model.Accessors[AccessorIndex];
+        TGltfAccessorView<T> View;
+        if (Accessor.IsSparse())
+        {
+            // Dense consumers get the merged accessor, materialized once in its source format into cache-owned storage
+            TGltfSparseAccessorView<T> Sparse;
+            Cached->Result = MakeSparseAccessorView(Model, Accessor, Sparse);
+            // A base-less sparse accessor is bounded by nothing but its count, so the merged size is checked like the arena
+            const int32 ElementSize = Accessor.GetElementSize();
+            const int64 MergedSize = static_cast<int64>(Sparse.Num()) * ElementSize;
+            if (Cached->Result.bSuccess && MergedSize > MAX_int32)
+            {
+                Cached->Result.bSuccess = false;
+                Cached->Result.ErrorMessage = FString::Printf(TEXT("Sparse accessor %d is too large to merge (%lld bytes)"), AccessorIndex, MergedSize);
+            }
+            if (Cached->Result.bSuccess)
+            {
+                Cached->Storage.SetNumUninitialized(static_cast<int32>(MergedSize));
+                uint8* Merged = Cached->Storage.GetData();
+
+                if (Sparse.HasBase())
+                {
+                    VrmAccessorKernels::CopyElements(Sparse.Base.GetData(), Sparse.Base.GetStride(), ElementSize, Sparse.Num(), Merged);
+                }
+                else
+                {
+                    FMemory::Memzero(Merged, Cached->Storage.Num());
+                }
+
+                for (int32 Entry = 0; Entry < Sparse.Indices.Num(); ++Entry)
+                {
+                    FMemory::Memcpy(Merged + static_cast<int64>(Sparse.Indices[Entry]) * ElementSize,
+                                    Sparse.Values.GetData() + static_cast<int64>(Entry) * Sparse.Values.GetStride(),
+                                    ElementSize);
+                }
 
-        T Element;
-        if (!DecodeElement(ComponentType, ComponentCount, ElementData, Element))
+                View = TGltfAccessorView<T>(Merged, ElementSize, Sparse.Num(), Accessor.ComponentType, Accessor.bNormalized);
+            }
+        }
+        else
         {
-            Result.bSuccess = false;
-            Result.ErrorMessage = FString::Printf(TEXT("Failed to decode element %d"), i);
-            return Result;
+            Cached->Result = MakeAccessorView(Model, Accessor, View);
         }
+        Cached->Data = View.GetData();
+        Cached->Stride = View.GetStride();
+        Cached->Count = View.Num();
+        Cached->ComponentType = View.GetComponentType();
+        Cached->bNormalized = View.IsNormalized();
+        Cached->bResolved = true;
+    }
+
+    OutView = Cached->Result.bSuccess
+        ? TGltfAccessorView<T>(Cached->Data, Cached->Stride, Cached->Count, Cached->ComponentType, Cached->bNormalized)
+        : TGltfAccessorView<T>();
+    return Cached->Result;
+}
 
-        OutArray.Add(Element);
+template<typename T>
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::GetSparseAccessorView(
+    int32 AccessorIndex,
+    TGltfSparseAccessorView<T>& OutView) const
+{
+    FDecodeResult Result;
+
+    if (!Document.IsValid() || !Document->GetModel().IsValidAccessor(AccessorIndex))
+    {
+        Result.bSuccess = false;
+        Result.ErrorMessage = FString::Printf(TEXT("Accessor index %d out of range"), AccessorIndex);
+        return Result;
     }
 
-    Result.bSuccess = true;
+    const FVrmGltfModel& Model = Document->GetModel();
+    const FVrmGltfAccessor& Accessor = Model.Accessors[AccessorIndex];
+    if (Accessor.IsSparse())
+    {
+        return MakeSparseAccessorView(Model, Accessor, OutView);
+    }
+
+    // A dense accessor is a sparse one with nothing substituted
+    OutView = TGltfSparseAccessorView<T>();
+    Result = MakeAccessorView(Model, Accessor, OutView.Base);
+    OutView.Count = OutView.Base.Num();
     return Result;
 }
 
-// Template specializations for different accessor types
-template<>
-bool FVrmGlbAccessorReader::DecodeElement<FVector3f>(int32 ComponentType, int32 ComponentCount, const uint8* Data, FVector3f& OutElement)
+template<typename T>
+bool FVrmGlbAccessorReader::CheckAccessorFormat(const FVrmGltfAccessor& Accessor, FDecodeResult& OutResult)
 {
-    if (ComponentCount != 3 || ComponentType != 5126) // FLOAT
+    const int32 Count = Accessor.Count;
+    if (Count <= 0)
     {
+        OutResult.bSuccess = false;
+        OutResult.ErrorMessage = TEXT("Accessor missing or invalid count");
         return false;
     }
 
-    // GLTF uses right-handed coordinates, UE uses left-handed
-    // For positions, we need to convert Y/Z axes
-    const float* FloatData = reinterpret_cast<const float*>(Data);
-    OutElement.X = FloatData[0];
-    OutElement.Y = FloatData[2]; // Swap Y and Z
-    OutElement.Z = -FloatData[1]; // Negate Y (original Z)
+    const int32 ComponentType = Accessor.ComponentType;
+    if (ComponentType == EVrmGltfComponentType::None)
+    {
+        OutResult.bSuccess = false;
+        OutResult.ErrorMessage = TEXT("Accessor missing componentType");
+        return false;
+    }
 
-    return true;
-}
+    // Calculate sizes
+    int32 ComponentSize = EVrmGltfComponentType::GetSize(ComponentType);
+    if (ComponentSize == 0)
+    {
+        OutResult.bSuccess = false;
+        OutResult.ErrorMessage = FString::Printf(TEXT("Unsupported componentType: %d"), ComponentType);
+        return false;
+    }
 
-template<>
-bool FVrmGlbAccessorReader::DecodeElement<FVector2f>(int32 ComponentType, int32 ComponentCount, const uint8* Data, FVector2f& OutElement)
-{
-    if (ComponentCount != 2 || ComponentType != 5126) // FLOAT
+    int32 ComponentCount = Accessor.GetComponentCount();
+    if (ComponentCount == 0)
     {
+        OutResult.bSuccess = false;
+        OutResult.ErrorMessage = TEXT("Accessor missing or unsupported type");
         return false;
     }
 
-    const float* FloatData = reinterpret_cast<const float*>(Data);
-    OutElement.X = FloatData[0];
-    OutElement.Y = FloatData[1];
+    if (!TGltfAccessorView<T>::SupportsFormat(ComponentType, ComponentCount))
+    {
+        OutResult.bSuccess = false;
+        OutResult.ErrorMessage = FString::Printf(TEXT("Unsupported accessor format: componentType %d with %d components"), ComponentType, ComponentCount);
+        return false;
+    }
 
     return true;
 }
 
-template<>
-bool FVrmGlbAccessorReader::DecodeElement<FVector4f>(int32 ComponentType, int32 ComponentCount, const uint8* Data, FVector4f& OutElement)
+template<typename T>
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::MakeAccessorView(
+    const FVrmGltfModel& Model,
+    const FVrmGltfAccessor& Accessor,
+    TGltfAccessorView<T>& OutView) const
 {
-    if (ComponentCount != 4 || ComponentType != 5126) // FLOAT
+    FDecodeResult Result;
+
+    if (!CheckAccessorFormat<T>(Accessor, Result))
     {
-        return false;
+        return Result;
     }
 
-    const float* FloatData = reinterpret_cast<const float*>(Data);
-    OutElement.X = FloatData[0];
-    OutElement.Y = FloatData[1];
-    OutElement.Z = FloatData[2];
-    OutElement.W = FloatData[3];
+    // Get accessor properties
+    if (Accessor.BufferView < 0)
+    {
+        Result.bSuccess = false;
+        Result.ErrorMessage = TEXT("Accessor missing bufferView");
+        return Result;
+    }
 
-    return true;
+    return MakeBufferView(Model, Accessor.BufferView, Accessor.ByteOffset, Accessor.ComponentType, Accessor.GetComponentCount(), Accessor.bNormalized, Accessor.Count, OutView);
 }
 
-template<>
-bool FVrmGlbAccessorReader::DecodeElement<FIntVector4>(int32 ComponentType, int32 ComponentCount, const uint8* Data, FIntVector4& OutElement)
+template<typename T>
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::MakeSparseAccessorView(
+    const FVrmGltfModel& Model,
+    const FVrmGltfAccessor& Accessor,
+    TGltfSparseAccessorView<T>& OutView) const
 {
-    if (ComponentCount != 4)
+    FDecodeResult Result;
+    OutView = TGltfSparseAccessorView<T>();
+
+    if (!CheckAccessorFormat<T>(Accessor, Result))
     {
-        return false;
+        return Result;
     }
 
-    if (ComponentType == 5121) // UNSIGNED_BYTE
+    const FVrmGltfAccessorSparse& Sparse = Accessor.Sparse;
+    if (Sparse.Count > Accessor.Count)
     {
-        const uint8* ByteData = Data;
-        OutElement.X = ByteData[0];
-        OutElement.Y = ByteData[1];
-        OutElement.Z = ByteData[2];
-        OutElement.W = ByteData[3];
+        Result.bSuccess = false;
+        Result.ErrorMessage = FString::Printf(TEXT("Sparse count (%d) exceeds accessor count (%d)"), Sparse.Count, Accessor.Count);
+        return Result;
     }
-    else if (ComponentType == 5123) // UNSIGNED_SHORT
+
+    // Base values are optional: without a bufferView every element starts at zero
+    if (Accessor.BufferView >= 0)
     {
-        const uint16* ShortData = reinterpret_cast<const uint16*>(Data);
-        OutElement.X = ShortData[0];
-        OutElement.Y = ShortData[1];
-        OutElement.Z = ShortData[2];
-        OutElement.W = ShortData[3];
+        Result = MakeBufferView(Model, Accessor.BufferView, Accessor.ByteOffset, Accessor.ComponentType, Accessor.GetComponentCount(), Accessor.bNormalized, Accessor.Count, OutView.Base);
+        if (!Result.bSuccess)
+        {
+            return Result;
+        }
     }
-    else
+
+    if (!TGltfAccessorView<uint32>::SupportsFormat(Sparse.IndicesComponentType, 1))
     {
-        return false; // Unsupported component type for joints
+        Result.bSuccess = false;
+        Result.ErrorMessage = FString::Printf(TEXT("Unsupported sparse indices componentType: %d"), Sparse.IndicesComponentType);
+        return Result;
     }
 
-    return true;
+    Result = MakeBufferView(Model, Sparse.IndicesBufferView, Sparse.IndicesByteOffset, Sparse.IndicesComponentType, 1, false, Sparse.Count, OutView.Indices);
+    if (!Result.bSuccess)
+    {
+        Result.ErrorMessage = FString::Printf(TEXT("Sparse indices: %s"), *Result.ErrorMessage);
+        return Result;
+    }
+
+    Result = MakeBufferView(Model, Sparse.ValuesBufferView, Sparse.ValuesByteOffset, Accessor.ComponentType, Accessor.GetComponentCount(), Accessor.bNormalized, Sparse.Count, OutView.Values);
+    if (!Result.bSuccess)
+    {
+        Result.ErrorMessage = FString::Printf(TEXT("Sparse values: %s"), *Result.ErrorMessage);
+        return Result;
+    }
+
+    // Consumers merge in one forward pass, which needs strictly increasing in-range indices
+    int64 Previous = -1;
+    for (const uint32 Index : OutView.Indices)
+    {
+        if (static_cast<int64>(Index) <= Previous || Index >= static_cast<uint32>(Accessor.Count))
+        {
+            OutView = TGltfSparseAccessorView<T>();
+            Result.bSuccess = false;
+            Result.ErrorMessage = FString::Printf(TEXT("Sparse index %u is out of order or out of range"), Index);
+            return Result;
+        }
+        Previous = Index;
+    }
+
+    OutView.Count = Accessor.Count;
+    Result.bSuccess = true;
+    return Result;
 }
 
-template<>
-bool FVrmGlbAccessorReader::DecodeElement<uint32>(int32 ComponentType, int32 ComponentCount, const uint8* Data, uint32& OutElement)
+template<typename T>
+FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::MakeBufferView(
+    const FVrmGltfModel& Model,
+    int32 BufferViewIndex,
+    int64 ByteOffset,
+    int32 ComponentType,
+    int32 ComponentCount,
+    bool bNormalized,
+    int32 Count,
+    TGltfAccessorView<T>& OutView) const
 {
-    if (ComponentCount != 1)
+    FDecodeResult Result;
+
+    // Get buffer view
+    if (!Model.IsValidBufferView(BufferViewIndex))
     {
-        return false;
+        Result.bSuccess = false;
+        Result.ErrorMessage = FString::Printf(TEXT("BufferView index %d out of range"), BufferViewIndex);
+        return Result;
     }
 
-    if (ComponentType == 5123) // UNSIGNED_SHORT
+    const FVrmGltfBufferView& BufferView = Model.BufferViews[BufferViewIndex];
+
+    // Compressed views read from their decompressed copy in the arena, the rest straight from their buffer
+    TConstArrayView<uint8> Source = Document->GetBufferData(BufferView.Buffer);
+    int64 ViewOffset = BufferView.ByteOffset;
+    if (BufferView.IsCompressed())
     {
-        const uint16* ShortData = reinterpret_cast<const uint16*>(Data);
-        OutElement = *ShortData;
+        if (!DecompressedViewOffsets.IsValidIndex(BufferViewIndex) || DecompressedViewOffsets[BufferViewIndex] == INDEX_NONE)
+        {
+            Result.bSuccess = false;
+            Result.ErrorMessage = FString::Printf(TEXT("Compressed bufferView %d has not been decompressed"), BufferViewIndex);
+            return Result;
+        }
+        Source = TConstArrayView<uint8>(DecompressedArena.GetData() + DecompressedViewOffsets[BufferViewIndex], BufferView.ByteLength);
+        ViewOffset = 0;
     }
-    else if (ComponentType == 5125) // UNSIGNED_INT
+    else if (Source.Num() == 0)
     {
-        const uint32* IntData = reinterpret_cast<const uint32*>(Data);
-        OutElement = *IntData;
+        Result.bSuccess = false;
+        Result.ErrorMessage = FString::Printf(TEXT("Buffer %d has no data (missing file or unsupported URI)"), BufferView.Buffer);
+        return Result;
     }
-    else
+
+    // The model rejects these when parsing JSON; a model built in code must not reach the pointer math below
+    if (ByteOffset < 0 || ViewOffset < 0 || BufferView.ByteLength < 0 || Count < 0)
     {
-        return false; // Unsupported component type for indices
+        Result.bSuccess = false;
+        Result.ErrorMessage = FString::Printf(TEXT("Negative offset, length or count (byteOffset %lld, bufferView %d byteOffset %lld, byteLength %lld, count %d)"),
+            ByteOffset, BufferViewIndex, ViewOffset, BufferView.ByteLength, Count);
+        return Result;
     }
 
-    return true;
-}
+    int32 ElementSize = EVrmGltfComponentType::GetSize(ComponentType) * ComponentCount;
+    int32 Stride = (BufferView.ByteStride > 0) ? BufferView.ByteStride : ElementSize;
+    int64 TotalOffset = ViewOffset + ByteOffset;
 
-int32 FVrmGlbAccessorReader::GetComponentTypeSize(int32 ComponentType)
-{
-    switch (ComponentType)
-    {
-    case 5120: // BYTE
-    case 5121: // UNSIGNED_BYTE
-        return 1;
-    case 5122: // SHORT
-    case 5123: // UNSIGNED_SHORT
-        return 2;
-    case 5125: // UNSIGNED_INT
-    case 5126: // FLOAT
-        return 4;
-    default:
-        return 0;
+    if (Stride < ElementSize)
+    {
+        Result.bSuccess = false;
+        Result.ErrorMessage = FString::Printf(TEXT("byteStride (%d) is smaller than the element size (%d)"), Stride, ElementSize);
+        return Result;
     }
+
+    // The last element only needs its own bytes, not a whole stride: interleaved attributes end before the view does
+    const int64 AccessorSize = Count > 0 ? (int64)(Count - 1) * Stride + ElementSize : 0;
+    if (ByteOffset + AccessorSize > BufferView.ByteLength)
+    {
+        Result.bSuccess = false;
+        Result.ErrorMessage = FString::Printf(TEXT("Accessor data exceeds bufferView %d length: %lld > %lld"), BufferViewIndex, ByteOffset + AccessorSize, BufferView.ByteLength);
+        return Result;
+    }
+
+    // Validate bounds
+    int64 RequiredSize = TotalOffset + AccessorSize;
+    if (RequiredSize > Source.Num())
+    {
+        Result.bSuccess = false;
+        Result.ErrorMessage = BufferView.IsCompressed()
+            ? FString::Printf(TEXT("Accessor data exceeds decompressed bufferView size: %lld > %d"), RequiredSize, Source.Num())
+            : FString::Printf(TEXT("Accessor data exceeds buffer %d size: %lld > %d"), BufferView.Buffer, RequiredSize, Source.Num());
+        return Result;
+    }
+
+    // No copy: elements are converted when the consumer reads them
+    OutView = TGltfAccessorView<T>(Source.GetData() + TotalOffset, Stride, Count, ComponentType, bNormalized);
+
+    Result.bSuccess = true;
+    return Result;
 }
 
-int32 FVrmGlbAccessorReader::GetTypeComponentCount(const FString& TypeString)
-{
-    if (TypeString == TEXT("SCALAR")) return 1;
-    if (TypeString == TEXT("VEC2")) return 2;
-    if (TypeString == TEXT("VEC3")) return 3;
-    if (TypeString == TEXT("VEC4")) return 4;
-    return 0;
-}
\ No newline at end of file
+// Morph targets and other delta consumers may read any supported attribute type
+template FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::GetSparseAccessorView<FVector3f>(int32, TGltfSparseAccessorView<FVector3f>&) const;
+template FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::GetSparseAccessorView<FVector2f>(int32, TGltfSparseAccessorView<FVector2f>&) const;
+template FVrmGlbAccessorReader::FDecodeResult FVrmGlbAccessorReader::GetSparseAccessorView<FVector4f>(int32, TGltfSparseAccessorView<FVector4f>&) const;
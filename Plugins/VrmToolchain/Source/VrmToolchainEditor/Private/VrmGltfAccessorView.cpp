@@ -0,0 +1,72 @@
+#include "VrmGltfAccessorView.h"
+#include "VrmAccessorKernels.h"
+
+// Bulk conversions used by TGltfAccessorView::CopyTo. Formats were checked with Supports() when the view was made.
+
+void TGltfAccessorElement<FVector3f>::LoadRun(const uint8* Data, int32 Stride, int32 Count, int32 ComponentType, bool bNormalized, FVector3f* OutElements)
+{
+    if (ComponentType == EVrmGltfComponentType::Float)
+    {
+        VrmAccessorKernels::DecodeFloat3SwapYZ(Data, Stride, Count, OutElements);
+        return;
+    }
+
+    // Quantized positions/normals: dequantize and convert axes in the same pass
+    VrmAccessorKernels::DequantizeToFloat(Data, Stride, ComponentType, bNormalized, 3, true, Count, reinterpret_cast<float*>(OutElements));
+}
+
+void TGltfAccessorElement<FVector2f>::LoadRun(const uint8* Data, int32 Stride, int32 Count, int32 ComponentType, bool bNormalized, FVector2f* OutElements)
+{
+    if (ComponentType == EVrmGltfComponentType::Float)
+    {
+        // No conversion: a tightly packed stream is a single memcpy
+        VrmAccessorKernels::CopyElements(Data, Stride, sizeof(FVector2f), Count, OutElements);
+        return;
+    }
+
+    VrmAccessorKernels::DequantizeToFloat(Data, Stride, ComponentType, bNormalized, 2, false, Count, reinterpret_cast<float*>(OutElements));
+}
+
+void TGltfAccessorElement<FVector4f>::LoadRun(const uint8* Data, int32 Stride, int32 Count, int32 ComponentType, bool bNormalized, FVector4f* OutElements)
+{
+    if (ComponentType == EVrmGltfComponentType::Float)
+    {
+        VrmAccessorKernels::CopyElements(Data, Stride, sizeof(FVector4f), Count, OutElements);
+        return;
+    }
+
+    // Normalized UNSIGNED_BYTE/UNSIGNED_SHORT weights and colors
+    VrmAccessorKernels::DequantizeToFloat(Data, Stride, ComponentType, bNormalized, 4, false, Count, reinterpret_cast<float*>(OutElements));
+}
+
+void TGltfAccessorElement<FIntVector4>::LoadRun(const uint8* Data, int32 Stride, int32 Count, int32 ComponentType, bool bNormalized, FIntVector4* OutElements)
+{
+    // Joint indices are small and non-negative, so widening to uint32 lanes fills the int32 components
+    static_assert(sizeof(FIntVector4) == 4 * sizeof(uint32), "FIntVector4 must be four packed 32-bit lanes");
+    uint32* Lanes = reinterpret_cast<uint32*>(OutElements);
+
+    if (ComponentType == EVrmGltfComponentType::UnsignedByte)
+    {
+        VrmAccessorKernels::WidenU8ToU32(Data, Stride, 4, Count, Lanes);
+    }
+    else
+    {
+        VrmAccessorKernels::WidenU16ToU32(Data, Stride, 4, Count, Lanes);
+    }
+}
+
+void TGltfAccessorElement<uint32>::LoadRun(const uint8* Data, int32 Stride, int32 Count, int32 ComponentType, bool bNormalized, uint32* OutElements)
+{
+    if (ComponentType == EVrmGltfComponentType::UnsignedByte)
+    {
+        VrmAccessorKernels::WidenU8ToU32(Data, Stride, 1, Count, OutElements);
+    }
+    else if (ComponentType == EVrmGltfComponentType::UnsignedShort)
+    {
+        VrmAccessorKernels::WidenU16ToU32(Data, Stride, 1, Count, OutElements);
+    }
+    else
+    {
+        VrmAccessorKernels::CopyElements(Data, Stride, sizeof(uint32), Count, OutElements);
+    }
+}
@@ -1,38 +1,21 @@
 #include "VrmGltfParser.h"
-#include "VrmToolchain/VrmMetadata.h" // for ReadGlbJsonChunk
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
+#include "VrmToolchainEditor.h"
+#include "VrmToolchain/VrmGlbDocument.h"
+#include "VrmToolchain/VrmJsonDom.h"
+#include "VrmToolchain/VrmGltfModel.h"
 #include "Containers/Set.h"
 #include "Containers/Map.h"
 
-bool FVrmGltfParser::TryExtractSkin0Joints(const TSharedPtr<FJsonObject>& Root, TArray<int32>& OutJoints)
+bool FVrmGltfParser::TryExtractSkin0Joints(const FVrmGltfModel& Model, TArray<int32>& OutJoints)
 {
 	OutJoints.Reset();
 
-	const TArray<TSharedPtr<FJsonValue>>* Skins = nullptr;
-	if (!Root->TryGetArrayField(TEXT("skins"), Skins) || !Skins || Skins->Num() == 0)
+	if (Model.Skins.Num() == 0)
 	{
 		return false;
 	}
 
-	const TSharedPtr<FJsonObject> Skin0 = (*Skins)[0]->AsObject();
-	if (!Skin0.IsValid())
-	{
-		return false;
-	}
-
-	const TArray<TSharedPtr<FJsonValue>>* Joints = nullptr;
-	if (!Skin0->TryGetArrayField(TEXT("joints"), Joints) || !Joints || Joints->Num() == 0)
-	{
-		return false;
-	}
-
-	for (const TSharedPtr<FJsonValue>& V : *Joints)
-	{
-		// glTF joints are integer indices but appear as JSON numbers
-		OutJoints.Add((int32)V->AsNumber());
-	}
-
+	OutJoints.Append(Model.GetJoints(Model.Skins[0]));
 	return OutJoints.Num() > 0;
 }
 
@@ -91,64 +74,98 @@ static bool OrderKeptNodesParentFirst(const TSet<int32>& KeepNodes, const TArray
 	return Remaining.Num() == 0;
 }
 
+// The skeleton needs a parsed root with a 'nodes' array; an empty array yields an empty skeleton
+static bool ValidateGltfRoot(const FVrmJsonValue& Root, FString& OutError)
+{
+	if (!Root.IsObject())
+	{
+		OutError = TEXT("Failed to parse JSON");
+		return false;
+	}
+
+	const FVrmJsonValue* Nodes = Root.Find("nodes");
+	if (!Nodes || !Nodes->IsArray())
+	{
+		OutError = TEXT("No 'nodes' array in GLTF JSON");
+		return false;
+	}
+
+	return true;
+}
+
 bool FVrmGltfParser::ExtractSkeletonFromGltfJsonString(const FString& JsonString, FVrmGltfSkeleton& OutSkeleton, FString& OutError)
 {
 	OutSkeleton.Bones.Reset();
 	OutError.Reset();
 
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-	TSharedPtr<FJsonObject> Root;
-	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	const FTCHARToUTF8 Utf8(*JsonString, JsonString.Len());
+	FVrmJsonDom Json;
+	FString ParseError;
+	if (!Json.Parse(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()), ParseError))
 	{
 		OutError = TEXT("Failed to parse JSON");
 		return false;
 	}
 
-	// GLTF nodes array
-	const TArray<TSharedPtr<FJsonValue>>* NodesArray = nullptr;
-	if (!Root->TryGetArrayField(TEXT("nodes"), NodesArray) || !NodesArray)
+	return ExtractSkeletonFromGltfJson(Json.GetRoot(), OutSkeleton, OutError);
+}
+
+bool FVrmGltfParser::ExtractSkeletonFromGltfJson(const FVrmJsonValue& Root, FVrmGltfSkeleton& OutSkeleton, FString& OutError)
+{
+	OutSkeleton.Bones.Reset();
+	OutError.Reset();
+
+	if (!ValidateGltfRoot(Root, OutError))
 	{
-		OutError = TEXT("No 'nodes' array in GLTF JSON");
 		return false;
 	}
 
-	// Build mapping from node index -> parent index by inspecting children
+	FVrmGltfModel Model;
+	if (!Model.Build(Root, OutError))
+	{
+		return false;
+	}
+	return ExtractSkeletonFromGltfModel(Model, OutSkeleton, OutError);
+}
+
+bool FVrmGltfParser::ExtractSkeletonFromGltfModel(const FVrmGltfModel& Model, FVrmGltfSkeleton& OutSkeleton, FString& OutError)
+{
+	OutSkeleton.Bones.Reset();
+	OutError.Reset();
+
+	// Node index -> parent index (resolved from the children lists when the model was built)
 	TArray<int32> ParentMap;
-	ParentMap.Init(INDEX_NONE, NodesArray->Num());
+	ParentMap.Reserve(Model.Nodes.Num());
+	for (const FVrmGltfNode& Node : Model.Nodes)
+	{
+		ParentMap.Add(Node.Parent);
+	}
 
-	for (int32 i = 0; i < NodesArray->Num(); ++i)
+	// B1.2: If any skin has joints, filter to the joints of every skin and the nodes of rigid meshes
+	// (the bones those meshes follow), plus ancestors; otherwise keep all nodes.
+	TSet<int32> KeepNodes;
 	{
-		const TSharedPtr<FJsonObject> Obj = (*NodesArray)[i]->AsObject();
-		if (!Obj.IsValid())
+		TArray<int32> Joints;
+		for (const FVrmGltfSkin& Skin : Model.Skins)
 		{
-			continue;
+			Joints.Append(Model.GetJoints(Skin));
 		}
 
-		const TArray<TSharedPtr<FJsonValue>>* Children = nullptr;
-		if (Obj->TryGetArrayField(TEXT("children"), Children) && Children)
+		if (Joints.Num() > 0)
 		{
-			for (const TSharedPtr<FJsonValue>& ChildVal : *Children)
+			for (int32 NodeIdx = 0; NodeIdx < Model.Nodes.Num(); ++NodeIdx)
 			{
-				const int32 ChildIndex = (int32)ChildVal->AsNumber();
-				if (ChildIndex >= 0 && ChildIndex < ParentMap.Num())
+				const FVrmGltfNode& Node = Model.Nodes[NodeIdx];
+				if (Model.Meshes.IsValidIndex(Node.Mesh) && Node.Skin == INDEX_NONE)
 				{
-					ParentMap[ChildIndex] = i;
+					Joints.Add(NodeIdx);
 				}
 			}
-		}
-	}
-
-	// B1.2: If skins[0].joints exists, filter to joints + ancestors; otherwise keep all nodes.
-	TSet<int32> KeepNodes;
-	{
-		TArray<int32> Joints;
-		if (TryExtractSkin0Joints(Root, Joints))
-		{
 			AddAncestorsClosure(ParentMap, Joints, KeepNodes);
 		}
 		else
 		{
-			for (int32 i = 0; i < NodesArray->Num(); ++i)
+			for (int32 i = 0; i < Model.Nodes.Num(); ++i)
 			{
 				KeepNodes.Add(i);
 			}
@@ -176,19 +193,13 @@ bool FVrmGltfParser::ExtractSkeletonFromGltfJsonString(const FString& JsonString
 	for (int32 OrderedIdx = 0; OrderedIdx < OrderedNodes.Num(); ++OrderedIdx)
 	{
 		const int32 NodeIdx = OrderedNodes[OrderedIdx];
-		const TSharedPtr<FJsonObject> Obj = (*NodesArray)[NodeIdx]->AsObject();
-		if (!Obj.IsValid())
-		{
-			continue;
-		}
+		const FVrmGltfNode& Node = Model.Nodes[NodeIdx];
 
 		FVrmGltfBone Bone;
 		Bone.GltfNodeIndex = NodeIdx;
 
 		// name
-		FString NameStr;
-		Obj->TryGetStringField(TEXT("name"), NameStr);
-		Bone.Name = NameStr.IsEmpty() ? FName(*FString::Printf(TEXT("node_%d"), NodeIdx)) : FName(*NameStr);
+		Bone.Name = Node.Name.IsEmpty() ? FName(*FString::Printf(TEXT("node_%d"), NodeIdx)) : FName(*Node.Name);
 
 		// remapped parent index (bone index)
 		const int32 ParentNode = ParentMap.IsValidIndex(NodeIdx) ? ParentMap[NodeIdx] : INDEX_NONE;
@@ -196,51 +207,123 @@ bool FVrmGltfParser::ExtractSkeletonFromGltfJsonString(const FString& JsonString
 
 		// transforms (keep your existing behavior)
 		FTransform T = FTransform::Identity;
-		const TArray<TSharedPtr<FJsonValue>>* Matrix = nullptr;
-		if (Obj->TryGetArrayField(TEXT("matrix"), Matrix) && Matrix && Matrix->Num() == 16)
+		if (Node.bHasMatrix)
 		{
-			double M[16];
-			for (int32 m = 0; m < 16; ++m) M[m] = (*Matrix)[m]->AsNumber();
-
-			FVector Translation((float)M[12], (float)M[13], (float)M[14]);
-			T.SetTranslation(Translation);
+			const FVector Origin = Node.Matrix.GetOrigin();
+			T.SetTranslation(FVector((float)Origin.X, (float)Origin.Y, (float)Origin.Z));
 		}
 		else
 		{
-			const TArray<TSharedPtr<FJsonValue>>* Trans = nullptr;
-			if (Obj->TryGetArrayField(TEXT("translation"), Trans) && Trans && Trans->Num() == 3)
+			T.SetTranslation(FVector((float)Node.Translation.X, (float)Node.Translation.Y, (float)Node.Translation.Z));
+			T.SetRotation(FQuat((float)Node.Rotation.X, (float)Node.Rotation.Y, (float)Node.Rotation.Z, (float)Node.Rotation.W));
+			T.SetScale3D(FVector((float)Node.Scale.X, (float)Node.Scale.Y, (float)Node.Scale.Z));
+		}
+
+		Bone.LocalTransform = T;
+		OutSkeleton.Bones.Add(Bone);
+	}
+
+	return true;
+}
+
+bool FVrmGltfParser::ExtractMeshBinding(const FVrmGltfModel& Model, const FVrmGltfSkeleton& Skeleton, FVrmGltfMeshBinding& OutBinding, FString& OutError)
+{
+	OutBinding = FVrmGltfMeshBinding();
+	OutError.Reset();
+
+	TMap<int32, int32> NodeToBone;
+	for (int32 BoneIndex = 0; BoneIndex < Skeleton.Bones.Num(); ++BoneIndex)
+	{
+		NodeToBone.Add(Skeleton.Bones[BoneIndex].GltfNodeIndex, BoneIndex);
+	}
+
+	// One joint table per skin: JOINTS_n values are ordinals into the joints of the skin of the mesh's node
+	for (const FVrmGltfSkin& Skin : Model.Skins)
+	{
+		TMap<int32, int32>& JointToBone = OutBinding.SkinJointToBone.AddDefaulted_GetRef();
+		const TConstArrayView<int32> Joints = Model.GetJoints(Skin);
+		for (int32 JointOrdinal = 0; JointOrdinal < Joints.Num(); ++JointOrdinal)
+		{
+			if (const int32* BoneIndex = NodeToBone.Find(Joints[JointOrdinal]))
 			{
-				T.SetTranslation(FVector((float)(*Trans)[0]->AsNumber(), (float)(*Trans)[1]->AsNumber(), (float)(*Trans)[2]->AsNumber()));
+				JointToBone.Add(JointOrdinal, *BoneIndex);
 			}
-			const TArray<TSharedPtr<FJsonValue>>* Rot = nullptr;
-			if (Obj->TryGetArrayField(TEXT("rotation"), Rot) && Rot && Rot->Num() == 4)
+		}
+	}
+
+	// Meshes no node instances keep the first skin, as every mesh did before per-node binding
+	const int32 NumMeshes = Model.Meshes.Num();
+	OutBinding.MeshSkins.Init(Model.Skins.Num() > 0 ? 0 : INDEX_NONE, NumMeshes);
+	OutBinding.MeshRigidBones.Init(0, NumMeshes);
+	OutBinding.MeshRigidTransforms.Init(FMatrix44f::Identity, NumMeshes);
+
+	// glTF (x, y, z) is UE (x, z, -y): node transforms are conjugated into UE axes
+	const FMatrix ToUe(FPlane(1, 0, 0, 0), FPlane(0, 0, -1, 0), FPlane(0, 1, 0, 0), FPlane(0, 0, 0, 1));
+	const FMatrix FromUe = ToUe.GetTransposed();
+
+	TArray<int32> MeshNodes;
+	MeshNodes.Init(INDEX_NONE, NumMeshes);
+	for (int32 NodeIdx = 0; NodeIdx < Model.Nodes.Num(); ++NodeIdx)
+	{
+		const FVrmGltfNode& Node = Model.Nodes[NodeIdx];
+		if (!Model.Meshes.IsValidIndex(Node.Mesh))
+		{
+			continue;
+		}
+
+		const int32 Skin = Model.Skins.IsValidIndex(Node.Skin) ? Node.Skin : INDEX_NONE;
+		const int32 FirstNode = MeshNodes[Node.Mesh];
+		if (FirstNode != INDEX_NONE)
+		{
+			if (OutBinding.MeshSkins[Node.Mesh] != Skin)
 			{
-				FQuat Q((float)(*Rot)[0]->AsNumber(), (float)(*Rot)[1]->AsNumber(), (float)(*Rot)[2]->AsNumber(), (float)(*Rot)[3]->AsNumber());
-				T.SetRotation(Q);
+				OutError = FString::Printf(TEXT("Mesh %d is instanced under conflicting skins (node %d, node %d)"), Node.Mesh, FirstNode, NodeIdx);
+				return false;
 			}
-			const TArray<TSharedPtr<FJsonValue>>* Scale = nullptr;
-			if (Obj->TryGetArrayField(TEXT("scale"), Scale) && Scale && Scale->Num() == 3)
+			if (Skin == INDEX_NONE)
 			{
-				T.SetScale3D(FVector((float)(*Scale)[0]->AsNumber(), (float)(*Scale)[1]->AsNumber(), (float)(*Scale)[2]->AsNumber()));
+				UE_LOG(LogVrmToolchainEditor, Warning, TEXT("Rigid mesh %d is instanced by several nodes; only node %d is placed"), Node.Mesh, FirstNode);
 			}
+			continue;
 		}
 
-		Bone.LocalTransform = T;
-		OutSkeleton.Bones.Add(Bone);
+		MeshNodes[Node.Mesh] = NodeIdx;
+		OutBinding.MeshSkins[Node.Mesh] = Skin;
+
+		// Skinned vertices are posed by their joints alone: glTF ignores the transform of a skinned mesh's node
+		if (const int32* BoneIndex = NodeToBone.Find(NodeIdx))
+		{
+			OutBinding.MeshRigidBones[Node.Mesh] = *BoneIndex;
+		}
+		if (Skin == INDEX_NONE)
+		{
+			OutBinding.MeshRigidTransforms[Node.Mesh] = FMatrix44f(FromUe * Model.GetWorldMatrix(NodeIdx) * ToUe);
+		}
 	}
 
 	return true;
 }
 
+bool FVrmGltfParser::ExtractSkeletonFromGlbDocument(const FVrmGlbDocument& Document, FVrmGltfSkeleton& OutSkeleton, FString& OutError)
+{
+	OutSkeleton.Bones.Reset();
+	if (!ValidateGltfRoot(Document.GetJsonRoot(), OutError))
+	{
+		return false;
+	}
+
+	return ExtractSkeletonFromGltfModel(Document.GetModel(), OutSkeleton, OutError);
+}
+
 bool FVrmGltfParser::ExtractSkeletonFromGlbFile(const FString& FilePath, FVrmGltfSkeleton& OutSkeleton, FString& OutError)
 {
     OutError.Reset();
-    FString JsonChunk;
-    if (!FVrmParser::ReadGlbJsonChunk(FilePath, JsonChunk))
+    const TSharedPtr<FVrmGlbDocument> Document = FVrmGlbDocument::LoadFromFile(FilePath, OutError);
+    if (!Document.IsValid())
     {
-        OutError = TEXT("Failed to extract JSON chunk from GLB");
+        OutError = FString::Printf(TEXT("Failed to extract JSON chunk from GLB: %s"), *OutError);
         return false;
     }
 
-    return ExtractSkeletonFromGltfJsonString(JsonChunk, OutSkeleton, OutError);
+    return ExtractSkeletonFromGlbDocument(*Document, OutSkeleton, OutError);
 }
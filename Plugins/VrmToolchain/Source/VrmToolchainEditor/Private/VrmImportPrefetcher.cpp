@@ -0,0 +1,274 @@
+#include "VrmImportPrefetcher.h"
+#include "VrmImportSettings.h"
+#include "VrmToolchainEditor.h"
+#include "Async/AsyncFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ContentBrowserModule.h"
+#include "Input/DragAndDrop.h"
+
+static FDelegateHandle GVrmPrefetchDropHandle;
+
+FVrmImportPrefetcher::~FVrmImportPrefetcher()
+{
+	Reset();
+}
+
+FVrmImportPrefetcher& FVrmImportPrefetcher::Get()
+{
+	static FVrmImportPrefetcher Instance;
+	return Instance;
+}
+
+void FVrmImportPrefetcher::SetLimits(int32 InMaxFiles, int64 InMaxBytes)
+{
+	MaxFiles = FMath::Max(InMaxFiles, 0);
+	MaxBytes = FMath::Max<int64>(InMaxBytes, 0);
+}
+
+void FVrmImportPrefetcher::Enqueue(TConstArrayView<FString> FilePaths)
+{
+	Reset();
+	Pending = TArray<FString>(FilePaths.GetData(), FilePaths.Num());
+	LastUseTime = FPlatformTime::Seconds();
+	Pump();
+	ScheduleExpiry();
+
+	UE_LOG(LogVrmToolchainEditor, Verbose, TEXT("VRM import read-ahead: %d file(s) queued, %d read(s) started"), Pending.Num() + Active.Num(), Active.Num());
+}
+
+bool FVrmImportPrefetcher::Acquire(const FString& FilePath, TArray<uint8>& OutBytes, FString& OutError)
+{
+	OutError.Reset();
+	LastUseTime = FPlatformTime::Seconds();
+
+	const int32 ActiveIndex = Active.IndexOfByPredicate([&FilePath](const TUniquePtr<FRead>& Read) { return FPaths::IsSamePath(Read->FilePath, FilePath); });
+	if (ActiveIndex != INDEX_NONE)
+	{
+		// Reads queued ahead of this one belong to files the importer skipped
+		for (int32 Index = 0; Index < ActiveIndex; ++Index)
+		{
+			// The reservation is the buffer size, which cancelling empties: release it first
+			ActiveBytes -= Active[Index]->Bytes.Num();
+			Finish(*Active[Index], true);
+		}
+		TUniquePtr<FRead> Read = MoveTemp(Active[ActiveIndex]);
+		Active.RemoveAt(0, ActiveIndex + 1, EAllowShrinking::No);
+		ActiveBytes -= Read->Bytes.Num();
+
+		Finish(*Read, false);
+		if (Read->Bytes.Num() > 0 && IsUnchanged(*Read))
+		{
+			OutBytes = MoveTemp(Read->Bytes);
+			Pump();
+			return true;
+		}
+
+		// The async read failed or the file was rewritten since; the synchronous read below reads it as it is now
+	}
+	else
+	{
+		// Not read ahead yet: drop everything queued before it and read it now
+		const int32 PendingIndex = Pending.IndexOfByPredicate([&FilePath](const FString& Path) { return FPaths::IsSamePath(Path, FilePath); });
+		if (PendingIndex != INDEX_NONE)
+		{
+			for (const TUniquePtr<FRead>& Read : Active)
+			{
+				Finish(*Read, true);
+			}
+			Active.Reset();
+			ActiveBytes = 0;
+			Pending.RemoveAt(0, PendingIndex + 1, EAllowShrinking::No);
+		}
+	}
+
+	// Start the next reads before blocking on this one, so they overlap
+	Pump();
+
+	if (!FFileHelper::LoadFileToArray(OutBytes, *FilePath))
+	{
+		OutError = FString::Printf(TEXT("Failed to read file: %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+void FVrmImportPrefetcher::Reset()
+{
+	for (const TUniquePtr<FRead>& Read : Active)
+	{
+		Finish(*Read, true);
+	}
+	Active.Reset();
+	ActiveBytes = 0;
+	Pending.Reset();
+
+	if (ExpiryHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ExpiryHandle);
+		ExpiryHandle.Reset();
+	}
+}
+
+void FVrmImportPrefetcher::Pump()
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	while (Pending.Num() > 0 && Active.Num() < MaxFiles)
+	{
+		const FFileStatData Stat = PlatformFile.GetStatData(*Pending[0]);
+		const int64 FileSize = Stat.bIsValid && !Stat.bIsDirectory ? Stat.FileSize : -1;
+		if (FileSize <= 0 || FileSize > FMath::Min<int64>(MaxBytes, MAX_int32))
+		{
+			// Missing, empty or over the cap by itself: leave it to the synchronous path
+			Pending.RemoveAt(0, EAllowShrinking::No);
+			continue;
+		}
+
+		if (ActiveBytes + FileSize > MaxBytes)
+		{
+			// Wait for earlier files to be acquired before holding more memory
+			break;
+		}
+
+		TUniquePtr<FRead> Read = MakeUnique<FRead>();
+		Read->FilePath = Pending[0];
+		Read->FileSize = FileSize;
+		Read->ModificationTime = Stat.ModificationTime;
+		Read->Handle.Reset(PlatformFile.OpenAsyncRead(*Read->FilePath));
+		if (Read->Handle.IsValid())
+		{
+			// Read straight into the buffer the factory will take ownership of
+			Read->Bytes.SetNumUninitialized(static_cast<int32>(FileSize));
+			Read->Request.Reset(Read->Handle->ReadRequest(0, FileSize, AIOP_Normal, nullptr, Read->Bytes.GetData()));
+		}
+		Pending.RemoveAt(0, EAllowShrinking::No);
+
+		if (!Read->Request.IsValid())
+		{
+			Finish(*Read, true);
+			continue;
+		}
+
+		ActiveBytes += Read->Bytes.Num();
+		Active.Add(MoveTemp(Read));
+	}
+}
+
+void FVrmImportPrefetcher::Finish(FRead& Read, bool bCancel)
+{
+	if (Read.Request.IsValid())
+	{
+		if (bCancel)
+		{
+			Read.Request->Cancel();
+		}
+		Read.Request->WaitCompletion();
+
+		// With caller-supplied memory the result is that same buffer; null means the read failed
+		if (bCancel || Read.Request->GetReadResults() == nullptr)
+		{
+			Read.Bytes.Empty();
+		}
+		Read.Request.Reset();
+	}
+	else
+	{
+		Read.Bytes.Empty();
+	}
+
+	// Requests must be destroyed before the handle that issued them
+	Read.Handle.Reset();
+}
+
+bool FVrmImportPrefetcher::IsUnchanged(const FRead& Read)
+{
+	const FFileStatData Stat = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*Read.FilePath);
+	return Stat.bIsValid && Stat.FileSize == Read.FileSize && Stat.ModificationTime == Read.ModificationTime;
+}
+
+void FVrmImportPrefetcher::ScheduleExpiry()
+{
+	if (ExpiryHandle.IsValid() || (Active.IsEmpty() && Pending.IsEmpty()))
+	{
+		return;
+	}
+
+	// A drop that never reaches the factory (or an import that stops early) would otherwise hold its reads forever
+	ExpiryHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+	{
+		if (Active.IsEmpty() && Pending.IsEmpty())
+		{
+			ExpiryHandle.Reset();
+			return false;
+		}
+		if (FPlatformTime::Seconds() - LastUseTime < IdleExpirySeconds)
+		{
+			return true;
+		}
+
+		UE_LOG(LogVrmToolchainEditor, Verbose, TEXT("VRM import read-ahead: dropping %d unused read(s) after %.0fs idle"), Active.Num(), IdleExpirySeconds);
+		Reset();
+		return false;
+	}), 5.0f);
+}
+
+void FVrmImportPrefetcher::RegisterDropHook()
+{
+	FContentBrowserModule& ContentBrowserModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser"));
+
+	// Files dropped from the OS are imported in drop order; start reading them before the first factory call.
+	// Returning false leaves the drop to the default import handling.
+	FAssetViewDragAndDropExtender::FOnDropDelegate OnDrop = FAssetViewDragAndDropExtender::FOnDropDelegate::CreateLambda(
+		[](const FAssetViewDragAndDropExtender::FPayload& Payload)
+		{
+			if (!Payload.DragDropOp.IsValid() || !Payload.DragDropOp->IsOfType<FExternalDragOperation>())
+			{
+				return false;
+			}
+
+			const FExternalDragOperation& ExternalOp = static_cast<const FExternalDragOperation&>(*Payload.DragDropOp);
+			if (!ExternalOp.HasFiles())
+			{
+				return false;
+			}
+
+			TArray<FString> VrmFiles;
+			for (const FString& File : ExternalOp.GetFiles())
+			{
+				const FString Extension = FPaths::GetExtension(File).ToLower();
+				if (Extension == TEXT("vrm") || Extension == TEXT("glb") || Extension == TEXT("gltf"))
+				{
+					VrmFiles.Add(File);
+				}
+			}
+
+			if (VrmFiles.Num() > 1)
+			{
+				const UVrmImportSettings* Settings = GetDefault<UVrmImportSettings>();
+				FVrmImportPrefetcher& Prefetcher = FVrmImportPrefetcher::Get();
+				Prefetcher.SetLimits(Settings->ReadAheadDepth, static_cast<int64>(Settings->ReadAheadMemoryCapMB) * 1024 * 1024);
+				Prefetcher.Enqueue(VrmFiles);
+			}
+			return false;
+		});
+
+	GVrmPrefetchDropHandle = OnDrop.GetHandle();
+	ContentBrowserModule.GetAssetViewDragAndDropExtenders().Add(FAssetViewDragAndDropExtender(OnDrop));
+}
+
+void FVrmImportPrefetcher::UnregisterDropHook()
+{
+	if (GVrmPrefetchDropHandle.IsValid() && FModuleManager::Get().IsModuleLoaded(TEXT("ContentBrowser")))
+	{
+		FContentBrowserModule& ContentBrowserModule = FModuleManager::GetModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser"));
+		ContentBrowserModule.GetAssetViewDragAndDropExtenders().RemoveAll([](const FAssetViewDragAndDropExtender& Extender)
+		{
+			return Extender.OnDropDelegate.GetHandle() == GVrmPrefetchDropHandle;
+		});
+	}
+	GVrmPrefetchDropHandle.Reset();
+
+	Get().Reset();
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Templates/UniquePtr.h"
+
+class IAsyncReadFileHandle;
+class IAsyncReadRequest;
+
+/**
+ * Read-ahead stage for batch imports.
+ *
+ * Files are queued in import order. While file N is being parsed and built, the next files are
+ * read with IAsyncReadFileHandle straight into their destination buffers, so by the time the
+ * factory asks for file N+1 its bytes are usually already in memory. The number of files held
+ * and the bytes they occupy are both capped. Files that were never queued, or that exceed the
+ * memory cap on their own, are read synchronously on demand.
+ *
+ * A read-ahead is only handed out if the file's size and modification time still match those
+ * seen when its read started. Whatever the batch leaves unacquired is dropped when the factory
+ * cleans up after the batch, or after IdleExpirySeconds without an Acquire if it never runs.
+ *
+ * Game thread only.
+ */
+class FVrmImportPrefetcher
+{
+public:
+	FVrmImportPrefetcher() = default;
+	~FVrmImportPrefetcher();
+
+	FVrmImportPrefetcher(const FVrmImportPrefetcher&) = delete;
+	FVrmImportPrefetcher& operator=(const FVrmImportPrefetcher&) = delete;
+
+	/** Shared instance used by the import factory and the Content Browser drop hook */
+	static FVrmImportPrefetcher& Get();
+
+	/**
+	 * Sets the read-ahead limits
+	 * @param InMaxFiles Files read ahead at once (0 disables read-ahead)
+	 * @param InMaxBytes Bytes held by completed and in-flight reads
+	 */
+	void SetLimits(int32 InMaxFiles, int64 InMaxBytes);
+
+	/** Replaces the queue with a new batch (in import order) and starts reading its first files */
+	void Enqueue(TConstArrayView<FString> FilePaths);
+
+	/**
+	 * Returns the contents of a file, waiting for its read-ahead if one is in flight and reading
+	 * synchronously otherwise (or when the file changed since its read-ahead started). Queued files before it are dropped (the importer skipped them) and
+	 * the read-ahead window moves on before this returns, so the next reads overlap the caller's work.
+	 * @param FilePath File to read
+	 * @param OutBytes File contents
+	 * @param OutError Error description on failure
+	 */
+	bool Acquire(const FString& FilePath, TArray<uint8>& OutBytes, FString& OutError);
+
+	/** Cancels all reads and clears the queue */
+	void Reset();
+
+	/** Reads started and not yet acquired */
+	int32 GetNumActive() const { return Active.Num(); }
+
+	/** Bytes reserved by reads started and not yet acquired */
+	int64 GetActiveBytes() const { return ActiveBytes; }
+
+	/** Register/unregister the Content Browser external-drop hook that feeds Get() */
+	static void RegisterDropHook();
+	static void UnregisterDropHook();
+
+private:
+	struct FRead
+	{
+		FString FilePath;
+		int64 FileSize = 0;
+		FDateTime ModificationTime;
+		TArray<uint8> Bytes;
+		TUniquePtr<IAsyncReadFileHandle> Handle;
+		TUniquePtr<IAsyncReadRequest> Request;
+	};
+
+	/** Starts reads from the queue until a limit is reached */
+	void Pump();
+
+	/** Waits for (or cancels) the read and releases its handle */
+	void Finish(FRead& Read, bool bCancel);
+
+	/** Whether the file on disk still has the size and modification time its read started with */
+	static bool IsUnchanged(const FRead& Read);
+
+	/** Starts the ticker that resets a batch nobody acquires from */
+	void ScheduleExpiry();
+
+	/** Seconds without an Acquire after which the remaining reads are dropped */
+	static constexpr double IdleExpirySeconds = 60.0;
+
+	TArray<FString> Pending;
+	TArray<TUniquePtr<FRead>> Active;
+	int64 ActiveBytes = 0;
+	double LastUseTime = 0.0;
+	FTSTicker::FDelegateHandle ExpiryHandle;
+
+	int32 MaxFiles = 2;
+	int64 MaxBytes = 512ll * 1024 * 1024;
+};
@@ -0,0 +1,20 @@
+#include "VrmImportSettings.h"
+
+UVrmImportSettings::UVrmImportSettings()
+	: ReadAheadDepth(2)
+	, ReadAheadMemoryCapMB(512)
+	, bBuildFromMeshDescription(false)
+	, bUseDerivedDataCache(true)
+	, bWeldAndOptimizeMeshes(false)
+{
+}
+
+FName UVrmImportSettings::GetCategoryName() const
+{
+	return TEXT("Plugins");
+}
+
+FText UVrmImportSettings::GetSectionText() const
+{
+	return NSLOCTEXT("VrmToolchain", "VrmImportSettingsSection", "VRM Import");
+}
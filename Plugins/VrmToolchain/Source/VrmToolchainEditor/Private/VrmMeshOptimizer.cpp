@@ -0,0 +1,455 @@
+#include "VrmMeshOptimizer.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "Algo/StableSort.h"
+
+namespace VrmMeshOptimizer
+{
+	namespace
+	{
+		/** Vertices hashed per welding task */
+		constexpr int32 VerticesPerHashChunk = 16384;
+
+		/** Scoring of Forsyth's algorithm, with the constants of the original article */
+		constexpr float CacheDecayPower = 1.5f;
+		constexpr float LastTriangleScore = 0.75f;
+		constexpr float ValenceBoostScale = 2.0f;
+		constexpr float ValenceBoostPower = 0.5f;
+
+		/** FIFO cache simulated while clustering for overdraw */
+		constexpr int32 OverdrawCacheSize = 16;
+
+		uint64 HashVertex(const FVertexStreams& Streams, int32 Vertex)
+		{
+			uint64 Hash = 0;
+			for (const FVertexStreams::FStream& Stream : Streams.Streams)
+			{
+				Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Stream.Data + int64(Vertex) * Stream.Stride), Stream.Stride, Hash);
+			}
+			return Hash;
+		}
+
+		bool AreVerticesEqual(const FVertexStreams& Streams, int32 A, int32 B)
+		{
+			for (const FVertexStreams::FStream& Stream : Streams.Streams)
+			{
+				if (FMemory::Memcmp(Stream.Data + int64(A) * Stream.Stride, Stream.Data + int64(B) * Stream.Stride, Stream.Stride) != 0)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/** Stable LSD radix sort of 64-bit items by their upper 32 bits, 11 bits per pass */
+		void RadixSortByHighWord(TArray<uint64>& Items)
+		{
+			TArray<uint64> Scratch;
+			Scratch.SetNumUninitialized(Items.Num());
+			uint64* Src = Items.GetData();
+			uint64* Dst = Scratch.GetData();
+
+			for (int32 Shift = 32; Shift < 64; Shift += 11)
+			{
+				uint32 Offsets[2048] = {};
+				for (int32 Item = 0; Item < Items.Num(); ++Item)
+				{
+					++Offsets[(Src[Item] >> Shift) & 2047];
+				}
+
+				uint32 Sum = 0;
+				for (uint32& Offset : Offsets)
+				{
+					const uint32 Count = Offset;
+					Offset = Sum;
+					Sum += Count;
+				}
+
+				for (int32 Item = 0; Item < Items.Num(); ++Item)
+				{
+					Dst[Offsets[(Src[Item] >> Shift) & 2047]++] = Src[Item];
+				}
+				Swap(Src, Dst);
+			}
+
+			if (Src != Items.GetData())
+			{
+				FMemory::Memcpy(Items.GetData(), Src, Items.Num() * sizeof(uint64));
+			}
+		}
+
+		float GetVertexScore(int32 CachePosition, int32 RemainingValence)
+		{
+			// No triangle left to draw: the vertex must not attract any
+			if (RemainingValence == 0)
+			{
+				return -1.0f;
+			}
+
+			float Score = 0.0f;
+			if (CachePosition >= 0)
+			{
+				// The last triangle's vertices score a fixed amount so the next one does not just reuse its edge
+				Score = CachePosition < 3
+					? LastTriangleScore
+					: FMath::Pow(1.0f - float(CachePosition - 3) / float(VertexCacheSize - 3), CacheDecayPower);
+			}
+
+			// Vertices with few triangles left are finished first so they leave the working set
+			return Score + ValenceBoostScale * FMath::Pow(float(RemainingValence), -ValenceBoostPower);
+		}
+
+		/** Cache misses of one triangle in a FIFO cache; Timestamps hold when each vertex entered the cache */
+		int32 UpdateCache(const uint32* Triangle, int32 CacheSize, TArray<uint32>& Timestamps, uint32& Timestamp)
+		{
+			int32 Misses = 0;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				uint32& Entered = Timestamps[Triangle[Corner]];
+				if (Timestamp - Entered > uint32(CacheSize))
+				{
+					Entered = Timestamp++;
+					++Misses;
+				}
+			}
+			return Misses;
+		}
+	}
+
+	int32 WeldVertices(int32 NumVertices, const FVertexStreams& Streams, TArray<uint32>& OutRemap)
+	{
+		OutRemap.SetNumUninitialized(NumVertices);
+
+		// (hash, vertex) pairs: hashing dominates and runs in parallel
+		TArray<uint64> Items;
+		Items.SetNumUninitialized(NumVertices);
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumVertices, VerticesPerHashChunk);
+		ParallelFor(NumChunks, [&Streams, &Items, NumVertices](int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumVertices, (Chunk + 1) * VerticesPerHashChunk);
+			for (int32 Vertex = Chunk * VerticesPerHashChunk; Vertex < End; ++Vertex)
+			{
+				const uint64 Hash = HashVertex(Streams, Vertex);
+				Items[Vertex] = (uint64(uint32(Hash ^ (Hash >> 32))) << 32) | uint32(Vertex);
+			}
+		});
+
+		RadixSortByHighWord(Items);
+
+		// The sort is stable, so each run of equal hashes lists its vertices in increasing order and the first
+		// vertex of every kind becomes its representative
+		int32 NumDistinct = 0;
+		for (int32 RunStart = 0; RunStart < NumVertices;)
+		{
+			const uint32 Hash = uint32(Items[RunStart] >> 32);
+			int32 RunEnd = RunStart + 1;
+			while (RunEnd < NumVertices && uint32(Items[RunEnd] >> 32) == Hash)
+			{
+				++RunEnd;
+			}
+
+			for (int32 Item = RunStart; Item < RunEnd; ++Item)
+			{
+				const uint32 Vertex = uint32(Items[Item]);
+				OutRemap[Vertex] = Vertex;
+				for (int32 Earlier = RunStart; Earlier < Item; ++Earlier)
+				{
+					const uint32 Candidate = uint32(Items[Earlier]);
+					if (OutRemap[Candidate] == Candidate && AreVerticesEqual(Streams, Candidate, Vertex))
+					{
+						OutRemap[Vertex] = Candidate;
+						break;
+					}
+				}
+				NumDistinct += OutRemap[Vertex] == Vertex ? 1 : 0;
+			}
+
+			RunStart = RunEnd;
+		}
+
+		return NumDistinct;
+	}
+
+	void OptimizeVertexCache(TArrayView<uint32> Indices, int32 NumVertices)
+	{
+		const int32 NumTriangles = Indices.Num() / 3;
+		if (NumTriangles < 2)
+		{
+			return;
+		}
+
+		// Triangles of every vertex; the ones not drawn yet are kept at the front of each vertex's range
+		TArray<int32> FirstTriangle;
+		FirstTriangle.SetNumZeroed(NumVertices + 1);
+		for (int32 Corner = 0; Corner < NumTriangles * 3; ++Corner)
+		{
+			++FirstTriangle[Indices[Corner] + 1];
+		}
+		for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			FirstTriangle[Vertex + 1] += FirstTriangle[Vertex];
+		}
+
+		TArray<int32> VertexTriangles;
+		VertexTriangles.SetNumUninitialized(NumTriangles * 3);
+		TArray<int32> Valence;
+		Valence.SetNumZeroed(NumVertices);
+		for (int32 Corner = 0; Corner < NumTriangles * 3; ++Corner)
+		{
+			const uint32 Vertex = Indices[Corner];
+			VertexTriangles[FirstTriangle[Vertex] + Valence[Vertex]++] = Corner / 3;
+		}
+
+		TArray<int32> CachePosition;
+		CachePosition.Init(INDEX_NONE, NumVertices);
+		TArray<float> VertexScores;
+		VertexScores.SetNumUninitialized(NumVertices);
+		for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			VertexScores[Vertex] = GetVertexScore(INDEX_NONE, Valence[Vertex]);
+		}
+
+		auto GetTriangleScore = [&Indices, &VertexScores](int32 Triangle)
+		{
+			const uint32* Corners = Indices.GetData() + Triangle * 3;
+			return VertexScores[Corners[0]] + VertexScores[Corners[1]] + VertexScores[Corners[2]];
+		};
+
+		int32 BestTriangle = INDEX_NONE;
+		float BestScore = -1.0f;
+		for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			const float Score = GetTriangleScore(Triangle);
+			if (Score > BestScore)
+			{
+				BestScore = Score;
+				BestTriangle = Triangle;
+			}
+		}
+
+		TArray<bool> Drawn;
+		Drawn.Init(false, NumTriangles);
+		TArray<uint32> Output;
+		Output.Reserve(NumTriangles * 3);
+
+		int32 Cache[VertexCacheSize + 3];
+		int32 CacheCount = 0;
+		int32 NextUndrawn = 0;
+
+		for (int32 Step = 0; Step < NumTriangles; ++Step)
+		{
+			// Dead end (nothing cached has triangles left): go on with the first triangle not drawn yet
+			if (BestTriangle == INDEX_NONE)
+			{
+				while (Drawn[NextUndrawn])
+				{
+					++NextUndrawn;
+				}
+				BestTriangle = NextUndrawn;
+			}
+
+			const uint32* Corners = Indices.GetData() + BestTriangle * 3;
+			Drawn[BestTriangle] = true;
+
+			// The drawn triangle's vertices move to the front of the cache and drop it from their lists
+			int32 NewCache[VertexCacheSize + 3];
+			int32 NewCount = 0;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 Vertex = static_cast<int32>(Corners[Corner]);
+				Output.Add(Corners[Corner]);
+
+				int32* Live = VertexTriangles.GetData() + FirstTriangle[Vertex];
+				for (int32 Entry = 0; Entry < Valence[Vertex]; ++Entry)
+				{
+					if (Live[Entry] == BestTriangle)
+					{
+						Live[Entry] = Live[Valence[Vertex] - 1];
+						break;
+					}
+				}
+				--Valence[Vertex];
+
+				if (!MakeArrayView(NewCache, NewCount).Contains(Vertex))
+				{
+					NewCache[NewCount++] = Vertex;
+				}
+			}
+			for (int32 Entry = 0; Entry < CacheCount; ++Entry)
+			{
+				if (Cache[Entry] != int32(Corners[0]) && Cache[Entry] != int32(Corners[1]) && Cache[Entry] != int32(Corners[2]))
+				{
+					NewCache[NewCount++] = Cache[Entry];
+				}
+			}
+
+			// Rescore every vertex whose cache position changed, including the ones pushed out
+			for (int32 Entry = 0; Entry < NewCount; ++Entry)
+			{
+				const int32 Vertex = NewCache[Entry];
+				CachePosition[Vertex] = Entry < VertexCacheSize ? Entry : INDEX_NONE;
+				VertexScores[Vertex] = GetVertexScore(CachePosition[Vertex], Valence[Vertex]);
+			}
+
+			// Only triangles of those vertices change score; the best of them is drawn next
+			BestTriangle = INDEX_NONE;
+			BestScore = -1.0f;
+			for (int32 Entry = 0; Entry < NewCount; ++Entry)
+			{
+				const int32 Vertex = NewCache[Entry];
+				const int32* Live = VertexTriangles.GetData() + FirstTriangle[Vertex];
+				for (int32 LiveEntry = 0; LiveEntry < Valence[Vertex]; ++LiveEntry)
+				{
+					const int32 Triangle = Live[LiveEntry];
+					const float Score = GetTriangleScore(Triangle);
+					if (Score > BestScore)
+					{
+						BestScore = Score;
+						BestTriangle = Triangle;
+					}
+				}
+			}
+
+			CacheCount = FMath::Min(NewCount, VertexCacheSize);
+			FMemory::Memcpy(Cache, NewCache, CacheCount * sizeof(int32));
+		}
+
+		FMemory::Memcpy(Indices.GetData(), Output.GetData(), Output.Num() * sizeof(uint32));
+	}
+
+	void OptimizeOverdraw(TArrayView<uint32> Indices, TConstArrayView<FVector3f> Positions, float Threshold)
+	{
+		const int32 NumTriangles = Indices.Num() / 3;
+		if (NumTriangles < 2)
+		{
+			return;
+		}
+
+		TArray<uint32> Timestamps;
+		Timestamps.SetNumZeroed(Positions.Num());
+		uint32 Timestamp = OverdrawCacheSize + 1;
+
+		// Hard boundaries: a triangle missing the cache on every corner starts a new patch of the mesh
+		TArray<int32> Patches;
+		for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			const int32 Misses = UpdateCache(Indices.GetData() + Triangle * 3, OverdrawCacheSize, Timestamps, Timestamp);
+			if (Triangle == 0 || Misses == 3)
+			{
+				Patches.Add(Triangle);
+			}
+		}
+
+		// Soft boundaries: split a patch wherever the running ACMR already meets the patch's own within Threshold
+		TArray<int32> Clusters;
+		for (int32 Patch = 0; Patch < Patches.Num(); ++Patch)
+		{
+			const int32 Start = Patches[Patch];
+			const int32 End = Patch + 1 < Patches.Num() ? Patches[Patch + 1] : NumTriangles;
+
+			Timestamp += OverdrawCacheSize + 1;
+			int32 PatchMisses = 0;
+			for (int32 Triangle = Start; Triangle < End; ++Triangle)
+			{
+				PatchMisses += UpdateCache(Indices.GetData() + Triangle * 3, OverdrawCacheSize, Timestamps, Timestamp);
+			}
+			const float PatchThreshold = Threshold * float(PatchMisses) / float(End - Start);
+
+			const int32 FirstCluster = Clusters.Add(Start);
+			Timestamp += OverdrawCacheSize + 1;
+			int32 RunningMisses = 0;
+			int32 RunningTriangles = 0;
+			for (int32 Triangle = Start; Triangle < End; ++Triangle)
+			{
+				RunningMisses += UpdateCache(Indices.GetData() + Triangle * 3, OverdrawCacheSize, Timestamps, Timestamp);
+				++RunningTriangles;
+				if (float(RunningMisses) / float(RunningTriangles) <= PatchThreshold)
+				{
+					Clusters.Add(Triangle + 1);
+					Timestamp += OverdrawCacheSize + 1;
+					RunningMisses = 0;
+					RunningTriangles = 0;
+				}
+			}
+
+			// Drop the empty cluster a split on the last triangle opens, or fold the trailing remainder,
+			// which never reached the target ACMR, into the cluster before it
+			if (Clusters.Last() == End || Clusters.Num() - 1 > FirstCluster)
+			{
+				Clusters.Pop();
+			}
+		}
+
+		// Clusters facing away from the mesh center are in front of the rest from most viewpoints: draw them first
+		FVector3f MeshCentroid = FVector3f::ZeroVector;
+		for (const FVector3f& Position : Positions)
+		{
+			MeshCentroid += Position;
+		}
+		MeshCentroid /= float(FMath::Max(Positions.Num(), 1));
+
+		TArray<float> SortKeys;
+		SortKeys.SetNumUninitialized(Clusters.Num());
+		for (int32 Cluster = 0; Cluster < Clusters.Num(); ++Cluster)
+		{
+			const int32 End = Cluster + 1 < Clusters.Num() ? Clusters[Cluster + 1] : NumTriangles;
+
+			FVector3f Centroid = FVector3f::ZeroVector;
+			FVector3f Normal = FVector3f::ZeroVector;
+			float Area = 0.0f;
+			for (int32 Triangle = Clusters[Cluster]; Triangle < End; ++Triangle)
+			{
+				const FVector3f& P0 = Positions[Indices[Triangle * 3 + 0]];
+				const FVector3f& P1 = Positions[Indices[Triangle * 3 + 1]];
+				const FVector3f& P2 = Positions[Indices[Triangle * 3 + 2]];
+				const FVector3f FaceNormal = FVector3f::CrossProduct(P1 - P0, P2 - P0);
+				const float FaceArea = FaceNormal.Size();
+
+				Centroid += (P0 + P1 + P2) * (FaceArea / 3.0f);
+				Normal += FaceNormal;
+				Area += FaceArea;
+			}
+
+			Centroid = Area > 0.0f ? Centroid / Area : Centroid;
+			SortKeys[Cluster] = FVector3f::DotProduct(Centroid - MeshCentroid, Normal.GetSafeNormal());
+		}
+
+		TArray<int32> Order;
+		Order.SetNumUninitialized(Clusters.Num());
+		for (int32 Cluster = 0; Cluster < Clusters.Num(); ++Cluster)
+		{
+			Order[Cluster] = Cluster;
+		}
+		Algo::StableSort(Order, [&SortKeys](int32 A, int32 B) { return SortKeys[A] > SortKeys[B]; });
+
+		TArray<uint32> Output;
+		Output.Reserve(Indices.Num());
+		for (const int32 Cluster : Order)
+		{
+			const int32 End = Cluster + 1 < Clusters.Num() ? Clusters[Cluster + 1] : NumTriangles;
+			Output.Append(Indices.GetData() + Clusters[Cluster] * 3, (End - Clusters[Cluster]) * 3);
+		}
+
+		FMemory::Memcpy(Indices.GetData(), Output.GetData(), Output.Num() * sizeof(uint32));
+	}
+
+	float ComputeAcmr(TConstArrayView<uint32> Indices, int32 NumVertices, int32 CacheSize)
+	{
+		const int32 NumTriangles = Indices.Num() / 3;
+		if (NumTriangles == 0)
+		{
+			return 0.0f;
+		}
+
+		TArray<uint32> Timestamps;
+		Timestamps.SetNumZeroed(NumVertices);
+		uint32 Timestamp = CacheSize + 1;
+
+		int32 Misses = 0;
+		for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			Misses += UpdateCache(Indices.GetData() + Triangle * 3, CacheSize, Timestamps, Timestamp);
+		}
+		return float(Misses) / float(NumTriangles);
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Vertex welding and triangle reordering for glTF primitives, run before the engine build.
+ *
+ * Welding maps split vertices that are bitwise identical in every attribute onto one vertex, so triangles
+ * that only touched them apart share it. Reordering then sorts triangles for the post-transform vertex cache
+ * (Forsyth, "Linear-Speed Vertex Cache Optimisation") and, in cache-friendly clusters, front to back from the
+ * mesh outward to cut overdraw (Sander et al., "Fast Triangle Reordering for Vertex Locality and Reduced
+ * Overdraw"). The engine creates render vertices in face order, so vertex fetch follows the new order too.
+ */
+namespace VrmMeshOptimizer
+{
+	/** Simulated post-transform cache size of the vertex cache optimization */
+	static constexpr int32 VertexCacheSize = 32;
+
+	/** ACMR a cluster split by OptimizeOverdraw may reach, relative to its unsplit cluster */
+	static constexpr float DefaultOverdrawThreshold = 1.05f;
+
+	/** Per-vertex attribute streams that together identify a vertex */
+	struct FVertexStreams
+	{
+		struct FStream
+		{
+			const uint8* Data = nullptr;
+			int32 Stride = 0;
+		};
+
+		/** Adds a stream of Stride bytes per vertex; every stream must cover every welded vertex */
+		void Add(const void* Data, int32 Stride)
+		{
+			Streams.Add({ static_cast<const uint8*>(Data), Stride });
+		}
+
+		TArray<FStream, TInlineAllocator<8>> Streams;
+	};
+
+	/**
+	 * Maps every vertex to the lowest-numbered vertex whose streams hold the same bytes. Vertices are hashed in
+	 * parallel and radix sorted by hash; bytes are only compared within runs of equal hash.
+	 * @param NumVertices Vertices in every stream
+	 * @param Streams Attributes that must match for two vertices to weld
+	 * @param OutRemap Representative of each vertex (itself when it is the first of its kind)
+	 * @return Number of distinct vertices
+	 */
+	int32 WeldVertices(int32 NumVertices, const FVertexStreams& Streams, TArray<uint32>& OutRemap);
+
+	/**
+	 * Reorders whole triangles so each one reuses vertices still in the post-transform cache.
+	 * @param Indices Triangle list, every index below NumVertices; reordered in place
+	 */
+	void OptimizeVertexCache(TArrayView<uint32> Indices, int32 NumVertices);
+
+	/**
+	 * Splits a vertex cache optimized triangle list into clusters that keep their cache efficiency within
+	 * Threshold, then draws the clusters facing away from the mesh center first.
+	 * @param Indices Triangle list, every index below Positions.Num(); reordered in place
+	 * @param Positions Vertex positions
+	 * @param Threshold Allowed ACMR growth of the clusters (1.05: five percent more cache misses)
+	 */
+	void OptimizeOverdraw(TArrayView<uint32> Indices, TConstArrayView<FVector3f> Positions, float Threshold = DefaultOverdrawThreshold);
+
+	/** Average cache misses per triangle of a FIFO cache of CacheSize vertices: 0.5 is ideal for a regular grid, 3 the worst */
+	float ComputeAcmr(TConstArrayView<uint32> Indices, int32 NumVertices, int32 CacheSize = 16);
+}
@@ -0,0 +1,570 @@
+#include "VrmMeshoptDecoder.h"
+
+namespace VrmMeshoptDecoder
+{
+	static constexpr uint8 VertexHeader = 0xA0;
+	static constexpr uint8 IndexHeader = 0xE0;
+	static constexpr uint8 SequenceHeader = 0xD0;
+
+	/** Vertex blocks hold at most this many bytes of vertex data, in groups of 16 bytes per channel */
+	static constexpr int32 VertexBlockSizeBytes = 8192;
+	static constexpr int32 VertexBlockMaxSize = 256;
+	static constexpr int32 ByteGroupSize = 16;
+
+	/** Largest encoded byte group; the tail guarantees this much data after every group */
+	static constexpr int32 ByteGroupDecodeLimit = 24;
+	static constexpr int32 TailMinSize = 32;
+
+	static int32 GetVertexBlockSize(int32 VertexSize)
+	{
+		const int32 Result = (VertexBlockSizeBytes / VertexSize) & ~(ByteGroupSize - 1);
+		return FMath::Min(Result, VertexBlockMaxSize);
+	}
+
+	static uint8 Unzigzag8(uint8 Value)
+	{
+		return static_cast<uint8>(-(Value & 1) ^ (Value >> 1));
+	}
+
+	/** 16 values of Bits bits packed high bits first; all-ones values are escapes read from the bytes that follow */
+	template<int32 Bits>
+	static const uint8* DecodePackedGroup(const uint8* Data, uint8* Out)
+	{
+		constexpr uint32 Escape = (1u << Bits) - 1;
+		constexpr int32 ValuesPerByte = 8 / Bits;
+
+		const uint8* Extra = Data + ByteGroupSize * Bits / 8;
+		for (int32 Byte = 0; Byte < ByteGroupSize / ValuesPerByte; ++Byte)
+		{
+			uint32 Packed = Data[Byte];
+			for (int32 Slot = 0; Slot < ValuesPerByte; ++Slot)
+			{
+				const uint32 Encoded = (Packed >> (8 - Bits)) & Escape;
+				Packed <<= Bits;
+				*Out++ = (Encoded == Escape) ? *Extra++ : static_cast<uint8>(Encoded);
+			}
+		}
+		return Extra;
+	}
+
+	static const uint8* DecodeBytesGroup(const uint8* Data, uint8* Out, int32 BitsLog2)
+	{
+		switch (BitsLog2)
+		{
+		case 0:
+			FMemory::Memzero(Out, ByteGroupSize);
+			return Data;
+		case 1:
+			return DecodePackedGroup<2>(Data, Out);
+		case 2:
+			return DecodePackedGroup<4>(Data, Out);
+		default:
+			FMemory::Memcpy(Out, Data, ByteGroupSize);
+			return Data + ByteGroupSize;
+		}
+	}
+
+	/** One channel of a vertex block: a 2-bit width per 16-byte group, then the groups */
+	static const uint8* DecodeBytes(const uint8* Data, const uint8* DataEnd, uint8* Out, int32 Size)
+	{
+		const int32 NumGroups = Size / ByteGroupSize;
+		const int32 HeaderSize = (NumGroups + 3) / 4;
+		if (DataEnd - Data < HeaderSize)
+		{
+			return nullptr;
+		}
+
+		const uint8* Header = Data;
+		Data += HeaderSize;
+		for (int32 Group = 0; Group < NumGroups; ++Group)
+		{
+			if (DataEnd - Data < ByteGroupDecodeLimit)
+			{
+				return nullptr;
+			}
+
+			const int32 BitsLog2 = (Header[Group / 4] >> ((Group % 4) * 2)) & 3;
+			Data = DecodeBytesGroup(Data, Out + Group * ByteGroupSize, BitsLog2);
+		}
+		return Data;
+	}
+
+	/** Each byte channel is stored transposed and delta-coded against the previous vertex */
+	static const uint8* DecodeVertexBlock(const uint8* Data, const uint8* DataEnd, uint8* Out, int32 Count, int32 VertexSize, uint8* LastVertex)
+	{
+		uint8 Deltas[VertexBlockMaxSize];
+		uint8 Transposed[VertexBlockSizeBytes];
+
+		const int32 CountAligned = Align(Count, ByteGroupSize);
+		for (int32 Channel = 0; Channel < VertexSize; ++Channel)
+		{
+			Data = DecodeBytes(Data, DataEnd, Deltas, CountAligned);
+			if (!Data)
+			{
+				return nullptr;
+			}
+
+			uint8 Previous = LastVertex[Channel];
+			for (int32 Vertex = 0; Vertex < Count; ++Vertex)
+			{
+				Previous = static_cast<uint8>(Unzigzag8(Deltas[Vertex]) + Previous);
+				Transposed[Vertex * VertexSize + Channel] = Previous;
+			}
+		}
+
+		FMemory::Memcpy(Out, Transposed, Count * VertexSize);
+		FMemory::Memcpy(LastVertex, Transposed + (Count - 1) * VertexSize, VertexSize);
+		return Data;
+	}
+
+	bool DecodeVertexBuffer(TConstArrayView<uint8> Src, int32 Count, int32 VertexSize, uint8* Dst)
+	{
+		if (VertexSize <= 0 || VertexSize > 256 || VertexSize % 4 != 0 || Count < 0)
+		{
+			return false;
+		}
+
+		const uint8* Data = Src.GetData();
+		const uint8* DataEnd = Data + Src.Num();
+		if (Src.Num() < 1 + VertexSize || (Data[0] & 0xF0) != VertexHeader || (Data[0] & 0x0F) != 0)
+		{
+			return false;
+		}
+		++Data;
+
+		// The stream ends with the first vertex (the delta baseline), front-padded to at least 32 bytes
+		const int32 TailSize = FMath::Max(VertexSize, TailMinSize);
+		if (DataEnd - Data < TailSize)
+		{
+			return false;
+		}
+
+		uint8 LastVertex[256];
+		FMemory::Memcpy(LastVertex, DataEnd - VertexSize, VertexSize);
+
+		const int32 BlockSize = GetVertexBlockSize(VertexSize);
+		for (int32 First = 0; First < Count; First += BlockSize)
+		{
+			const int32 NumInBlock = FMath::Min(BlockSize, Count - First);
+			Data = DecodeVertexBlock(Data, DataEnd, Dst + static_cast<int64>(First) * VertexSize, NumInBlock, VertexSize, LastVertex);
+			if (!Data)
+			{
+				return false;
+			}
+		}
+
+		return DataEnd - Data == TailSize;
+	}
+
+	static void WriteIndex(uint8* Dst, int64 Index, int32 IndexSize, uint32 Value)
+	{
+		if (IndexSize == 2)
+		{
+			const uint16 Short = static_cast<uint16>(Value);
+			FMemory::Memcpy(Dst + Index * 2, &Short, sizeof(Short));
+		}
+		else
+		{
+			FMemory::Memcpy(Dst + Index * 4, &Value, sizeof(Value));
+		}
+	}
+
+	static uint32 DecodeVByte(const uint8*& Data)
+	{
+		const uint8 Lead = *Data++;
+		if (Lead < 128)
+		{
+			return Lead;
+		}
+
+		// Up to 5 bytes, 7 bits each, low bits first
+		uint32 Result = Lead & 127;
+		uint32 Shift = 7;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			const uint8 Group = *Data++;
+			Result |= static_cast<uint32>(Group & 127) << Shift;
+			Shift += 7;
+			if (Group < 128)
+			{
+				break;
+			}
+		}
+		return Result;
+	}
+
+	/** Free indices are zigzag deltas from the last free index */
+	static uint32 DecodeIndex(const uint8*& Data, uint32 Last)
+	{
+		const uint32 Value = DecodeVByte(Data);
+		const uint32 Delta = (Value >> 1) ^ (0u - (Value & 1));
+		return Last + Delta;
+	}
+
+	bool DecodeIndexBuffer(TConstArrayView<uint8> Src, int32 Count, int32 IndexSize, uint8* Dst)
+	{
+		if (Count < 0 || Count % 3 != 0 || (IndexSize != 2 && IndexSize != 4))
+		{
+			return false;
+		}
+
+		// Smallest valid stream: header, one code byte per triangle and the 16-byte codeaux table
+		const int64 SrcSize = Src.Num();
+		if (SrcSize < 1 + Count / 3 + 16)
+		{
+			return false;
+		}
+
+		const uint8* Buffer = Src.GetData();
+		const int32 Version = Buffer[0] & 0x0F;
+		if ((Buffer[0] & 0xF0) != IndexHeader || Version > 1)
+		{
+			return false;
+		}
+
+		// Recently seen edges and vertices, wrapped around 16 entries; must evolve exactly as in the encoder
+		uint32 EdgeFifo[16][2];
+		uint32 VertexFifo[16];
+		FMemory::Memset(EdgeFifo, 0xFF, sizeof(EdgeFifo));
+		FMemory::Memset(VertexFifo, 0xFF, sizeof(VertexFifo));
+		uint32 EdgeOffset = 0;
+		uint32 VertexOffset = 0;
+
+		auto PushEdge = [&EdgeFifo, &EdgeOffset](uint32 A, uint32 B)
+		{
+			EdgeFifo[EdgeOffset][0] = A;
+			EdgeFifo[EdgeOffset][1] = B;
+			EdgeOffset = (EdgeOffset + 1) & 15;
+		};
+		auto PushVertex = [&VertexFifo, &VertexOffset](uint32 V, bool bAdvance = true)
+		{
+			VertexFifo[VertexOffset] = V;
+			VertexOffset = (VertexOffset + (bAdvance ? 1 : 0)) & 15;
+		};
+
+		uint32 Next = 0;
+		uint32 Last = 0;
+
+		// Version 1 codes +1/-1 free index deltas as 14/13
+		const int32 FecMax = Version >= 1 ? 13 : 15;
+
+		const uint8* Code = Buffer + 1;
+		const uint8* Data = Code + Count / 3;
+		const uint8* DataSafeEnd = Buffer + SrcSize - 16;
+		const uint8* CodeauxTable = DataSafeEnd;
+
+		for (int32 i = 0; i < Count; i += 3)
+		{
+			// A triangle reads at most 16 bytes of data, and the codeaux table follows DataSafeEnd
+			if (Data > DataSafeEnd)
+			{
+				return false;
+			}
+
+			const uint8 CodeTri = *Code++;
+			uint32 A;
+			uint32 B;
+			uint32 C;
+
+			if (CodeTri < 0xF0)
+			{
+				// Triangle sharing a recent edge
+				const int32 Fe = CodeTri >> 4;
+				A = EdgeFifo[(EdgeOffset - 1 - Fe) & 15][0];
+				B = EdgeFifo[(EdgeOffset - 1 - Fe) & 15][1];
+				const int32 Fec = CodeTri & 15;
+
+				if (Fec < FecMax)
+				{
+					const bool bNewVertex = Fec == 0;
+					C = bNewVertex ? Next : VertexFifo[(VertexOffset - 1 - Fec) & 15];
+					Next += bNewVertex ? 1 : 0;
+					PushVertex(C, bNewVertex);
+				}
+				else
+				{
+					// 13 and 14 decode to -1 and +1 from the last free index
+					C = Last = (Fec != 15) ? Last + (Fec - (Fec ^ 3)) : DecodeIndex(Data, Last);
+					PushVertex(C);
+				}
+
+				PushEdge(C, B);
+				PushEdge(A, C);
+			}
+			else
+			{
+				int32 Fea;
+				int32 Feb;
+				int32 Fec;
+				if (CodeTri < 0xFE)
+				{
+					// Common case: the B/C codes come from the table at the end of the stream
+					const uint8 Codeaux = CodeauxTable[CodeTri & 15];
+					Fea = 0;
+					Feb = Codeaux >> 4;
+					Fec = Codeaux & 15;
+				}
+				else
+				{
+					const uint8 Codeaux = *Data++;
+					Fea = CodeTri == 0xFE ? 0 : 15;
+					Feb = Codeaux >> 4;
+					Fec = Codeaux & 15;
+
+					// Restart: codeaux 0 encoded explicitly rather than through the table
+					if (Codeaux == 0)
+					{
+						Next = 0;
+					}
+				}
+
+				// Next advances for all three vertices before any free index is read, matching the encoder
+				A = (Fea == 0) ? Next++ : 0;
+				B = (Feb == 0) ? Next++ : VertexFifo[(VertexOffset - Feb) & 15];
+				C = (Fec == 0) ? Next++ : VertexFifo[(VertexOffset - Fec) & 15];
+
+				if (Fea == 15)
+				{
+					Last = A = DecodeIndex(Data, Last);
+				}
+				if (Feb == 15)
+				{
+					Last = B = DecodeIndex(Data, Last);
+				}
+				if (Fec == 15)
+				{
+					Last = C = DecodeIndex(Data, Last);
+				}
+
+				PushVertex(A);
+				PushVertex(B, Feb == 0 || Feb == 15);
+				PushVertex(C, Fec == 0 || Fec == 15);
+
+				PushEdge(B, A);
+				PushEdge(C, B);
+				PushEdge(A, C);
+			}
+
+			WriteIndex(Dst, i + 0, IndexSize, A);
+			WriteIndex(Dst, i + 1, IndexSize, B);
+			WriteIndex(Dst, i + 2, IndexSize, C);
+		}
+
+		// Every data byte must be consumed, stopping exactly at the codeaux table
+		return Data == DataSafeEnd;
+	}
+
+	bool DecodeIndexSequence(TConstArrayView<uint8> Src, int32 Count, int32 IndexSize, uint8* Dst)
+	{
+		if (Count < 0 || (IndexSize != 2 && IndexSize != 4))
+		{
+			return false;
+		}
+
+		// Smallest valid stream: header, one byte per index and a 4-byte tail
+		const int64 SrcSize = Src.Num();
+		if (SrcSize < 1 + static_cast<int64>(Count) + 4)
+		{
+			return false;
+		}
+
+		const uint8* Buffer = Src.GetData();
+		if ((Buffer[0] & 0xF0) != SequenceHeader || (Buffer[0] & 0x0F) > 1)
+		{
+			return false;
+		}
+
+		const uint8* Data = Buffer + 1;
+		const uint8* DataSafeEnd = Buffer + SrcSize - 4;
+
+		// Two baselines; the low bit of each code selects which one the delta applies to
+		uint32 Last[2] = { 0, 0 };
+		for (int32 i = 0; i < Count; ++i)
+		{
+			// An index reads at most 5 bytes, covered by the tail
+			if (Data >= DataSafeEnd)
+			{
+				return false;
+			}
+
+			uint32 Value = DecodeVByte(Data);
+			const uint32 Baseline = Value & 1;
+			Value >>= 1;
+
+			const uint32 Delta = (Value >> 1) ^ (0u - (Value & 1));
+			const uint32 Index = Last[Baseline] + Delta;
+			Last[Baseline] = Index;
+
+			WriteIndex(Dst, i, IndexSize, Index);
+		}
+
+		return Data == DataSafeEnd;
+	}
+
+	template<typename T>
+	static void DecodeOctahedral(T* Data, int32 Count)
+	{
+		const float Max = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			T* Element = Data + i * 4;
+
+			// Z encodes 1.0 at the same bit count, so it reconstructs from |X| + |Y|
+			float X = static_cast<float>(Element[0]);
+			float Y = static_cast<float>(Element[1]);
+			const float Z = static_cast<float>(Element[2]) - FMath::Abs(X) - FMath::Abs(Y);
+
+			// Unfold the lower hemisphere
+			const float T0 = FMath::Min(Z, 0.0f);
+			X += (X >= 0.0f) ? T0 : -T0;
+			Y += (Y >= 0.0f) ? T0 : -T0;
+
+			const float Scale = Max / FMath::Sqrt(X * X + Y * Y + Z * Z);
+			Element[0] = static_cast<T>(static_cast<int32>(X * Scale + (X >= 0.0f ? 0.5f : -0.5f)));
+			Element[1] = static_cast<T>(static_cast<int32>(Y * Scale + (Y >= 0.0f ? 0.5f : -0.5f)));
+			Element[2] = static_cast<T>(static_cast<int32>(Z * Scale + (Z >= 0.0f ? 0.5f : -0.5f)));
+		}
+	}
+
+	void ApplyOctahedralFilter(uint8* Data, int32 Count, int32 Stride)
+	{
+		if (Stride == 4)
+		{
+			DecodeOctahedral(reinterpret_cast<int8*>(Data), Count);
+		}
+		else
+		{
+			DecodeOctahedral(reinterpret_cast<int16*>(Data), Count);
+		}
+	}
+
+	void ApplyQuaternionFilter(uint8* Data, int32 Count)
+	{
+		int16* Shorts = reinterpret_cast<int16*>(Data);
+		const float Scale = 1.0f / UE_SQRT_2;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			int16* Element = Shorts + i * 4;
+
+			// The fourth lane holds the component scale in its high bits and the index of the dropped component in the low 2 bits
+			const int32 ScaleBits = Element[3] | 3;
+			const float ComponentScale = Scale / static_cast<float>(ScaleBits);
+
+			const float X = Element[0] * ComponentScale;
+			const float Y = Element[1] * ComponentScale;
+			const float Z = Element[2] * ComponentScale;
+			const float W = FMath::Sqrt(FMath::Max(1.0f - X * X - Y * Y - Z * Z, 0.0f));
+
+			const int32 Xf = static_cast<int32>(X * 32767.0f + (X >= 0.0f ? 0.5f : -0.5f));
+			const int32 Yf = static_cast<int32>(Y * 32767.0f + (Y >= 0.0f ? 0.5f : -0.5f));
+			const int32 Zf = static_cast<int32>(Z * 32767.0f + (Z >= 0.0f ? 0.5f : -0.5f));
+			const int32 Wf = static_cast<int32>(W * 32767.0f + 0.5f);
+
+			const int32 Dropped = Element[3] & 3;
+			Element[(Dropped + 1) & 3] = static_cast<int16>(Xf);
+			Element[(Dropped + 2) & 3] = static_cast<int16>(Yf);
+			Element[(Dropped + 3) & 3] = static_cast<int16>(Zf);
+			Element[(Dropped + 0) & 3] = static_cast<int16>(Wf);
+		}
+	}
+
+	void ApplyExponentialFilter(uint8* Data, int32 Count, int32 Stride)
+	{
+		// Each lane is a 24-bit signed mantissa with an 8-bit signed exponent in the high byte
+		uint32* Lanes = reinterpret_cast<uint32*>(Data);
+		const int64 NumLanes = static_cast<int64>(Count) * (Stride / 4);
+		for (int64 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			const uint32 Value = Lanes[Lane];
+			const int32 Mantissa = static_cast<int32>(Value << 8) >> 8;
+			const int32 Exponent = static_cast<int32>(Value) >> 24;
+
+			const uint32 PowerBits = static_cast<uint32>(Exponent + 127) << 23;
+			float Power;
+			FMemory::Memcpy(&Power, &PowerBits, sizeof(Power));
+
+			const float Result = Power * static_cast<float>(Mantissa);
+			FMemory::Memcpy(&Lanes[Lane], &Result, sizeof(Result));
+		}
+	}
+
+	bool Decode(const FVrmGltfMeshoptCompression& Compression, TConstArrayView<uint8> Src, uint8* Dst, FString& OutError)
+	{
+		const int32 Count = Compression.Count;
+		const int32 Stride = Compression.ByteStride;
+		const EVrmGltfMeshoptFilter Filter = Compression.Filter;
+
+		if (Count < 0 || Stride <= 0)
+		{
+			OutError = FString::Printf(TEXT("invalid count (%d) or byteStride (%d)"), Count, Stride);
+			return false;
+		}
+
+		switch (Compression.Mode)
+		{
+		case EVrmGltfMeshoptMode::Attributes:
+		{
+			if (Stride % 4 != 0 || Stride > 256)
+			{
+				OutError = FString::Printf(TEXT("ATTRIBUTES byteStride %d must be a multiple of 4 up to 256"), Stride);
+				return false;
+			}
+			if ((Filter == EVrmGltfMeshoptFilter::Octahedral && Stride != 4 && Stride != 8)
+				|| (Filter == EVrmGltfMeshoptFilter::Quaternion && Stride != 8)
+				|| Filter == EVrmGltfMeshoptFilter::Unknown)
+			{
+				OutError = FString::Printf(TEXT("unsupported filter for byteStride %d"), Stride);
+				return false;
+			}
+			if (!DecodeVertexBuffer(Src, Count, Stride, Dst))
+			{
+				OutError = TEXT("malformed ATTRIBUTES stream");
+				return false;
+			}
+
+			switch (Filter)
+			{
+			case EVrmGltfMeshoptFilter::Octahedral:
+				ApplyOctahedralFilter(Dst, Count, Stride);
+				break;
+			case EVrmGltfMeshoptFilter::Quaternion:
+				ApplyQuaternionFilter(Dst, Count);
+				break;
+			case EVrmGltfMeshoptFilter::Exponential:
+				ApplyExponentialFilter(Dst, Count, Stride);
+				break;
+			default:
+				break;
+			}
+			return true;
+		}
+
+		case EVrmGltfMeshoptMode::Triangles:
+		case EVrmGltfMeshoptMode::Indices:
+		{
+			if (Stride != 2 && Stride != 4)
+			{
+				OutError = FString::Printf(TEXT("index byteStride %d must be 2 or 4"), Stride);
+				return false;
+			}
+			if (Filter != EVrmGltfMeshoptFilter::None)
+			{
+				OutError = TEXT("filters only apply to ATTRIBUTES");
+				return false;
+			}
+
+			const bool bTriangles = Compression.Mode == EVrmGltfMeshoptMode::Triangles;
+			if (bTriangles ? !DecodeIndexBuffer(Src, Count, Stride, Dst) : !DecodeIndexSequence(Src, Count, Stride, Dst))
+			{
+				OutError = bTriangles ? TEXT("malformed TRIANGLES stream") : TEXT("malformed INDICES stream");
+				return false;
+			}
+			return true;
+		}
+
+		default:
+			OutError = TEXT("unknown mode");
+			return false;
+		}
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VrmToolchain/VrmGltfModel.h"
+
+/**
+ * Decoder for EXT_meshopt_compression buffer views (meshoptimizer's vertex and index codecs).
+ *
+ * Implements bitstream version 0 of the ATTRIBUTES codec and versions 0/1 of the TRIANGLES and
+ * INDICES codecs, plus the OCTAHEDRAL, QUATERNION and EXPONENTIAL filters. Decoding never reads
+ * outside Src: truncated or malformed streams are rejected instead.
+ */
+namespace VrmMeshoptDecoder
+{
+	/**
+	 * Decodes a compressed buffer view and applies its filter
+	 * @param Compression The view's EXT_meshopt_compression description
+	 * @param Src Compressed stream (Compression.ByteLength bytes)
+	 * @param Dst Destination for Compression.Count * Compression.ByteStride decoded bytes
+	 * @param OutError Error description on failure
+	 * @return False if the description is invalid or the stream is malformed
+	 */
+	bool Decode(const FVrmGltfMeshoptCompression& Compression, TConstArrayView<uint8> Src, uint8* Dst, FString& OutError);
+
+	/** ATTRIBUTES: Count vertices of VertexSize bytes (a multiple of 4, at most 256) */
+	bool DecodeVertexBuffer(TConstArrayView<uint8> Src, int32 Count, int32 VertexSize, uint8* Dst);
+
+	/** TRIANGLES: Count indices (a multiple of 3) of IndexSize bytes (2 or 4) */
+	bool DecodeIndexBuffer(TConstArrayView<uint8> Src, int32 Count, int32 IndexSize, uint8* Dst);
+
+	/** INDICES: Count indices of IndexSize bytes (2 or 4) in arbitrary order */
+	bool DecodeIndexSequence(TConstArrayView<uint8> Src, int32 Count, int32 IndexSize, uint8* Dst);
+
+	/** OCTAHEDRAL filter in place: Stride 4 (BYTE x4) or 8 (SHORT x4) */
+	void ApplyOctahedralFilter(uint8* Data, int32 Count, int32 Stride);
+
+	/** QUATERNION filter in place: SHORT x4 elements */
+	void ApplyQuaternionFilter(uint8* Data, int32 Count);
+
+	/** EXPONENTIAL filter in place: every 32-bit lane becomes a float */
+	void ApplyExponentialFilter(uint8* Data, int32 Count, int32 Stride);
+}
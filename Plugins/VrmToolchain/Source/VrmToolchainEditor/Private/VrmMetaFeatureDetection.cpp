@@ -1,7 +1,7 @@
 #include "VrmMetaFeatureDetection.h"
-#include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
 #include "VrmToolchain/VrmMetaAsset.h"
+#include "VrmToolchain/VrmGlbDocument.h"
 
 namespace VrmMetaDetection
 {
@@ -52,33 +52,64 @@ FVrmImportReport BuildImportReport(const FVrmMetaFeatures& Features)
 }
     FVrmMetaFeatures ParseMetaFeaturesFromJson(const FString& JsonStr)
     {
-        FVrmMetaFeatures Result;
+        FTCHARToUTF8 Utf8(*JsonStr, JsonStr.Len());
+        return ParseMetaFeaturesFromUtf8(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()));
+    }
+
+    FVrmMetaFeatures ParseMetaFeaturesFromDocument(const FVrmGlbDocument& Document)
+    {
+        // The document parsed its whole JSON chunk on load: malformed text the early stop would not reach fails here
+        if (!Document.GetJsonRoot().IsObject())
+        {
+            return FVrmMetaFeatures();
+        }
+        return ParseMetaFeaturesFromUtf8(Document.GetJsonChunk());
+    }
 
-        // Attempt to deserialize JSON
-        TSharedPtr<FJsonObject> RootObj;
-        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonStr);
-        if (!FJsonSerializer::Deserialize(Reader, RootObj) || !RootObj.IsValid())
+    FVrmMetaFeatures ParseMetaFeaturesFromUtf8(TArrayView<const uint8> JsonUtf8)
+    {
+        // One rule set with the runtime probe (FVrmParser::ProbeVrmFile)
+        FVrmMetaFeatures Result;
+        FVrmProbeResult Scan;
+        if (!FVrmParser::ScanVrmFeatures(JsonUtf8, Scan))
         {
             // Parse failed; return conservative defaults (all Unknown/false)
             return Result;
         }
 
+        Result.SpecVersion = Scan.Version;
+        Result.bHasHumanoid = Scan.bHasHumanoid;
+        Result.bHasSpringBones = Scan.bHasSpringBones;
+        Result.bHasBlendShapesOrExpressions = Scan.bHasBlendShapesOrExpressions;
+        Result.bHasThumbnail = Scan.bHasThumbnail;
+        return Result;
+    }
+
+    FVrmMetaFeatures ParseMetaFeaturesFromJsonObject(const TSharedPtr<FJsonObject>& RootObj)
+    {
+        FVrmMetaFeatures Result;
+
+        if (!RootObj.IsValid())
+        {
+            return Result;
+        }
+
         // Safely get extensions object (may be missing or non-object in malformed JSON)
         const TSharedPtr<FJsonObject>* ExtObjPtr = nullptr;
         RootObj->TryGetObjectField(TEXT("extensions"), ExtObjPtr);
         TSharedPtr<FJsonObject> ExtObj = ExtObjPtr ? *ExtObjPtr : nullptr;
 
-        // Detect VRM version based on extension presence
+        // Detect VRM version based on extension presence (VRMC_vrm takes precedence, see FVrmParser::ScanVrmFeatures)
         EVrmVersion MetaVer = EVrmVersion::Unknown;
         if (ExtObj.IsValid())
         {
-            if (ExtObj->HasField(TEXT("VRM")))
+            if (ExtObj->HasField(TEXT("VRMC_vrm")))
             {
-                MetaVer = EVrmVersion::VRM0;
+                MetaVer = EVrmVersion::VRM1;
             }
-            else if (ExtObj->HasField(TEXT("VRMC_vrm")))
+            else if (ExtObj->HasField(TEXT("VRM")))
             {
-                MetaVer = EVrmVersion::VRM1;
+                MetaVer = EVrmVersion::VRM0;
             }
         }
 
@@ -97,13 +128,18 @@ FVrmImportReport BuildImportReport(const FVrmMetaFeatures& Features)
             ExtObj->TryGetObjectField(TEXT("VRM"), VrmPtr);
             TSharedPtr<FJsonObject> Vrm = VrmPtr ? *VrmPtr : nullptr;
             
+            // Flags where the VRM0 spec puts them, or at the root where some exporters write them
+            const TSharedPtr<FJsonObject>* MetaPtr = nullptr;
             if (Vrm.IsValid())
             {
                 bHasHumanoid = Vrm->HasField(TEXT("humanoid"));
+                bHasSpring = Vrm->HasField(TEXT("secondaryAnimation"));
+                bHasBlendOrExpr = Vrm->HasField(TEXT("blendShapeMaster"));
+                bHasThumb = Vrm->TryGetObjectField(TEXT("meta"), MetaPtr) && (*MetaPtr)->HasField(TEXT("texture"));
             }
-            bHasSpring = RootObj->HasField(TEXT("secondaryAnimation"));
-            bHasBlendOrExpr = RootObj->HasField(TEXT("blendShapeMaster"));
-            bHasThumb = RootObj->HasField(TEXT("thumbnail"));
+            bHasSpring |= RootObj->HasField(TEXT("secondaryAnimation"));
+            bHasBlendOrExpr |= RootObj->HasField(TEXT("blendShapeMaster"));
+            bHasThumb |= RootObj->HasField(TEXT("thumbnail"));
         }
         // VRM1 feature checks
         else if (MetaVer == EVrmVersion::VRM1 && ExtObj.IsValid())
@@ -5,6 +5,8 @@
 
 // Forward declaration (global scope to avoid namespace confusion)
 class UVrmMetaAsset;
+class FVrmGlbDocument;
+class FJsonObject;
 
 namespace VrmMetaDetection
 {
@@ -34,17 +36,55 @@ namespace VrmMetaDetection
      * Parse VRM metadata features from a JSON string extracted from a GLB file.
      * 
      * Examines the JSON structure for VRM0 (extensions.VRM) or VRM1 (extensions.VRMC_vrm)
-     * indicators and detects the presence of feature fields.
+     * indicators and detects the presence of feature fields, with the rules of FVrmParser::ScanVrmFeatures.
      * 
      * Safely handles malformed JSON (missing fields, non-object types) by returning
      * conservative defaults (Unknown version, all flags false).
      * 
      * @param JsonStr The JSON string extracted from a GLB file's JSON chunk
      * @return FVrmMetaFeatures struct with detected SpecVersion and feature flags.
-     *         On parse failure (invalid JSON), all fields are set to Unknown/false (conservative defaults).
+     *         On parse failure (invalid JSON), all fields are set to Unknown/false (conservative defaults);
+     *         text past the point where the result is final is not validated (see ParseMetaFeaturesFromUtf8).
      */
     FVrmMetaFeatures ParseMetaFeaturesFromJson(const FString& JsonStr);
 
+    /**
+     * Parse VRM metadata features straight from UTF-8 JSON (e.g. a GLB JSON chunk).
+     * 
+     * Streams the JSON once with FVrmParser::ScanVrmFeatures, the scan the runtime probe uses, and
+     * only descends into the members the detection rules need; unrelated subtrees are skipped
+     * without allocation and the scan stops as soon as the result is final. No DOM is built.
+     * 
+     * Validation is relaxed accordingly: text after the point where the result is final is never
+     * read, so JSON malformed only past that point (e.g. after the extensions object of a VRM1 file)
+     * still yields the detected features, where the DOM path rejects it. ParseMetaFeaturesFromDocument
+     * does not: the document has parsed its whole JSON chunk on load and an invalid one yields defaults.
+     * 
+     * @param JsonUtf8 UTF-8 JSON text
+     * @return FVrmMetaFeatures struct with detected SpecVersion and feature flags.
+     *         On parse failure before the result is final, all fields are set to Unknown/false (conservative defaults).
+     */
+    FVrmMetaFeatures ParseMetaFeaturesFromUtf8(TArrayView<const uint8> JsonUtf8);
+
+    /**
+     * Parse VRM metadata features from an already deserialized glTF JSON root.
+     * 
+     * Same detection rules as ParseMetaFeaturesFromJson; an invalid root yields conservative defaults.
+     * 
+     * @param RootObj The glTF JSON root object
+     * @return FVrmMetaFeatures struct with detected SpecVersion and feature flags
+     */
+    FVrmMetaFeatures ParseMetaFeaturesFromJsonObject(const TSharedPtr<FJsonObject>& RootObj);
+
+    /**
+     * Parse VRM metadata features from a parsed GLB document (scans the document's JSON chunk bytes).
+     * A JSON chunk the document failed to parse yields conservative defaults, as on the DOM path.
+     * 
+     * @param Document The parsed GLB document
+     * @return FVrmMetaFeatures struct with detected SpecVersion and feature flags
+     */
+    FVrmMetaFeatures ParseMetaFeaturesFromDocument(const FVrmGlbDocument& Document);
+
     /**
      * Format detected VRM metadata features into a compact, deterministic single-line diagnostic string.
      * 
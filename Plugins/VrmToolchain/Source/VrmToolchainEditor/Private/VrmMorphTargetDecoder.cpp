@@ -0,0 +1,143 @@
+#include "VrmMorphTargetDecoder.h"
+#include "Math/VectorRegister.h"
+
+void FVrmMorphDeltas::SetNumUninitialized(int32 NewNum)
+{
+	Vertices.SetNumUninitialized(NewNum, EAllowShrinking::No);
+	PositionX.SetNumUninitialized(NewNum, EAllowShrinking::No);
+	PositionY.SetNumUninitialized(NewNum, EAllowShrinking::No);
+	PositionZ.SetNumUninitialized(NewNum, EAllowShrinking::No);
+	NormalX.SetNumUninitialized(NewNum, EAllowShrinking::No);
+	NormalY.SetNumUninitialized(NewNum, EAllowShrinking::No);
+	NormalZ.SetNumUninitialized(NewNum, EAllowShrinking::No);
+}
+
+namespace VrmMorphTargetDecoder
+{
+	/** Every (vertex, delta) a view may hold: its substitutions, or every element when it has a dense base */
+	static void Gather(const TGltfSparseAccessorView<FVector3f>& View, TArray<int32>& OutVertices, TArray<FVector3f>& OutValues)
+	{
+		const int32 NumEntries = View.HasBase() ? View.Num() : View.Indices.Num();
+		OutVertices.Reset(NumEntries);
+		OutValues.Reset(NumEntries);
+
+		// Dense target: one bulk conversion instead of a per-element merge
+		if (View.HasBase() && View.Indices.IsEmpty())
+		{
+			OutValues.SetNumUninitialized(NumEntries);
+			View.Base.CopyTo(OutValues.GetData());
+			OutVertices.SetNumUninitialized(NumEntries);
+			for (int32 Vertex = 0; Vertex < NumEntries; ++Vertex)
+			{
+				OutVertices[Vertex] = Vertex;
+			}
+			return;
+		}
+
+		View.ForEach([&OutVertices, &OutValues](int32 Vertex, const FVector3f& Value)
+		{
+			OutVertices.Add(Vertex);
+			OutValues.Add(Value);
+		});
+	}
+
+	void Decode(
+		const TGltfSparseAccessorView<FVector3f>& Positions,
+		const TGltfSparseAccessorView<FVector3f>& Normals,
+		float PositionThreshold,
+		float NormalThreshold,
+		FVrmMorphDeltas& OutDeltas)
+	{
+		TArray<int32> PositionVertices;
+		TArray<FVector3f> PositionValues;
+		Gather(Positions, PositionVertices, PositionValues);
+
+		TArray<int32> NormalVertices;
+		TArray<FVector3f> NormalValues;
+		Gather(Normals, NormalVertices, NormalValues);
+
+		// Both lists are in increasing vertex order: one merge pass splits them into the SoA streams
+		OutDeltas.SetNumUninitialized(PositionVertices.Num() + NormalVertices.Num());
+		int32 PositionEntry = 0;
+		int32 NormalEntry = 0;
+		int32 Out = 0;
+		while (PositionEntry < PositionVertices.Num() || NormalEntry < NormalVertices.Num())
+		{
+			const int32 PositionVertex = PositionEntry < PositionVertices.Num() ? PositionVertices[PositionEntry] : MAX_int32;
+			const int32 NormalVertex = NormalEntry < NormalVertices.Num() ? NormalVertices[NormalEntry] : MAX_int32;
+			const int32 Vertex = FMath::Min(PositionVertex, NormalVertex);
+			const FVector3f Position = PositionVertex == Vertex ? PositionValues[PositionEntry++] : FVector3f::ZeroVector;
+			const FVector3f Normal = NormalVertex == Vertex ? NormalValues[NormalEntry++] : FVector3f::ZeroVector;
+
+			OutDeltas.Vertices[Out] = Vertex;
+			OutDeltas.PositionX[Out] = Position.X;
+			OutDeltas.PositionY[Out] = Position.Y;
+			OutDeltas.PositionZ[Out] = Position.Z;
+			OutDeltas.NormalX[Out] = Normal.X;
+			OutDeltas.NormalY[Out] = Normal.Y;
+			OutDeltas.NormalZ[Out] = Normal.Z;
+			++Out;
+		}
+		OutDeltas.SetNumUninitialized(Out);
+
+		CullNearZero(OutDeltas, PositionThreshold, NormalThreshold);
+	}
+
+	int32 CullNearZero(FVrmMorphDeltas& Deltas, float PositionThreshold, float NormalThreshold)
+	{
+		const int32 Num = Deltas.Num();
+		int32* Vertices = Deltas.Vertices.GetData();
+		float* Streams[6] = { Deltas.PositionX.GetData(), Deltas.PositionY.GetData(), Deltas.PositionZ.GetData(),
+			Deltas.NormalX.GetData(), Deltas.NormalY.GetData(), Deltas.NormalZ.GetData() };
+
+		auto MoveEntry = [Vertices, &Streams](int32 From, int32 To)
+		{
+			Vertices[To] = Vertices[From];
+			for (float* Stream : Streams)
+			{
+				Stream[To] = Stream[From];
+			}
+		};
+
+		int32 Write = 0;
+		int32 Entry = 0;
+
+		// Four entries per step: the largest |component| of each delta against its threshold
+		const VectorRegister4Float PositionLimit = VectorSetFloat1(PositionThreshold);
+		const VectorRegister4Float NormalLimit = VectorSetFloat1(NormalThreshold);
+		for (; Entry + 4 <= Num; Entry += 4)
+		{
+			const VectorRegister4Float Position = VectorMax(VectorMax(VectorAbs(VectorLoad(Streams[0] + Entry)), VectorAbs(VectorLoad(Streams[1] + Entry))), VectorAbs(VectorLoad(Streams[2] + Entry)));
+			const VectorRegister4Float Normal = VectorMax(VectorMax(VectorAbs(VectorLoad(Streams[3] + Entry)), VectorAbs(VectorLoad(Streams[4] + Entry))), VectorAbs(VectorLoad(Streams[5] + Entry)));
+			const uint32 Keep = VectorMaskBits(VectorBitwiseOr(VectorCompareGT(Position, PositionLimit), VectorCompareGT(Normal, NormalLimit)));
+
+			// Nothing culled so far and all four kept: the entries are already in place
+			if (Keep == 0xF && Write == Entry)
+			{
+				Write += 4;
+				continue;
+			}
+
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				if (Keep & (1u << Lane))
+				{
+					MoveEntry(Entry + Lane, Write++);
+				}
+			}
+		}
+
+		for (; Entry < Num; ++Entry)
+		{
+			const float Position = FMath::Max3(FMath::Abs(Streams[0][Entry]), FMath::Abs(Streams[1][Entry]), FMath::Abs(Streams[2][Entry]));
+			const float Normal = FMath::Max3(FMath::Abs(Streams[3][Entry]), FMath::Abs(Streams[4][Entry]), FMath::Abs(Streams[5][Entry]));
+			if (Position > PositionThreshold || Normal > NormalThreshold)
+			{
+				MoveEntry(Entry, Write++);
+			}
+		}
+
+		Deltas.SetNumUninitialized(Write);
+		return Write;
+	}
+}
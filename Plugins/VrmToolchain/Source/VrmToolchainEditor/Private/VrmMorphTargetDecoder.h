@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VrmGltfAccessorView.h"
+
+/** Deltas of one morph target on one primitive as parallel streams (SoA), in increasing vertex order */
+struct FVrmMorphDeltas
+{
+	/** Primitive-local vertex of each entry */
+	TArray<int32> Vertices;
+
+	/** Position delta components, UE axes */
+	TArray<float> PositionX;
+	TArray<float> PositionY;
+	TArray<float> PositionZ;
+
+	/** Normal delta components, UE axes (zero when the target has no NORMAL) */
+	TArray<float> NormalX;
+	TArray<float> NormalY;
+	TArray<float> NormalZ;
+
+	int32 Num() const { return Vertices.Num(); }
+
+	FVector3f GetPosition(int32 Entry) const { return FVector3f(PositionX[Entry], PositionY[Entry], PositionZ[Entry]); }
+	FVector3f GetNormal(int32 Entry) const { return FVector3f(NormalX[Entry], NormalY[Entry], NormalZ[Entry]); }
+
+	/** Resizes every stream (contents unspecified) */
+	void SetNumUninitialized(int32 NewNum);
+};
+
+/**
+ * Decoder for glTF morph target (blend shape) deltas.
+ *
+ * Targets arrive as sparse accessor views; decoding merges the POSITION and NORMAL deltas of a target
+ * into one SoA stream and drops the entries that do not move, so the mesh builder only touches
+ * displaced vertices. VRM face rigs are dominated by such entries: most of the 50-100 expressions
+ * displace a few hundred vertices of a mesh with tens of thousands.
+ */
+namespace VrmMorphTargetDecoder
+{
+	/** glTF units are meters: a hundredth of a millimetre */
+	static constexpr float DefaultPositionThreshold = 1.0e-5f;
+	static constexpr float DefaultNormalThreshold = 1.0e-4f;
+
+	/**
+	 * Decodes one target of a primitive
+	 * @param Positions POSITION deltas (a view with no data when absent)
+	 * @param Normals NORMAL deltas (a view with no data when absent)
+	 * @param PositionThreshold Largest position delta component still treated as zero
+	 * @param NormalThreshold Largest normal delta component still treated as zero
+	 * @param OutDeltas Entries of every vertex with a delta above either threshold
+	 */
+	void Decode(
+		const TGltfSparseAccessorView<FVector3f>& Positions,
+		const TGltfSparseAccessorView<FVector3f>& Normals,
+		float PositionThreshold,
+		float NormalThreshold,
+		FVrmMorphDeltas& OutDeltas);
+
+	/**
+	 * Removes, in place and in order, every entry whose position and normal delta components are all
+	 * within the thresholds. Four entries are classified per step with SSE/NEON compares.
+	 * @return Remaining entry count
+	 */
+	int32 CullNearZero(FVrmMorphDeltas& Deltas, float PositionThreshold, float NormalThreshold);
+}
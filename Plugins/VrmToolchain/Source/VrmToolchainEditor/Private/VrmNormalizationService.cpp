@@ -1,6 +1,7 @@
 #include "VrmNormalizationService.h"
 #include "VrmNormalizationSettings.h"
 #include "VrmToolchainEditor.h"
+#include "VrmToolchain/VrmGlbContainer.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFileManager.h"
@@ -114,6 +115,15 @@ bool FVrmNormalizationService::PerformNormalization(const FString& InPath, const
 		return false;
 	}
 
+	// Validate the GLB header and chunk table once; the same index serves any later chunk access
+	FVrmGlbContainer Container;
+	FString ContainerError;
+	if (!Container.Parse(SourceData, ContainerError))
+	{
+		OutErrorMessage = FString::Printf(TEXT("Invalid VRM/GLB file %s: %s"), *InPath, *ContainerError);
+		return false;
+	}
+
 	// TODO: Integrate vrm_normalizers.lib to perform actual normalization.
 	// This is a placeholder stub demonstrating the end-to-end flow.
 	// See Plugins/VrmToolchain/README.md "VRM Normalization Feature" for details.
@@ -151,6 +161,7 @@ bool FVrmNormalizationService::PerformNormalization(const FString& InPath, const
 	OutReport->SetStringField(TEXT("output_file"), OutPath);
 	OutReport->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
 	OutReport->SetNumberField(TEXT("source_size_bytes"), SourceData.Num());
+	OutReport->SetNumberField(TEXT("chunk_count"), Container.GetChunks().Num());
 	OutReport->SetBoolField(TEXT("success"), true);
 
 	// Record changes (currently none, as we're just copying)
@@ -1,6 +1,19 @@
 #include "VrmSkeletalMeshBuilder.h"
+#include "VrmMorphTargetDecoder.h"
+#include "VrmAccessorKernels.h"
+#include "VrmTangentSpace.h"
+#include "VrmMeshOptimizer.h"
+#include "VrmToolchain/VrmGlbDocument.h"
+#include "VrmToolchain/VrmGltfModel.h"
+#include "VrmToolchainEditor.h"
 #include "Engine/SkeletalMesh.h"
 #include "Animation/Skeleton.h"
+#include "Animation/MorphTarget.h"
+#include "BoneWeights.h"
+#include "GPUSkinPublicDefs.h"
+#include "MeshDescription.h"
+#include "SkeletalMeshAttributes.h"
+#include "ObjectTools.h"
 #include "MeshUtilities.h"
 #include "Rendering/SkeletalMeshLODImporterData.h"
 #include "Rendering/SkeletalMeshLODModel.h"
@@ -9,217 +22,1607 @@
 #include "UObject/Package.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Misc/PackageName.h"
+#include "Async/ParallelFor.h"
+#include "DerivedDataCache.h"
+#include "DerivedDataCacheKey.h"
+#include "DerivedDataRequestOwner.h"
+#include "DerivedDataValue.h"
+#include "Hash/Blake3.h"
+#include "Hash/CityHash.h"
+#include "Misc/EngineVersion.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
-FVrmSkeletalMeshBuilder::FBuildResult FVrmSkeletalMeshBuilder::BuildLod0SkinnedPrimitive(
-    const FVrmGlbAccessorReader& AccessorReader,
-    USkeleton* TargetSkeleton,
-    const TMap<int32, int32>& JointOrdinalToBoneIndex,
-    const FString& PackageName,
-    const FString& AssetName)
+namespace
 {
-    FBuildResult Result;
+    /** Where one primitive lands in the merged import data */
+    struct FPrimitiveSlot
+    {
+        int32 PointBase = 0;
+        int32 WedgeBase = 0;
+        int32 FaceBase = 0;
+        int32 MatIndex = 0;
 
-    // Validate inputs
-    if (!TargetSkeleton)
+        /** False when an earlier primitive already filled the points and influences this one reuses */
+        bool bOwnsPoints = true;
+
+        /** Primitive that filled the points this one uses: itself when it owns them */
+        int32 OwnerIndex = 0;
+
+        TArray<SkeletalMeshImportData::FRawBoneInfluence> Influences;
+        FString Error;
+    };
+
+    /** Marks joint ordinals without a bone in the remap table */
+    constexpr uint16 UnmappedJoint = MAX_uint16;
+
+    /** Influences kept per vertex: every JOINTS_n/WEIGHTS_n set is merged, then reduced to what skinning supports */
+    constexpr int32 MaxVertexInfluences = FMath::Min(MAX_TOTAL_INFLUENCES, FVrmGltfPrimitive::MaxInfluenceSets * 4);
+
+    /** Where every primitive lands in the merged mesh */
+    struct FPrimitiveLayout
     {
-        Result.ErrorMessage = TEXT("TargetSkeleton is null");
-        return Result;
+        TArray<FPrimitiveSlot> Slots;
+
+        /** glTF material of each material slot, in order of first use */
+        TArray<int32> GltfMaterials;
+
+        int32 NumPoints = 0;
+        int32 NumWedges = 0;
+        int32 NumFaces = 0;
+
+        /** First import point of each primitive (its owner's for primitives sharing points) */
+        TArray<int32> GetPointBases() const
+        {
+            TArray<int32> PointBases;
+            PointBases.Reserve(Slots.Num());
+            for (const FPrimitiveSlot& Slot : Slots)
+            {
+                PointBases.Add(Slot.PointBase);
+            }
+            return PointBases;
+        }
+    };
+
+    /**
+     * Map key of the accessors a primitive reads its points and influences from: primitives of one glTF mesh
+     * with equal keys share their points. Views of the same accessor match, so this stands for the accessor indices.
+     */
+    struct FPointSourceKey
+    {
+        const FVrmGlbAccessorReader::FPrimitive* Primitive = nullptr;
+
+        bool operator==(const FPointSourceKey& Other) const
+        {
+            const FVrmGlbAccessorReader::FPrimitive& A = *Primitive;
+            const FVrmGlbAccessorReader::FPrimitive& B = *Other.Primitive;
+            return A.MeshIndex == B.MeshIndex
+                && A.Positions == B.Positions && A.Joints == B.Joints && A.Weights == B.Weights
+                && A.ExtraJoints == B.ExtraJoints && A.ExtraWeights == B.ExtraWeights;
+        }
+
+        friend uint32 GetTypeHash(const FPointSourceKey& Key)
+        {
+            uint32 Hash = GetTypeHash(Key.Primitive->MeshIndex);
+            Hash = HashCombineFast(Hash, GetTypeHash(Key.Primitive->Positions.GetData()));
+            Hash = HashCombineFast(Hash, GetTypeHash(Key.Primitive->Joints.GetData()));
+            return HashCombineFast(Hash, GetTypeHash(Key.Primitive->Weights.GetData()));
+        }
+    };
+
+    /**
+     * Offsets of every primitive, laid out up front so each converts its accessors straight into its own ranges
+     * in parallel. Primitives of one mesh that share POSITION/JOINTS_n/WEIGHTS_n (material splits of one vertex
+     * buffer) share the points and influences of the first of them, so those accessors are converted once.
+     * Fails when the materials need more slots than the import data's 8-bit material index can address.
+     */
+    bool LayoutPrimitives(const TArray<FVrmGlbAccessorReader::FPrimitive>& Primitives, FPrimitiveLayout& OutLayout, FString& OutError)
+    {
+        TArray<FPrimitiveSlot>& Slots = OutLayout.Slots;
+        Slots.SetNum(Primitives.Num());
+
+        // First primitive reading each set of point accessors, which owns the points
+        TMap<FPointSourceKey, int32> Owners;
+        Owners.Reserve(Primitives.Num());
+
+        for (int32 PrimitiveIndex = 0; PrimitiveIndex < Primitives.Num(); ++PrimitiveIndex)
+        {
+            const FVrmGlbAccessorReader::FPrimitive& Primitive = Primitives[PrimitiveIndex];
+            FPrimitiveSlot& Slot = Slots[PrimitiveIndex];
+
+            const int32 OwnerIndex = Owners.FindOrAdd(FPointSourceKey{ &Primitive }, PrimitiveIndex);
+            Slot.OwnerIndex = OwnerIndex;
+            if (OwnerIndex < PrimitiveIndex)
+            {
+                Slot.PointBase = Slots[OwnerIndex].PointBase;
+                Slot.bOwnsPoints = false;
+            }
+            else
+            {
+                Slot.PointBase = OutLayout.NumPoints;
+                OutLayout.NumPoints += Primitive.Positions.Num();
+            }
+
+            Slot.WedgeBase = OutLayout.NumWedges;
+            Slot.FaceBase = OutLayout.NumFaces;
+            Slot.MatIndex = OutLayout.GltfMaterials.AddUnique(Primitive.Material);
+            if (Slot.MatIndex > MAX_uint8)
+            {
+                OutError = FString::Printf(TEXT("Primitive %d needs material slot %d; at most %d material slots are supported"),
+                    Primitive.PrimitiveIndex, Slot.MatIndex + 1, MAX_uint8 + 1);
+                return false;
+            }
+
+            OutLayout.NumWedges += Primitive.Positions.Num();
+            OutLayout.NumFaces += Primitive.Indices.Num() / 3;
+        }
+        return true;
     }
 
-    if (AccessorReader.Positions.Num() == 0)
+    FName GetMaterialSlotName(int32 GltfMaterial)
     {
-        Result.ErrorMessage = TEXT("No vertex positions in accessor data");
-        return Result;
+        return GltfMaterial == INDEX_NONE ? FName(TEXT("DefaultMaterial")) : FName(*FString::Printf(TEXT("Material_%d"), GltfMaterial));
     }
 
-    if (AccessorReader.Indices.Num() == 0)
+    /** First primitive error of a parallel conversion, prefixed with the glTF primitive index */
+    bool CheckSlotErrors(const TArray<FVrmGlbAccessorReader::FPrimitive>& Primitives, const TArray<FPrimitiveSlot>& Slots, FString& OutError)
     {
-        Result.ErrorMessage = TEXT("No triangle indices in accessor data");
-        return Result;
+        for (int32 PrimitiveIndex = 0; PrimitiveIndex < Slots.Num(); ++PrimitiveIndex)
+        {
+            if (!Slots[PrimitiveIndex].Error.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("Primitive %d: %s"), Primitives[PrimitiveIndex].PrimitiveIndex, *Slots[PrimitiveIndex].Error);
+                return false;
+            }
+        }
+        return true;
     }
 
-    if (AccessorReader.Weights.Num() == 0 || AccessorReader.Joints.Num() == 0)
+    /** Joint ordinal -> bone index as a flat table: one load per influence instead of a hash probe */
+    TArray<uint16> MakeJointToBoneTable(const TMap<int32, int32>& JointOrdinalToBoneIndex)
     {
-        Result.ErrorMessage = TEXT("Missing skinning data (weights/joints)");
-        return Result;
+        int32 MaxJointOrdinal = INDEX_NONE;
+        for (const TPair<int32, int32>& Mapping : JointOrdinalToBoneIndex)
+        {
+            MaxJointOrdinal = FMath::Max(MaxJointOrdinal, Mapping.Key);
+        }
+
+        TArray<uint16> JointToBone;
+        JointToBone.Init(UnmappedJoint, MaxJointOrdinal + 1);
+        for (const TPair<int32, int32>& Mapping : JointOrdinalToBoneIndex)
+        {
+            if (Mapping.Key >= 0 && Mapping.Value >= 0 && Mapping.Value < UnmappedJoint)
+            {
+                JointToBone[Mapping.Key] = static_cast<uint16>(Mapping.Value);
+            }
+        }
+        return JointToBone;
     }
 
-    // Create package if it doesn't exist
-    UPackage* Package = CreatePackage(*PackageName);
-    if (!Package)
+    /** Node transform a rigid primitive is placed with in the bind pose */
+    struct FRigidTransform
     {
-        Result.ErrorMessage = FString::Printf(TEXT("Failed to create package: %s"), *PackageName);
-        return Result;
+        FMatrix44f Points;
+
+        /** Inverse transpose of Points: normals stay perpendicular under non-uniform scale */
+        FMatrix44f Normals;
+
+        /** Negative determinant: the winding flips along with the geometry */
+        bool bMirrored = false;
+    };
+
+    /** Bone tables of a mesh binding, resolved per primitive through its glTF mesh */
+    class FPrimitiveBindings
+    {
+    public:
+        explicit FPrimitiveBindings(const FVrmGltfMeshBinding& InBinding)
+            : Binding(InBinding)
+        {
+            for (const TMap<int32, int32>& JointOrdinalToBoneIndex : Binding.SkinJointToBone)
+            {
+                SkinJointToBone.Add(MakeJointToBoneTable(JointOrdinalToBoneIndex));
+            }
+
+            RigidTransforms.SetNum(Binding.MeshRigidTransforms.Num());
+            for (int32 MeshIndex = 0; MeshIndex < Binding.MeshRigidTransforms.Num(); ++MeshIndex)
+            {
+                const FMatrix44f& Transform = Binding.MeshRigidTransforms[MeshIndex];
+                if (!Transform.Equals(FMatrix44f::Identity))
+                {
+                    FRigidTransform& Rigid = RigidTransforms[MeshIndex].Emplace();
+                    Rigid.Points = Transform;
+                    Rigid.Normals = Transform.Inverse().GetTransposed();
+                    Rigid.bMirrored = Transform.Determinant() < 0.0f;
+                }
+            }
+        }
+
+        /** Joint table of the skin of the primitive's mesh; null when the mesh has none */
+        const TArray<uint16>* GetJointToBone(const FVrmGlbAccessorReader::FPrimitive& Primitive) const
+        {
+            const int32 Skin = Binding.MeshSkins.IsValidIndex(Primitive.MeshIndex) ? Binding.MeshSkins[Primitive.MeshIndex] : INDEX_NONE;
+            return SkinJointToBone.IsValidIndex(Skin) ? &SkinJointToBone[Skin] : nullptr;
+        }
+
+        /** Bone every vertex of a rigid primitive follows */
+        uint16 GetRigidBone(const FVrmGlbAccessorReader::FPrimitive& Primitive) const
+        {
+            const int32 Bone = Binding.MeshRigidBones.IsValidIndex(Primitive.MeshIndex) ? Binding.MeshRigidBones[Primitive.MeshIndex] : 0;
+            return Bone >= 0 && Bone < UnmappedJoint ? static_cast<uint16>(Bone) : 0;
+        }
+
+        /** Node transform of a rigid primitive; null when it is placed as authored */
+        const FRigidTransform* GetRigidTransform(const FVrmGlbAccessorReader::FPrimitive& Primitive) const
+        {
+            return RigidTransforms.IsValidIndex(Primitive.MeshIndex) && RigidTransforms[Primitive.MeshIndex].IsSet()
+                ? &RigidTransforms[Primitive.MeshIndex].GetValue() : nullptr;
+        }
+
+    private:
+        const FVrmGltfMeshBinding& Binding;
+        TArray<TArray<uint16>> SkinJointToBone;
+        TArray<TOptional<FRigidTransform>> RigidTransforms;
+    };
+
+    /** Points of a rigid primitive moved to its node, in place */
+    void TransformPoints(const FRigidTransform& Transform, TArrayView<FVector3f> Points)
+    {
+        for (FVector3f& Point : Points)
+        {
+            Point = FVector3f(Transform.Points.TransformPosition(Point));
+        }
     }
 
-    // Create skeletal mesh asset
-    USkeletalMesh* SkeletalMesh = NewObject<USkeletalMesh>(Package, *AssetName, RF_Public | RF_Standalone);
-    if (!SkeletalMesh)
+    /** Corner frames of a rigid primitive moved to its node; a mirroring transform also reverses every triangle */
+    void TransformCornerFrames(const FRigidTransform& Transform, FVrmCornerFrames& Frames, TArray<uint32>& Indices)
     {
-        Result.ErrorMessage = FString::Printf(TEXT("Failed to create skeletal mesh asset: %s"), *AssetName);
-        return Result;
+        for (int32 Corner = 0; Corner < Frames.Num(); ++Corner)
+        {
+            Frames.TangentX[Corner] = FVector3f(Transform.Points.TransformVector(Frames.TangentX[Corner])).GetSafeNormal();
+            Frames.TangentY[Corner] = FVector3f(Transform.Points.TransformVector(Frames.TangentY[Corner])).GetSafeNormal();
+            Frames.TangentZ[Corner] = FVector3f(Transform.Normals.TransformVector(Frames.TangentZ[Corner])).GetSafeNormal();
+        }
+
+        if (Transform.bMirrored)
+        {
+            for (int32 Corner = 0; Corner + 2 < Indices.Num(); Corner += 3)
+            {
+                Swap(Indices[Corner + 1], Indices[Corner + 2]);
+                Swap(Frames.TangentX[Corner + 1], Frames.TangentX[Corner + 2]);
+                Swap(Frames.TangentY[Corner + 1], Frames.TangentY[Corner + 2]);
+                Swap(Frames.TangentZ[Corner + 1], Frames.TangentZ[Corner + 2]);
+            }
+        }
     }
 
-    // Set skeleton reference
-    SkeletalMesh->SetSkeleton(TargetSkeleton);
+    /** Morph deltas of a rigid primitive turned with its node (translation does not apply to deltas) */
+    void TransformMorphDeltas(const FRigidTransform* Transform, FVector3f& PositionDelta, FVector3f& NormalDelta)
+    {
+        if (Transform)
+        {
+            PositionDelta = FVector3f(Transform->Points.TransformVector(PositionDelta));
+            NormalDelta = FVector3f(Transform->Normals.TransformVector(NormalDelta));
+        }
+    }
 
-    // Get mesh utilities
-    IMeshUtilities& MeshUtilities = FModuleManager::Get().LoadModuleChecked<IMeshUtilities>("MeshUtilities");
+    /** Influences of every vertex of a primitive, MaxVertexInfluences slots per vertex of which Counts are used */
+    struct FVertexInfluences
+    {
+        TArray<float> Weights;
+        TArray<uint16> Bones;
+        TArray<uint8> Counts;
+    };
 
-    // Create import data structure
-    FSkeletalMeshImportData ImportData;
+    /**
+     * Every influence set of a primitive converted in bulk, pruned to the strongest influences, renormalized
+     * and remapped to bone indices through the skin of its mesh. Rigid primitives follow their node's bone.
+     */
+    bool ReduceVertexInfluences(
+        const FVrmGlbAccessorReader::FPrimitive& Primitive,
+        const FPrimitiveBindings& Bindings,
+        FVertexInfluences& OutInfluences,
+        FString& OutError)
+    {
+        // Unused slots stay zero, so vertices with equal influences compare equal byte for byte when welding
+        const int32 NumVertices = Primitive.Positions.Num();
+        OutInfluences.Weights.SetNumZeroed(NumVertices * MaxVertexInfluences);
+        OutInfluences.Bones.SetNumZeroed(NumVertices * MaxVertexInfluences);
+        OutInfluences.Counts.SetNumUninitialized(NumVertices);
+
+        if (!Primitive.IsSkinned())
+        {
+            const uint16 RigidBone = Bindings.GetRigidBone(Primitive);
+            for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+            {
+                OutInfluences.Weights[VertexIndex * MaxVertexInfluences] = 1.0f;
+                OutInfluences.Bones[VertexIndex * MaxVertexInfluences] = RigidBone;
+                OutInfluences.Counts[VertexIndex] = 1;
+            }
+            return true;
+        }
+
+        const TArray<uint16>* JointToBonePtr = Bindings.GetJointToBone(Primitive);
+        if (!JointToBonePtr)
+        {
+            OutError = FString::Printf(TEXT("Mesh %d has skin weights but no node binds it to a skin"), Primitive.MeshIndex);
+            return false;
+        }
+        const TArray<uint16>& JointToBone = *JointToBonePtr;
+
+        const int32 NumSets = Primitive.NumInfluenceSets();
+        TArray<FVector4f> SetWeights;
+        TArray<FIntVector4> SetJoints;
+        SetWeights.SetNumUninitialized(NumSets * NumVertices);
+        SetJoints.SetNumUninitialized(NumSets * NumVertices);
+
+        const FVector4f* SetWeightData[FVrmGltfPrimitive::MaxInfluenceSets];
+        const FIntVector4* SetJointData[FVrmGltfPrimitive::MaxInfluenceSets];
+        for (int32 Set = 0; Set < NumSets; ++Set)
+        {
+            FVector4f* Weights = SetWeights.GetData() + Set * NumVertices;
+            FIntVector4* Joints = SetJoints.GetData() + Set * NumVertices;
+            (Set == 0 ? Primitive.Weights : Primitive.ExtraWeights[Set - 1]).CopyTo(Weights);
+            (Set == 0 ? Primitive.Joints : Primitive.ExtraJoints[Set - 1]).CopyTo(Joints);
+            SetWeightData[Set] = Weights;
+            SetJointData[Set] = Joints;
+        }
+
+        TArray<int32> Joints;
+        Joints.SetNumUninitialized(NumVertices * MaxVertexInfluences);
+        VrmAccessorKernels::ReduceInfluences(SetWeightData, SetJointData, NumSets, NumVertices, MaxVertexInfluences,
+            OutInfluences.Weights.GetData(), Joints.GetData(), OutInfluences.Counts.GetData());
+
+        for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+        {
+            const int32 First = VertexIndex * MaxVertexInfluences;
+            for (int32 InfluenceIndex = First; InfluenceIndex < First + OutInfluences.Counts[VertexIndex]; ++InfluenceIndex)
+            {
+                // Map joint ordinal to bone index
+                const int32 JointOrdinal = Joints[InfluenceIndex];
+                const uint16 BoneIndex = JointToBone.IsValidIndex(JointOrdinal) ? JointToBone[JointOrdinal] : UnmappedJoint;
+                if (BoneIndex == UnmappedJoint)
+                {
+                    OutError = FString::Printf(TEXT("Joint ordinal %d not found in bone mapping"), JointOrdinal);
+                    return false;
+                }
+                OutInfluences.Bones[InfluenceIndex] = BoneIndex;
+            }
+        }
+        return true;
+    }
+
+    /** Whole triangles of a primitive's indices, every index checked against its vertices */
+    bool CopyTriangleIndices(const FVrmGlbAccessorReader::FPrimitive& Primitive, TArray<uint32>& OutIndices, FString& OutError)
+    {
+        const int32 PrimitiveVertices = Primitive.Positions.Num();
+        OutIndices.SetNumUninitialized(Primitive.Indices.Num());
+        Primitive.Indices.CopyTo(OutIndices.GetData());
+        OutIndices.SetNum(Primitive.Indices.Num() / 3 * 3);
+        for (const uint32 Index : OutIndices)
+        {
+            if (Index >= static_cast<uint32>(PrimitiveVertices))
+            {
+                OutError = FString::Printf(TEXT("Index %u out of range (%d vertices)"), Index, PrimitiveVertices);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Converted indices as the accessor view the tangent space reads */
+    TGltfAccessorView<uint32> MakeIndexView(const TArray<uint32>& Indices)
+    {
+        return TGltfAccessorView<uint32>(reinterpret_cast<const uint8*>(Indices.GetData()), sizeof(uint32), Indices.Num(), EVrmGltfComponentType::UnsignedInt);
+    }
+
+    /** One morph target of the skeletal mesh: every (primitive, glTF target) pair that carries its name */
+    struct FMorphTargetSource
+    {
+        FString GltfName;
+        FName Name;
+        TArray<TPair<int32, int32>> PrimitiveTargets;
+        TArray<FMorphTargetDelta> Deltas;
+    };
+
+    /** extras.targetNames entry of a glTF mesh target, or a name derived from the mesh */
+    FString GetMorphTargetName(const FVrmGltfModel* Model, int32 MeshIndex, int32 TargetIndex)
+    {
+        FString Name;
+        if (Model && Model->Meshes.IsValidIndex(MeshIndex))
+        {
+            const FVrmGltfMesh& Mesh = Model->Meshes[MeshIndex];
+            if (Mesh.TargetNames.IsValidIndex(TargetIndex))
+            {
+                Name = Mesh.TargetNames[TargetIndex];
+            }
+            else if (!Mesh.Name.IsEmpty())
+            {
+                Name = FString::Printf(TEXT("%s_Morph_%d"), *Mesh.Name, TargetIndex);
+            }
+        }
+        if (Name.IsEmpty())
+        {
+            Name = FString::Printf(TEXT("Mesh_%d_Morph_%d"), MeshIndex, TargetIndex);
+        }
+        return Name;
+    }
+
+    /** True if both sparse views read the same accessor data */
+    bool IsSameMorphAccessor(const TGltfSparseAccessorView<FVector3f>& A, const TGltfSparseAccessorView<FVector3f>& B)
+    {
+        return A.Count == B.Count && A.Base == B.Base && A.Indices == B.Indices && A.Values == B.Values;
+    }
+
+    /** Map key funcs for glTF target names, which differ by case alone as often as not ("A" and "a" visemes) */
+    struct FCaseSensitiveNameKeyFuncs : BaseKeyFuncs<TPair<FString, int32>, FString, false>
+    {
+        static const FString& GetSetKey(const TPair<FString, int32>& Element) { return Element.Key; }
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+    };
+
+    /**
+     * Morph targets of the mesh by glTF name: targets sharing a name (the same glTF target split across material
+     * primitives, or across meshes) merge into one. Every primitive contributes its targets at its points, so
+     * targets only present on primitives sharing points with an earlier one are kept (each point takes one delta,
+     * see ForEachMorphTargetDelta); a target reading the same accessors at the same points as one already gathered
+     * is not decoded twice. Names are left to AssignMorphTargetNames, so welding can gather the targets without
+     * warning about them twice.
+     */
+    void GatherMorphTargetSources(const FVrmGlbAccessorReader& AccessorReader, const TArray<int32>& PointBases, TArray<FMorphTargetSource>& OutSources)
+    {
+        const TArray<FVrmGlbAccessorReader::FPrimitive>& Primitives = AccessorReader.Primitives;
+        const FVrmGltfModel* Model = AccessorReader.GetDocument() ? &AccessorReader.GetDocument()->GetModel() : nullptr;
+
+        TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveNameKeyFuncs> SourceByName;
+        for (int32 PrimitiveIndex = 0; PrimitiveIndex < Primitives.Num(); ++PrimitiveIndex)
+        {
+            const FVrmGlbAccessorReader::FPrimitive& Primitive = Primitives[PrimitiveIndex];
+            for (int32 TargetIndex = 0; TargetIndex < Primitive.NumMorphTargets(); ++TargetIndex)
+            {
+                const FString Name = GetMorphTargetName(Model, Primitive.MeshIndex, TargetIndex);
+                int32& SourceIndex = SourceByName.FindOrAdd(Name, INDEX_NONE);
+                if (SourceIndex == INDEX_NONE)
+                {
+                    SourceIndex = OutSources.Num();
+                    OutSources.AddDefaulted_GetRef().GltfName = Name;
+                }
+
+                FMorphTargetSource& Source = OutSources[SourceIndex];
+                const bool bGathered = Source.PrimitiveTargets.ContainsByPredicate([&Primitives, &Primitive, &PointBases, PrimitiveIndex, TargetIndex](const TPair<int32, int32>& Gathered)
+                {
+                    const FVrmGlbAccessorReader::FPrimitive& Other = Primitives[Gathered.Key];
+                    return PointBases[Gathered.Key] == PointBases[PrimitiveIndex]
+                        && IsSameMorphAccessor(Other.MorphPositions[Gathered.Value], Primitive.MorphPositions[TargetIndex])
+                        && IsSameMorphAccessor(Other.MorphNormals[Gathered.Value], Primitive.MorphNormals[TargetIndex]);
+                });
+                if (!bGathered)
+                {
+                    Source.PrimitiveTargets.Emplace(PrimitiveIndex, TargetIndex);
+                }
+            }
+        }
+    }
+
+    /** Sanitized object names of the gathered morph targets; names that only collide once sanitized get a numbered suffix */
+    void AssignMorphTargetNames(TArray<FMorphTargetSource>& Sources)
+    {
+        TMap<FName, FString> NameOwners;
+        for (FMorphTargetSource& Source : Sources)
+        {
+            const FString Sanitized = ObjectTools::SanitizeObjectName(Source.GltfName);
+            FName UniqueName(*Sanitized);
+            for (int32 Suffix = 1; NameOwners.Contains(UniqueName); ++Suffix)
+            {
+                UniqueName = FName(*FString::Printf(TEXT("%s_%d"), *Sanitized, Suffix));
+            }
+            if (UniqueName != FName(*Sanitized))
+            {
+                UE_LOG(LogVrmToolchainEditor, Warning, TEXT("Morph target \"%s\" renamed to %s: \"%s\" already has its name %s"),
+                    *Source.GltfName, *UniqueName.ToString(), *NameOwners.FindChecked(FName(*Sanitized)), *Sanitized);
+            }
+            NameOwners.Add(UniqueName, Source.GltfName);
+            Source.Name = UniqueName;
+        }
+    }
+
+    /**
+     * Visit the decoded deltas of a morph target once per import point. Where primitives sharing points both move
+     * a point, the first of them (in glTF order) wins, so both build paths and welding see the same deltas.
+     * Deltas are in glTF space; Visit gets the primitive they came from to transform them.
+     */
+    template<typename VisitType>
+    void ForEachMorphTargetDelta(
+        const TArray<FVrmGlbAccessorReader::FPrimitive>& Primitives,
+        const TArray<int32>& PointBases,
+        int32 NumPoints,
+        const FMorphTargetSource& Source,
+        VisitType&& Visit)
+    {
+        TBitArray<> Resolved(false, NumPoints);
+        FVrmMorphDeltas Deltas;
+        for (const TPair<int32, int32>& PrimitiveTarget : Source.PrimitiveTargets)
+        {
+            const FVrmGlbAccessorReader::FPrimitive& Primitive = Primitives[PrimitiveTarget.Key];
+            VrmMorphTargetDecoder::Decode(Primitive.MorphPositions[PrimitiveTarget.Value], Primitive.MorphNormals[PrimitiveTarget.Value],
+                VrmMorphTargetDecoder::DefaultPositionThreshold, VrmMorphTargetDecoder::DefaultNormalThreshold, Deltas);
+
+            const int32 PointBase = PointBases[PrimitiveTarget.Key];
+            for (int32 Entry = 0; Entry < Deltas.Num(); ++Entry)
+            {
+                const int32 Point = PointBase + Deltas.Vertices[Entry];
+                if (Point >= NumPoints || Resolved[Point])
+                {
+                    continue;
+                }
+
+                Resolved[Point] = true;
+                Visit(Primitive, Point, Deltas.GetPosition(Entry), Deltas.GetNormal(Entry));
+            }
+        }
+    }
+
+    /**
+     * Hash of every morph delta of each import point (0 where no target moves it), resolved as the morph targets
+     * are built (see ForEachMorphTargetDelta), so welding keeps apart vertices that deform differently whichever
+     * primitive sharing the points carries the targets. Left empty when the mesh has no morph targets.
+     */
+    void ComputeMorphSignatures(
+        const TArray<FVrmGlbAccessorReader::FPrimitive>& Primitives,
+        const TArray<int32>& PointBases,
+        int32 NumPoints,
+        const TArray<FMorphTargetSource>& Sources,
+        TArray<uint64>& OutSignatures)
+    {
+        struct FDeltaKey
+        {
+            int32 SourceIndex;
+            FVector3f Position;
+            FVector3f Normal;
+        };
+
+        OutSignatures.Reset();
+        if (Sources.IsEmpty())
+        {
+            return;
+        }
+
+        // Targets decode in parallel; their deltas are hashed into the points in target order afterwards
+        TArray<TArray<TPair<int32, FDeltaKey>>> SourceKeys;
+        SourceKeys.SetNum(Sources.Num());
+        ParallelFor(Sources.Num(), [&Primitives, &PointBases, &Sources, &SourceKeys, NumPoints](int32 SourceIndex)
+        {
+            ForEachMorphTargetDelta(Primitives, PointBases, NumPoints, Sources[SourceIndex],
+                [&SourceKeys, SourceIndex](const FVrmGlbAccessorReader::FPrimitive& Primitive, int32 Point, const FVector3f& Position, const FVector3f& Normal)
+                {
+                    SourceKeys[SourceIndex].Emplace(Point, FDeltaKey{ SourceIndex, Position, Normal });
+                });
+        });
+
+        OutSignatures.SetNumZeroed(NumPoints);
+        for (const TArray<TPair<int32, FDeltaKey>>& Keys : SourceKeys)
+        {
+            for (const TPair<int32, FDeltaKey>& Key : Keys)
+            {
+                uint64& Signature = OutSignatures[Key.Key];
+                Signature = CityHash64WithSeed(reinterpret_cast<const char*>(&Key.Value), sizeof(FDeltaKey), Signature);
+            }
+        }
+    }
+
+    /** Entries of a per-point array for the points of one primitive, or nothing when the array is empty */
+    template<typename T>
+    TConstArrayView<T> GetPointRange(const TArray<T>& PerPoint, int32 PointBase, int32 NumPrimitivePoints)
+    {
+        return PerPoint.IsEmpty() ? TConstArrayView<T>() : TConstArrayView<T>(PerPoint.GetData() + PointBase, NumPrimitivePoints);
+    }
 
-    // Populate vertex positions
-    ImportData.Points.Reserve(AccessorReader.Positions.Num());
-    for (const FVector3f& Position : AccessorReader.Positions)
+    /**
+     * Weld the split vertices of one primitive that match in everything the build reads (position, normal,
+     * tangent, UV, influences, morph deltas), then reorder its triangles for the post-transform cache and
+     * overdraw (see VrmMeshOptimizer). Welded-away vertices keep their points, which no triangle references
+     * any more, so mappings by point (morph targets) stay valid.
+     * @param Positions UE positions of the primitive's points
+     * @param Influences Reduced influences of the points
+     * @param MorphSignatures Morph delta hashes of the primitive's points (see ComputeMorphSignatures), empty without morph targets
+     * @param Indices Checked triangle indices of the primitive, rewritten in place
+     */
+    void WeldAndOptimizeIndices(
+        const FVrmGlbAccessorReader::FPrimitive& Primitive,
+        TConstArrayView<FVector3f> Positions,
+        const FVertexInfluences& Influences,
+        TConstArrayView<uint64> MorphSignatures,
+        TArray<uint32>& Indices)
     {
-        ImportData.Points.Add(Position);
+        const int32 NumVertices = Primitive.Positions.Num();
+        const float AcmrBefore = UE_LOG_ACTIVE(LogVrmToolchainEditor, Verbose) ? VrmMeshOptimizer::ComputeAcmr(Indices, NumVertices) : 0.0f;
+
+        // A partial attribute accessor pads the build with defaults past its end: such primitives are only reordered
+        auto CoversVertices = [NumVertices](int32 NumAttribute) { return NumAttribute == 0 || NumAttribute == NumVertices; };
+        int32 NumDistinct = NumVertices;
+        if (CoversVertices(Primitive.Normals.Num()) && CoversVertices(Primitive.Tangents.Num()) && CoversVertices(Primitive.TexCoords.Num()))
+        {
+            VrmMeshOptimizer::FVertexStreams Streams;
+            Streams.Add(Positions.GetData(), sizeof(FVector3f));
+
+            TArray<FVector3f> Normals;
+            if (!Primitive.Normals.IsEmpty())
+            {
+                Normals.SetNumUninitialized(NumVertices);
+                Primitive.Normals.CopyTo(Normals.GetData());
+                Streams.Add(Normals.GetData(), sizeof(FVector3f));
+            }
+
+            TArray<FVector4f> Tangents;
+            if (!Primitive.Tangents.IsEmpty())
+            {
+                Tangents.SetNumUninitialized(NumVertices);
+                Primitive.Tangents.CopyTo(Tangents.GetData());
+                Streams.Add(Tangents.GetData(), sizeof(FVector4f));
+            }
+
+            TArray<FVector2f> TexCoords;
+            if (!Primitive.TexCoords.IsEmpty())
+            {
+                TexCoords.SetNumUninitialized(NumVertices);
+                Primitive.TexCoords.CopyTo(TexCoords.GetData());
+                Streams.Add(TexCoords.GetData(), sizeof(FVector2f));
+            }
+
+            Streams.Add(Influences.Weights.GetData(), MaxVertexInfluences * sizeof(float));
+            Streams.Add(Influences.Bones.GetData(), MaxVertexInfluences * sizeof(uint16));
+            Streams.Add(Influences.Counts.GetData(), sizeof(uint8));
+            if (!MorphSignatures.IsEmpty())
+            {
+                Streams.Add(MorphSignatures.GetData(), sizeof(uint64));
+            }
+
+            TArray<uint32> Remap;
+            NumDistinct = VrmMeshOptimizer::WeldVertices(NumVertices, Streams, Remap);
+            if (NumDistinct < NumVertices)
+            {
+                for (uint32& Index : Indices)
+                {
+                    Index = Remap[Index];
+                }
+            }
+        }
+
+        VrmMeshOptimizer::OptimizeVertexCache(Indices, NumVertices);
+        VrmMeshOptimizer::OptimizeOverdraw(Indices, Positions);
+
+        UE_LOG(LogVrmToolchainEditor, Verbose, TEXT("Primitive %d: %d of %d vertices kept, ACMR %.3f -> %.3f"),
+            Primitive.PrimitiveIndex, NumDistinct, NumVertices, AcmrBefore, VrmMeshOptimizer::ComputeAcmr(Indices, NumVertices));
     }
 
-    // Populate wedges (vertex data with UVs)
-    ImportData.Wedges.Reserve(AccessorReader.Positions.Num());
-    for (int32 i = 0; i < AccessorReader.Positions.Num(); ++i)
+    /**
+     * Merge every primitive of the reader into one import data set, each primitive converting into its own
+     * ranges of Points/Wedges/Faces in parallel (see LayoutPrimitives). Owners convert their points first,
+     * so every primitive can weld against the points it shares when bWeldAndOptimize is set. Rigid primitives
+     * are moved to their node's bind pose (see FVrmGltfMeshBinding).
+     * OutPointBases receives the first import point of each primitive (its owner's for primitives sharing points).
+     */
+    bool FillImportData(
+        const FVrmGlbAccessorReader& AccessorReader,
+        const FVrmGltfMeshBinding& Binding,
+        bool bWeldAndOptimize,
+        FSkeletalMeshImportData& ImportData,
+        TArray<FName>& OutMaterialSlots,
+        TArray<int32>& OutPointBases,
+        FString& OutError)
     {
-        SkeletalMeshImportData::FVertex Wedge;
-        Wedge.VertexIndex = i;
-        
-        // Use texcoords if available, otherwise default to zero
-        if (AccessorReader.TexCoords.Num() > i)
+        const TArray<FVrmGlbAccessorReader::FPrimitive>& Primitives = AccessorReader.Primitives;
+
+        FPrimitiveLayout Layout;
+        if (!LayoutPrimitives(Primitives, Layout, OutError))
+        {
+            return false;
+        }
+        TArray<FPrimitiveSlot>& Slots = Layout.Slots;
+
+        for (const int32 GltfMaterial : Layout.GltfMaterials)
+        {
+            const FName SlotName = GetMaterialSlotName(GltfMaterial);
+            OutMaterialSlots.Add(SlotName);
+
+            SkeletalMeshImportData::FMaterial& ImportMaterial = ImportData.Materials.AddDefaulted_GetRef();
+            ImportMaterial.MaterialImportName = SlotName.ToString();
+        }
+
+        ImportData.Points.SetNumUninitialized(Layout.NumPoints);
+        ImportData.Wedges.SetNum(Layout.NumWedges);
+        ImportData.Faces.SetNum(Layout.NumFaces);
+        ImportData.bHasNormals = true;
+        ImportData.bHasTangents = true;
+
+        const FPrimitiveBindings Bindings(Binding);
+
+        // Populate vertex positions and reduce influences: one bulk conversion straight from the BIN chunk per owner
+        TArray<FVertexInfluences> OwnerInfluences;
+        OwnerInfluences.SetNum(Primitives.Num());
+        ParallelFor(Primitives.Num(), [&Primitives, &Slots, &ImportData, &Bindings, &OwnerInfluences](int32 PrimitiveIndex)
+        {
+            const FVrmGlbAccessorReader::FPrimitive& Primitive = Primitives[PrimitiveIndex];
+            FPrimitiveSlot& Slot = Slots[PrimitiveIndex];
+            if (!Slot.bOwnsPoints)
+            {
+                return;
+            }
+
+            Primitive.Positions.CopyTo(ImportData.Points.GetData() + Slot.PointBase);
+            if (const FRigidTransform* Transform = Bindings.GetRigidTransform(Primitive))
+            {
+                TransformPoints(*Transform, MakeArrayView(ImportData.Points.GetData() + Slot.PointBase, Primitive.Positions.Num()));
+            }
+            ReduceVertexInfluences(Primitive, Bindings, OwnerInfluences[PrimitiveIndex], Slot.Error);
+        });
+
+        if (!CheckSlotErrors(Primitives, Slots, OutError))
+        {
+            return false;
+        }
+
+        // Welding compares the morph deltas of each point, from every primitive sharing it
+        OutPointBases = Layout.GetPointBases();
+        TArray<uint64> MorphSignatures;
+        if (bWeldAndOptimize)
         {
-            Wedge.UVs[0] = FVector2f(AccessorReader.TexCoords[i].X, AccessorReader.TexCoords[i].Y);
+            TArray<FMorphTargetSource> Sources;
+            GatherMorphTargetSources(AccessorReader, OutPointBases, Sources);
+            ComputeMorphSignatures(Primitives, OutPointBases, Layout.NumPoints, Sources, MorphSignatures);
         }
-        else
+
+        ParallelFor(Primitives.Num(), [&Primitives, &Slots, &ImportData, &Bindings, &OwnerInfluences, &MorphSignatures, bWeldAndOptimize](int32 PrimitiveIndex)
+        {
+            const FVrmGlbAccessorReader::FPrimitive& Primitive = Primitives[PrimitiveIndex];
+            FPrimitiveSlot& Slot = Slots[PrimitiveIndex];
+            const int32 PrimitiveVertices = Primitive.Positions.Num();
+
+            // Populate wedges (vertex data with UVs)
+            for (int32 i = 0; i < PrimitiveVertices; ++i)
+            {
+                SkeletalMeshImportData::FVertex& Wedge = ImportData.Wedges[Slot.WedgeBase + i];
+                Wedge.VertexIndex = Slot.PointBase + i;
+                Wedge.MatIndex = static_cast<uint8>(Slot.MatIndex);
+
+                // Use texcoords if available, otherwise default to zero
+                Wedge.UVs[0] = Primitive.TexCoords.IsValidIndex(i) ? Primitive.TexCoords[i] : FVector2f::ZeroVector;
+                Wedge.Color = FColor::White;
+            }
+
+            // Populate faces (triangles), welded and reordered on request
+            TArray<uint32> Indices;
+            if (!CopyTriangleIndices(Primitive, Indices, Slot.Error))
+            {
+                return;
+            }
+
+            if (bWeldAndOptimize)
+            {
+                WeldAndOptimizeIndices(Primitive, MakeArrayView(ImportData.Points.GetData() + Slot.PointBase, PrimitiveVertices),
+                    OwnerInfluences[Slot.OwnerIndex], GetPointRange(MorphSignatures, Slot.PointBase, PrimitiveVertices), Indices);
+            }
+
+            // Tangent space per corner: NORMAL/TANGENT when present, flat normals and MikkTSpace tangents otherwise
+            FVrmCornerFrames Frames;
+            VrmTangentSpace::ComputeCornerFrames(Primitive.Positions, Primitive.Normals, Primitive.Tangents, Primitive.TexCoords, MakeIndexView(Indices), Frames);
+            if (const FRigidTransform* Transform = Bindings.GetRigidTransform(Primitive))
+            {
+                TransformCornerFrames(*Transform, Frames, Indices);
+            }
+
+            for (int32 i = 0; i < Indices.Num(); i += 3)
+            {
+                SkeletalMeshImportData::FTriangle& Triangle = ImportData.Faces[Slot.FaceBase + i / 3];
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    Triangle.WedgeIndex[Corner] = Slot.WedgeBase + Indices[i + Corner];
+                }
+                Triangle.MatIndex = static_cast<uint8>(Slot.MatIndex);
+            }
+
+            for (int32 Corner = 0; Corner < Frames.Num(); ++Corner)
+            {
+                SkeletalMeshImportData::FTriangle& Triangle = ImportData.Faces[Slot.FaceBase + Corner / 3];
+                Triangle.TangentX[Corner % 3] = Frames.TangentX[Corner];
+                Triangle.TangentY[Corner % 3] = Frames.TangentY[Corner];
+                Triangle.TangentZ[Corner % 3] = Frames.TangentZ[Corner];
+            }
+
+            // Populate influences (skinning data)
+            if (!Slot.bOwnsPoints)
+            {
+                return;
+            }
+
+            const FVertexInfluences& Influences = OwnerInfluences[PrimitiveIndex];
+            int32 NumPrimitiveInfluences = 0;
+            for (const uint8 Count : Influences.Counts)
+            {
+                NumPrimitiveInfluences += Count;
+            }
+            Slot.Influences.SetNumUninitialized(NumPrimitiveInfluences);
+
+            int32 Written = 0;
+            for (int32 VertexIndex = 0; VertexIndex < PrimitiveVertices; ++VertexIndex)
+            {
+                const int32 First = VertexIndex * MaxVertexInfluences;
+                for (int32 InfluenceIndex = First; InfluenceIndex < First + Influences.Counts[VertexIndex]; ++InfluenceIndex)
+                {
+                    SkeletalMeshImportData::FRawBoneInfluence& Influence = Slot.Influences[Written++];
+                    Influence.VertexIndex = Slot.PointBase + VertexIndex;
+                    Influence.BoneIndex = Influences.Bones[InfluenceIndex];
+                    Influence.Weight = Influences.Weights[InfluenceIndex];
+                }
+            }
+        });
+
+        if (!CheckSlotErrors(Primitives, Slots, OutError))
         {
-            Wedge.UVs[0] = FVector2f::ZeroVector;
+            return false;
         }
 
-        Wedge.Color = FColor::White;
+        int32 NumInfluences = 0;
+        for (const FPrimitiveSlot& Slot : Slots)
+        {
+            NumInfluences += Slot.Influences.Num();
+        }
 
-        ImportData.Wedges.Add(Wedge);
+        ImportData.Influences.Reserve(NumInfluences);
+        for (const FPrimitiveSlot& Slot : Slots)
+        {
+            ImportData.Influences.Append(Slot.Influences);
+        }
+        return true;
     }
 
-    // Populate faces (triangles)
-    ImportData.Faces.Reserve(AccessorReader.Indices.Num() / 3);
-    for (int32 i = 0; i < AccessorReader.Indices.Num(); i += 3)
+    /**
+     * Decode the morph targets of every primitive and attach them to the built mesh. Decoding, culling
+     * and the expansion from import points to render vertices run in parallel, one task per morph target.
+     * @return Number of morph targets registered on the mesh
+     */
+    int32 BuildMorphTargets(
+        const FVrmGlbAccessorReader& AccessorReader,
+        const FVrmGltfMeshBinding& Binding,
+        const TArray<int32>& PointBases,
+        int32 NumPoints,
+        const FSkeletalMeshLODModel& LODModel,
+        USkeletalMesh* SkeletalMesh)
     {
-        SkeletalMeshImportData::FTriangle Triangle;
-        Triangle.WedgeIndex[0] = AccessorReader.Indices[i];
-        Triangle.WedgeIndex[1] = AccessorReader.Indices[i + 1];
-        Triangle.WedgeIndex[2] = AccessorReader.Indices[i + 2];
-        Triangle.MatIndex = 0;
-        
-        // Set up tangent space (basic calculation)
-        Triangle.TangentX[0] = FVector3f(1, 0, 0);
-        Triangle.TangentY[0] = FVector3f(0, 1, 0);
-        Triangle.TangentZ[0] = FVector3f(0, 0, 1);
-        
-        Triangle.TangentX[1] = FVector3f(1, 0, 0);
-        Triangle.TangentY[1] = FVector3f(0, 1, 0);
-        Triangle.TangentZ[1] = FVector3f(0, 0, 1);
-        
-        Triangle.TangentX[2] = FVector3f(1, 0, 0);
-        Triangle.TangentY[2] = FVector3f(0, 1, 0);
-        Triangle.TangentZ[2] = FVector3f(0, 0, 1);
+        const TArray<FVrmGlbAccessorReader::FPrimitive>& Primitives = AccessorReader.Primitives;
+
+        TArray<FMorphTargetSource> Sources;
+        GatherMorphTargetSources(AccessorReader, PointBases, Sources);
+        if (Sources.Num() == 0)
+        {
+            return 0;
+        }
+        AssignMorphTargetNames(Sources);
+
+        // Render vertices of every import point, inverted once from the LOD's render-to-import map
+        const TArray<int32>& MeshToImportVertexMap = LODModel.MeshToImportVertexMap;
+        if (MeshToImportVertexMap.IsEmpty())
+        {
+            UE_LOG(LogVrmToolchainEditor, Warning, TEXT("%s: no render-to-import vertex map, %d morph targets skipped"), *SkeletalMesh->GetName(), Sources.Num());
+            return 0;
+        }
+
+        TArray<int32> PointFirstVertex;
+        PointFirstVertex.SetNumZeroed(NumPoints + 1);
+        for (const int32 Point : MeshToImportVertexMap)
+        {
+            if (Point >= 0 && Point < NumPoints)
+            {
+                ++PointFirstVertex[Point + 1];
+            }
+        }
+        for (int32 Point = 0; Point < NumPoints; ++Point)
+        {
+            PointFirstVertex[Point + 1] += PointFirstVertex[Point];
+        }
+
+        TArray<int32> PointVertices;
+        PointVertices.SetNumUninitialized(PointFirstVertex[NumPoints]);
+        TArray<int32> Cursor(PointFirstVertex.GetData(), NumPoints);
+        for (int32 RenderVertex = 0; RenderVertex < MeshToImportVertexMap.Num(); ++RenderVertex)
+        {
+            const int32 Point = MeshToImportVertexMap[RenderVertex];
+            if (Point >= 0 && Point < NumPoints)
+            {
+                PointVertices[Cursor[Point]++] = RenderVertex;
+            }
+        }
+
+        const FPrimitiveBindings Bindings(Binding);
+        ParallelFor(Sources.Num(), [&Primitives, &Bindings, &PointBases, &Sources, &PointFirstVertex, &PointVertices, NumPoints](int32 SourceIndex)
+        {
+            FMorphTargetSource& Source = Sources[SourceIndex];
+            ForEachMorphTargetDelta(Primitives, PointBases, NumPoints, Source,
+                [&Bindings, &Source, &PointFirstVertex, &PointVertices](const FVrmGlbAccessorReader::FPrimitive& Primitive, int32 Point, FVector3f PositionDelta, FVector3f NormalDelta)
+                {
+                    // Every render vertex split off an import point (UV or normal seams) moves with it
+                    TransformMorphDeltas(Bindings.GetRigidTransform(Primitive), PositionDelta, NormalDelta);
+                    for (int32 Slot = PointFirstVertex[Point]; Slot < PointFirstVertex[Point + 1]; ++Slot)
+                    {
+                        FMorphTargetDelta& Delta = Source.Deltas.AddDefaulted_GetRef();
+                        Delta.PositionDelta = PositionDelta;
+                        Delta.TangentZDelta = NormalDelta;
+                        Delta.SourceIdx = static_cast<uint32>(PointVertices[Slot]);
+                    }
+                });
+        });
+
+        // Objects are created on this thread; filling them touches only each target's own LOD data
+        TArray<UMorphTarget*> MorphTargets;
+        MorphTargets.Reserve(Sources.Num());
+        for (const FMorphTargetSource& Source : Sources)
+        {
+            MorphTargets.Add(NewObject<UMorphTarget>(SkeletalMesh, Source.Name));
+        }
+
+        ParallelFor(Sources.Num(), [&Sources, &MorphTargets, &LODModel](int32 SourceIndex)
+        {
+            MorphTargets[SourceIndex]->PopulateDeltas(Sources[SourceIndex].Deltas, 0, LODModel.Sections, true, false, VrmMorphTargetDecoder::DefaultPositionThreshold);
+        });
+
+        for (UMorphTarget* MorphTarget : MorphTargets)
+        {
+            SkeletalMesh->RegisterMorphTarget(MorphTarget, false);
+        }
+        SkeletalMesh->InitMorphTargets();
 
-        ImportData.Faces.Add(Triangle);
+        return MorphTargets.Num();
     }
 
-    // Populate influences (skinning data)
-    ImportData.Influences.Reserve(AccessorReader.Weights.Num() * 4); // Up to 4 influences per vertex
+    /** Indices, UVs, tangent frames and influences of one primitive, converted before the mesh description is assembled */
+    struct FPrimitiveElements
+    {
+        TArray<uint32> Indices;
+        TArray<FVector2f> TexCoords;
+        FVrmCornerFrames Frames;
+        FVertexInfluences Influences;
+
+        /** First vertex instance of the primitive's triangles */
+        int32 InstanceBase = 0;
+    };
+
+    /** Triangles whose corners share a vertex have no edges to build; both passes below skip them alike */
+    bool IsDegenerateTriangle(const uint32* Corners)
+    {
+        return Corners[0] == Corners[1] || Corners[1] == Corners[2] || Corners[0] == Corners[2];
+    }
 
-    for (int32 VertexIndex = 0; VertexIndex < AccessorReader.Weights.Num(); ++VertexIndex)
+    /**
+     * Fill a skeletal mesh description straight from the accessor views, without the import data and the LOD
+     * import arrays copied from it. Primitives convert in parallel into their disjoint ranges of the vertex and
+     * vertex instance attributes (see LayoutPrimitives); only element creation is serial. Every triangle corner
+     * is a vertex instance carrying its tangent frame, which the engine build merges where they match. Morph
+     * targets become morph attributes: position deltas per vertex, normal deltas per vertex instance. With
+     * bWeldAndOptimize, triangles reference welded vertices in cache and overdraw order, as on the import data path.
+     * Rigid primitives are moved to their node's bind pose, as on the import data path.
+     */
+    bool FillMeshDescription(
+        const FVrmGlbAccessorReader& AccessorReader,
+        const FVrmGltfMeshBinding& Binding,
+        bool bWeldAndOptimize,
+        FMeshDescription& MeshDescription,
+        TArray<FName>& OutMaterialSlots,
+        FString& OutError)
     {
-        const FVector4f& Weight = AccessorReader.Weights[VertexIndex];
-        const FIntVector4& Joint = AccessorReader.Joints[VertexIndex];
+        const TArray<FVrmGlbAccessorReader::FPrimitive>& Primitives = AccessorReader.Primitives;
+
+        FPrimitiveLayout Layout;
+        if (!LayoutPrimitives(Primitives, Layout, OutError))
+        {
+            return false;
+        }
+        TArray<FPrimitiveSlot>& Slots = Layout.Slots;
+
+        FSkeletalMeshAttributes Attributes(MeshDescription);
+        Attributes.Register();
+
+        // Vertices first, so the position attribute has its final size before primitives fill it in parallel
+        MeshDescription.ReserveNewVertices(Layout.NumPoints);
+        for (int32 Point = 0; Point < Layout.NumPoints; ++Point)
+        {
+            MeshDescription.CreateVertex();
+        }
+
+        TArray<FPolygonGroupID> PolygonGroups;
+        TPolygonGroupAttributesRef<FName> MaterialSlotNames = Attributes.GetPolygonGroupMaterialSlotNames();
+        for (const int32 GltfMaterial : Layout.GltfMaterials)
+        {
+            const FName SlotName = GetMaterialSlotName(GltfMaterial);
+            OutMaterialSlots.Add(SlotName);
+
+            const FPolygonGroupID PolygonGroup = MeshDescription.CreatePolygonGroup();
+            MaterialSlotNames[PolygonGroup] = SlotName;
+            PolygonGroups.Add(PolygonGroup);
+        }
+
+        const FPrimitiveBindings Bindings(Binding);
+        const TArrayView<FVector3f> VertexPositions = Attributes.GetVertexPositions().GetRawArray();
+
+        // Owners first: every primitive welds against the positions and influences of the points it uses
+        TArray<FPrimitiveElements> Elements;
+        Elements.SetNum(Primitives.Num());
+        ParallelFor(Primitives.Num(), [&Primitives, &Slots, &Elements, &Bindings, &VertexPositions](int32 PrimitiveIndex)
+        {
+            const FVrmGlbAccessorReader::FPrimitive& Primitive = Primitives[PrimitiveIndex];
+            FPrimitiveSlot& Slot = Slots[PrimitiveIndex];
+            if (!Slot.bOwnsPoints)
+            {
+                return;
+            }
+
+            Primitive.Positions.CopyTo(VertexPositions.GetData() + Slot.PointBase);
+            if (const FRigidTransform* Transform = Bindings.GetRigidTransform(Primitive))
+            {
+                TransformPoints(*Transform, MakeArrayView(VertexPositions.GetData() + Slot.PointBase, Primitive.Positions.Num()));
+            }
+            ReduceVertexInfluences(Primitive, Bindings, Elements[PrimitiveIndex].Influences, Slot.Error);
+        });
+
+        if (!CheckSlotErrors(Primitives, Slots, OutError))
+        {
+            return false;
+        }
+
+        // Morph targets by name, for welding and for the morph attributes below
+        const TArray<int32> PointBases = Layout.GetPointBases();
+        TArray<FMorphTargetSource> Sources;
+        GatherMorphTargetSources(AccessorReader, PointBases, Sources);
+
+        TArray<uint64> MorphSignatures;
+        if (bWeldAndOptimize)
+        {
+            ComputeMorphSignatures(Primitives, PointBases, Layout.NumPoints, Sources, MorphSignatures);
+        }
+
+        ParallelFor(Primitives.Num(), [&Primitives, &Slots, &Elements, &Bindings, &VertexPositions, &MorphSignatures, bWeldAndOptimize](int32 PrimitiveIndex)
+        {
+            const FVrmGlbAccessorReader::FPrimitive& Primitive = Primitives[PrimitiveIndex];
+            FPrimitiveSlot& Slot = Slots[PrimitiveIndex];
+            FPrimitiveElements& Element = Elements[PrimitiveIndex];
+            const int32 PrimitiveVertices = Primitive.Positions.Num();
+
+            if (!CopyTriangleIndices(Primitive, Element.Indices, Slot.Error))
+            {
+                return;
+            }
+
+            if (bWeldAndOptimize)
+            {
+                WeldAndOptimizeIndices(Primitive, MakeArrayView(VertexPositions.GetData() + Slot.PointBase, PrimitiveVertices),
+                    Elements[Slot.OwnerIndex].Influences, GetPointRange(MorphSignatures, Slot.PointBase, PrimitiveVertices), Element.Indices);
+            }
+
+            // Tangent space per corner: NORMAL/TANGENT when present, flat normals and MikkTSpace tangents otherwise
+            VrmTangentSpace::ComputeCornerFrames(Primitive.Positions, Primitive.Normals, Primitive.Tangents, Primitive.TexCoords, MakeIndexView(Element.Indices), Element.Frames);
+            if (const FRigidTransform* Transform = Bindings.GetRigidTransform(Primitive))
+            {
+                TransformCornerFrames(*Transform, Element.Frames, Element.Indices);
+            }
+
+            if (Primitive.TexCoords.Num() == PrimitiveVertices)
+            {
+                Element.TexCoords.SetNumUninitialized(PrimitiveVertices);
+                Primitive.TexCoords.CopyTo(Element.TexCoords.GetData());
+            }
+        });
+
+        if (!CheckSlotErrors(Primitives, Slots, OutError))
+        {
+            return false;
+        }
+
+        // Topology: a fresh description hands out dense IDs in creation order, so each primitive's instances
+        // are the range starting at its InstanceBase
+        MeshDescription.ReserveNewVertexInstances(Layout.NumFaces * 3);
+        MeshDescription.ReserveNewTriangles(Layout.NumFaces);
+        MeshDescription.ReserveNewPolygons(Layout.NumFaces);
+        MeshDescription.ReserveNewEdges(Layout.NumFaces * 3 / 2);
 
-        // Process up to 4 influences per vertex
-        for (int32 InfluenceIndex = 0; InfluenceIndex < 4; ++InfluenceIndex)
+        int32 NumInstances = 0;
+        for (int32 PrimitiveIndex = 0; PrimitiveIndex < Primitives.Num(); ++PrimitiveIndex)
         {
-            float InfluenceWeight = 0.0f;
-            int32 JointOrdinal = 0;
+            const FPrimitiveSlot& Slot = Slots[PrimitiveIndex];
+            FPrimitiveElements& Element = Elements[PrimitiveIndex];
+            Element.InstanceBase = NumInstances;
+
+            for (int32 Corner = 0; Corner < Element.Indices.Num(); Corner += 3)
+            {
+                const uint32* Corners = Element.Indices.GetData() + Corner;
+                if (IsDegenerateTriangle(Corners))
+                {
+                    continue;
+                }
+
+                FVertexInstanceID Instances[3];
+                for (int32 Vert = 0; Vert < 3; ++Vert)
+                {
+                    Instances[Vert] = MeshDescription.CreateVertexInstance(FVertexID(Slot.PointBase + static_cast<int32>(Corners[Vert])));
+                }
+                MeshDescription.CreateTriangle(PolygonGroups[Slot.MatIndex], MakeArrayView(Instances));
+                NumInstances += 3;
+            }
+        }
+
+        // Vertex instance attributes in bulk, each primitive into its own range
+        TVertexInstanceAttributesRef<FVector2f> InstanceUVs = Attributes.GetVertexInstanceUVs();
+        InstanceUVs.SetNumChannels(1);
+        const TArrayView<FVector3f> InstanceNormals = Attributes.GetVertexInstanceNormals().GetRawArray();
+        const TArrayView<FVector3f> InstanceTangents = Attributes.GetVertexInstanceTangents().GetRawArray();
+        const TArrayView<float> InstanceBinormalSigns = Attributes.GetVertexInstanceBinormalSigns().GetRawArray();
+        const TArrayView<FVector2f> InstanceTexCoords = InstanceUVs.GetRawArray(0);
 
-            switch (InfluenceIndex)
+        ParallelFor(Primitives.Num(), [&Elements, &InstanceNormals, &InstanceTangents, &InstanceBinormalSigns, &InstanceTexCoords](int32 PrimitiveIndex)
+        {
+            const FPrimitiveElements& Element = Elements[PrimitiveIndex];
+            int32 Instance = Element.InstanceBase;
+            for (int32 Corner = 0; Corner < Element.Indices.Num(); Corner += 3)
             {
-            case 0:
-                InfluenceWeight = Weight.X;
-                JointOrdinal = Joint.X;
-                break;
-            case 1:
-                InfluenceWeight = Weight.Y;
-                JointOrdinal = Joint.Y;
-                break;
-            case 2:
-                InfluenceWeight = Weight.Z;
-                JointOrdinal = Joint.Z;
-                break;
-            case 3:
-                InfluenceWeight = Weight.W;
-                JointOrdinal = Joint.W;
-                break;
+                if (IsDegenerateTriangle(Element.Indices.GetData() + Corner))
+                {
+                    continue;
+                }
+
+                for (int32 Vert = Corner; Vert < Corner + 3; ++Vert, ++Instance)
+                {
+                    InstanceNormals[Instance] = Element.Frames.TangentZ[Vert];
+                    InstanceTangents[Instance] = Element.Frames.TangentX[Vert];
+                    InstanceBinormalSigns[Instance] = Element.Frames.GetBinormalSign(Vert);
+                    InstanceTexCoords[Instance] = Element.TexCoords.IsEmpty() ? FVector2f::ZeroVector : Element.TexCoords[Element.Indices[Vert]];
+                }
             }
+        });
 
-            // Skip zero weights
-            if (FMath::IsNearlyZero(InfluenceWeight))
+        // Skin weights: the compressed weight container is not thread safe, so only the reduction above ran in parallel
+        FSkinWeightsVertexAttributesRef SkinWeights = Attributes.GetVertexSkinWeights();
+        TArray<UE::AnimationCore::FBoneWeight> BoneWeights;
+        for (int32 PrimitiveIndex = 0; PrimitiveIndex < Primitives.Num(); ++PrimitiveIndex)
+        {
+            const FPrimitiveSlot& Slot = Slots[PrimitiveIndex];
+            if (!Slot.bOwnsPoints)
             {
                 continue;
             }
 
-            // Map joint ordinal to bone index
-            const int32* BoneIndexPtr = JointOrdinalToBoneIndex.Find(JointOrdinal);
-            if (!BoneIndexPtr)
+            const FVertexInfluences& Influences = Elements[PrimitiveIndex].Influences;
+            for (int32 VertexIndex = 0; VertexIndex < Influences.Counts.Num(); ++VertexIndex)
+            {
+                BoneWeights.Reset();
+                const int32 First = VertexIndex * MaxVertexInfluences;
+                for (int32 InfluenceIndex = First; InfluenceIndex < First + Influences.Counts[VertexIndex]; ++InfluenceIndex)
+                {
+                    BoneWeights.Emplace(Influences.Bones[InfluenceIndex], Influences.Weights[InfluenceIndex]);
+                }
+                SkinWeights.Set(FVertexID(Slot.PointBase + VertexIndex), BoneWeights);
+            }
+        }
+
+        // Morph attributes are registered here, then filled in parallel, one task per target
+        AssignMorphTargetNames(Sources);
+        for (const FMorphTargetSource& Source : Sources)
+        {
+            Attributes.RegisterMorphTargetAttribute(Source.Name, true);
+        }
+
+        const int32 NumPoints = Layout.NumPoints;
+        ParallelFor(Sources.Num(), [&Primitives, &PointBases, &Sources, &Bindings, &Attributes, &MeshDescription, NumPoints, NumInstances](int32 SourceIndex)
+        {
+            const FMorphTargetSource& Source = Sources[SourceIndex];
+            const TArrayView<FVector3f> PositionDeltas = Attributes.GetVertexMorphPositionDelta(Source.Name).GetRawArray();
+            const TArrayView<FVector3f> NormalDeltas = Attributes.GetVertexInstanceMorphNormalDelta(Source.Name).GetRawArray();
+
+            TArray<FVector3f> PointNormalDeltas;
+            ForEachMorphTargetDelta(Primitives, PointBases, NumPoints, Source,
+                [&Bindings, &PositionDeltas, &PointNormalDeltas, NumPoints](const FVrmGlbAccessorReader::FPrimitive& Primitive, int32 Point, FVector3f PositionDelta, FVector3f NormalDelta)
+                {
+                    TransformMorphDeltas(Bindings.GetRigidTransform(Primitive), PositionDelta, NormalDelta);
+                    PositionDeltas[Point] = PositionDelta;
+                    if (!NormalDelta.IsZero())
+                    {
+                        if (PointNormalDeltas.IsEmpty())
+                        {
+                            PointNormalDeltas.SetNumZeroed(NumPoints);
+                        }
+                        PointNormalDeltas[Point] = NormalDelta;
+                    }
+                });
+
+            // Every corner of a vertex bends with it
+            if (!PointNormalDeltas.IsEmpty())
+            {
+                for (int32 Instance = 0; Instance < NumInstances; ++Instance)
+                {
+                    NormalDeltas[Instance] = PointNormalDeltas[MeshDescription.GetVertexInstanceVertex(FVertexInstanceID(Instance)).GetValue()];
+                }
+            }
+        });
+
+        return true;
+    }
+
+    /**
+     * Commit LOD0's mesh description and let the engine build the render data from it. The build reads the
+     * mesh's own reference skeleton and LOD build settings, so both are set first. USkeletalMesh::Build works on
+     * the UObject and cannot leave the game thread: on this path PrepareLod0 only fills the description, and the
+     * engine build itself stays synchronous in FinalizeLod0 (the import data path builds LOD0 ahead instead).
+     */
+    bool BuildFromMeshDescription(FMeshDescription&& MeshDescription, USkeleton* TargetSkeleton, USkeletalMesh* SkeletalMesh, FString& OutError)
+    {
+        SkeletalMesh->SetRefSkeleton(TargetSkeleton->GetReferenceSkeleton());
+        SkeletalMesh->CalculateInvRefMatrices();
+
+        // Every corner carries its normal and tangent: keep them instead of recomputing
+        FSkeletalMeshLODInfo& LODInfo = SkeletalMesh->AddLODInfo();
+        LODInfo.BuildSettings.bRecomputeNormals = false;
+        LODInfo.BuildSettings.bRecomputeTangents = false;
+        LODInfo.BuildSettings.bUseMikkTSpace = true;
+        SkeletalMesh->GetImportedModel()->LODModels.Add(new FSkeletalMeshLODModel());
+
+        SkeletalMesh->CreateMeshDescription(0, MoveTemp(MeshDescription));
+        SkeletalMesh->CommitMeshDescription(0);
+        SkeletalMesh->Build();
+
+        const FSkeletalMeshModel* ImportedModel = SkeletalMesh->GetImportedModel();
+        if (!ImportedModel->LODModels.IsValidIndex(0) || ImportedModel->LODModels[0].Sections.IsEmpty())
+        {
+            OutError = TEXT("Failed to build skeletal mesh from its mesh description");
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Build LOD0's render model through the LOD import arrays copied from the import data and
+     * IMeshUtilities::BuildSkeletalMesh. Plain data in and out: safe off the game thread.
+     */
+    bool BuildLodModelFromImportData(
+        FSkeletalMeshImportData& ImportData,
+        const FReferenceSkeleton& RefSkeleton,
+        const FString& MeshName,
+        FSkeletalMeshLODModel& OutLODModel,
+        int32& OutNumPoints,
+        FString& OutError)
+    {
+        // Get mesh utilities (loaded by the caller when this runs on a worker)
+        IMeshUtilities& MeshUtilities = FModuleManager::Get().LoadModuleChecked<IMeshUtilities>("MeshUtilities");
+
+        // Process influences
+        SkeletalMeshImportUtils::ProcessImportMeshInfluences(ImportData, MeshName);
+
+        // Convert import data to LOD format
+        TArray<FVector3f> LODPoints;
+        TArray<SkeletalMeshImportData::FMeshWedge> LODWedges;
+        TArray<SkeletalMeshImportData::FMeshFace> LODFaces;
+        TArray<SkeletalMeshImportData::FVertInfluence> LODInfluences;
+        ImportData.CopyLODImportData(LODPoints, LODWedges, LODFaces, LODInfluences, ImportData.PointToRawMap);
+
+        // Build the skeletal mesh; every corner carries its normal and tangent: keep them instead of recomputing
+        IMeshUtilities::MeshBuildOptions BuildOptions;
+        BuildOptions.bComputeNormals = false;
+        BuildOptions.bComputeTangents = false;
+        TArray<FText> WarningMessages;
+        TArray<FName> WarningNames;
+
+        bool bBuildSuccess = MeshUtilities.BuildSkeletalMesh(
+            OutLODModel,
+            MeshName,
+            RefSkeleton,
+            LODInfluences,
+            LODWedges,
+            LODFaces,
+            LODPoints,
+            ImportData.PointToRawMap,
+            BuildOptions,
+            &WarningMessages,
+            &WarningNames
+        );
+
+        if (!bBuildSuccess)
+        {
+            OutError = TEXT("Failed to build skeletal mesh");
+            return false;
+        }
+
+        OutNumPoints = LODPoints.Num();
+        return true;
+    }
+
+    /** Bump when the builder's output changes: every LOD0 cached by older builders is then ignored */
+    const FGuid LodModelCacheVersion(0x3B81E6D4, 0x5FA24C97, 0xA0D63E1B, 0x92C45F70);
+
+    /**
+     * Engine state a cached LOD0 depends on besides the builder: the engine build, whose MeshUtilities produced it
+     * (the engine's own skeletal mesh DDC version is private to it), and the custom versions LOD models are written with
+     */
+    const FIoHash& GetEngineLodModelVersion()
+    {
+        static const FIoHash Version = []()
+        {
+            FBlake3 Hasher;
+            const FString EngineVersion = FEngineVersion::Current().ToString();
+            Hasher.Update(*EngineVersion, EngineVersion.Len() * sizeof(TCHAR));
+
+            TArray<uint8> Bytes;
+            FMemoryWriter Ar(Bytes, /*bIsPersistent*/ true);
+            FSkeletalMeshLODModel().Serialize(Ar, nullptr, 0);
+            for (const FCustomVersion& CustomVersion : Ar.GetCustomVersions().GetAllVersions())
+            {
+                Hasher.Update(&CustomVersion.Key, sizeof(CustomVersion.Key));
+                Hasher.Update(&CustomVersion.Version, sizeof(CustomVersion.Version));
+            }
+            return FIoHash(Hasher.Finalize());
+        }();
+        return Version;
+    }
+
+    /** Derived data cache key of LOD0: the caller's source identity, the build options, the builder and engine versions and the package format */
+    UE::DerivedData::FCacheKey MakeLodModelCacheKey(const FString& DerivedDataKey, bool bWeldAndOptimize)
+    {
+        static const UE::DerivedData::FCacheBucket Bucket(TEXT("VrmSkeletalMeshLOD0"));
+
+        FBlake3 Hasher;
+        Hasher.Update(&LodModelCacheVersion, sizeof(LodModelCacheVersion));
+        const FIoHash& EngineVersion = GetEngineLodModelVersion();
+        Hasher.Update(&EngineVersion, sizeof(EngineVersion));
+        const int32 PackageVersion = GPackageFileUEVersion.ToValue();
+        Hasher.Update(&PackageVersion, sizeof(PackageVersion));
+        const uint8 BuildOptions = bWeldAndOptimize ? 1 : 0;
+        Hasher.Update(&BuildOptions, sizeof(BuildOptions));
+        Hasher.Update(*DerivedDataKey, DerivedDataKey.Len() * sizeof(TCHAR));
+        return { Bucket, FIoHash(Hasher.Finalize()) };
+    }
+
+    /**
+     * The cached part of a prepared LOD0, in either direction. There is no owning mesh to pass: LOD0 is cached
+     * and restored in PrepareLod0, before FinalizeLod0 creates the asset (possibly on a worker, where no UObject may
+     * be touched). The owner only ties bulk data to its package's linker; without one it travels inline in the payload.
+     */
+    void SerializeCachedLod0(FArchive& Ar, FVrmSkeletalMeshBuilder::FPreparedMesh& Prepared)
+    {
+        Prepared.LODModel->Serialize(Ar, nullptr, 0);
+        Ar << Prepared.MaterialSlots;
+        Ar << Prepared.PointBases;
+        Ar << Prepared.NumPoints;
+    }
+
+    /** Restore a prepared LOD0 from the derived data cache; blocks until the cache answers */
+    bool LoadCachedLod0(const UE::DerivedData::FCacheKey& Key, const FString& MeshName, FVrmSkeletalMeshBuilder::FPreparedMesh& OutPrepared)
+    {
+        using namespace UE::DerivedData;
+
+        FSharedBuffer Data;
+        FRequestOwner Owner(EPriority::Blocking);
+        FCacheGetValueRequest Request;
+        Request.Name = MeshName;
+        Request.Key = Key;
+        GetCache().GetValue({ Request }, Owner, [&Data](FCacheGetValueResponse&& Response)
+        {
+            if (Response.Status == EStatus::Ok)
+            {
+                Data = Response.Value.GetData().Decompress();
+            }
+        });
+        Owner.Wait();
+
+        if (Data.IsNull())
+        {
+            return false;
+        }
+
+        FMemoryReaderView Ar(MakeArrayView(static_cast<const uint8*>(Data.GetData()), static_cast<int64>(Data.GetSize())), /*bIsPersistent*/ true);
+
+        // The LOD model reads with the custom versions it was written with; a shared cache may hold
+        // entries from newer engine builds, which this one cannot read
+        FCustomVersionContainer CustomVersions;
+        CustomVersions.Serialize(Ar);
+        for (const FCustomVersion& Version : CustomVersions.GetAllVersions())
+        {
+            const TOptional<FCustomVersion> Current = FCurrentCustomVersions::Get(Version.Key);
+            if (!Current.IsSet() || Current->Version < Version.Version)
             {
-                Result.ErrorMessage = FString::Printf(TEXT("Joint ordinal %d not found in bone mapping"), JointOrdinal);
-                return Result;
+                return false;
             }
+        }
+        Ar.SetCustomVersions(CustomVersions);
+
+        OutPrepared.LODModel = MakeUnique<FSkeletalMeshLODModel>();
+        SerializeCachedLod0(Ar, OutPrepared);
+        return !Ar.IsError();
+    }
+
+    /** Store a prepared LOD0 in the derived data cache; the put completes in the background */
+    void StoreCachedLod0(const UE::DerivedData::FCacheKey& Key, const FString& MeshName, FVrmSkeletalMeshBuilder::FPreparedMesh& Prepared)
+    {
+        using namespace UE::DerivedData;
+
+        TArray64<uint8> Body;
+        FMemoryWriter64 BodyAr(Body, /*bIsPersistent*/ true);
+        SerializeCachedLod0(BodyAr, Prepared);
+
+        // Custom versions lead the payload: the reader needs them before the LOD model
+        TArray64<uint8> Payload;
+        FMemoryWriter64 Ar(Payload, /*bIsPersistent*/ true);
+        FCustomVersionContainer CustomVersions = BodyAr.GetCustomVersions();
+        CustomVersions.Serialize(Ar);
+        Ar.Serialize(Body.GetData(), Body.Num());
+
+        FCachePutValueRequest Request;
+        Request.Name = MeshName;
+        Request.Key = Key;
+        Request.Value = FValue::Compress(MakeSharedBufferFromArray(MoveTemp(Payload)));
+
+        FRequestOwner Owner(EPriority::Normal);
+        GetCache().PutValue({ Request }, Owner);
+        Owner.KeepAlive();
+    }
+}
+
+FVrmSkeletalMeshBuilder::FPreparedMesh::FPreparedMesh() = default;
+FVrmSkeletalMeshBuilder::FPreparedMesh::~FPreparedMesh() = default;
+FVrmSkeletalMeshBuilder::FPreparedMesh::FPreparedMesh(FPreparedMesh&&) = default;
+FVrmSkeletalMeshBuilder::FPreparedMesh& FVrmSkeletalMeshBuilder::FPreparedMesh::operator=(FPreparedMesh&&) = default;
+
+FVrmSkeletalMeshBuilder::FBuildResult FVrmSkeletalMeshBuilder::BuildLod0SkinnedPrimitive(
+    const FVrmGlbAccessorReader& AccessorReader,
+    USkeleton* TargetSkeleton,
+    const FVrmGltfMeshBinding& Binding,
+    const FString& PackageName,
+    const FString& AssetName,
+    EBuildPath BuildPath,
+    bool bWeldAndOptimize)
+{
+    FBuildResult Result;
+
+    // Validate inputs
+    if (!TargetSkeleton)
+    {
+        Result.ErrorMessage = TEXT("TargetSkeleton is null");
+        return Result;
+    }
 
-            SkeletalMeshImportData::FRawBoneInfluence Influence;
-            Influence.VertexIndex = VertexIndex;
-            Influence.BoneIndex = *BoneIndexPtr;
-            Influence.Weight = InfluenceWeight;
+    // Conversion errors surface before any asset is created
+    FPreparedMesh Prepared;
+    if (!PrepareLod0(AccessorReader, TargetSkeleton->GetReferenceSkeleton(), Binding, PackageName + TEXT(".") + AssetName,
+        BuildPath, bWeldAndOptimize, FString(), Prepared, Result.ErrorMessage))
+    {
+        return Result;
+    }
+
+    return FinalizeLod0(MoveTemp(Prepared), AccessorReader, TargetSkeleton, PackageName, AssetName);
+}
+
+bool FVrmSkeletalMeshBuilder::PrepareLod0(
+    const FVrmGlbAccessorReader& AccessorReader,
+    const FReferenceSkeleton& RefSkeleton,
+    const FVrmGltfMeshBinding& Binding,
+    const FString& MeshName,
+    EBuildPath BuildPath,
+    bool bWeldAndOptimize,
+    const FString& DerivedDataKey,
+    FPreparedMesh& OutPrepared,
+    FString& OutError)
+{
+    if (AccessorReader.Primitives.Num() == 0)
+    {
+        OutError = TEXT("No primitives in accessor data");
+        return false;
+    }
+
+    OutPrepared.BuildPath = BuildPath;
+    OutPrepared.Binding = Binding;
+    if (BuildPath == EBuildPath::MeshDescription)
+    {
+        OutPrepared.MeshDescription = MakeUnique<FMeshDescription>();
+        return FillMeshDescription(AccessorReader, Binding, bWeldAndOptimize, *OutPrepared.MeshDescription, OutPrepared.MaterialSlots, OutError);
+    }
 
-            ImportData.Influences.Add(Influence);
+    // A cache hit skips the accessor conversion and the engine build altogether
+    const bool bUseCache = !DerivedDataKey.IsEmpty();
+    UE::DerivedData::FCacheKey CacheKey;
+    if (bUseCache)
+    {
+        CacheKey = MakeLodModelCacheKey(DerivedDataKey, bWeldAndOptimize);
+        if (LoadCachedLod0(CacheKey, MeshName, OutPrepared))
+        {
+            UE_LOG(LogVrmToolchainEditor, Log, TEXT("%s: LOD0 restored from the derived data cache"), *MeshName);
+            OutPrepared.bRestoredFromCache = true;
+            return true;
         }
+
+        OutPrepared = FPreparedMesh();
+        OutPrepared.BuildPath = BuildPath;
+        OutPrepared.Binding = Binding;
+    }
+
+    FSkeletalMeshImportData ImportData;
+    if (!FillImportData(AccessorReader, Binding, bWeldAndOptimize, ImportData, OutPrepared.MaterialSlots, OutPrepared.PointBases, OutError))
+    {
+        return false;
+    }
+
+    OutPrepared.LODModel = MakeUnique<FSkeletalMeshLODModel>();
+    if (!BuildLodModelFromImportData(ImportData, RefSkeleton, MeshName, *OutPrepared.LODModel, OutPrepared.NumPoints, OutError))
+    {
+        return false;
+    }
+
+    if (bUseCache)
+    {
+        StoreCachedLod0(CacheKey, MeshName, OutPrepared);
     }
+    return true;
+}
 
-    // Process influences
-    SkeletalMeshImportUtils::ProcessImportMeshInfluences(ImportData, SkeletalMesh->GetPathName());
+FVrmSkeletalMeshBuilder::FBuildResult FVrmSkeletalMeshBuilder::FinalizeLod0(
+    FPreparedMesh&& Prepared,
+    const FVrmGlbAccessorReader& AccessorReader,
+    USkeleton* TargetSkeleton,
+    const FString& PackageName,
+    const FString& AssetName)
+{
+    check(IsInGameThread());
+    FBuildResult Result;
 
-    // Convert import data to LOD format
-    TArray<FVector3f> LODPoints;
-    TArray<SkeletalMeshImportData::FMeshWedge> LODWedges;
-    TArray<SkeletalMeshImportData::FMeshFace> LODFaces;
-    TArray<SkeletalMeshImportData::FVertInfluence> LODInfluences;
-    ImportData.CopyLODImportData(LODPoints, LODWedges, LODFaces, LODInfluences, ImportData.PointToRawMap);
+    if (!TargetSkeleton)
+    {
+        Result.ErrorMessage = TEXT("TargetSkeleton is null");
+        return Result;
+    }
 
-    // Create LOD model
-    FSkeletalMeshLODModel* LODModel = new FSkeletalMeshLODModel();
-    SkeletalMesh->GetImportedModel()->LODModels.Add(LODModel);
+    if (Prepared.BuildPath == EBuildPath::MeshDescription ? !Prepared.MeshDescription.IsValid() : !Prepared.LODModel.IsValid())
+    {
+        Result.ErrorMessage = TEXT("Mesh was not prepared");
+        return Result;
+    }
 
-    // Build the skeletal mesh
-    IMeshUtilities::MeshBuildOptions BuildOptions;
-    TArray<FText> WarningMessages;
-    TArray<FName> WarningNames;
-    
-    bool bBuildSuccess = MeshUtilities.BuildSkeletalMesh(
-        *LODModel,
-        SkeletalMesh->GetPathName(),
-        TargetSkeleton->GetReferenceSkeleton(),
-        LODInfluences,
-        LODWedges,
-        LODFaces,
-        LODPoints,
-        ImportData.PointToRawMap,
-        BuildOptions,
-        &WarningMessages,
-        &WarningNames
-    );
+    // Create package if it doesn't exist
+    UPackage* Package = CreatePackage(*PackageName);
+    if (!Package)
+    {
+        Result.ErrorMessage = FString::Printf(TEXT("Failed to create package: %s"), *PackageName);
+        return Result;
+    }
 
-    if (!bBuildSuccess)
+    // Create skeletal mesh asset
+    USkeletalMesh* SkeletalMesh = NewObject<USkeletalMesh>(Package, *AssetName, RF_Public | RF_Standalone);
+    if (!SkeletalMesh)
     {
-        Result.ErrorMessage = TEXT("Failed to build skeletal mesh");
+        Result.ErrorMessage = FString::Printf(TEXT("Failed to create skeletal mesh asset: %s"), *AssetName);
         return Result;
     }
 
+    // Set skeleton reference
+    SkeletalMesh->SetSkeleton(TargetSkeleton);
+
+    // One material slot per section
+    for (const FName& SlotName : Prepared.MaterialSlots)
+    {
+        SkeletalMesh->GetMaterials().Add(FSkeletalMaterial(nullptr, SlotName, SlotName));
+    }
+
+    if (Prepared.BuildPath == EBuildPath::MeshDescription)
+    {
+        if (!BuildFromMeshDescription(MoveTemp(*Prepared.MeshDescription), TargetSkeleton, SkeletalMesh, Result.ErrorMessage))
+        {
+            return Result;
+        }
+
+        // Morph attributes of the mesh description became morph targets during the engine build
+        Result.NumMorphTargets = SkeletalMesh->GetMorphTargets().Num();
+    }
+    else
+    {
+        // The LOD model was built ahead; morph targets reference the render vertices it holds
+        FSkeletalMeshLODModel* LODModel = Prepared.LODModel.Release();
+        SkeletalMesh->GetImportedModel()->LODModels.Add(LODModel);
+        Result.NumMorphTargets = BuildMorphTargets(AccessorReader, Prepared.Binding, Prepared.PointBases, Prepared.NumPoints, *LODModel, SkeletalMesh);
+    }
+
     // Mark package as dirty
     Package->MarkPackageDirty();
 
@@ -229,4 +1632,4 @@ FVrmSkeletalMeshBuilder::FBuildResult FVrmSkeletalMeshBuilder::BuildLod0SkinnedP
     Result.bSuccess = true;
     Result.BuiltMesh = SkeletalMesh;
     return Result;
-}
\ No newline at end of file
+}
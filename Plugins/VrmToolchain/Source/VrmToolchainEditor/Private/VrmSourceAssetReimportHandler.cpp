@@ -4,6 +4,7 @@
 
 #include "VrmToolchain/VrmMetadata.h"
 #include "VrmToolchain/VrmMetadataAsset.h"
+#include "VrmToolchain/VrmGlbDocument.h"
 
 #include "EditorFramework/AssetImportData.h"
 #include "Misc/FileHelper.h"
@@ -127,6 +128,7 @@ bool FVrmSourceAssetReimportHandler::RefreshFromFile(UVrmSourceAsset* Source, co
         return false;
     }
 
+    // Reimport always reads the file as it is now; read-ahead only serves import batches
     TArray<uint8> Bytes;
     if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
     {
@@ -134,8 +136,20 @@ bool FVrmSourceAssetReimportHandler::RefreshFromFile(UVrmSourceAsset* Source, co
         return false;
     }
 
+    // Refreshed bytes stay self-contained, as on import
+    if (!FVrmGlbDocument::EmbedExternalBuffers(Bytes, Filename, OutError))
+    {
+        return false;
+    }
+
+    // Parse once from the freshly read bytes (no second disk read for metadata)
+    TSharedPtr<FVrmGlbDocument> Document;
+    FString DocumentError;
 #if WITH_EDITORONLY_DATA
     Source->SetSourceBytes(MoveTemp(Bytes));
+    Document = FVrmGlbDocument::LoadFromView(Source->GetSourceBytes(), DocumentError, Filename);
+#else
+    Document = FVrmGlbDocument::LoadFromBytes(MoveTemp(Bytes), DocumentError, Filename);
 #endif
 
     Source->SourceFilename = Filename;
@@ -149,7 +163,7 @@ bool FVrmSourceAssetReimportHandler::RefreshFromFile(UVrmSourceAsset* Source, co
     UVrmMetadataAsset* MetaAsset = Source->Descriptor;
     if (MetaAsset)
     {
-        const FVrmMetadata Parsed = FVrmParser::ExtractVrmMetadata(Filename);
+        const FVrmMetadata Parsed = Document.IsValid() ? FVrmParser::ExtractVrmMetadata(*Document) : FVrmMetadata();
 
         MetaAsset->SpecVersion = Parsed.Version;
         MetaAsset->Metadata.Title       = Parsed.Name;
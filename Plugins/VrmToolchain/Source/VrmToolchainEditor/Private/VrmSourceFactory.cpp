@@ -6,10 +6,12 @@
 #include "VrmMetaAssetRecomputeHelper.h"
 #include "VrmConversionService.h"
 #include "VrmImportOptions.h"
+#include "VrmImportPrefetcher.h"
 
 // Runtime-side types we create/populate:
 #include "VrmToolchain/VrmMetadata.h"
 #include "VrmToolchain/VrmMetadataAsset.h"
+#include "VrmToolchain/VrmGlbDocument.h"
 
 #include "EditorFramework/AssetImportData.h"
 #include "Misc/FileHelper.h"
@@ -228,6 +230,7 @@ UVrmSourceFactory::UVrmSourceFactory()
 
     Formats.Add(TEXT("vrm;VRM Avatar"));
     Formats.Add(TEXT("glb;glTF Binary"));
+    Formats.Add(TEXT("gltf;glTF"));
 
     SupportedClass = UVrmSourceAsset::StaticClass();
 }
@@ -235,7 +238,16 @@ UVrmSourceFactory::UVrmSourceFactory()
 bool UVrmSourceFactory::FactoryCanImport(const FString& Filename)
 {
     const FString Ext = FPaths::GetExtension(Filename).ToLower();
-    return Ext == TEXT("vrm") || Ext == TEXT("glb");
+    return Ext == TEXT("vrm") || Ext == TEXT("glb") || Ext == TEXT("gltf");
+}
+
+void UVrmSourceFactory::CleanUp()
+{
+    Super::CleanUp();
+
+    // Files of this batch that were never acquired (skipped, failed or cancelled) must not hold memory
+    // or be served to a later import
+    FVrmImportPrefetcher::Get().Reset();
 }
 
 bool UVrmSourceFactory::ConfigureProperties()
@@ -296,11 +308,19 @@ UObject* UVrmSourceFactory::FactoryCreateFile(
 {
     bOutOperationCanceled = false;
 
-    // Read bytes
+    // Read bytes (already in memory when the file was read ahead as part of a batch)
     TArray<uint8> Bytes;
-    if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
+    FString ReadError;
+    if (!FVrmImportPrefetcher::Get().Acquire(Filename, Bytes, ReadError))
+    {
+        Warn->Logf(ELogVerbosity::Error, TEXT("VRM import: %s"), *ReadError);
+        return nullptr;
+    }
+
+    // The source asset must hold everything conversion reads, including .bin files next to a .gltf
+    if (!FVrmGlbDocument::EmbedExternalBuffers(Bytes, Filename, ReadError))
     {
-        Warn->Logf(ELogVerbosity::Error, TEXT("VRM import: failed to read file: %s"), *Filename);
+        Warn->Logf(ELogVerbosity::Error, TEXT("VRM import: %s"), *ReadError);
         return nullptr;
     }
 
@@ -357,8 +377,20 @@ UObject* UVrmSourceFactory::FactoryCreateFile(
     Source->SourceFilename = Filename;
     Source->ImportTime = FDateTime::UtcNow();
 
+    // Parse the container once; metadata, feature detection and conversion all share this document
+    TSharedPtr<const FVrmGlbDocument> Document;
+    FString DocumentError;
 #if WITH_EDITORONLY_DATA
     Source->SetSourceBytes(MoveTemp(Bytes));
+    Document = FVrmGlbDocument::LoadFromView(Source->GetSourceBytes(), DocumentError, Filename);
+#else
+    Document = FVrmGlbDocument::LoadFromBytes(MoveTemp(Bytes), DocumentError, Filename);
+#endif
+#if WITH_EDITOR
+    if (!Document.IsValid())
+    {
+        UE_LOG(LogVrmToolchainEditor, Warning, TEXT("VrmSourceFactory: failed to parse GLB container '%s': %s"), *Filename, *DocumentError);
+    }
 #endif
 
     // Create AssetImportData if needed (must be done after removing constructor initialization to avoid CDO reference)
@@ -381,7 +413,7 @@ UObject* UVrmSourceFactory::FactoryCreateFile(
     Source->Descriptor = MetaAsset;
 
     // Parse metadata (fail-soft): ExtractVrmMetadata provides Version and basic fields
-    const FVrmMetadata Parsed = FVrmParser::ExtractVrmMetadata(Filename);
+    const FVrmMetadata Parsed = Document.IsValid() ? FVrmParser::ExtractVrmMetadata(*Document) : FVrmMetadata();
 
     MetaAsset->SpecVersion = Parsed.Version;
 
@@ -399,14 +431,12 @@ UObject* UVrmSourceFactory::FactoryCreateFile(
     Source->DetectedVrmExtension = FPaths::GetExtension(Filename).ToLower();
 
     // --- VRM meta asset (lightweight) ---
-    // Parse JSON chunk minimally to detect features. Use bytes if still available in memory.
+    // Detect features from the shared document's JSON DOM (no second parse).
 
-    FString JsonStr;
-    const TArray<uint8>& SourceBytesRef = Source->GetSourceBytes();
-    if (SourceBytesRef.Num() > 0 && FVrmParser::ReadGlbJsonChunkFromMemory(SourceBytesRef.GetData(), SourceBytesRef.Num(), JsonStr))
+    if (Document.IsValid())
     {
         // Parse VRM metadata features from JSON
-        VrmMetaDetection::FVrmMetaFeatures Features = VrmMetaDetection::ParseMetaFeaturesFromJson(JsonStr);
+        VrmMetaDetection::FVrmMetaFeatures Features = VrmMetaDetection::ParseMetaFeaturesFromDocument(*Document);
         EVrmVersion MetaVer = Features.SpecVersion;
         bool bHasHumanoid = Features.bHasHumanoid;
         bool bHasSpring = Features.bHasSpringBones;
@@ -418,12 +448,12 @@ UObject* UVrmSourceFactory::FactoryCreateFile(
         UE_LOG(LogVrmToolchainEditor, Verbose, TEXT("VrmSourceFactory: VRM meta detection - file=%s %s"), *FPaths::GetCleanFilename(Filename), *DiagnosticsStr);
 
         // Detect parse failure or missing VRM extensions
-        const bool bJsonBlank = JsonStr.TrimStartAndEnd().IsEmpty();
+        const bool bJsonBlank = !Document->GetJsonRoot().IsObject();
         const bool bLooksNonVrm = (MetaVer == EVrmVersion::Unknown) && !bHasHumanoid && !bHasSpring && !bHasBlendOrExpr && !bHasThumb;
 
         if (bJsonBlank)
         {
-            UE_LOG(LogVrmToolchainEditor, Verbose, TEXT("VrmSourceFactory: VRM meta detection - missing/blank JSON chunk"));
+            UE_LOG(LogVrmToolchainEditor, Verbose, TEXT("VrmSourceFactory: VRM meta detection - blank/unparsable JSON chunk"));
         }
         else if (bLooksNonVrm)
         {
@@ -597,57 +627,79 @@ UObject* UVrmSourceFactory::FactoryCreateFile(
     {
         UE_LOG(LogVrmToolchainEditor, Display, TEXT("VrmSourceFactory: Auto-generation enabled, creating SkeletalMesh and Skeleton..."));
         
-        USkeletalMesh* GeneratedMesh = nullptr;
-        USkeleton* GeneratedSkeleton = nullptr;
-        FString ConversionError;
-        
 		FVrmConvertOptions ConvertOptions = FVrmConversionService::MakeDefaultConvertOptions();
 		ConvertOptions.bApplyGltfSkeleton = ImportOptions->bApplyGltfSkeleton;  // Allow user override from dialog
-		
-		const bool bConversionSuccess = FVrmConversionService::ConvertSourceToPlaceholderSkeletalMesh(
-			Source, ConvertOptions, GeneratedMesh, GeneratedSkeleton, ConversionError);
-        
-        if (bConversionSuccess && GeneratedMesh && GeneratedSkeleton)
+
+        const bool bInteractive = !IsRunningCommandlet() && !GIsAutomationTesting && !FApp::IsUnattended();
+        const TWeakObjectPtr<UVrmSourceAsset> WeakSource = Source;
+
+        // Runs once the conversion ends, right away (sync) or on a later game-thread tick (async)
+        auto OnConversionComplete = [WeakSource, bInteractive](bool bConversionSuccess, USkeletalMesh* GeneratedMesh, USkeleton* GeneratedSkeleton, const FString& ConversionError)
         {
-            UE_LOG(LogVrmToolchainEditor, Display, TEXT("VrmSourceFactory: Auto-generated SkeletalMesh '%s' and Skeleton '%s'"),
-                *GeneratedMesh->GetName(), *GeneratedSkeleton->GetName());
-            
-            // Show notification only in interactive mode (skip commandlet/automation/unattended)
-            if (!IsRunningCommandlet() && !GIsAutomationTesting && !FApp::IsUnattended())
+            UVrmSourceAsset* ConvertedSource = WeakSource.Get();
+            const FString SourceName = ConvertedSource ? ConvertedSource->GetName() : FString(TEXT("VRM source"));
+
+            if (bConversionSuccess && GeneratedMesh && GeneratedSkeleton)
             {
-                FNotificationInfo Info(FText::FromString(FString::Printf(TEXT("VRM Import: Created %s, %s, %s"),
-                    *Source->GetName(), *GeneratedSkeleton->GetName(), *GeneratedMesh->GetName())));
-                Info.ExpireDuration = 5.0f;
-                Info.bFireAndForget = true;
-                FSlateNotificationManager::Get().AddNotification(Info);
+                UE_LOG(LogVrmToolchainEditor, Display, TEXT("VrmSourceFactory: Auto-generated SkeletalMesh '%s' and Skeleton '%s'"),
+                    *GeneratedMesh->GetName(), *GeneratedSkeleton->GetName());
+
+                // Show notification only in interactive mode (skip commandlet/automation/unattended)
+                if (bInteractive)
+                {
+                    FNotificationInfo Info(FText::FromString(FString::Printf(TEXT("VRM Import: Created %s, %s, %s"),
+                        *SourceName, *GeneratedSkeleton->GetName(), *GeneratedMesh->GetName())));
+                    Info.ExpireDuration = 5.0f;
+                    Info.bFireAndForget = true;
+                    FSlateNotificationManager::Get().AddNotification(Info);
+                }
             }
-        }
-        else
-        {
-            // Conversion failed, but import should still succeed for Source+Meta
-            const FString ErrorMsg = FString::Printf(TEXT("VRM Import: Created %s, but auto-generation of SkeletalMesh failed: %s"),
-                *Source->GetName(), *ConversionError);
-            
-            UE_LOG(LogVrmToolchainEditor, Warning, TEXT("VrmSourceFactory: %s"), *ErrorMsg);
-            
-            // Add warning to Source asset for user visibility
-            if (Source)
+            else
             {
-                Source->ImportWarnings.Add(FString::Printf(TEXT("Auto-generation failed: %s"), *ConversionError));
-                Source->MarkPackageDirty();
+                // Conversion failed, but import should still succeed for Source+Meta
+                const FString ErrorMsg = FString::Printf(TEXT("VRM Import: Created %s, but auto-generation of SkeletalMesh failed: %s"),
+                    *SourceName, *ConversionError);
+
+                UE_LOG(LogVrmToolchainEditor, Warning, TEXT("VrmSourceFactory: %s"), *ErrorMsg);
+
+                // Add warning to Source asset for user visibility
+                if (ConvertedSource)
+                {
+                    ConvertedSource->ImportWarnings.Add(FString::Printf(TEXT("Auto-generation failed: %s"), *ConversionError));
+                    ConvertedSource->MarkPackageDirty();
+                }
+
+                // Show notification only in interactive mode
+                if (bInteractive)
+                {
+                    FNotificationInfo Info(FText::FromString(ErrorMsg));
+                    Info.ExpireDuration = 7.0f;
+                    Info.bFireAndForget = true;
+                    FSlateNotificationManager::Get().AddNotification(Info);
+                }
+
+                // Log to MessageLog for user reference
+                FMessageLog("VrmToolchain").Warning(FText::FromString(ErrorMsg));
             }
-            
-            // Show notification only in interactive mode
-            if (!IsRunningCommandlet() && !GIsAutomationTesting && !FApp::IsUnattended())
+        };
+
+        FString ConversionError;
+        if (bInteractive)
+        {
+            // Build off the game thread so large avatars do not freeze the editor; assets appear when it completes
+            if (!FVrmConversionService::ConvertSourceToSkeletalMeshAsync(Source, ConvertOptions, Document, OnConversionComplete, ConversionError))
             {
-                FNotificationInfo Info(FText::FromString(ErrorMsg));
-                Info.ExpireDuration = 7.0f;
-                Info.bFireAndForget = true;
-                FSlateNotificationManager::Get().AddNotification(Info);
+                OnConversionComplete(false, nullptr, nullptr, ConversionError);
             }
-            
-            // Log to MessageLog for user reference
-            FMessageLog("VrmToolchain").Warning(FText::FromString(ErrorMsg));
+        }
+        else
+        {
+            // Commandlets and automation expect the generated assets when the import returns
+            USkeletalMesh* GeneratedMesh = nullptr;
+            USkeleton* GeneratedSkeleton = nullptr;
+            const bool bConversionSuccess = FVrmConversionService::ConvertSourceToPlaceholderSkeletalMesh(
+                Source, ConvertOptions, Document, GeneratedMesh, GeneratedSkeleton, ConversionError);
+            OnConversionComplete(bConversionSuccess, GeneratedMesh, GeneratedSkeleton, ConversionError);
         }
     }
 
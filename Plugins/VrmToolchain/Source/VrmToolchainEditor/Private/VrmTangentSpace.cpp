@@ -0,0 +1,293 @@
+#include "VrmTangentSpace.h"
+#include "Async/ParallelFor.h"
+#include "mikktspace.h"
+
+namespace VrmTangentSpace
+{
+	/** Squared length below which a cross product counts as degenerate; glTF meters put millimetre triangles near 1e-12 */
+	static constexpr float DegenerateTolerance = 1.0e-24f;
+
+	/** Batch of whole islands handed to one MikkTSpace run */
+	struct FMikkChunk
+	{
+		const FVector3f* Positions = nullptr;
+		const FVector2f* TexCoords = nullptr;
+		const uint32* Indices = nullptr;
+		const FVector3f* CornerNormals = nullptr;
+
+		/** Primitive triangles of the batch; MikkTSpace faces index into this list */
+		const int32* Triangles = nullptr;
+		int32 NumTriangles = 0;
+
+		FVector3f* OutTangents = nullptr;
+		float* OutSigns = nullptr;
+
+		int32 GetCorner(int32 Face, int32 Vert) const { return Triangles[Face] * 3 + Vert; }
+	};
+
+	static const FMikkChunk& GetChunk(const SMikkTSpaceContext* Context)
+	{
+		return *static_cast<const FMikkChunk*>(Context->m_pUserData);
+	}
+
+	static int MikkGetNumFaces(const SMikkTSpaceContext* Context)
+	{
+		return GetChunk(Context).NumTriangles;
+	}
+
+	static int MikkGetNumVerticesOfFace(const SMikkTSpaceContext* Context, const int Face)
+	{
+		return 3;
+	}
+
+	static void MikkGetPosition(const SMikkTSpaceContext* Context, float OutPosition[], const int Face, const int Vert)
+	{
+		const FMikkChunk& Chunk = GetChunk(Context);
+		const FVector3f& Position = Chunk.Positions[Chunk.Indices[Chunk.GetCorner(Face, Vert)]];
+		OutPosition[0] = Position.X;
+		OutPosition[1] = Position.Y;
+		OutPosition[2] = Position.Z;
+	}
+
+	static void MikkGetNormal(const SMikkTSpaceContext* Context, float OutNormal[], const int Face, const int Vert)
+	{
+		const FMikkChunk& Chunk = GetChunk(Context);
+		const FVector3f& Normal = Chunk.CornerNormals[Chunk.GetCorner(Face, Vert)];
+		OutNormal[0] = Normal.X;
+		OutNormal[1] = Normal.Y;
+		OutNormal[2] = Normal.Z;
+	}
+
+	static void MikkGetTexCoord(const SMikkTSpaceContext* Context, float OutTexCoord[], const int Face, const int Vert)
+	{
+		const FMikkChunk& Chunk = GetChunk(Context);
+		const FVector2f& TexCoord = Chunk.TexCoords[Chunk.Indices[Chunk.GetCorner(Face, Vert)]];
+		OutTexCoord[0] = TexCoord.X;
+		OutTexCoord[1] = TexCoord.Y;
+	}
+
+	static void MikkSetTSpaceBasic(const SMikkTSpaceContext* Context, const float Tangent[], const float Sign, const int Face, const int Vert)
+	{
+		const FMikkChunk& Chunk = GetChunk(Context);
+		const int32 Corner = Chunk.GetCorner(Face, Vert);
+		Chunk.OutTangents[Corner] = FVector3f(Tangent[0], Tangent[1], Tangent[2]);
+		Chunk.OutSigns[Corner] = Sign;
+	}
+
+	/**
+	 * MikkTSpace over islands of triangles. MikkTSpace also merges corners with identical position, normal
+	 * and UV; across islands that only happens for duplicated geometry, which is then treated separately.
+	 */
+	static void GenerateTangents(
+		const TArray<FVector3f>& Positions,
+		const TArray<FVector2f>& TexCoords,
+		const TArray<uint32>& Indices,
+		const TArray<FVector3f>& CornerNormals,
+		TArray<FVector3f>& OutTangents,
+		TArray<float>& OutSigns)
+	{
+		const int32 NumVertices = Positions.Num();
+		const int32 NumTriangles = Indices.Num() / 3;
+
+		// Islands: union-find over the vertices each triangle connects
+		TArray<int32> Parent;
+		Parent.SetNumUninitialized(NumVertices);
+		for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			Parent[Vertex] = Vertex;
+		}
+
+		auto Find = [&Parent](int32 Vertex)
+		{
+			while (Parent[Vertex] != Vertex)
+			{
+				Parent[Vertex] = Parent[Parent[Vertex]];
+				Vertex = Parent[Vertex];
+			}
+			return Vertex;
+		};
+
+		for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			const int32 Root = Find(static_cast<int32>(Indices[Triangle * 3]));
+			Parent[Find(static_cast<int32>(Indices[Triangle * 3 + 1]))] = Root;
+			Parent[Find(static_cast<int32>(Indices[Triangle * 3 + 2]))] = Root;
+		}
+
+		TArray<int32> IslandOfRoot;
+		IslandOfRoot.Init(INDEX_NONE, NumVertices);
+		TArray<int32> TriangleIsland;
+		TriangleIsland.SetNumUninitialized(NumTriangles);
+		TArray<int32> IslandStarts;
+		for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			int32& Island = IslandOfRoot[Find(static_cast<int32>(Indices[Triangle * 3]))];
+			if (Island == INDEX_NONE)
+			{
+				Island = IslandStarts.Add(0);
+			}
+			++IslandStarts[Island];
+			TriangleIsland[Triangle] = Island;
+		}
+
+		// Counting sort: triangles grouped by island, islands in order of first appearance
+		int32 Start = 0;
+		for (int32& IslandStart : IslandStarts)
+		{
+			const int32 Size = IslandStart;
+			IslandStart = Start;
+			Start += Size;
+		}
+		IslandStarts.Add(NumTriangles);
+
+		TArray<int32> Triangles;
+		Triangles.SetNumUninitialized(NumTriangles);
+		{
+			TArray<int32> Cursors(IslandStarts.GetData(), IslandStarts.Num() - 1);
+			for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+			{
+				Triangles[Cursors[TriangleIsland[Triangle]]++] = Triangle;
+			}
+		}
+
+		// Consecutive islands batched until a chunk holds TrianglesPerChunk triangles
+		TArray<int32> ChunkEnds;
+		int32 ChunkStart = 0;
+		for (int32 Island = 0; Island + 1 < IslandStarts.Num(); ++Island)
+		{
+			const int32 IslandEnd = IslandStarts[Island + 1];
+			if (IslandEnd - ChunkStart >= TrianglesPerChunk || IslandEnd == NumTriangles)
+			{
+				ChunkEnds.Add(IslandEnd);
+				ChunkStart = IslandEnd;
+			}
+		}
+
+		ParallelFor(ChunkEnds.Num(), [&](int32 ChunkIndex)
+		{
+			const int32 First = ChunkIndex > 0 ? ChunkEnds[ChunkIndex - 1] : 0;
+
+			FMikkChunk Chunk;
+			Chunk.Positions = Positions.GetData();
+			Chunk.TexCoords = TexCoords.GetData();
+			Chunk.Indices = Indices.GetData();
+			Chunk.CornerNormals = CornerNormals.GetData();
+			Chunk.Triangles = Triangles.GetData() + First;
+			Chunk.NumTriangles = ChunkEnds[ChunkIndex] - First;
+			Chunk.OutTangents = OutTangents.GetData();
+			Chunk.OutSigns = OutSigns.GetData();
+
+			SMikkTSpaceInterface Interface;
+			FMemory::Memzero(Interface);
+			Interface.m_getNumFaces = MikkGetNumFaces;
+			Interface.m_getNumVerticesOfFace = MikkGetNumVerticesOfFace;
+			Interface.m_getPosition = MikkGetPosition;
+			Interface.m_getNormal = MikkGetNormal;
+			Interface.m_getTexCoord = MikkGetTexCoord;
+			Interface.m_setTSpaceBasic = MikkSetTSpaceBasic;
+
+			SMikkTSpaceContext Context;
+			Context.m_pInterface = &Interface;
+			Context.m_pUserData = &Chunk;
+			genTangSpaceDefault(&Context);
+		});
+	}
+
+	void ComputeCornerFrames(
+		const TGltfAccessorView<FVector3f>& Positions,
+		const TGltfAccessorView<FVector3f>& Normals,
+		const TGltfAccessorView<FVector4f>& Tangents,
+		const TGltfAccessorView<FVector2f>& TexCoords,
+		const TGltfAccessorView<uint32>& Indices,
+		FVrmCornerFrames& OutFrames)
+	{
+		const int32 NumVertices = Positions.Num();
+		const int32 NumCorners = Indices.Num() / 3 * 3;
+		OutFrames.TangentX.SetNumUninitialized(NumCorners);
+		OutFrames.TangentY.SetNumUninitialized(NumCorners);
+		OutFrames.TangentZ.SetNumUninitialized(NumCorners);
+		if (NumCorners == 0)
+		{
+			return;
+		}
+
+		TArray<FVector3f> VertexPositions;
+		VertexPositions.SetNumUninitialized(NumVertices);
+		Positions.CopyTo(VertexPositions.GetData());
+
+		TArray<uint32> CornerIndices;
+		CornerIndices.SetNumUninitialized(Indices.Num());
+		Indices.CopyTo(CornerIndices.GetData());
+		CornerIndices.SetNum(NumCorners);
+
+		// Normals: NORMAL where usable, the face normal otherwise
+		TArray<FVector3f> VertexNormals;
+		const bool bHasNormals = Normals.Num() == NumVertices;
+		if (bHasNormals)
+		{
+			VertexNormals.SetNumUninitialized(NumVertices);
+			Normals.CopyTo(VertexNormals.GetData());
+		}
+
+		for (int32 Corner = 0; Corner < NumCorners; Corner += 3)
+		{
+			const FVector3f& P0 = VertexPositions[CornerIndices[Corner]];
+			const FVector3f& P1 = VertexPositions[CornerIndices[Corner + 1]];
+			const FVector3f& P2 = VertexPositions[CornerIndices[Corner + 2]];
+			const FVector3f FaceNormal = FVector3f::CrossProduct(P1 - P0, P2 - P0).GetSafeNormal(DegenerateTolerance, FVector3f::UpVector);
+
+			for (int32 Vert = 0; Vert < 3; ++Vert)
+			{
+				OutFrames.TangentZ[Corner + Vert] = bHasNormals
+					? VertexNormals[CornerIndices[Corner + Vert]].GetSafeNormal(DegenerateTolerance, FaceNormal)
+					: FaceNormal;
+			}
+		}
+
+		// Tangents: TANGENT, else MikkTSpace along the UVs, else left to the orthonormalization below.
+		// Without NORMAL, glTF ignores TANGENT: it was authored against normals that are not there
+		TArray<float> Signs;
+		Signs.Init(1.0f, NumCorners);
+		if (bHasNormals && Tangents.Num() == NumVertices)
+		{
+			TArray<FVector4f> VertexTangents;
+			VertexTangents.SetNumUninitialized(NumVertices);
+			Tangents.CopyTo(VertexTangents.GetData());
+			for (int32 Corner = 0; Corner < NumCorners; ++Corner)
+			{
+				// Same axis swap as positions and normals; the sign survives it (a rotation)
+				const FVector4f& Tangent = VertexTangents[CornerIndices[Corner]];
+				OutFrames.TangentX[Corner] = FVector3f(Tangent.X, Tangent.Z, -Tangent.Y);
+				Signs[Corner] = Tangent.W < 0.0f ? -1.0f : 1.0f;
+			}
+		}
+		else if (TexCoords.Num() == NumVertices)
+		{
+			TArray<FVector2f> VertexTexCoords;
+			VertexTexCoords.SetNumUninitialized(NumVertices);
+			TexCoords.CopyTo(VertexTexCoords.GetData());
+
+			FMemory::Memzero(OutFrames.TangentX.GetData(), NumCorners * sizeof(FVector3f));
+			GenerateTangents(VertexPositions, VertexTexCoords, CornerIndices, OutFrames.TangentZ, OutFrames.TangentX, Signs);
+		}
+		else
+		{
+			FMemory::Memzero(OutFrames.TangentX.GetData(), NumCorners * sizeof(FVector3f));
+		}
+
+		// Gram-Schmidt against the normal; degenerate tangents get any perpendicular axis
+		for (int32 Corner = 0; Corner < NumCorners; ++Corner)
+		{
+			const FVector3f& Normal = OutFrames.TangentZ[Corner];
+			FVector3f Tangent = OutFrames.TangentX[Corner] - Normal * FVector3f::DotProduct(Normal, OutFrames.TangentX[Corner]);
+			if (!Tangent.Normalize(DegenerateTolerance))
+			{
+				FVector3f Unused;
+				Normal.FindBestAxisVectors(Tangent, Unused);
+			}
+
+			OutFrames.TangentX[Corner] = Tangent;
+			OutFrames.TangentY[Corner] = -Signs[Corner] * FVector3f::CrossProduct(Normal, Tangent);
+		}
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VrmGltfAccessorView.h"
+
+/** Tangent frame of every triangle corner of a primitive, three entries per triangle, UE axes */
+struct FVrmCornerFrames
+{
+	TArray<FVector3f> TangentX;
+	TArray<FVector3f> TangentY;
+	TArray<FVector3f> TangentZ;
+
+	int32 Num() const { return TangentZ.Num(); }
+
+	/** Sign of TangentY against cross(TangentZ, TangentX), as mesh descriptions store the bitangent */
+	float GetBinormalSign(int32 Corner) const
+	{
+		return FVector3f::DotProduct(TangentY[Corner], FVector3f::CrossProduct(TangentZ[Corner], TangentX[Corner])) < 0.0f ? -1.0f : 1.0f;
+	}
+};
+
+/**
+ * Tangent space of glTF triangle primitives.
+ *
+ * Normals come from NORMAL, or are flat face normals as glTF requires when it is absent. Tangents come
+ * from TANGENT when NORMAL is present too, or are generated with MikkTSpace, the algorithm glTF normal maps
+ * are baked against.
+ * Generation runs per connected island of triangles: islands share no vertices, so MikkTSpace gives the
+ * same frames on each island alone as on the whole primitive, and batches of islands run in parallel.
+ */
+namespace VrmTangentSpace
+{
+	/** Triangles per generation task; small islands (hair strands, accessories) are batched up to this size */
+	static constexpr int32 TrianglesPerChunk = 8192;
+
+	/**
+	 * Computes the tangent frame of every corner. The bitangent follows UE's convention, the negated
+	 * glTF bitangent (cross(normal, tangent) * sign), as the engine's own MikkTSpace binding does.
+	 * @param Positions Vertex positions
+	 * @param Normals NORMAL (empty for flat normals)
+	 * @param Tangents TANGENT, glTF axes with the bitangent sign in W (empty to generate; ignored without Normals)
+	 * @param TexCoords UV set the tangents follow (empty or mismatched: any tangent perpendicular to the normal)
+	 * @param Indices Triangle indices, every one below Positions.Num()
+	 * @param OutFrames Three frames per whole triangle of Indices
+	 */
+	void ComputeCornerFrames(
+		const TGltfAccessorView<FVector3f>& Positions,
+		const TGltfAccessorView<FVector3f>& Normals,
+		const TGltfAccessorView<FVector4f>& Tangents,
+		const TGltfAccessorView<FVector2f>& TexCoords,
+		const TGltfAccessorView<uint32>& Indices,
+		FVrmCornerFrames& OutFrames);
+}
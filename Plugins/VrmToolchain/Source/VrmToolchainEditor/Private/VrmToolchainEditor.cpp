@@ -2,6 +2,7 @@
 #include "VrmRetargetActions.h"
 #include "VrmContentBrowserActions.h"
 #include "VrmImportHooks.h"
+#include "VrmImportPrefetcher.h"
 #include "AssetDefinition_VrmSourceAsset.h"
 #include "AssetDefinitionRegistry.h"
 #include "AssetTypeActions_VrmSourceAsset.h"
@@ -287,6 +288,9 @@ void FVrmToolchainEditorModule::StartupModule()
     // Register import hooks (attach metadata on import)
     FVrmImportHooks::Register();
 
+    // Read ahead files dropped into the Content Browser while earlier ones import
+    FVrmImportPrefetcher::RegisterDropHook();
+
     // Register reimport handler for UVrmSourceAsset
     GVrmSourceReimportHandler = MakeShared<FVrmSourceAssetReimportHandler>();
     FReimportManager::Instance()->RegisterHandler(*GVrmSourceReimportHandler);
@@ -344,6 +348,9 @@ void FVrmToolchainEditorModule::ShutdownModule()
     // Unregister import hooks
     FVrmImportHooks::Unregister();
 
+    // Unregister the import read-ahead drop hook (cancels outstanding reads)
+    FVrmImportPrefetcher::UnregisterDropHook();
+
     // Unregister reimport handler
     if (GVrmSourceReimportHandler.IsValid())
     {
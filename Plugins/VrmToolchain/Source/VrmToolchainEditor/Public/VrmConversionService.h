@@ -2,8 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "VrmGltfTypes.h"
+#include <atomic>
 
 class UVrmSourceAsset;
+class FVrmGlbDocument;
 class USkeletalMesh;
 class USkeleton;
 
@@ -40,6 +42,56 @@ public:
 		USkeleton*& OutSkeleton,
 		FString& OutError);
 
+	/**
+	 * Same as above, but consumes an already parsed GLB document so the import pipeline
+	 * reads and parses the source file only once. Document may be null (skeleton/mesh stages are skipped with warnings).
+	 */
+	static bool ConvertSourceToPlaceholderSkeletalMesh(
+		UVrmSourceAsset* Source,
+		const FVrmConvertOptions& Options,
+		const TSharedPtr<const FVrmGlbDocument>& Document,
+		USkeletalMesh*& OutSkeletalMesh,
+		USkeleton*& OutSkeleton,
+		FString& OutError);
+
+	/** Called on the game thread when an async conversion ends; the assets are null on failure or cancellation */
+	using FOnConversionComplete = TFunction<void(bool bSuccess, USkeletalMesh* SkeletalMesh, USkeleton* Skeleton, const FString& Error)>;
+
+	/** Shared by an async conversion and its caller: cancelling stops it before any asset is created */
+	class FAsyncConversionControl
+	{
+	public:
+		void Cancel() { bCancelled = true; }
+		bool IsCancelled() const { return bCancelled; }
+
+	private:
+		std::atomic<bool> bCancelled{ false };
+	};
+
+	/**
+	 * Same conversion as ConvertSourceToPlaceholderSkeletalMesh without blocking the editor: document load,
+	 * skeleton parse, accessor decode and the mesh build run on worker tasks, and only asset creation and
+	 * registration come back to the game thread. Shows a progress notification with a Cancel button in
+	 * interactive sessions. Document may be null, or borrow bytes the source asset owns (LoadFromView): the worker
+	 * then parses its own copy of what LoadSourceDocument would read, so reimporting or deleting the source while
+	 * the conversion runs is safe.
+	 * @param OutControl Receives the conversion's control, to cancel it (optional)
+	 * @return false (OutError set) when the conversion could not start; OnComplete is then never called
+	 */
+	static bool ConvertSourceToSkeletalMeshAsync(
+		UVrmSourceAsset* Source,
+		const FVrmConvertOptions& Options,
+		const TSharedPtr<const FVrmGlbDocument>& Document,
+		FOnConversionComplete OnComplete,
+		FString& OutError,
+		TSharedPtr<FAsyncConversionControl>* OutControl = nullptr);
+
+	/**
+	 * Parses the GLB document for a source asset, preferring its in-memory source bytes over a disk read.
+	 * @return The parsed document, or nullptr (OutError describes why)
+	 */
+	static TSharedPtr<const FVrmGlbDocument> LoadSourceDocument(UVrmSourceAsset* Source, FString& OutError);
+
 private:
 	static bool DeriveGeneratedPaths(UVrmSourceAsset* Source, FString& OutFolderPath, FString& OutBaseName, FString& OutError);
 
@@ -4,10 +4,20 @@
 #include "Containers/Array.h"
 #include "Math/Vector.h"
 #include "Math/IntVector.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/UniquePtr.h"
+#include "VrmGltfAccessorView.h"
+
+class FVrmGlbDocument;
+class FVrmGltfModel;
+struct FVrmGltfAccessor;
 
 /**
- * Reads and decodes GLB accessor data from binary chunks.
- * Handles buffer views, accessors, and typed array decoding.
+ * Reads GLB accessor data from binary chunks.
+ * Handles buffer views and accessors, exposing each attribute as a typed view over its buffer
+ * (the BIN chunk, an external .bin file or a decoded data: URI).
+ * Elements are converted on access, so consumers stream them straight into their own buffers.
+ * EXT_meshopt_compression buffer views are decoded up front into a scratch arena the views point into.
  */
 class FVrmGlbAccessorReader
 {
@@ -19,90 +29,215 @@ public:
         FString ErrorMessage;
     };
 
-    /** Decoded vertex positions */
-    TArray<FVector3f> Positions;
-    
-    /** Decoded vertex normals (optional) */
-    TArray<FVector3f> Normals;
-    
-    /** Decoded texture coordinates (optional) */
-    TArray<FVector2f> TexCoords;
-    
-    /** Decoded skin weights */
-    TArray<FVector4f> Weights;
-    
-    /** Decoded joint indices */
-    TArray<FIntVector4> Joints;
-    
-    /** Decoded triangle indices */
-    TArray<uint32> Indices;
+    /** Attribute views of one triangle primitive (views stay valid while the reader holds its document) */
+    struct FPrimitive
+    {
+        /** Owning glTF mesh */
+        int32 MeshIndex = INDEX_NONE;
+
+        /** Index into the model's flat primitive list */
+        int32 PrimitiveIndex = INDEX_NONE;
+
+        /** glTF material index (INDEX_NONE for the default material) */
+        int32 Material = INDEX_NONE;
+
+        /** Vertex positions, local to the mesh node (KHR_mesh_quantization leaves the dequantization scale on that node) */
+        TGltfAccessorView<FVector3f> Positions;
+
+        /** Vertex normals (optional) */
+        TGltfAccessorView<FVector3f> Normals;
+
+        /** Vertex tangents (optional): glTF axes, W is the bitangent sign */
+        TGltfAccessorView<FVector4f> Tangents;
+
+        /** Texture coordinates (optional) */
+        TGltfAccessorView<FVector2f> TexCoords;
+
+        /** Skin weights, WEIGHTS_0 (empty for rigid primitives) */
+        TGltfAccessorView<FVector4f> Weights;
+
+        /** Joint indices, JOINTS_0 (empty for rigid primitives) */
+        TGltfAccessorView<FIntVector4> Joints;
+
+        /** Further influence sets WEIGHTS_1, WEIGHTS_2, ... (4 influences each) */
+        TArray<TGltfAccessorView<FVector4f>> ExtraWeights;
+
+        /** JOINTS_1, JOINTS_2, ..., parallel to ExtraWeights */
+        TArray<TGltfAccessorView<FIntVector4>> ExtraJoints;
+
+        /** Triangle indices */
+        TGltfAccessorView<uint32> Indices;
+
+        /** Morph target POSITION deltas, one sparse view per glTF target (a view with no data when the target has none) */
+        TArray<TGltfSparseAccessorView<FVector3f>> MorphPositions;
+
+        /** Morph target NORMAL deltas, parallel to MorphPositions */
+        TArray<TGltfSparseAccessorView<FVector3f>> MorphNormals;
+
+        bool IsSkinned() const { return !Weights.IsEmpty(); }
+        int32 NumInfluenceSets() const { return IsSkinned() ? 1 + ExtraWeights.Num() : 0; }
+        int32 NumMorphTargets() const { return MorphPositions.Num(); }
+    };
+
+    /** Triangle primitives of every mesh, in model order */
+    TArray<FPrimitive> Primitives;
 
     /**
      * Load and parse GLB file, extracting JSON and BIN chunks
      * @param FilePath Path to the GLB file
-     * @param OutJsonString Parsed JSON content
      * @return Success/failure result
      */
-    FDecodeResult LoadGlbFile(const FString& FilePath, FString& OutJsonString);
+    FDecodeResult LoadGlbFile(const FString& FilePath);
+
+    /**
+     * Use an already parsed GLB document (shares its JSON DOM and BIN chunk, no re-read)
+     * @param InDocument The parsed GLB document; kept alive by the reader
+     * @return Success/failure result
+     */
+    FDecodeResult LoadGlbDocument(const TSharedRef<const FVrmGlbDocument>& InDocument);
 
     /**
-     * Decode accessors from parsed JSON and BIN data
-     * @param JsonString The GLB JSON content
+     * Resolve the attribute views of every mesh primitive from the loaded document's JSON and BIN data.
+     * Compressed buffer views are decompressed first; then primitives are decoded in parallel, each into
+     * its own slot of Primitives
      * @return Success/failure result
      */
-    FDecodeResult DecodeAccessors(const FString& JsonString);
+    FDecodeResult DecodeAccessors();
+
+    /** Distinct (accessor, element type) pairs resolved by the last DecodeAccessors call */
+    int32 GetNumCachedAccessors() const;
+
+    /** Buffer views decompressed (EXT_meshopt_compression) by the last DecodeAccessors call */
+    int32 GetNumDecompressedBufferViews() const { return NumDecompressedViews; }
+
+    /** Document the views point into (null before a successful load) */
+    const FVrmGlbDocument* GetDocument() const { return Document.Get(); }
+
+    /**
+     * Get an accessor in sparse form without merging it: the optional dense base plus the substituted
+     * elements. Dense accessors come back as a base with no substitutions. Meant for delta consumers
+     * such as morph targets; instantiated for FVector3f, FVector2f and FVector4f. Call after DecodeAccessors
+     * so compressed buffer views are available.
+     * @param AccessorIndex Accessor to view
+     * @param OutView Sparse view to populate
+     * @return Success/failure result
+     */
+    template<typename T>
+    FDecodeResult GetSparseAccessorView(int32 AccessorIndex, TGltfSparseAccessorView<T>& OutView) const;
 
 private:
-    /** Raw BIN chunk data */
-    TArray<uint8> BinData;
+    /** Document providing the JSON DOM and the buffer data */
+    TSharedPtr<const FVrmGlbDocument> Document;
+
+    /** Decompressed EXT_meshopt_compression buffer views, packed back to back (16-byte aligned) */
+    TArray<uint8> DecompressedArena;
 
-    /** GLB chunk header structure */
-    struct FGlbChunk
+    /** Arena offset of each buffer view; INDEX_NONE for views read straight from their buffer */
+    TArray<int64> DecompressedViewOffsets;
+
+    int32 NumDecompressedViews = 0;
+
+    /** Resolved view of one (accessor, element type) pair */
+    struct FCachedAccessor
     {
-        uint32 Length;
-        uint32 Type;
-        TArrayView<const uint8> Data;
+        FCriticalSection Lock;
+        bool bResolved = false;
+        FDecodeResult Result;
+        const uint8* Data = nullptr;
+        int32 Stride = 0;
+        int32 Count = 0;
+        int32 ComponentType = 0;
+        bool bNormalized = false;
+
+        /** Merged elements of a sparse accessor, in its source format (the view points here) */
+        TArray<uint8> Storage;
     };
 
+    /** Per-document accessor cache, keyed by accessor index and element TypeId */
+    TMap<uint64, TUniquePtr<FCachedAccessor>> AccessorCache;
+    mutable FCriticalSection AccessorCacheLock;
+
     /**
-     * Read a chunk from GLB data
-     * @param Data Raw GLB data
-     * @param Offset Current read offset
-     * @param OutChunk Parsed chunk data
-     * @return True if chunk was read successfully
+     * Decompress every EXT_meshopt_compression buffer view into the arena, one parallel task per view
+     * @param Model glTF model owning the buffer views
+     * @return Success/failure result
      */
-    bool ReadChunk(const TArray<uint8>& Data, int64& Offset, FGlbChunk& OutChunk);
+    FDecodeResult DecompressBufferViews(const FVrmGltfModel& Model);
 
     /**
-     * Decode a typed accessor into an array
-     * @param AccessorJson Accessor JSON object
-     * @param BufferViewsJson Buffer views array
-     * @param OutArray Output array to populate
+     * Decode one primitive of the model (safe to run concurrently for different primitives)
+     * @param Model glTF model owning the primitive
+     * @param PrimitiveIndex Index into the model's flat primitive list
+     * @param OutPrimitive Slot to populate; left without positions for skipped topologies
      * @return Success/failure result
      */
-    template<typename T>
-    FDecodeResult DecodeAccessor(const TSharedPtr<FJsonObject>& AccessorJson, 
-                                const TArray<TSharedPtr<FJsonValue>>& BufferViewsJson,
-                                TArray<T>& OutArray);
+    FDecodeResult DecodePrimitive(const FVrmGltfModel& Model,
+                                  int32 PrimitiveIndex,
+                                  FPrimitive& OutPrimitive);
 
     /**
-     * Decode a single element from binary data
-     * Template specializations handle different GLTF types
+     * Get the sparse view of one morph target attribute. An absent attribute, or an accessor with neither
+     * bufferView nor sparse data, is all zeros and yields a view with no data
+     * @param Model glTF model owning the accessor
+     * @param AccessorIndex Delta accessor (INDEX_NONE when the target does not displace this attribute)
+     * @param NumVertices Vertex count of the primitive the deltas apply to
+     * @param OutView Sparse view to populate
+     * @return Success/failure result
+     */
+    FDecodeResult GetMorphTargetView(const FVrmGltfModel& Model,
+                                     int32 AccessorIndex,
+                                     int32 NumVertices,
+                                     TGltfSparseAccessorView<FVector3f>& OutView) const;
+
+    /**
+     * Get the typed view of an accessor through the per-document cache, resolving it on first use.
+     * Primitives sharing an accessor share one validated view; safe to call concurrently.
+     * @param Model glTF model owning the accessor
+     * @param AccessorIndex Accessor to view
+     * @param OutView View to populate
+     * @return Success/failure result (cached along with the view)
      */
     template<typename T>
-    static bool DecodeElement(int32 ComponentType, int32 ComponentCount, const uint8* Data, T& OutElement);
+    FDecodeResult GetAccessorView(const FVrmGltfModel& Model,
+                                  int32 AccessorIndex,
+                                  TGltfAccessorView<T>& OutView);
 
     /**
-     * Get component type size in bytes
-     * @param ComponentType GLTF component type enum
-     * @return Size in bytes, or 0 if invalid
+     * Validate an accessor against its buffer and make a typed view over it
+     * @param Model glTF model owning the accessor and its buffer views
+     * @param Accessor Accessor to view
+     * @param OutView View to populate
+     * @return Success/failure result
      */
-    static int32 GetComponentTypeSize(int32 ComponentType);
+    template<typename T>
+    FDecodeResult MakeAccessorView(const FVrmGltfModel& Model,
+                                   const FVrmGltfAccessor& Accessor,
+                                   TGltfAccessorView<T>& OutView) const;
 
     /**
-     * Get number of components per element
-     * @param TypeString GLTF type string ("SCALAR", "VEC2", "VEC3", "VEC4")
-     * @return Number of components, or 0 if invalid
+     * Validate a sparse accessor and make views over its base, indices and values
+     * @param Model glTF model owning the accessor and its buffer views
+     * @param Accessor Sparse accessor to view
+     * @param OutView Sparse view to populate
+     * @return Success/failure result
      */
-    static int32 GetTypeComponentCount(const FString& TypeString);
+    template<typename T>
+    FDecodeResult MakeSparseAccessorView(const FVrmGltfModel& Model,
+                                         const FVrmGltfAccessor& Accessor,
+                                         TGltfSparseAccessorView<T>& OutView) const;
+
+    /** Make a typed view over Count elements of a buffer view, checking stride and bounds */
+    template<typename T>
+    FDecodeResult MakeBufferView(const FVrmGltfModel& Model,
+                                 int32 BufferViewIndex,
+                                 int64 ByteOffset,
+                                 int32 ComponentType,
+                                 int32 ComponentCount,
+                                 bool bNormalized,
+                                 int32 Count,
+                                 TGltfAccessorView<T>& OutView) const;
+
+    /** Check count, componentType and type of an accessor against what T accepts */
+    template<typename T>
+    static bool CheckAccessorFormat(const FVrmGltfAccessor& Accessor, FDecodeResult& OutResult);
 };
\ No newline at end of file
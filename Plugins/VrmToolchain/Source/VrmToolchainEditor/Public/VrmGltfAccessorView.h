@@ -0,0 +1,356 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Vector.h"
+#include "Math/IntVector.h"
+#include "VrmToolchain/VrmGltfModel.h"
+
+/**
+ * Per-type conversion from a glTF accessor element to the engine-side value. Float targets also
+ * accept integer components, dequantized as the accessor's normalized flag says.
+ *
+ * Supports() lists the accessor formats accepted for the type, Load() converts one element and
+ * LoadRun() converts a whole strided run with the bulk kernels. TypeId tells target types apart
+ * when views of the same accessor are cached.
+ */
+template<typename T>
+struct TGltfAccessorElement;
+
+/** Component types a float target accepts: FLOAT, or integers dequantized on load (KHR_mesh_quantization) */
+inline bool IsGltfFloatOrQuantized(int32 ComponentType)
+{
+    return ComponentType == EVrmGltfComponentType::Float
+        || ComponentType == EVrmGltfComponentType::Byte
+        || ComponentType == EVrmGltfComponentType::UnsignedByte
+        || ComponentType == EVrmGltfComponentType::Short
+        || ComponentType == EVrmGltfComponentType::UnsignedShort;
+}
+
+/** Reads the first N components of an element as floats */
+template<int32 N>
+inline void ReadGltfFloats(const uint8* Element, int32 ComponentType, bool bNormalized, float (&Out)[N])
+{
+    if (ComponentType == EVrmGltfComponentType::Float)
+    {
+        FMemory::Memcpy(Out, Element, sizeof(Out));
+        return;
+    }
+
+    const int32 ComponentSize = EVrmGltfComponentType::GetSize(ComponentType);
+    for (int32 Lane = 0; Lane < N; ++Lane)
+    {
+        Out[Lane] = EVrmGltfComponentType::ReadAsFloat(Element + Lane * ComponentSize, ComponentType, bNormalized);
+    }
+}
+
+template<>
+struct TGltfAccessorElement<FVector3f>
+{
+    static constexpr uint8 TypeId = 0;
+
+    static bool Supports(int32 ComponentType, int32 ComponentCount)
+    {
+        return ComponentCount == 3 && IsGltfFloatOrQuantized(ComponentType);
+    }
+
+    /** GLTF is right-handed Y up: swap Y/Z and negate the original Y */
+    static FVector3f Load(const uint8* Element, int32 ComponentType, bool bNormalized)
+    {
+        float In[3];
+        ReadGltfFloats(Element, ComponentType, bNormalized, In);
+        return FVector3f(In[0], In[2], -In[1]);
+    }
+
+    static void LoadRun(const uint8* Data, int32 Stride, int32 Count, int32 ComponentType, bool bNormalized, FVector3f* OutElements);
+};
+
+template<>
+struct TGltfAccessorElement<FVector2f>
+{
+    static constexpr uint8 TypeId = 1;
+
+    static bool Supports(int32 ComponentType, int32 ComponentCount)
+    {
+        return ComponentCount == 2 && IsGltfFloatOrQuantized(ComponentType);
+    }
+
+    static FVector2f Load(const uint8* Element, int32 ComponentType, bool bNormalized)
+    {
+        float In[2];
+        ReadGltfFloats(Element, ComponentType, bNormalized, In);
+        return FVector2f(In[0], In[1]);
+    }
+
+    static void LoadRun(const uint8* Data, int32 Stride, int32 Count, int32 ComponentType, bool bNormalized, FVector2f* OutElements);
+};
+
+template<>
+struct TGltfAccessorElement<FVector4f>
+{
+    static constexpr uint8 TypeId = 2;
+
+    static bool Supports(int32 ComponentType, int32 ComponentCount)
+    {
+        return ComponentCount == 4 && IsGltfFloatOrQuantized(ComponentType);
+    }
+
+    static FVector4f Load(const uint8* Element, int32 ComponentType, bool bNormalized)
+    {
+        float In[4];
+        ReadGltfFloats(Element, ComponentType, bNormalized, In);
+        return FVector4f(In[0], In[1], In[2], In[3]);
+    }
+
+    static void LoadRun(const uint8* Data, int32 Stride, int32 Count, int32 ComponentType, bool bNormalized, FVector4f* OutElements);
+};
+
+template<>
+struct TGltfAccessorElement<FIntVector4>
+{
+    static constexpr uint8 TypeId = 3;
+
+    static bool Supports(int32 ComponentType, int32 ComponentCount)
+    {
+        return ComponentCount == 4
+            && (ComponentType == EVrmGltfComponentType::UnsignedByte || ComponentType == EVrmGltfComponentType::UnsignedShort);
+    }
+
+    /** Joint indices, widened from UNSIGNED_BYTE or UNSIGNED_SHORT */
+    static FIntVector4 Load(const uint8* Element, int32 ComponentType, bool bNormalized)
+    {
+        if (ComponentType == EVrmGltfComponentType::UnsignedByte)
+        {
+            return FIntVector4(Element[0], Element[1], Element[2], Element[3]);
+        }
+
+        uint16 In[4];
+        FMemory::Memcpy(In, Element, sizeof(In));
+        return FIntVector4(In[0], In[1], In[2], In[3]);
+    }
+
+    static void LoadRun(const uint8* Data, int32 Stride, int32 Count, int32 ComponentType, bool bNormalized, FIntVector4* OutElements);
+};
+
+template<>
+struct TGltfAccessorElement<uint32>
+{
+    static constexpr uint8 TypeId = 4;
+
+    static bool Supports(int32 ComponentType, int32 ComponentCount)
+    {
+        return ComponentCount == 1
+            && (ComponentType == EVrmGltfComponentType::UnsignedByte
+                || ComponentType == EVrmGltfComponentType::UnsignedShort
+                || ComponentType == EVrmGltfComponentType::UnsignedInt);
+    }
+
+    /** Triangle indices, widened from UNSIGNED_BYTE or UNSIGNED_SHORT */
+    static uint32 Load(const uint8* Element, int32 ComponentType, bool bNormalized)
+    {
+        if (ComponentType == EVrmGltfComponentType::UnsignedByte)
+        {
+            return Element[0];
+        }
+        if (ComponentType == EVrmGltfComponentType::UnsignedShort)
+        {
+            uint16 Value;
+            FMemory::Memcpy(&Value, Element, sizeof(Value));
+            return Value;
+        }
+
+        uint32 Value;
+        FMemory::Memcpy(&Value, Element, sizeof(Value));
+        return Value;
+    }
+
+    static void LoadRun(const uint8* Data, int32 Stride, int32 Count, int32 ComponentType, bool bNormalized, uint32* OutElements);
+};
+
+/**
+ * Typed, read-only view of a glTF accessor over its strided buffer data.
+ *
+ * Nothing is decoded up front: operator[] and iteration convert one element at a time (axis swap,
+ * widening, dequantization), and CopyTo() converts the whole accessor straight into a caller-owned buffer. The view
+ * does not own the bytes; whoever created it must keep the underlying buffer alive.
+ */
+template<typename T>
+class TGltfAccessorView
+{
+public:
+    using ElementType = T;
+    using FElement = TGltfAccessorElement<T>;
+
+    /** Forward iterator converting each element as it is dereferenced */
+    class FIterator
+    {
+    public:
+        FIterator(const uint8* InElement, int32 InStride, int32 InComponentType, bool bInNormalized)
+            : Element(InElement)
+            , Stride(InStride)
+            , ComponentType(InComponentType)
+            , bNormalized(bInNormalized)
+        {
+        }
+
+        T operator*() const { return FElement::Load(Element, ComponentType, bNormalized); }
+        FIterator& operator++() { Element += Stride; return *this; }
+        bool operator==(const FIterator& Other) const { return Element == Other.Element; }
+        bool operator!=(const FIterator& Other) const { return Element != Other.Element; }
+
+    private:
+        const uint8* Element;
+        int32 Stride;
+        int32 ComponentType;
+        bool bNormalized;
+    };
+
+    TGltfAccessorView() = default;
+
+    /**
+     * @param InData First element of the accessor
+     * @param InStride Bytes between consecutive elements
+     * @param InNum Number of elements
+     * @param InComponentType GLTF componentType of the source data (must pass FElement::Supports)
+     * @param bInNormalized Accessor normalized flag; integer components read as floats are scaled to [0, 1] or [-1, 1]
+     */
+    TGltfAccessorView(const uint8* InData, int32 InStride, int32 InNum, int32 InComponentType, bool bInNormalized = false)
+        : Data(InData)
+        , Stride(InStride)
+        , Count(InNum)
+        , ComponentType(InComponentType)
+        , bNormalized(bInNormalized)
+    {
+    }
+
+    /** True if the accessor format can be read as T */
+    static bool SupportsFormat(int32 InComponentType, int32 InComponentCount)
+    {
+        return FElement::Supports(InComponentType, InComponentCount);
+    }
+
+    int32 Num() const { return Count; }
+    bool IsEmpty() const { return Count == 0; }
+    bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Count; }
+
+    const uint8* GetData() const { return Data; }
+    int32 GetStride() const { return Stride; }
+    int32 GetComponentType() const { return ComponentType; }
+    bool IsNormalized() const { return bNormalized; }
+
+    T operator[](int32 Index) const
+    {
+        checkSlow(IsValidIndex(Index));
+        return FElement::Load(Data + static_cast<int64>(Index) * Stride, ComponentType, bNormalized);
+    }
+
+    FIterator begin() const { return FIterator(Data, Stride, ComponentType, bNormalized); }
+    FIterator end() const { return FIterator(Data + static_cast<int64>(Count) * Stride, Stride, ComponentType, bNormalized); }
+
+    /** Converts every element into OutElements (Num() entries) in one bulk pass */
+    void CopyTo(T* OutElements) const
+    {
+        if (Count > 0)
+        {
+            FElement::LoadRun(Data, Stride, Count, ComponentType, bNormalized, OutElements);
+        }
+    }
+
+    /** True if both views read the same bytes the same way */
+    bool operator==(const TGltfAccessorView& Other) const
+    {
+        return Data == Other.Data && Stride == Other.Stride && Count == Other.Count
+            && ComponentType == Other.ComponentType && bNormalized == Other.bNormalized;
+    }
+
+    bool operator!=(const TGltfAccessorView& Other) const { return !(*this == Other); }
+
+    void Reset()
+    {
+        *this = TGltfAccessorView();
+    }
+
+private:
+    const uint8* Data = nullptr;
+    int32 Stride = 0;
+    int32 Count = 0;
+    int32 ComponentType = EVrmGltfComponentType::None;
+    bool bNormalized = false;
+};
+
+/**
+ * Sparse glTF accessor: an optional dense base plus substituted elements (accessor.sparse).
+ *
+ * Morph targets are usually stored with no base at all (every element zero) and a short list of
+ * displaced vertices. ForEach() then visits only those, so no dense array is ever allocated.
+ */
+template<typename T>
+struct TGltfSparseAccessorView
+{
+    /** Dense base values; empty when the accessor has no bufferView (every element is zero) */
+    TGltfAccessorView<T> Base;
+
+    /** Indices of the substituted elements, strictly increasing */
+    TGltfAccessorView<uint32> Indices;
+
+    /** Substituted values, one per entry of Indices */
+    TGltfAccessorView<T> Values;
+
+    /** Logical element count of the accessor */
+    int32 Count = 0;
+
+    int32 Num() const { return Count; }
+    bool HasBase() const { return !Base.IsEmpty(); }
+
+    /**
+     * Visits (Index, Value) for every element that may be non-zero, in increasing index order: only the
+     * substituted elements when there is no base, otherwise every element with the substitutions merged in.
+     */
+    template<typename FunctorType>
+    void ForEach(FunctorType&& Func) const
+    {
+        const int32 NumSubstituted = Indices.Num();
+        if (!HasBase())
+        {
+            for (int32 Entry = 0; Entry < NumSubstituted; ++Entry)
+            {
+                Func(static_cast<int32>(Indices[Entry]), Values[Entry]);
+            }
+            return;
+        }
+
+        // Single merge pass: indices are sorted, so the next substitution is always the next entry
+        int32 Entry = 0;
+        int32 NextSubstituted = NumSubstituted > 0 ? static_cast<int32>(Indices[0]) : Count;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            if (Index == NextSubstituted)
+            {
+                Func(Index, Values[Entry]);
+                ++Entry;
+                NextSubstituted = Entry < NumSubstituted ? static_cast<int32>(Indices[Entry]) : Count;
+            }
+            else
+            {
+                Func(Index, Base[Index]);
+            }
+        }
+    }
+
+    /** Writes all Num() elements into OutElements: the base (or zeros), then the substitutions scattered over it */
+    void CopyTo(T* OutElements) const
+    {
+        if (HasBase())
+        {
+            Base.CopyTo(OutElements);
+        }
+        else
+        {
+            FMemory::Memzero(OutElements, sizeof(T) * Count);
+        }
+
+        for (int32 Entry = 0; Entry < Indices.Num(); ++Entry)
+        {
+            OutElements[Indices[Entry]] = Values[Entry];
+        }
+    }
+};
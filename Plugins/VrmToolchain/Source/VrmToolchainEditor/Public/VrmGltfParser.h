@@ -3,15 +3,32 @@
 #include "CoreMinimal.h"
 #include "VrmGltfTypes.h"
 
+class FVrmGlbDocument;
+struct FVrmJsonValue;
+class FVrmGltfModel;
+
 class VRMTOOLCHAINEDITOR_API FVrmGltfParser
 {
 public:
     // Parse JSON string (editor-only testable) and extract skeleton nodes
     static bool ExtractSkeletonFromGltfJsonString(const FString& JsonString, FVrmGltfSkeleton& OutSkeleton, FString& OutError);
 
+    // Extract skeleton nodes from an already parsed glTF JSON root
+    static bool ExtractSkeletonFromGltfJson(const FVrmJsonValue& Root, FVrmGltfSkeleton& OutSkeleton, FString& OutError);
+
+    // Extract skeleton nodes from a typed glTF model (no JSON lookups)
+    static bool ExtractSkeletonFromGltfModel(const FVrmGltfModel& Model, FVrmGltfSkeleton& OutSkeleton, FString& OutError);
+
+    // Extract skeleton nodes from a parsed GLB document (reuses the document's JSON DOM)
+    static bool ExtractSkeletonFromGlbDocument(const FVrmGlbDocument& Document, FVrmGltfSkeleton& OutSkeleton, FString& OutError);
+
     // High-level helper: read GLB JSON chunk from disk and then parse
     static bool ExtractSkeletonFromGlbFile(const FString& FilePath, FVrmGltfSkeleton& OutSkeleton, FString& OutError);
 
-    // Extract skin joints from GLB JSON
-    static bool TryExtractSkin0Joints(const TSharedPtr<FJsonObject>& Root, TArray<int32>& OutJoints);
+    // Extract the joints of the first skin
+    static bool TryExtractSkin0Joints(const FVrmGltfModel& Model, TArray<int32>& OutJoints);
+
+    // Bind every mesh to the bones of an extracted skeleton through the nodes instancing it: skinned meshes
+    // to their skin's joints, rigid meshes to their node's bone. Fails for meshes instanced under different skins
+    static bool ExtractMeshBinding(const FVrmGltfModel& Model, const FVrmGltfSkeleton& Skeleton, FVrmGltfMeshBinding& OutBinding, FString& OutError);
 };
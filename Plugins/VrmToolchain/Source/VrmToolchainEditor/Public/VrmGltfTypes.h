@@ -29,3 +29,19 @@ struct FVrmGltfSkeleton
     UPROPERTY()
     TArray<FVrmGltfBone> Bones;
 };
+
+/** Bones the glTF meshes are bound to, resolved through the nodes that instance them */
+struct FVrmGltfMeshBinding
+{
+    /** Joint ordinal -> bone index, one table per glTF skin */
+    TArray<TMap<int32, int32>> SkinJointToBone;
+
+    /** Skin of each glTF mesh (INDEX_NONE for rigid meshes) */
+    TArray<int32> MeshSkins;
+
+    /** Bone the rigid primitives of each glTF mesh follow: the bone of the node instancing it */
+    TArray<int32> MeshRigidBones;
+
+    /** Bind pose of each rigid glTF mesh: its node's world transform, UE axes (identity for skinned meshes) */
+    TArray<FMatrix44f> MeshRigidTransforms;
+};
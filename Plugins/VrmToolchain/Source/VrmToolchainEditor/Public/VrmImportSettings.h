@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "VrmImportSettings.generated.h"
+
+/**
+ * Editor settings for VRM/GLB import throughput and mesh build
+ */
+UCLASS(Config=EditorPerProjectUserSettings, meta=(DisplayName="VRM Import"))
+class VRMTOOLCHAINEDITOR_API UVrmImportSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UVrmImportSettings();
+
+	/** Number of upcoming files read asynchronously while the current one is imported (0 disables read-ahead) */
+	UPROPERTY(Config, EditAnywhere, Category = "I/O", meta = (ClampMin = "0", ClampMax = "16"))
+	int32 ReadAheadDepth;
+
+	/** Upper bound on file bytes held by the read-ahead queue; larger files are read when their import starts */
+	UPROPERTY(Config, EditAnywhere, Category = "I/O", meta = (ClampMin = "16", Units = "Megabytes"))
+	int32 ReadAheadMemoryCapMB;
+
+	/** Build skeletal meshes from a mesh description filled straight from the accessors instead of legacy import data */
+	UPROPERTY(Config, EditAnywhere, Category = "Mesh")
+	bool bBuildFromMeshDescription;
+
+	/** Reuse built LOD0 models from the derived data cache when the source content and conversion options are unchanged */
+	UPROPERTY(Config, EditAnywhere, Category = "Mesh")
+	bool bUseDerivedDataCache;
+
+	/** Weld identical split vertices and reorder triangles for the vertex cache and overdraw before the mesh build */
+	UPROPERTY(Config, EditAnywhere, Category = "Mesh")
+	bool bWeldAndOptimizeMeshes;
+
+	//~ Begin UDeveloperSettings Interface
+	virtual FName GetCategoryName() const override;
+	virtual FText GetSectionText() const override;
+	//~ End UDeveloperSettings Interface
+};
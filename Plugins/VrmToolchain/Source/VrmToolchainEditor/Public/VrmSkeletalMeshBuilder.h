@@ -2,6 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "VrmGlbAccessorReader.h"
+#include "VrmGltfTypes.h"
+#include "Templates/UniquePtr.h"
+
+class FSkeletalMeshLODModel;
+struct FMeshDescription;
+struct FReferenceSkeleton;
 
 /**
  * Builds skeletal meshes using MeshUtilities from decoded GLB accessor data
@@ -9,27 +15,121 @@
 class FVrmSkeletalMeshBuilder
 {
 public:
+    /** How LOD0 reaches the engine's skeletal mesh build */
+    enum class EBuildPath : uint8
+    {
+        /** FSkeletalMeshImportData, copied to LOD import arrays for IMeshUtilities::BuildSkeletalMesh */
+        ImportData,
+
+        /**
+         * FMeshDescription filled straight from the accessor views, committed to the mesh and built by the engine.
+         * The engine build runs synchronously on the game thread in FinalizeLod0, so async conversions block there.
+         */
+        MeshDescription
+    };
+
     /** Result of mesh building operations */
     struct FBuildResult
     {
         bool bSuccess = false;
         FString ErrorMessage;
         USkeletalMesh* BuiltMesh = nullptr;
+
+        /** Morph targets attached to BuiltMesh */
+        int32 NumMorphTargets = 0;
+    };
+
+    /** LOD0 converted from the accessors, waiting for its asset (see PrepareLod0) */
+    struct FPreparedMesh
+    {
+        FPreparedMesh();
+        ~FPreparedMesh();
+        FPreparedMesh(FPreparedMesh&&);
+        FPreparedMesh& operator=(FPreparedMesh&&);
+
+        EBuildPath BuildPath = EBuildPath::ImportData;
+        TArray<FName> MaterialSlots;
+
+        /** Bones and node transforms the primitives were bound with; morph targets follow them */
+        FVrmGltfMeshBinding Binding;
+
+        /** ImportData path: LOD0 as built by IMeshUtilities */
+        TUniquePtr<FSkeletalMeshLODModel> LODModel;
+
+        /** ImportData path: first import point of each primitive (shared with its owner's), and the import point count */
+        TArray<int32> PointBases;
+        int32 NumPoints = 0;
+
+        /** ImportData path: LOD0 came from the derived data cache, without accessor conversion or engine build */
+        bool bRestoredFromCache = false;
+
+        /** MeshDescription path: the description to commit */
+        TUniquePtr<FMeshDescription> MeshDescription;
     };
 
     /**
-     * Build a skinned skeletal mesh from GLB accessor data
+     * Build a skinned skeletal mesh from GLB accessor data (PrepareLod0 then FinalizeLod0).
+     * Every decoded primitive becomes a section of LOD0, with one material slot per glTF material.
+     * Each morph target of a glTF mesh becomes a morph target of the skeletal mesh, named by extras.targetNames.
+     * Normals and tangents come from NORMAL/TANGENT; flat normals and MikkTSpace tangents fill in when absent.
+     * Every JOINTS_n/WEIGHTS_n set contributes influences; each vertex keeps its MAX_TOTAL_INFLUENCES strongest, renormalized.
+     * JOINTS_n are read against the skin of each primitive's mesh; rigid meshes follow their node's bone, placed at its transform.
      * @param AccessorReader The reader containing decoded GLB data
      * @param TargetSkeleton The skeleton to assign to the mesh
-     * @param JointOrdinalToBoneIndex Mapping from joint ordinals to bone indices
+     * @param Binding Skin or rigid bone of every glTF mesh (see FVrmGltfParser::ExtractMeshBinding)
      * @param PackageName Package name for the new mesh asset
      * @param AssetName Asset name for the new mesh asset
+     * @param BuildPath Intermediate representation handed to the engine build
+     * @param bWeldAndOptimize Weld identical split vertices and reorder triangles for the vertex cache and overdraw
      * @return Build result with success/failure and the created mesh
      */
     static FBuildResult BuildLod0SkinnedPrimitive(
         const FVrmGlbAccessorReader& AccessorReader,
         USkeleton* TargetSkeleton,
-        const TMap<int32, int32>& JointOrdinalToBoneIndex,
+        const FVrmGltfMeshBinding& Binding,
+        const FString& PackageName,
+        const FString& AssetName,
+        EBuildPath BuildPath = EBuildPath::ImportData,
+        bool bWeldAndOptimize = false);
+
+    /**
+     * Convert the accessors of LOD0 and, on the import data path, build its render model. Touches no UObject,
+     * so it may run on a worker thread; the MeshUtilities module must already be loaded.
+     * @param AccessorReader The reader containing decoded GLB data
+     * @param RefSkeleton Reference skeleton the mesh will be skinned to
+     * @param Binding Skin or rigid bone of every glTF mesh (see FVrmGltfParser::ExtractMeshBinding)
+     * @param MeshName Name used in build messages
+     * @param BuildPath Intermediate representation handed to the engine build
+     * @param bWeldAndOptimize Weld each primitive's vertices that match in every attribute, skin influence and morph
+     *                         delta, then reorder its triangles for the vertex cache and overdraw (see VrmMeshOptimizer)
+     * @param DerivedDataKey Identity of every input (source content, conversion options); on the import data path
+     *                       LOD0 is restored from, or stored to, the derived data cache under it. Empty skips the cache
+     * @param OutPrepared Prepared LOD0
+     * @param OutError Error description on failure
+     */
+    static bool PrepareLod0(
+        const FVrmGlbAccessorReader& AccessorReader,
+        const FReferenceSkeleton& RefSkeleton,
+        const FVrmGltfMeshBinding& Binding,
+        const FString& MeshName,
+        EBuildPath BuildPath,
+        bool bWeldAndOptimize,
+        const FString& DerivedDataKey,
+        FPreparedMesh& OutPrepared,
+        FString& OutError);
+
+    /**
+     * Create, build and register the mesh asset from a prepared LOD0; game thread only.
+     * @param Prepared Output of PrepareLod0 (consumed)
+     * @param AccessorReader The reader Prepared was converted from (morph targets are decoded from it)
+     * @param TargetSkeleton The skeleton to assign to the mesh
+     * @param PackageName Package name for the new mesh asset
+     * @param AssetName Asset name for the new mesh asset
+     */
+    static FBuildResult FinalizeLod0(
+        FPreparedMesh&& Prepared,
+        const FVrmGlbAccessorReader& AccessorReader,
+        USkeleton* TargetSkeleton,
         const FString& PackageName,
         const FString& AssetName);
 };
\ No newline at end of file
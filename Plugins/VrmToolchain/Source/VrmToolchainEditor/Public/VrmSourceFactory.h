@@ -31,6 +31,9 @@ public:
 
     virtual bool ConfigureProperties() override;
 
+    /** Called once when an import batch ends (including cancelled ones); drops any read-ahead left over */
+    virtual void CleanUp() override;
+
 private:
     /** Transient import options set via ConfigureProperties() dialog */
     TObjectPtr<class UVrmImportOptions> ImportOptions;
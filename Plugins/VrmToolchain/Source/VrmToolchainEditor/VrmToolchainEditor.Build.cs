@@ -53,8 +53,11 @@ public class VrmToolchainEditor : ModuleRules
             "MeshUtilities",
             "SkeletalMeshUtilitiesCommon",
             "MeshDescription",
+            "SkeletalMeshDescription",
             "StaticMeshDescription",
             "RenderCore",
+            "MikkTSpace",
+            "DerivedDataCache",
             // Details panel customization for UVrmMetaAsset (PR-12)
             "PropertyEditor",
             "ApplicationCore"